@@ -49,7 +49,7 @@
                 base_class_type::begin());
     }
 
-    constexpr fixed_dynamic_array(fixed_dynamic_array&& other_array)
+    constexpr fixed_dynamic_array(fixed_dynamic_array&& other_array) noexcept
       : base_class_type((base_class_type&&) other_array) { }
 
     fixed_dynamic_array& operator=(const fixed_dynamic_array& other_array)
@@ -59,7 +59,7 @@
       return *this;
     }
 
-    fixed_dynamic_array& operator=(fixed_dynamic_array&& other_array)
+    fixed_dynamic_array& operator=(fixed_dynamic_array&& other_array) noexcept
     {
       base_class_type::operator=((base_class_type&&) other_array);
 
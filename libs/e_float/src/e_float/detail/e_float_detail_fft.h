@@ -11,6 +11,10 @@
 #ifndef E_FLOAT_DETAIL_FFT_2013_01_08_HPP_
   #define E_FLOAT_DETAIL_FFT_2013_01_08_HPP_
 
+  #include <algorithm>
+  #include <cmath>
+  #include <vector>
+
   #if defined(_MSC_VER)
     #pragma warning (disable:4127)
   #endif
@@ -208,12 +212,134 @@
     {
       bit_twiddle(data);
 
-      danielson_lanczos<N, is_forward_fft, float_type>::apply(data);
+      if(N >= blocked_butterfly_min_points)
+      {
+        // The stages up to blocked_butterfly_points stay within contiguous
+        // blocks. The stages above them are combined in one blocked pass.
+        for(std::uint32_t b = static_cast<std::uint32_t>(0U); b < N; b += blocked_butterfly_points)
+        {
+          danielson_lanczos<blocked_butterfly_points, is_forward_fft, float_type>::apply(data + (b * 2U));
+        }
+
+        danielson_lanczos_blocked(data);
+      }
+      else
+      {
+        danielson_lanczos<N, is_forward_fft, float_type>::apply(data);
+      }
     }
 
   private:
+    // Complex points are exchanged in blocks above this size.
+    static constexpr std::uint32_t blocked_twiddle_bits = static_cast<std::uint32_t>(8U);
+
+    // The stages are blocked above this size, where the array exceeds typical
+    // caches. Below it, the depth-first recursion is faster. The first stages
+    // work on contiguous blocks of blocked_butterfly_points complex points,
+    // and the later stages on groups of blocked_butterfly_columns columns.
+    static constexpr std::uint32_t blocked_butterfly_min_points = static_cast<std::uint32_t>(1UL << 20U);
+    static constexpr std::uint32_t blocked_butterfly_points     = static_cast<std::uint32_t>(1UL << 13U);
+    static constexpr std::uint32_t blocked_butterfly_columns    = static_cast<std::uint32_t>(64U);
+
+    static void danielson_lanczos_blocked(float_type* data)
+    {
+      // View the points as M = N / B rows of B = blocked_butterfly_points
+      // contiguous points each. The stages combining blocks of 2B, 4B, ..., N
+      // points only connect points in the same column k, with the twiddle
+      // factor exp(i pi (q B + k) / (h B)) for the pair of rows (q, q + h)
+      // within each group of 2h rows. This factors into a row part
+      // exp(i pi q / h) and a column part exp(i pi k / (h B)).
+      // Columns are copied in groups to a buffer, all of these stages are
+      // applied there, and the columns are copied back. So the whole array
+      // is swept only once, in contiguous runs of a row.
+      const std::uint32_t m_rows  = static_cast<std::uint32_t>(N / blocked_butterfly_points);
+      const std::uint32_t n_cols  = blocked_butterfly_columns;
+      const long double   pi_sign = (is_forward_fft ? +3.14159265358979323846264338327950288L
+                                                    : -3.14159265358979323846264338327950288L);
+
+      // The row parts of the twiddle factors for h = 1, 2, 4, ..., M / 2,
+      // stored one after the other starting at the index h - 1.
+      std::vector<float_type> row_twiddle(static_cast<std::size_t>(m_rows * 2U));
+
+      for(std::uint32_t h = static_cast<std::uint32_t>(1U); h < m_rows; h <<= 1U)
+      {
+        for(std::uint32_t q = static_cast<std::uint32_t>(0U); q < h; ++q)
+        {
+          const long double phi = (pi_sign * static_cast<long double>(q)) / static_cast<long double>(h);
+
+          row_twiddle[((h - 1U) + q) * 2U]       = static_cast<float_type>(std::cos(phi));
+          row_twiddle[(((h - 1U) + q) * 2U) + 1U] = static_cast<float_type>(std::sin(phi));
+        }
+      }
+
+      std::vector<float_type> buffer    (static_cast<std::size_t>((m_rows * n_cols) * 2U));
+      std::vector<float_type> col_twiddle(static_cast<std::size_t>(n_cols * 2U));
+
+      for(std::uint32_t k0 = static_cast<std::uint32_t>(0U); k0 < blocked_butterfly_points; k0 += n_cols)
+      {
+        for(std::uint32_t q = static_cast<std::uint32_t>(0U); q < m_rows; ++q)
+        {
+          std::copy(data + (((q * blocked_butterfly_points) + k0) * 2U),
+                    data + (((q * blocked_butterfly_points) + k0 + n_cols) * 2U),
+                    buffer.begin() + static_cast<std::ptrdiff_t>((q * n_cols) * 2U));
+        }
+
+        for(std::uint32_t h = static_cast<std::uint32_t>(1U); h < m_rows; h <<= 1U)
+        {
+          for(std::uint32_t c = static_cast<std::uint32_t>(0U); c < n_cols; ++c)
+          {
+            const long double phi = (pi_sign * static_cast<long double>(k0 + c)) / (static_cast<long double>(h) * static_cast<long double>(blocked_butterfly_points));
+
+            col_twiddle[c * 2U]        = static_cast<float_type>(std::cos(phi));
+            col_twiddle[(c * 2U) + 1U] = static_cast<float_type>(std::sin(phi));
+          }
+
+          for(std::uint32_t q0 = static_cast<std::uint32_t>(0U); q0 < m_rows; q0 += (h * 2U))
+          {
+            for(std::uint32_t q = static_cast<std::uint32_t>(0U); q < h; ++q)
+            {
+              const float_type wr_row = row_twiddle[((h - 1U) + q) * 2U];
+              const float_type wi_row = row_twiddle[(((h - 1U) + q) * 2U) + 1U];
+
+              float_type* lo = &buffer[((q0 + q)      * n_cols) * 2U];
+              float_type* hi = &buffer[((q0 + q + h) * n_cols) * 2U];
+
+              for(std::uint32_t c = static_cast<std::uint32_t>(0U); c < (n_cols * 2U); c += 2U)
+              {
+                const float_type wr = (wr_row * col_twiddle[c]) - (wi_row * col_twiddle[c + 1U]);
+                const float_type wi = (wr_row * col_twiddle[c + 1U]) + (wi_row * col_twiddle[c]);
+
+                const float_type tmp_real = (wr * hi[c]) - (wi * hi[c + 1U]);
+                const float_type tmp_imag = (wr * hi[c + 1U]) + (wi * hi[c]);
+
+                hi[c]      = lo[c]      - tmp_real;
+                hi[c + 1U] = lo[c + 1U] - tmp_imag;
+
+                lo[c]      += tmp_real;
+                lo[c + 1U] += tmp_imag;
+              }
+            }
+          }
+        }
+
+        for(std::uint32_t q = static_cast<std::uint32_t>(0U); q < m_rows; ++q)
+        {
+          std::copy(buffer.begin() + static_cast<std::ptrdiff_t>((q * n_cols) * 2U),
+                    buffer.begin() + static_cast<std::ptrdiff_t>(((q + 1U) * n_cols) * 2U),
+                    data + (((q * blocked_butterfly_points) + k0) * 2U));
+        }
+      }
+    }
+
     static void bit_twiddle(float_type* data)
     {
+      if(N >= static_cast<std::uint32_t>(1UL << (2U * blocked_twiddle_bits)))
+      {
+        bit_twiddle_blocked(data);
+
+        return;
+      }
+
       // TBD: Is there a way to improve the performance with metaprogramming here?
       // TBD: Or would metaprogramming here simply excessively load the compiler?
 
@@ -239,6 +365,72 @@
         j += m;
       }
     }
+
+    static std::uint32_t bit_reverse(std::uint32_t n, const std::uint32_t number_of_bits)
+    {
+      std::uint32_t r = static_cast<std::uint32_t>(0U);
+
+      for(std::uint32_t i = static_cast<std::uint32_t>(0U); i < number_of_bits; ++i)
+      {
+        r   = static_cast<std::uint32_t>((r << 1U) | (n & 1U));
+        n >>= 1U;
+      }
+
+      return r;
+    }
+
+    static void bit_twiddle_blocked(float_type* data)
+    {
+      // Split each point index into (hi | mid | lo), where hi and lo have
+      // blocked_twiddle_bits each. The bit-reversed index is then
+      // (rev(lo) | rev(mid) | rev(hi)). So all exchanges of one mid group
+      // stay within two groups of short contiguous runs. This keeps the
+      // working set small, which matters for cache and for mapped storage.
+
+      std::uint32_t total_bits = static_cast<std::uint32_t>(0U);
+
+      while((static_cast<std::uint32_t>(1U) << total_bits) < N)
+      {
+        ++total_bits;
+      }
+
+      const std::uint32_t lo_count = static_cast<std::uint32_t>(1UL << blocked_twiddle_bits);
+      const std::uint32_t mid_bits = static_cast<std::uint32_t>(total_bits - (2U * blocked_twiddle_bits));
+      const std::uint32_t hi_shift = static_cast<std::uint32_t>(mid_bits + blocked_twiddle_bits);
+
+      std::uint32_t rev_lo[1UL << blocked_twiddle_bits];
+
+      for(std::uint32_t i = static_cast<std::uint32_t>(0U); i < lo_count; ++i)
+      {
+        rev_lo[i] = bit_reverse(i, blocked_twiddle_bits);
+      }
+
+      for(std::uint32_t m = static_cast<std::uint32_t>(0U); m < static_cast<std::uint32_t>(1UL << mid_bits); ++m)
+      {
+        const std::uint32_t m_rev = bit_reverse(m, mid_bits);
+
+        // The pair of groups (m, m_rev) is handled once.
+        if(m_rev < m)
+        {
+          continue;
+        }
+
+        for(std::uint32_t hi = static_cast<std::uint32_t>(0U); hi < lo_count; ++hi)
+        {
+          for(std::uint32_t lo = static_cast<std::uint32_t>(0U); lo < lo_count; ++lo)
+          {
+            const std::uint32_t i = static_cast<std::uint32_t>((hi         << hi_shift) | (m     << blocked_twiddle_bits) | lo);
+            const std::uint32_t j = static_cast<std::uint32_t>((rev_lo[lo] << hi_shift) | (m_rev << blocked_twiddle_bits) | rev_lo[hi]);
+
+            if((m != m_rev) || (i < j))
+            {
+              std::swap(data[(i * 2U) + 0U], data[(j * 2U) + 0U]);
+              std::swap(data[(i * 2U) + 1U], data[(j * 2U) + 1U]);
+            }
+          }
+        }
+      }
+    }
   };
 
   template<const std::uint32_t N,
@@ -11,15 +11,23 @@
 #include <e_float/e_float.h>
 #include <utility/util_lexical_cast.h>
 
+// Moves and swaps exchange limb storage. They must not throw so that
+// standard containers and algorithms move rather than copy e_float.
+static_assert(std::is_nothrow_move_constructible<e_float>::value, "Error: e_float must be nothrow move constructible");
+static_assert(std::is_nothrow_move_assignable   <e_float>::value, "Error: e_float must be nothrow move assignable");
+
 // Global unary operators of e_float reference.
 e_float operator+(const e_float& self) { return e_float(self); }
 e_float operator-(const e_float& self) { e_float tmp(self); tmp.negate(); return tmp; }
+e_float operator-(e_float&& self)      { self.negate(); return static_cast<e_float&&>(self); }
 
 // Global add/sub/mul/div of const e_float& with const e_float&.
-e_float operator+(const e_float& u, const e_float& v) { return e_float(u) += v; }
-e_float operator-(const e_float& u, const e_float& v) { return e_float(u) -= v; }
-e_float operator*(const e_float& u, const e_float& v) { return e_float(u) *= v; }
-e_float operator/(const e_float& u, const e_float& v) { return e_float(u) /= v; }
+// The result is built in a named local in order to benefit
+// from return value optimization.
+e_float operator+(const e_float& u, const e_float& v) { e_float result(u); result += v; return result; }
+e_float operator-(const e_float& u, const e_float& v) { e_float result(u); result -= v; return result; }
+e_float operator*(const e_float& u, const e_float& v) { e_float result(u); result *= v; return result; }
+e_float operator/(const e_float& u, const e_float& v) { e_float result(u); result /= v; return result; }
 
 // Global comparison operators of const e_float& with const e_float&.
 bool operator< (const e_float& u, const e_float& v) { return (u.cmp(v) <  static_cast<std::int32_t>(0)); }
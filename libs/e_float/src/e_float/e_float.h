@@ -88,6 +88,7 @@
   // Global unary operators of e_float reference.
   e_float operator+(const e_float& self);
   e_float operator-(const e_float& self);
+  e_float operator-(e_float&& self);
 
   // Global add/sub/mul/div of const e_float& with const e_float&.
   e_float operator+(const e_float& u, const e_float& v);
@@ -95,6 +96,40 @@
   e_float operator*(const e_float& u, const e_float& v);
   e_float operator/(const e_float& u, const e_float& v);
 
+  // Global add/sub/mul/div of e_float&& with const e_float&.
+  // These re-use the storage of the expiring left operand for the result.
+  // Only the left operand is recycled, so that the result retains the
+  // working precision of the left operand just as in the const& case.
+  // The right operand is a template parameter restricted to e_float in
+  // order to prevent ambiguities with the overloads for built-in types.
+  template<typename EFloatType>
+  typename std::enable_if<std::is_same<EFloatType, e_float>::value, e_float>::type operator+(e_float&& u, const EFloatType& v)
+  {
+    u += v;
+    return static_cast<e_float&&>(u);
+  }
+
+  template<typename EFloatType>
+  typename std::enable_if<std::is_same<EFloatType, e_float>::value, e_float>::type operator-(e_float&& u, const EFloatType& v)
+  {
+    u -= v;
+    return static_cast<e_float&&>(u);
+  }
+
+  template<typename EFloatType>
+  typename std::enable_if<std::is_same<EFloatType, e_float>::value, e_float>::type operator*(e_float&& u, const EFloatType& v)
+  {
+    u *= v;
+    return static_cast<e_float&&>(u);
+  }
+
+  template<typename EFloatType>
+  typename std::enable_if<std::is_same<EFloatType, e_float>::value, e_float>::type operator/(e_float&& u, const EFloatType& v)
+  {
+    u /= v;
+    return static_cast<e_float&&>(u);
+  }
+
   // Global add/sub/mul/div of const e_float& with all built-in types.
   template<typename SignedIntegralType>
   typename std::enable_if<   (std::is_integral<SignedIntegralType>::value == true)
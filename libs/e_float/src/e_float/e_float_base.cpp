@@ -47,10 +47,155 @@ namespace local
                                         const bool my_uppercase);
 
   void special_extend_string_to_precision(std::string& str, const std::size_t os_precision);
+
+  // Sequential reader of the raw (unrounded) output digits of e_float,
+  // which fetches the digits block-by-block from the MP implementation.
+  class output_digit_reader
+  {
+  public:
+    using digit_function_type = std::size_t(*)(const e_float_base&, char* const, const std::size_t, const std::size_t);
+
+    output_digit_reader(const e_float_base& f, const digit_function_type pfn) : my_f    (f),
+                                                                                my_pfn  (pfn),
+                                                                                my_first(static_cast<std::size_t>(0U)),
+                                                                                my_count(static_cast<std::size_t>(0U)),
+                                                                                my_index(static_cast<std::size_t>(0U)) { }
+
+    char next()
+    {
+      if(my_index == my_count)
+      {
+        // Fetch the next block of digits. Missing digits are zero.
+        my_first += my_count;
+        my_count  = my_pfn(my_f, my_buffer, my_first, static_cast<std::size_t>(sizeof(my_buffer)));
+
+        std::fill(my_buffer + my_count, my_buffer + sizeof(my_buffer), static_cast<char>('0'));
+
+        my_count = static_cast<std::size_t>(sizeof(my_buffer));
+        my_index = static_cast<std::size_t>(0U);
+      }
+
+      return my_buffer[my_index++];
+    }
+
+  private:
+    const e_float_base&       my_f;
+    const digit_function_type my_pfn;
+    std::size_t               my_first;
+    std::size_t               my_count;
+    std::size_t               my_index;
+    char                      my_buffer[512U];
+
+    output_digit_reader(const output_digit_reader&) = delete;
+    const output_digit_reader& operator=(const output_digit_reader&) = delete;
+  };
+
+  // Buffered writer of the formatted digits to a stream buffer. The decimal
+  // point is written just before the digit at the given position.
+  class output_digit_writer
+  {
+  public:
+    output_digit_writer(std::streambuf* sb, const std::size_t point_pos, const bool has_point)
+      : my_sb       (sb),
+        my_point_pos(point_pos),
+        my_has_point(has_point),
+        my_digit_cnt(static_cast<std::size_t>(0U)),
+        my_size     (static_cast<std::size_t>(0U)),
+        my_good     (true) { }
+
+    ~output_digit_writer() { flush(); }
+
+    void put_digit(const char c)
+    {
+      if(my_has_point && (my_digit_cnt == my_point_pos))
+      {
+        put_char(static_cast<char>('.'));
+      }
+
+      put_char(c);
+
+      ++my_digit_cnt;
+    }
+
+    void put_digits(const char c, const std::size_t n)
+    {
+      for(std::size_t i = static_cast<std::size_t>(0U); i < n; ++i)
+      {
+        put_digit(c);
+      }
+    }
+
+    void put_point_if_pending()
+    {
+      if(my_has_point && (my_digit_cnt == my_point_pos))
+      {
+        put_char(static_cast<char>('.'));
+
+        my_has_point = false;
+      }
+    }
+
+    void put_char(const char c)
+    {
+      if(my_size == sizeof(my_buffer))
+      {
+        flush();
+      }
+
+      my_buffer[my_size++] = c;
+    }
+
+    void put_chars(const char c, const std::size_t n)
+    {
+      for(std::size_t i = static_cast<std::size_t>(0U); i < n; ++i)
+      {
+        put_char(c);
+      }
+    }
+
+    bool flush()
+    {
+      if(my_size != static_cast<std::size_t>(0U))
+      {
+        const std::streamsize n = static_cast<std::streamsize>(my_size);
+
+        my_good = (my_good && (my_sb->sputn(my_buffer, n) == n));
+
+        my_size = static_cast<std::size_t>(0U);
+      }
+
+      return my_good;
+    }
+
+    std::size_t digit_count() const { return my_digit_cnt; }
+
+  private:
+    std::streambuf*   my_sb;
+    const std::size_t my_point_pos;
+    bool              my_has_point;
+    std::size_t       my_digit_cnt;
+    std::size_t       my_size;
+    bool              my_good;
+    char              my_buffer[512U];
+
+    output_digit_writer(const output_digit_writer&) = delete;
+    const output_digit_writer& operator=(const output_digit_writer&) = delete;
+  };
+
+  std::size_t number_of_output_digits(const bool use_scientific,
+                                      const bool use_fixed,
+                                      const std::int64_t the_exp,
+                                      const std::size_t os_precision);
 }
 
 std::ostream& operator<<(std::ostream& os, const e_float_base& f)
 {
+  // Stream the digits directly if possible, without building the output string.
+  if(f.wr_stream(os))
+  {
+    return os;
+  }
+
   std::string str;
 
   f.wr_string(str, os);
@@ -208,40 +353,7 @@ void e_float_base::wr_string(std::string& str, std::ostream& os) const
   }
 
   // Ascertain the number of digits requested from e_float.
-  std::size_t the_number_of_digits_i_want_from_e_float = static_cast<std::size_t>(0U);
-
-  const std::size_t max10_plus_one = static_cast<std::size_t>(std::numeric_limits<e_float>::max_digits10 + 1);
-
-  if(use_scientific)
-  {
-    // The float-field is scientific. The number of digits is given by
-    // (1 + the ostream's precision), not to exceed (max_digits10 + 1).
-    const std::size_t prec_plus_one  = static_cast<std::size_t>(1U + os_precision);
-    the_number_of_digits_i_want_from_e_float = (std::min)(max10_plus_one, prec_plus_one);
-  }
-  else if(use_fixed)
-  {
-    // The float-field is scientific. The number of all-digits depends
-    // on the form of the number.
-
-    if(the_exp >= static_cast<std::int64_t>(0))
-    {
-      // If the number is larger than 1 in absolute value, then the number of
-      // digits is given by the width of the integer part plus the ostream's
-      // precision, not to exceed (max_digits10 + 1).
-      const std::size_t exp_plus_one = static_cast<std::size_t>(the_exp + 1);
-      const std::size_t exp_plus_one_plus_my_precision = static_cast<std::size_t>(exp_plus_one + os_precision);
-
-      the_number_of_digits_i_want_from_e_float = (std::min)(exp_plus_one_plus_my_precision, max10_plus_one);
-    }
-    else
-    {
-      const std::int64_t exp_plus_one = static_cast<std::int64_t>(the_exp + 1);
-      const std::int64_t exp_plus_one_plus_my_precision = static_cast<std::int64_t>(exp_plus_one + static_cast<std::int64_t>(os_precision));
-
-      the_number_of_digits_i_want_from_e_float = (std::min)(static_cast<std::size_t>((std::max)(exp_plus_one_plus_my_precision, static_cast<std::int64_t>(0))), max10_plus_one);
-    }
-  }
+  std::size_t the_number_of_digits_i_want_from_e_float = local::number_of_output_digits(use_scientific, use_fixed, the_exp, os_precision);
 
   // If the float field is not set, reduce the number of digits requested
   // from e_float such that it neither exceeds the ostream's precision
@@ -288,6 +400,282 @@ void e_float_base::wr_string(std::string& str, std::ostream& os) const
   }
 }
 
+bool e_float_base::wr_stream(std::ostream& os) const
+{
+  // Write the formatted digits chunk-by-chunk directly into the stream buffer.
+  // This is supported for finite numbers in scientific and fixed notation
+  // if the MP implementation provides direct access to its decimal digits.
+  // The memory used does not depend on the number of digits.
+
+  const std::ios::fmtflags my_flags = os.flags();
+
+  const bool use_scientific = ((my_flags & std::ios::scientific) != static_cast<std::ios::fmtflags>(0U));
+  const bool use_fixed      = ((!use_scientific) && ((my_flags & std::ios::fixed) != static_cast<std::ios::fmtflags>(0U)));
+
+  if((!i_have_my_own_output_digits()) || (!isfinite()) || ((!use_scientific) && (!use_fixed)))
+  {
+    return false;
+  }
+
+  const std::ostream::sentry my_sentry(os);
+
+  if(!my_sentry)
+  {
+    return true;
+  }
+
+  const bool my_showpos    = ((my_flags & std::ios::showpos)   != static_cast<std::ios::fmtflags>(0U));
+  const bool my_uppercase  = ((my_flags & std::ios::uppercase) != static_cast<std::ios::fmtflags>(0U));
+  const bool my_showpoint  = ((my_flags & std::ios::showpoint) != static_cast<std::ios::fmtflags>(0U));
+
+  static const std::stringstream str_default;
+  static const std::streamsize   prec_default = str_default.precision();
+
+  const std::size_t os_precision = ((os.precision() <= static_cast<std::streamsize>(0)) ? static_cast<std::size_t>(prec_default) : static_cast<std::size_t>(os.precision()));
+
+  std::int64_t the_exp = get_order_exact();
+
+  const std::size_t number_of_digits = local::number_of_output_digits(use_scientific, use_fixed, the_exp, os_precision);
+
+  const local::output_digit_reader::digit_function_type pfn =
+    [](const e_float_base& f, char* const p_digits, const std::size_t first_digit, const std::size_t count) -> std::size_t
+    {
+      return f.get_output_digits(p_digits, first_digit, count);
+    };
+
+  // Look ahead at the digit just after the last needed digit for rounding.
+  // If the rounding carries through nothing but nines, the output becomes
+  // 1000... and the exponent is incremented.
+  bool round_up = false;
+  bool carry    = false;
+
+  if(number_of_digits > static_cast<std::size_t>(0U))
+  {
+    char round_digit;
+
+    if(get_output_digits(&round_digit, number_of_digits, static_cast<std::size_t>(1U)) == static_cast<std::size_t>(1U))
+    {
+      round_up = (round_digit >= static_cast<char>('5'));
+    }
+
+    if(round_up)
+    {
+      local::output_digit_reader rd(*this, pfn);
+
+      std::size_t i = static_cast<std::size_t>(0U);
+
+      while((i < number_of_digits) && (rd.next() == static_cast<char>('9')))
+      {
+        ++i;
+      }
+
+      carry = (i == number_of_digits);
+
+      if(carry)
+      {
+        ++the_exp;
+      }
+    }
+  }
+
+  // Set up the layout of the formatted digits: total number of digits
+  // (including leading zeros), the position of the decimal point
+  // and the number of leading zeros.
+  std::size_t total_digits;
+  std::size_t point_pos;
+  std::size_t leading_zeros = static_cast<std::size_t>(0U);
+
+  if(use_scientific)
+  {
+    total_digits = static_cast<std::size_t>(os_precision + 1U);
+    point_pos    = static_cast<std::size_t>(1U);
+  }
+  else if(the_exp < static_cast<std::int64_t>(0))
+  {
+    total_digits  = static_cast<std::size_t>(os_precision + 1U);
+    point_pos     = static_cast<std::size_t>(1U);
+    leading_zeros = static_cast<std::size_t>(1U + (std::min)(static_cast<std::size_t>(-the_exp - 1), os_precision));
+  }
+  else
+  {
+    total_digits = static_cast<std::size_t>(static_cast<std::size_t>(the_exp + 1) + os_precision);
+    point_pos    = static_cast<std::size_t>(the_exp + 1);
+  }
+
+  const bool has_point = ((os_precision != static_cast<std::size_t>(0U)) || my_showpoint);
+
+  // Prepare the exponent of the scientific notation. Its width is an even multiple of three.
+  char        exp_buffer[32U];
+  std::size_t exp_len = static_cast<std::size_t>(0U);
+
+  if(use_scientific)
+  {
+    const bool          b_exp_is_neg = (the_exp < static_cast<std::int64_t>(0));
+          std::uint64_t u_exp        = static_cast<std::uint64_t>(!b_exp_is_neg ? the_exp : static_cast<std::int64_t>(-the_exp));
+
+    char        exp_digits[24U];
+    std::size_t exp_digits_len = static_cast<std::size_t>(0U);
+
+    do
+    {
+      exp_digits[exp_digits_len++] = static_cast<char>(static_cast<std::uint64_t>('0') + (u_exp % 10U));
+
+      u_exp /= 10U;
+    }
+    while(u_exp != static_cast<std::uint64_t>(0U));
+
+    exp_buffer[exp_len++] = (my_uppercase ? static_cast<char>('E') : static_cast<char>('e'));
+    exp_buffer[exp_len++] = (b_exp_is_neg ? static_cast<char>('-') : static_cast<char>('+'));
+
+    const std::size_t exp_len_mod3 = static_cast<std::size_t>(exp_digits_len % 3U);
+
+    if(exp_len_mod3 != static_cast<std::size_t>(0U))
+    {
+      for(std::size_t i = exp_len_mod3; i < static_cast<std::size_t>(3U); ++i)
+      {
+        exp_buffer[exp_len++] = static_cast<char>('0');
+      }
+    }
+
+    while(exp_digits_len != static_cast<std::size_t>(0U))
+    {
+      exp_buffer[exp_len++] = exp_digits[--exp_digits_len];
+    }
+  }
+
+  // Handle the sign and std::setw(...), std::setfill(...), std::left, std::right, std::internal.
+  const bool        has_sign = (isneg() || my_showpos);
+  const std::size_t length   = static_cast<std::size_t>(  static_cast<std::size_t>(has_sign ? 1U : 0U)
+                                                        + total_digits
+                                                        + static_cast<std::size_t>(has_point ? 1U : 0U)
+                                                        + exp_len);
+
+  const std::size_t my_width = ((os.width() >= static_cast<std::streamsize>(0)) ? static_cast<std::size_t>(os.width())
+                                                                                : static_cast<std::size_t>(0U));
+
+  const std::size_t n_fill  = ((my_width > length) ? static_cast<std::size_t>(my_width - length) : static_cast<std::size_t>(0U));
+  const bool        my_left = ((my_flags & std::ios::left) != static_cast<std::ios::fmtflags>(0U));
+
+  local::output_digit_writer wr(os.rdbuf(), point_pos, has_point);
+
+  if(!my_left) { wr.put_chars(os.fill(), n_fill); }
+
+  if     (isneg())    { wr.put_char(static_cast<char>('-')); }
+  else if(my_showpos) { wr.put_char(static_cast<char>('+')); }
+
+  wr.put_digits(static_cast<char>('0'), leading_zeros);
+
+  // Write the rounded digits. When rounding up, a non-nine digit is held back
+  // together with the count of nines following it, until it is known
+  // whether the subsequent digits carry into it.
+  if(carry)
+  {
+    wr.put_digit(static_cast<char>('1'));
+    wr.put_digits(static_cast<char>('0'), static_cast<std::size_t>(number_of_digits - 1U));
+  }
+  else if(round_up)
+  {
+    local::output_digit_reader rd(*this, pfn);
+
+    char        held  = static_cast<char>('\0');
+    std::size_t nines = static_cast<std::size_t>(0U);
+
+    for(std::size_t i = static_cast<std::size_t>(0U); i < number_of_digits; ++i)
+    {
+      const char c = rd.next();
+
+      if(c == static_cast<char>('9'))
+      {
+        ++nines;
+      }
+      else
+      {
+        if(held != static_cast<char>('\0')) { wr.put_digit(held); }
+
+        wr.put_digits(static_cast<char>('9'), nines);
+
+        held  = c;
+        nines = static_cast<std::size_t>(0U);
+      }
+    }
+
+    wr.put_digit(static_cast<char>(held + 1));
+    wr.put_digits(static_cast<char>('0'), nines);
+  }
+  else
+  {
+    local::output_digit_reader rd(*this, pfn);
+
+    for(std::size_t i = static_cast<std::size_t>(0U); i < number_of_digits; ++i)
+    {
+      wr.put_digit(rd.next());
+    }
+  }
+
+  // Zero-extend the digits to the given precision.
+  wr.put_digits(static_cast<char>('0'), static_cast<std::size_t>(total_digits - wr.digit_count()));
+  wr.put_point_if_pending();
+
+  for(std::size_t i = static_cast<std::size_t>(0U); i < exp_len; ++i)
+  {
+    wr.put_char(exp_buffer[i]);
+  }
+
+  if(my_left) { wr.put_chars(os.fill(), n_fill); }
+
+  if(!wr.flush())
+  {
+    os.setstate(std::ios::badbit);
+  }
+
+  static_cast<void>(os.width(0));
+
+  return true;
+}
+
+std::size_t local::number_of_output_digits(const bool use_scientific,
+                                          const bool use_fixed,
+                                          const std::int64_t the_exp,
+                                          const std::size_t os_precision)
+{
+  std::size_t the_number_of_digits_i_want_from_e_float = static_cast<std::size_t>(0U);
+
+  const std::size_t max10_plus_one = static_cast<std::size_t>(std::numeric_limits<e_float>::max_digits10 + 1);
+
+  if(use_scientific)
+  {
+    // The float-field is scientific. The number of digits is given by
+    // (1 + the ostream's precision), not to exceed (max_digits10 + 1).
+    const std::size_t prec_plus_one  = static_cast<std::size_t>(1U + os_precision);
+    the_number_of_digits_i_want_from_e_float = (std::min)(max10_plus_one, prec_plus_one);
+  }
+  else if(use_fixed)
+  {
+    // The float-field is scientific. The number of all-digits depends
+    // on the form of the number.
+
+    if(the_exp >= static_cast<std::int64_t>(0))
+    {
+      // If the number is larger than 1 in absolute value, then the number of
+      // digits is given by the width of the integer part plus the ostream's
+      // precision, not to exceed (max_digits10 + 1).
+      const std::size_t exp_plus_one = static_cast<std::size_t>(the_exp + 1);
+      const std::size_t exp_plus_one_plus_my_precision = static_cast<std::size_t>(exp_plus_one + os_precision);
+
+      the_number_of_digits_i_want_from_e_float = (std::min)(exp_plus_one_plus_my_precision, max10_plus_one);
+    }
+    else
+    {
+      const std::int64_t exp_plus_one = static_cast<std::int64_t>(the_exp + 1);
+      const std::int64_t exp_plus_one_plus_my_precision = static_cast<std::int64_t>(exp_plus_one + static_cast<std::int64_t>(os_precision));
+
+      the_number_of_digits_i_want_from_e_float = (std::min)(static_cast<std::size_t>((std::max)(exp_plus_one_plus_my_precision, static_cast<std::int64_t>(0))), max10_plus_one);
+    }
+  }
+
+  return the_number_of_digits_i_want_from_e_float;
+}
+
 void local::special_handle_string_not_finite(std::string& str,
                                              const e_float& f,
                                              const bool my_showpos,
@@ -518,6 +906,7 @@ e_float e_float_base::my_own_fmod         (const e_float&, const e_float&)
 e_float e_float_base::my_own_cbrt         (const e_float&)                      { return std::numeric_limits<e_float>::quiet_NaN(); }
 e_float e_float_base::my_own_rootn        (const e_float&, const std::uint32_t) { return std::numeric_limits<e_float>::quiet_NaN(); }
 e_float e_float_base::my_own_exp          (const e_float&)                      { return std::numeric_limits<e_float>::quiet_NaN(); }
+e_float e_float_base::my_own_expm1        (const e_float&)                      { return std::numeric_limits<e_float>::quiet_NaN(); }
 e_float e_float_base::my_own_log          (const e_float&)                      { return std::numeric_limits<e_float>::quiet_NaN(); }
 e_float e_float_base::my_own_sin          (const e_float&)                      { return std::numeric_limits<e_float>::quiet_NaN(); }
 e_float e_float_base::my_own_cos          (const e_float&)                      { return std::numeric_limits<e_float>::quiet_NaN(); }
@@ -46,6 +46,12 @@
     #error The e_float type is undefined. Please define the e_float type.
   #endif
 
+  namespace ef
+  {
+    class binary_writer;
+    class binary_reader;
+  }
+
   class e_float_base
   {
   public:
@@ -63,7 +69,9 @@
     const e_float& my_value_max() const;
     const e_float& my_value_min() const;
 
-    virtual void precision(const std::int32_t) = 0;
+    // Set and get the working precision in decimal digits.
+    virtual void         precision(const std::int32_t) = 0;
+    virtual std::int32_t precision() const = 0;
 
     // Assignment operator.
     virtual e_float& operator=(const e_float&) = 0;
@@ -121,8 +129,13 @@
 
     // Formated I/O routines.
             void wr_string(std::string& str, std::ostream& os) const;
+            bool wr_stream(std::ostream& os) const;
     virtual bool rd_string(const char* const) = 0;
 
+    // Binary I/O routines, see e_float_serialize.h.
+    virtual void wr_binary(ef::binary_writer&) const = 0;
+    virtual bool rd_binary(ef::binary_reader&) = 0;
+
     // Specific higher functions which might be present in the MP implementation.
     virtual bool i_have_my_own_ldexp        () const noexcept { return false; }
     virtual bool i_have_my_own_frexp        () const noexcept { return false; }
@@ -130,6 +143,7 @@
     virtual bool i_have_my_own_cbrt         () const noexcept { return false; }
     virtual bool i_have_my_own_rootn        () const noexcept { return false; }
     virtual bool i_have_my_own_exp          () const noexcept { return false; }
+    virtual bool i_have_my_own_expm1        () const noexcept { return false; }
     virtual bool i_have_my_own_log          () const noexcept { return false; }
     virtual bool i_have_my_own_sin          () const noexcept { return false; }
     virtual bool i_have_my_own_cos          () const noexcept { return false; }
@@ -154,6 +168,7 @@
     static e_float my_own_cbrt         (const e_float&);
     static e_float my_own_rootn        (const e_float&, const std::uint32_t);
     static e_float my_own_exp          (const e_float&);
+    static e_float my_own_expm1        (const e_float&);
     static e_float my_own_log          (const e_float&);
     static e_float my_own_sin          (const e_float&);
     static e_float my_own_cos          (const e_float&);
@@ -247,6 +262,12 @@
     virtual void get_output_string(std::string& str,
                                    std::int64_t& the_exp,
                                    const std::size_t number_of_digits) const = 0;
+
+    // Direct access to the raw (unrounded) decimal digits, which might be present
+    // in the MP implementation. Writes up to count digits starting at the digit
+    // index first_digit and returns the number of digits written.
+    virtual bool        i_have_my_own_output_digits() const noexcept { return false; }
+    virtual std::size_t get_output_digits(char* const, const std::size_t, const std::size_t) const { return static_cast<std::size_t>(0U); }
   };
 
   std::ostream& operator<<(std::ostream& os, const e_float_base& f);
@@ -145,6 +145,7 @@
     e_float rootn        (const e_float& x, const std::int32_t p);
     e_float rootn_inverse(const e_float& x, const std::int32_t p);
     e_float exp          (const e_float& x);
+    e_float expm1        (const e_float& x);
     e_float log          (const e_float& x);
     e_float log10        (const e_float& x);
     e_float loga         (const e_float& a, const e_float& x);
@@ -181,6 +182,9 @@
 
     e_float gamma          (const e_float& x);
     e_float gamma_near_n   (const std::int32_t n, const e_float& x);
+    e_float lgamma         (const e_float& x);
+    e_float digamma        (const e_float& x);
+    e_float polygamma      (const std::uint32_t n, const e_float& x);
     e_float factorial      (const std::uint32_t n);
     e_float factorial2     (const std::int32_t  n);
     e_float binomial       (const std::uint32_t n, const std::uint32_t k);
@@ -12,15 +12,21 @@
   #define E_FLOAT_FUNCTIONS_COMPLEX_2017_08_23_HPP_
 
   #include <cstdint>
+  #include <vector>
 
   #include <e_float/e_float_complex.h>
 
   namespace ef
   {
     complex<e_float> gamma       (const complex<e_float>& z);
+    complex<e_float> lgamma      (const complex<e_float>& z);
+    complex<e_float> digamma     (const complex<e_float>& z);
+    complex<e_float> polygamma   (const std::uint32_t n, const complex<e_float>& z);
     complex<e_float> pochhammer  (const complex<e_float>& z, const std::uint32_t n);
     complex<e_float> pochhammer  (const complex<e_float>& z, const complex<e_float>& a);
     complex<e_float> riemann_zeta(const complex<e_float>& s);
+
+    void             riemann_zeta_table(std::vector<complex<e_float>>& zeta_values, const complex<e_float>& s0, const complex<e_float>& ds, const std::uint32_t n);
   }
 
 #endif // E_FLOAT_FUNCTIONS_COMPLEX_2017_08_23_HPP_
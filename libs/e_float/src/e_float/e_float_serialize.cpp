@@ -0,0 +1,434 @@
+//          Copyright Christopher Kormanyos 1999 - 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+// This work is based on an earlier work:
+// "Algorithm 910: A Portable C++ Multiple-Precision System for Special-Function Calculations",
+// in ACM TOMS, {VOL 37, ISSUE 4, (February 2011)} (C) ACM, 2011. http://doi.acm.org/10.1145/1916461.1916469
+
+#include <algorithm>
+
+#include <e_float/e_float_serialize.h>
+
+namespace local
+{
+  const char          binary_magic[4U] = { 'e', 'f', 'b', 'n' };
+  const std::uint16_t binary_version   = static_cast<std::uint16_t>(1U);
+
+  #if defined(E_FLOAT_TYPE_EFX)
+  const std::uint8_t binary_backend = static_cast<std::uint8_t>(1U);
+  #elif defined(E_FLOAT_TYPE_GMP)
+  const std::uint8_t binary_backend = static_cast<std::uint8_t>(2U);
+  #elif defined(E_FLOAT_TYPE_MPFR)
+  const std::uint8_t binary_backend = static_cast<std::uint8_t>(3U);
+  #endif
+
+  // Modulus of the Adler-32 checksum, and the largest number of bytes
+  // for which the sums can be accumulated before the modulo is needed
+  // without overflowing 32 bits (NMAX of zlib).
+  const std::uint32_t adler_modulus = static_cast<std::uint32_t>(65521U);
+  const std::size_t   adler_nmax    = static_cast<std::size_t>(5552U);
+
+  // Size of the local buffers for ranges of values.
+  const std::size_t block_size = static_cast<std::size_t>(4096U);
+
+  // Update the Adler-32 sums. The modulo is deferred across calls
+  // until the number of pending bytes reaches NMAX.
+  void adler_update(std::uint32_t& sum_a, std::uint32_t& sum_b, std::size_t& pending, const std::uint8_t* p, std::size_t count)
+  {
+    while(count != static_cast<std::size_t>(0U))
+    {
+      const std::size_t n = (std::min)(count, static_cast<std::size_t>(adler_nmax - pending));
+
+      // Use the closed form of the sums over the n bytes, which has no
+      // dependency from one byte to the next and vectorizes. The partial
+      // sums do not exceed the final sum_b, which is below 2^32 by NMAX.
+      std::uint32_t s1 = static_cast<std::uint32_t>(0U);
+      std::uint32_t s2 = static_cast<std::uint32_t>(0U);
+
+      for(std::size_t i = static_cast<std::size_t>(0U); i < n; ++i)
+      {
+        s1 += p[i];
+        s2 += static_cast<std::uint32_t>(n - i) * p[i];
+      }
+
+      sum_b += (static_cast<std::uint32_t>(n) * sum_a) + s2;
+      sum_a += s1;
+
+      pending += n;
+
+      if(pending == adler_nmax)
+      {
+        sum_a %= adler_modulus;
+        sum_b %= adler_modulus;
+
+        pending = static_cast<std::size_t>(0U);
+      }
+
+      p     += n;
+      count -= n;
+    }
+  }
+
+  std::uint32_t adler_value(const std::uint32_t sum_a, const std::uint32_t sum_b)
+  {
+    return static_cast<std::uint32_t>(((sum_b % adler_modulus) << 16) | (sum_a % adler_modulus));
+  }
+
+  // Store and load unsigned integers in little-endian byte order.
+  template<typename unsigned_type>
+  void pack(std::uint8_t* p, const unsigned_type u)
+  {
+    for(std::size_t i = static_cast<std::size_t>(0U); i < sizeof(unsigned_type); ++i)
+    {
+      p[i] = static_cast<std::uint8_t>(u >> (i * 8U));
+    }
+  }
+
+  template<typename unsigned_type>
+  unsigned_type unpack(const std::uint8_t* p)
+  {
+    unsigned_type u = static_cast<unsigned_type>(0U);
+
+    for(std::size_t i = static_cast<std::size_t>(0U); i < sizeof(unsigned_type); ++i)
+    {
+      u = static_cast<unsigned_type>(u | static_cast<unsigned_type>(static_cast<unsigned_type>(p[i]) << (i * 8U)));
+    }
+
+    return u;
+  }
+
+  bool write_binary_range(std::ostream& os, const e_float* p, const std::size_t count);
+
+  bool read_binary_header(std::istream& is, ef::binary_reader& rd, std::uint64_t& count);
+  bool read_binary_footer(ef::binary_reader& rd);
+}
+
+ef::binary_writer::binary_writer(std::ostream& os) : my_os         (os),
+                                                     my_sum_a      (static_cast<std::uint32_t>(1U)),
+                                                     my_sum_b      (static_cast<std::uint32_t>(0U)),
+                                                     my_sum_pending(static_cast<std::size_t>(0U)) { }
+
+void ef::binary_writer::put_bytes(const std::uint8_t* p, const std::size_t count)
+{
+  local::adler_update(my_sum_a, my_sum_b, my_sum_pending, p, count);
+
+  // Write through the stream buffer, which avoids the sentry of
+  // std::ostream::write for each of the small fields of a value.
+  const std::streamsize n_put = my_os.good() ? my_os.rdbuf()->sputn(reinterpret_cast<const char*>(p), static_cast<std::streamsize>(count))
+                                             : static_cast<std::streamsize>(0);
+
+  if(n_put != static_cast<std::streamsize>(count))
+  {
+    my_os.setstate(std::ios::badbit);
+  }
+}
+
+void ef::binary_writer::put_u08(const std::uint8_t u)
+{
+  put_bytes(&u, static_cast<std::size_t>(1U));
+}
+
+void ef::binary_writer::put_u16(const std::uint16_t u)
+{
+  std::uint8_t buf[2U];
+
+  local::pack(buf, u);
+
+  put_bytes(buf, sizeof(buf));
+}
+
+void ef::binary_writer::put_u32(const std::uint32_t u)
+{
+  std::uint8_t buf[4U];
+
+  local::pack(buf, u);
+
+  put_bytes(buf, sizeof(buf));
+}
+
+void ef::binary_writer::put_u64(const std::uint64_t u)
+{
+  std::uint8_t buf[8U];
+
+  local::pack(buf, u);
+
+  put_bytes(buf, sizeof(buf));
+}
+
+void ef::binary_writer::put_u32_range(const std::uint32_t* p, const std::size_t count)
+{
+  // Pack the values into a local buffer and write it with one call per block.
+  std::uint8_t buf[local::block_size];
+
+  for(std::size_t i = static_cast<std::size_t>(0U); i < count; )
+  {
+    const std::size_t n = (std::min)(count - i, static_cast<std::size_t>(local::block_size / 4U));
+
+    for(std::size_t j = static_cast<std::size_t>(0U); j < n; ++j)
+    {
+      local::pack(buf + (j * 4U), p[i + j]);
+    }
+
+    put_bytes(buf, n * 4U);
+
+    i += n;
+  }
+}
+
+void ef::binary_writer::put_u64_range(const std::uint64_t* p, const std::size_t count)
+{
+  std::uint8_t buf[local::block_size];
+
+  for(std::size_t i = static_cast<std::size_t>(0U); i < count; )
+  {
+    const std::size_t n = (std::min)(count - i, static_cast<std::size_t>(local::block_size / 8U));
+
+    for(std::size_t j = static_cast<std::size_t>(0U); j < n; ++j)
+    {
+      local::pack(buf + (j * 8U), p[i + j]);
+    }
+
+    put_bytes(buf, n * 8U);
+
+    i += n;
+  }
+}
+
+std::uint32_t ef::binary_writer::checksum() const
+{
+  return local::adler_value(my_sum_a, my_sum_b);
+}
+
+ef::binary_reader::binary_reader(std::istream& is) : my_is         (is),
+                                                     my_sum_a      (static_cast<std::uint32_t>(1U)),
+                                                     my_sum_b      (static_cast<std::uint32_t>(0U)),
+                                                     my_sum_pending(static_cast<std::size_t>(0U)) { }
+
+void ef::binary_reader::get_bytes(std::uint8_t* p, const std::size_t count)
+{
+  // Read exactly the requested bytes, such that the stream is not
+  // consumed beyond the end of the serialized data. The stream buffer
+  // is used directly, as in binary_writer::put_bytes().
+  const std::streamsize n_get = my_is.good() ? my_is.rdbuf()->sgetn(reinterpret_cast<char*>(p), static_cast<std::streamsize>(count))
+                                             : static_cast<std::streamsize>(0);
+
+  const std::size_t n_read = static_cast<std::size_t>(n_get);
+
+  if(n_read < count)
+  {
+    std::fill(p + n_read, p + count, static_cast<std::uint8_t>(0U));
+
+    my_is.setstate(std::ios::eofbit | std::ios::failbit);
+  }
+
+  local::adler_update(my_sum_a, my_sum_b, my_sum_pending, p, count);
+}
+
+std::uint8_t ef::binary_reader::get_u08()
+{
+  std::uint8_t u;
+
+  get_bytes(&u, static_cast<std::size_t>(1U));
+
+  return u;
+}
+
+std::uint16_t ef::binary_reader::get_u16()
+{
+  std::uint8_t buf[2U];
+
+  get_bytes(buf, sizeof(buf));
+
+  return local::unpack<std::uint16_t>(buf);
+}
+
+std::uint32_t ef::binary_reader::get_u32()
+{
+  std::uint8_t buf[4U];
+
+  get_bytes(buf, sizeof(buf));
+
+  return local::unpack<std::uint32_t>(buf);
+}
+
+std::uint64_t ef::binary_reader::get_u64()
+{
+  std::uint8_t buf[8U];
+
+  get_bytes(buf, sizeof(buf));
+
+  return local::unpack<std::uint64_t>(buf);
+}
+
+void ef::binary_reader::get_u32_range(std::uint32_t* p, const std::size_t count)
+{
+  std::uint8_t buf[local::block_size];
+
+  for(std::size_t i = static_cast<std::size_t>(0U); i < count; )
+  {
+    const std::size_t n = (std::min)(count - i, static_cast<std::size_t>(local::block_size / 4U));
+
+    get_bytes(buf, n * 4U);
+
+    for(std::size_t j = static_cast<std::size_t>(0U); j < n; ++j)
+    {
+      p[i + j] = local::unpack<std::uint32_t>(buf + (j * 4U));
+    }
+
+    i += n;
+  }
+}
+
+void ef::binary_reader::get_u64_range(std::uint64_t* p, const std::size_t count)
+{
+  std::uint8_t buf[local::block_size];
+
+  for(std::size_t i = static_cast<std::size_t>(0U); i < count; )
+  {
+    const std::size_t n = (std::min)(count - i, static_cast<std::size_t>(local::block_size / 8U));
+
+    get_bytes(buf, n * 8U);
+
+    for(std::size_t j = static_cast<std::size_t>(0U); j < n; ++j)
+    {
+      p[i + j] = local::unpack<std::uint64_t>(buf + (j * 8U));
+    }
+
+    i += n;
+  }
+}
+
+std::uint32_t ef::binary_reader::checksum() const
+{
+  return local::adler_value(my_sum_a, my_sum_b);
+}
+
+bool local::write_binary_range(std::ostream& os, const e_float* p, const std::size_t count)
+{
+  static_cast<void>(os.write(local::binary_magic, static_cast<std::streamsize>(sizeof(local::binary_magic))));
+
+  ef::binary_writer wr(os);
+
+  wr.put_u16(local::binary_version);
+  wr.put_u08(local::binary_backend);
+  wr.put_u08(static_cast<std::uint8_t>(0U));
+  wr.put_u64(static_cast<std::uint64_t>(count));
+
+  for(std::size_t i = static_cast<std::size_t>(0U); i < count; ++i)
+  {
+    p[i].wr_binary(wr);
+  }
+
+  // Append the checksum of everything written so far.
+  const std::uint32_t the_checksum = wr.checksum();
+
+  wr.put_u32(the_checksum);
+
+  return wr.good();
+}
+
+bool local::read_binary_header(std::istream& is, ef::binary_reader& rd, std::uint64_t& count)
+{
+  char magic[sizeof(local::binary_magic)];
+
+  static_cast<void>(is.read(magic, static_cast<std::streamsize>(sizeof(magic))));
+
+  if((!is.good()) || (!std::equal(magic, magic + sizeof(magic), local::binary_magic)))
+  {
+    return false;
+  }
+
+  const std::uint16_t version  = rd.get_u16();
+  const std::uint8_t  backend  = rd.get_u08();
+  const std::uint8_t  reserved = rd.get_u08();
+
+  count = rd.get_u64();
+
+  return (   rd.good()
+          && (version  == local::binary_version)
+          && (backend  == local::binary_backend)
+          && (reserved == static_cast<std::uint8_t>(0U)));
+}
+
+bool local::read_binary_footer(ef::binary_reader& rd)
+{
+  // Verify the checksum of everything read so far.
+  const std::uint32_t the_checksum = rd.checksum();
+
+  return ((rd.get_u32() == the_checksum) && rd.good());
+}
+
+bool ef::write_binary(std::ostream& os, const e_float& x)
+{
+  return local::write_binary_range(os, &x, static_cast<std::size_t>(1U));
+}
+
+bool ef::read_binary(std::istream& is, e_float& x)
+{
+  ef::binary_reader rd(is);
+
+  std::uint64_t count;
+
+  if(!local::read_binary_header(is, rd, count) || (count != static_cast<std::uint64_t>(1U)))
+  {
+    return false;
+  }
+
+  e_float val;
+
+  if(!val.rd_binary(rd) || !local::read_binary_footer(rd))
+  {
+    return false;
+  }
+
+  x = static_cast<e_float&&>(val);
+
+  return true;
+}
+
+bool ef::write_binary(std::ostream& os, const std::vector<e_float>& v)
+{
+  return local::write_binary_range(os, v.data(), v.size());
+}
+
+bool ef::read_binary(std::istream& is, std::vector<e_float>& v)
+{
+  v.clear();
+
+  ef::binary_reader rd(is);
+
+  std::uint64_t count;
+
+  if(!local::read_binary_header(is, rd, count))
+  {
+    return false;
+  }
+
+  // Do not trust the count for pre-allocation, since the stream might be corrupt.
+  v.reserve(static_cast<std::size_t>((std::min)(count, static_cast<std::uint64_t>(1024U))));
+
+  for(std::uint64_t i = static_cast<std::uint64_t>(0U); i < count; ++i)
+  {
+    e_float val;
+
+    if(!val.rd_binary(rd))
+    {
+      v.clear();
+
+      return false;
+    }
+
+    v.push_back(static_cast<e_float&&>(val));
+  }
+
+  if(!local::read_binary_footer(rd))
+  {
+    v.clear();
+
+    return false;
+  }
+
+  return true;
+}
@@ -0,0 +1,99 @@
+//          Copyright Christopher Kormanyos 1999 - 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+// This work is based on an earlier work:
+// "Algorithm 910: A Portable C++ Multiple-Precision System for Special-Function Calculations",
+// in ACM TOMS, {VOL 37, ISSUE 4, (February 2011)} (C) ACM, 2011. http://doi.acm.org/10.1145/1916461.1916469
+
+#ifndef E_FLOAT_SERIALIZE_2021_07_10_H_
+  #define E_FLOAT_SERIALIZE_2021_07_10_H_
+
+  #include <cstddef>
+  #include <cstdint>
+  #include <iostream>
+  #include <vector>
+
+  #include <e_float/e_float.h>
+  #include <utility/util_noncopyable.h>
+
+  // Binary serialization of e_float values and arrays of e_float values.
+  // The stream layout (all integers little-endian) is:
+  //   magic "efbn", u16 version, u8 backend, u8 reserved, u64 count,
+  //   count values in the backend-specific layout, u32 Adler-32 checksum.
+  // The checksum covers all bytes following the magic characters.
+  // The backend-specific value layout begins with u8 class and u8 sign,
+  // followed by the exponent, precision and raw limbs of the MP type.
+  // The limbs are written and read as one block per value, and the
+  // checksum is updated once per block.
+
+  namespace ef
+  {
+    class binary_writer : private util::noncopyable
+    {
+    public:
+      explicit binary_writer(std::ostream& os);
+
+      void put_u08(const std::uint8_t  u);
+      void put_u16(const std::uint16_t u);
+      void put_u32(const std::uint32_t u);
+      void put_u64(const std::uint64_t u);
+
+      void put_i32(const std::int32_t n) { put_u32(static_cast<std::uint32_t>(n)); }
+      void put_i64(const std::int64_t n) { put_u64(static_cast<std::uint64_t>(n)); }
+
+      void put_u32_range(const std::uint32_t* p, const std::size_t count);
+      void put_u64_range(const std::uint64_t* p, const std::size_t count);
+
+      std::uint32_t checksum() const;
+
+      bool good() const { return my_os.good(); }
+
+    private:
+      std::ostream& my_os;
+      std::uint32_t my_sum_a;
+      std::uint32_t my_sum_b;
+      std::size_t   my_sum_pending;
+
+      void put_bytes(const std::uint8_t* p, const std::size_t count);
+    };
+
+    class binary_reader : private util::noncopyable
+    {
+    public:
+      explicit binary_reader(std::istream& is);
+
+      std::uint8_t  get_u08();
+      std::uint16_t get_u16();
+      std::uint32_t get_u32();
+      std::uint64_t get_u64();
+
+      std::int32_t get_i32() { return static_cast<std::int32_t>(get_u32()); }
+      std::int64_t get_i64() { return static_cast<std::int64_t>(get_u64()); }
+
+      // Read count values into p. Values past the end of the stream are zero.
+      void get_u32_range(std::uint32_t* p, const std::size_t count);
+      void get_u64_range(std::uint64_t* p, const std::size_t count);
+
+      std::uint32_t checksum() const;
+
+      bool good() const { return my_is.good(); }
+
+    private:
+      std::istream& my_is;
+      std::uint32_t my_sum_a;
+      std::uint32_t my_sum_b;
+      std::size_t   my_sum_pending;
+
+      void get_bytes(std::uint8_t* p, const std::size_t count);
+    };
+
+    bool write_binary(std::ostream& os, const e_float& x);
+    bool read_binary (std::istream& is,       e_float& x);
+
+    bool write_binary(std::ostream& os, const std::vector<e_float>& v);
+    bool read_binary (std::istream& is,       std::vector<e_float>& v);
+  }
+
+#endif // E_FLOAT_SERIALIZE_2021_07_10_H_
@@ -20,9 +20,12 @@
 // *****************************************************************************
 
 #include <cmath>
+#include <cstring>
 #include <iomanip>
+#include <utility>
 
 #include <e_float/e_float_functions.h>
+#include <e_float/e_float_serialize.h>
 #include <e_float/detail/e_float_detail_karatsuba.h>
 #include <e_float/detail/e_float_detail_fft.h>
 
@@ -106,7 +109,7 @@ efx::e_float::e_float(const std::string& str) : my_data     (),
                                                 my_fpclass  (ef_finite),
                                                 my_prec_elem(ef_elem_number)
 {
-  if(!rd_string(str.c_str()))
+  if(!rd_chars(str.data(), str.length()))
   {
     std::fill(my_data.begin(), my_data.end(), static_cast<array_type::value_type>(0U));
 
@@ -116,6 +119,38 @@ efx::e_float::e_float(const std::string& str) : my_data     (),
   }
 }
 
+efx::e_float::e_float(const char* const s, const std::size_t len) : my_data     (),
+                                                                    my_exp      (static_cast<std::int64_t>(0)),
+                                                                    my_neg      (false),
+                                                                    my_fpclass  (ef_finite),
+                                                                    my_prec_elem(ef_elem_number)
+{
+  if(!rd_chars(s, len))
+  {
+    std::fill(my_data.begin(), my_data.end(), static_cast<array_type::value_type>(0U));
+
+    my_exp     = static_cast<std::int64_t>(0);
+    my_neg     = false;
+    my_fpclass = ef_NaN;
+  }
+}
+
+efx::e_float::e_float(const std::uint32_t* const limb_values,
+                      const std::size_t limb_count,
+                      const std::int64_t e,
+                      const bool is_neg) : my_data     (),
+                                           my_exp      (e),
+                                           my_neg      (is_neg),
+                                           my_fpclass  (ef_finite),
+                                           my_prec_elem(ef_elem_number)
+{
+  // The limbs have the same base as the data elements. Copy the
+  // leading limbs and truncate the ones beyond the precision.
+  std::copy(limb_values,
+            limb_values + (std::min)(limb_count, static_cast<std::size_t>(ef_elem_number)),
+            my_data.begin());
+}
+
 void efx::e_float::from_unsigned_long_long(const unsigned long long u)
 {
   std::fill(my_data.begin(), my_data.end(), static_cast<array_type::value_type>(0U));
@@ -238,8 +273,13 @@ void efx::e_float::mul_loop_fft(std::uint32_t* const u, const std::uint32_t* con
   n_fft <<= 1U;
 
   // Allocate dynamic memory for the FFT result arrays.
-  double* af = new double[n_fft];
-  double* bf = new double[n_fft];
+  // These use the same (possibly memory-mapped) storage as the limbs.
+  using fft_allocator_type = std::allocator_traits<allocator_type>::rebind_alloc<double>;
+
+  fft_allocator_type fft_alloc;
+
+  double* af = std::allocator_traits<fft_allocator_type>::allocate(fft_alloc, n_fft);
+  double* bf = std::allocator_traits<fft_allocator_type>::allocate(fft_alloc, n_fft);
 
   for(std::uint32_t i = static_cast<std::uint32_t>(0U); i < static_cast<std::uint32_t>(p); ++i)
   {
@@ -294,6 +334,10 @@ void efx::e_float::mul_loop_fft(std::uint32_t* const u, const std::uint32_t* con
     af[j + 1U] = (tmp_aj * bf[j + 1U]) + (af[j + 1U] * bf[j + 0U]);
   }
 
+  // The transform of b is no longer needed. Release it before
+  // the reverse FFT in order to reduce the peak storage.
+  std::allocator_traits<fft_allocator_type>::deallocate(fft_alloc, bf, n_fft);
+
   // Perform the reverse FFT on the result of the convolution.
   switch(n_fft)
   {
@@ -342,9 +386,8 @@ void efx::e_float::mul_loop_fft(std::uint32_t* const u, const std::uint32_t* con
     u[(j / 2U)] = static_cast<std::uint32_t>(static_cast<std::uint32_t>(nhi * static_cast<std::uint32_t>(10000U)) + nlo);
   }
 
-  // De-allocate the dynamic memory for the FFT result arrays.
-  delete [] af;
-  delete [] bf;
+  // De-allocate the dynamic memory for the FFT result array.
+  std::allocator_traits<fft_allocator_type>::deallocate(fft_alloc, af, n_fft);
 }
 
 std::uint32_t efx::e_float::mul_loop_n(std::uint32_t* const u, std::uint32_t n, const std::int32_t p)
@@ -401,13 +444,11 @@ e_float& efx::e_float::operator=(const e_float& v)
 }
 
 // Move assignment operator.
-e_float& efx::e_float::operator=(e_float&& other)
+e_float& efx::e_float::operator=(e_float&& other) noexcept
 {
-  my_data      = static_cast<array_type&&>(other.my_data);
-  my_exp       = other.my_exp;
-  my_neg       = other.my_neg;
-  my_fpclass   = other.my_fpclass;
-  my_prec_elem = other.my_prec_elem;
+  // Exchange the limb arrays. The previous limbs of *this
+  // are released when the other value is destroyed.
+  swap(other);
 
   return *this;
 }
@@ -983,15 +1024,17 @@ efx::e_float& efx::e_float::div_unsigned_long_long(const unsigned long long n)
   return *this; 
 }
 
-void efx::e_float::swap(e_float& other)
+void efx::e_float::swap(e_float& other) noexcept
 {
   if(this != &other)
   {
-    const e_float tmp_value_this(*this);
+    // Exchange the pointers to the limb arrays, not the limbs themselves.
+    my_data.swap(other.my_data);
 
-    *this = other;
-
-    other = tmp_value_this;
+    std::swap(my_exp,       other.my_exp);
+    std::swap(my_neg,       other.my_neg);
+    std::swap(my_fpclass,   other.my_fpclass);
+    std::swap(my_prec_elem, other.my_prec_elem);
   }
 }
 
@@ -1046,7 +1089,8 @@ efx::e_float& efx::e_float::calculate_inv()
 
   // Compute the inverse of *this. Quadratically convergent Newton-Raphson iteration
   // is used. During the iterative steps, the precision of the calculation is limited
-  // to the minimum required in order to minimize the run-time.
+  // to the minimum required in order to minimize the run-time. The iteration stops
+  // at the precision of *this, which may be less than the full precision.
 
   static const auto double_digits10_minus_a_few =
     static_cast<std::int32_t>
@@ -1054,8 +1098,11 @@ efx::e_float& efx::e_float::calculate_inv()
       static_cast<std::int32_t>(std::numeric_limits<double>::digits10) - static_cast<std::int32_t>(3)
     );
 
+  const auto digits_limit = ((original_prec_elem < ef_elem_number) ? static_cast<std::int32_t>(original_prec_elem * ef_elem_digits10)
+                                                                   : static_cast<std::int32_t>(ef::tolerance()));
+
   for(auto digits  = double_digits10_minus_a_few;
-           digits <= static_cast<std::int32_t>(ef::tolerance());
+           digits <= digits_limit;
            digits *= static_cast<std::int32_t>(2))
   {
     // Adjust precision of the terms.
@@ -1134,8 +1181,11 @@ efx::e_float& efx::e_float::calculate_sqrt()
       static_cast<std::int32_t>(std::numeric_limits<double>::digits10) - static_cast<std::int32_t>(3)
     );
 
+  const auto digits_limit = ((original_prec_elem < ef_elem_number) ? static_cast<std::int32_t>(original_prec_elem * ef_elem_digits10)
+                                                                   : static_cast<std::int32_t>(ef::tolerance()));
+
   for(auto digits  = double_digits10_minus_a_few;
-           digits <= static_cast<std::int32_t>(ef::tolerance());
+           digits <= digits_limit;
            digits *= static_cast<std::int32_t>(2))
   {
     // Adjust precision of the terms.
@@ -1739,301 +1789,381 @@ std::int64_t efx::e_float::get_order_fast() const
   }
 }
 
-void efx::e_float::get_output_string(std::string& str, std::int64_t& the_exp, const std::size_t number_of_digits) const
+std::size_t efx::e_float::get_output_chars(char* const p_digits, const std::size_t number_of_digits, std::int64_t& the_exp) const
 {
+  // Write the rounded decimal digits of e_float directly into the character
+  // buffer p_digits, which must have room for number_of_digits characters.
+  // The number of digits actually written is returned.
+
   // Determine the number of elements needed to provide the requested digits from e_float.
   const std::size_t number_of_elements = (std::min)(static_cast<std::size_t>((number_of_digits / static_cast<std::size_t>(ef_elem_digits10)) + 2U),
                                                     static_cast<std::size_t>(ef_elem_number));
 
-  // Extract the remaining digits from e_float after the decimal point.
-  str = Util::lexical_cast(my_data[0]);
+  // The first element is written without leading zeros, each one of the
+  // following elements has exactly ef_elem_digits10 digits.
+  std::size_t first_digits = static_cast<std::size_t>(1U);
 
-  // Extract all of the digits from e_float, beginning with the first data element.
-  for(std::size_t i = static_cast<std::size_t>(1U); i < number_of_elements; i++)
+  for(std::uint32_t p10 = static_cast<std::uint32_t>(10U); (first_digits < static_cast<std::size_t>(ef_elem_digits10)) && (my_data[0U] >= p10); p10 *= 10U)
   {
-    std::stringstream ss;
+    ++first_digits;
+  }
+
+  const std::size_t total_digits = static_cast<std::size_t>(first_digits + ((number_of_elements - 1U) * static_cast<std::size_t>(ef_elem_digits10)));
+  const std::size_t count        = (std::min)(total_digits, number_of_digits);
+
+  // Obtain the n'th decimal digit of the (unrounded) output.
+  const auto digit_at =
+    [this, &first_digits](const std::size_t n) -> std::uint32_t
+    {
+      std::size_t   elem_index;
+      std::uint32_t elem_value;
+      std::size_t   digit_pos;
+      std::size_t   digit_cnt;
+
+      if(n < first_digits)
+      {
+        elem_index = static_cast<std::size_t>(0U);
+        digit_pos  = n;
+        digit_cnt  = first_digits;
+      }
+      else
+      {
+        elem_index = static_cast<std::size_t>(1U + ((n - first_digits) / static_cast<std::size_t>(ef_elem_digits10)));
+        digit_pos  = static_cast<std::size_t>((n - first_digits) % static_cast<std::size_t>(ef_elem_digits10));
+        digit_cnt  = static_cast<std::size_t>(ef_elem_digits10);
+      }
+
+      elem_value = my_data[static_cast<array_type::size_type>(elem_index)];
+
+      for(std::size_t j = static_cast<std::size_t>(digit_pos + 1U); j < digit_cnt; ++j)
+      {
+        elem_value /= 10U;
+      }
+
+      return static_cast<std::uint32_t>(elem_value % 10U);
+    };
+
+  // Write the digits element-by-element, from the back of each element to its front.
+  std::size_t out_pos = static_cast<std::size_t>(0U);
+
+  for(std::size_t i = static_cast<std::size_t>(0U); (i < number_of_elements) && (out_pos < count); ++i)
+  {
+    const std::size_t elem_digits = ((i == static_cast<std::size_t>(0U)) ? first_digits : static_cast<std::size_t>(ef_elem_digits10));
+    const std::size_t n_write     = (std::min)(elem_digits, static_cast<std::size_t>(count - out_pos));
+
+    std::uint32_t elem_value = my_data[static_cast<array_type::size_type>(i)];
+
+    // Discard the low digits of the element which are not written.
+    for(std::size_t j = n_write; j < elem_digits; ++j)
+    {
+      elem_value /= 10U;
+    }
+
+    for(std::size_t j = n_write; j > static_cast<std::size_t>(0U); --j)
+    {
+      p_digits[(out_pos + j) - 1U] = static_cast<char>(static_cast<std::uint32_t>('0') + (elem_value % 10U));
 
-    ss << std::setw(static_cast<std::streamsize>(ef_elem_digits10))
-       << std::setfill(static_cast<char>('0'))
-       << my_data[(typename array_type::size_type) i];
+      elem_value /= 10U;
+    }
 
-    str += ss.str();
+    out_pos += n_write;
   }
 
-  // Cut the output to the size of the precision.
-  if(str.length() > number_of_digits)
+  // Round the output to the size of the precision.
+  if((total_digits > number_of_digits) && (number_of_digits > static_cast<std::size_t>(0U)))
   {
     // Get the digit after the last needed digit for rounding
-    const std::uint32_t round = static_cast<std::uint32_t>(static_cast<std::uint32_t>(str.at(number_of_digits)) - static_cast<std::uint32_t>('0'));
-
-    // Truncate the string
-    str = str.substr(static_cast<std::size_t>(0U), number_of_digits);
+    const std::uint32_t round = digit_at(number_of_digits);
 
     if(round >= static_cast<std::uint32_t>(5U))
     {
-      std::size_t ix = static_cast<std::size_t>(str.length() - 1U);
+      std::size_t ix = static_cast<std::size_t>(number_of_digits - 1U);
 
       // Every trailing 9 must be rounded up
-      while(ix && (static_cast<std::int32_t>(str.at(ix)) - static_cast<std::int32_t>('0') == static_cast<std::int32_t>(9)))
+      while(ix && (p_digits[ix] == static_cast<char>('9')))
       {
-        str.at(ix) = static_cast<char>('0');
+        p_digits[ix] = static_cast<char>('0');
         --ix;
       }
 
       if(!ix)
       {
         // There were nothing but trailing nines.
-        if(static_cast<std::int32_t>(static_cast<std::int32_t>(str.at(ix)) - static_cast<std::int32_t>(0x30)) == static_cast<std::int32_t>(9))
+        if(p_digits[ix] == static_cast<char>('9'))
         {
           // Increment up to the next order and adjust exponent.
-          str.at(ix) = static_cast<char>('1');
+          p_digits[ix] = static_cast<char>('1');
           ++the_exp;
         }
         else
         {
           // Round up this digit.
-          ++str.at(ix);
+          ++p_digits[ix];
         }
       }
       else
       {
         // Round up the last digit.
-        ++str[ix];
+        ++p_digits[ix];
       }
     }
   }
+
+  return count;
 }
 
-bool efx::e_float::rd_string(const char* const s)
+std::size_t efx::e_float::get_output_digits(char* const p_digits, const std::size_t first_digit, const std::size_t count) const
 {
-  std::string str(s);
+  // Write the raw decimal digits [first_digit, first_digit + count) of e_float
+  // into p_digits. The first element is taken without leading zeros, each one
+  // of the following elements has exactly ef_elem_digits10 digits.
+  std::size_t first_digits = static_cast<std::size_t>(1U);
 
-  // Get a possible exponent and remove it.
-  my_exp = static_cast<std::int64_t>(0);
+  for(std::uint32_t p10 = static_cast<std::uint32_t>(10U); (first_digits < static_cast<std::size_t>(ef_elem_digits10)) && (my_data[0U] >= p10); p10 *= 10U)
+  {
+    ++first_digits;
+  }
 
-  std::size_t pos;
+  const std::size_t total_digits = static_cast<std::size_t>(first_digits + (static_cast<std::size_t>(ef_elem_number - 1) * static_cast<std::size_t>(ef_elem_digits10)));
 
-  if(   ((pos = str.find('e')) != std::string::npos)
-     || ((pos = str.find('E')) != std::string::npos)
-    )
+  if(first_digit >= total_digits)
   {
-    // Remove the exponent part from the string.
-    my_exp = Util::numeric_cast<std::int64_t>(static_cast<const char*>(str.c_str() + (pos + 1U)));
-
-    str = str.substr(static_cast<std::size_t>(0U), pos);
+    return static_cast<std::size_t>(0U);
   }
 
-  // Get a possible +/- sign and remove it.
-  my_neg = false;
+  const std::size_t n = (std::min)(count, static_cast<std::size_t>(total_digits - first_digit));
 
-  if((pos = str.find(static_cast<char>('-'))) != std::string::npos)
-  {
-    my_neg = true;
+  // Locate the element and the digit position within it.
+  std::size_t elem_index;
+  std::size_t digit_pos;
 
-    str.erase(pos, static_cast<std::size_t>(1U));
+  if(first_digit < first_digits)
+  {
+    elem_index = static_cast<std::size_t>(0U);
+    digit_pos  = static_cast<std::size_t>(first_digit + (static_cast<std::size_t>(ef_elem_digits10) - first_digits));
   }
-
-  if((pos = str.find(static_cast<char>('+'))) != std::string::npos)
+  else
   {
-    str.erase(pos, static_cast<std::size_t>(1U));
+    elem_index = static_cast<std::size_t>(1U + ((first_digit - first_digits) / static_cast<std::size_t>(ef_elem_digits10)));
+    digit_pos  = static_cast<std::size_t>((first_digit - first_digits) % static_cast<std::size_t>(ef_elem_digits10));
   }
 
-  // Remove leading zeros for all input types.
-  const std::string::const_iterator fwd_it_leading_zero =
-    std::find_if(str.cbegin(),
-                 str.cend(),
-                 [](const char& c) -> bool
-                 {
-                   return (c != static_cast<char>('0'));
-                 });
+  // Write the digits, handling each element as ef_elem_digits10 zero-padded digits.
+  char elem_digits[static_cast<std::size_t>(ef_elem_digits10)];
 
-  if(fwd_it_leading_zero != str.cbegin())
+  std::size_t out_pos = static_cast<std::size_t>(0U);
+
+  while(out_pos < n)
   {
-    if(fwd_it_leading_zero == str.cend())
-    {
-      // The string contains nothing but leading zeros.
-      // This string represents zero.
-      operator=(ef::zero());
+    std::uint32_t elem_value = my_data[static_cast<array_type::size_type>(elem_index)];
 
-      return true;
-    }
-    else
+    for(std::size_t j = static_cast<std::size_t>(ef_elem_digits10); j > static_cast<std::size_t>(0U); --j)
     {
-      str.erase(str.cbegin(), fwd_it_leading_zero);
+      elem_digits[j - 1U] = static_cast<char>(static_cast<std::uint32_t>('0') + (elem_value % 10U));
+
+      elem_value /= 10U;
     }
+
+    const std::size_t n_copy = (std::min)(static_cast<std::size_t>(static_cast<std::size_t>(ef_elem_digits10) - digit_pos),
+                                          static_cast<std::size_t>(n - out_pos));
+
+    std::copy(elem_digits + digit_pos, elem_digits + (digit_pos + n_copy), p_digits + out_pos);
+
+    out_pos += n_copy;
+
+    ++elem_index;
+    digit_pos = static_cast<std::size_t>(0U);
   }
 
-  // Put the input string into the standard e_float input form
-  // aaa.bbbbE+/-n, where aa has 1...ef_elem_digits10, bbbb has an
-  // even multiple of ef_elem_digits10 which are possibly zero padded
-  // on the right-end, and n is a signed 32-bit integer which is an
-  // even multiple of ef_elem_digits10.
+  return n;
+}
 
-  // Find a possible decimal point.
-  pos = str.find(static_cast<char>('.'));
+void efx::e_float::get_output_string(std::string& str, std::int64_t& the_exp, const std::size_t number_of_digits) const
+{
+  // Preallocate the output string and write the digits directly into it.
+  const std::size_t max_digits = (std::min)(number_of_digits,
+                                            static_cast<std::size_t>(static_cast<std::size_t>(ef_elem_number) * static_cast<std::size_t>(ef_elem_digits10)));
 
-  if(pos != std::string::npos)
-  {
-    // Remove all trailing insignificant zeros.
-    const std::string::const_reverse_iterator rit_non_zero =
-      std::find_if(str.crbegin(),
-                   str.crend(),
-                   [](const char& c) -> bool
-                   {
-                     return (c != static_cast<char>('0'));
-                   });
+  str.resize(max_digits);
 
-    if(rit_non_zero != str.crbegin())
-    {
-      const std::string::difference_type ofs =   static_cast<std::string::difference_type>(str.length())
-                                               - std::distance<std::string::const_reverse_iterator>(str.crbegin(), rit_non_zero);
+  const std::size_t count = ((max_digits > static_cast<std::size_t>(0U)) ? get_output_chars(&str[0U], number_of_digits, the_exp)
+                                                                         : static_cast<std::size_t>(0U));
 
-      str.erase(str.cbegin() + ofs, str.cend());
-    }
+  str.resize(count);
+}
 
-    // Check if the input is identically zero.
-    if(str == std::string("."))
-    {
-      operator=(ef::zero());
-      return true;
-    }
+bool efx::e_float::rd_string(const char* const s)
+{
+  return rd_chars(s, std::strlen(s));
+}
 
-    // Remove leading significant zeros just after the decimal point
-    // and adjust the exponent accordingly.
-    // Note that the while-loop operates only on strings of the form ".000abcd..."
-    // and peels away the zeros just after the decimal point.
-    if(str.at(static_cast<std::size_t>(0U)) == static_cast<char>('.'))
-    {
-      const std::string::const_iterator it_non_zero =
-        std::find_if(str.cbegin() + 1U,
-                     str.cend(),
-                     [](const char& c) -> bool
-                     {
-                       return (c != static_cast<char>('0'));
-                     });
+bool efx::e_float::rd_chars(const char* const s, const std::size_t len)
+{
+  // Parse the input string in a single pass over its characters,
+  // with the general form [+/-]aaa.bbb[e/E[+/-]nnn]. The significant
+  // digits are written directly into the data elements.
 
-      std::size_t delta_exp = static_cast<std::size_t>(0U);
+  const char* p     = s;
+  const char* p_end = s + len;
 
-      if(str.at(static_cast<std::size_t>(1U)) == static_cast<char>('0'))
-      {
-        delta_exp = static_cast<std::size_t>(it_non_zero - (str.cbegin() + 1U));
-      }
+  const auto is_space = [](const char c) -> bool { return ((c == static_cast<char>(' ')) || (c == static_cast<char>('\t'))); };
+  const auto is_digit = [](const char c) -> bool { return ((c >= static_cast<char>('0')) && (c <= static_cast<char>('9'))); };
 
-      // Bring one single digit into the mantissa and adjust exponent accordingly.
-      str.erase(str.cbegin(), it_non_zero);
+  // Skip leading and trailing spaces and tabs.
+  while((p     != p_end) && is_space(*p))            { ++p; }
+  while((p_end != p)     && is_space(*(p_end - 1U))) { --p_end; }
 
-      str.insert(static_cast<std::size_t>(1U), ".");
+  // Get a possible +/- sign.
+  my_neg = false;
 
-      my_exp -= static_cast<std::int64_t>(delta_exp + 1U);
-    }
-  }
-  else
+  if((p != p_end) && ((*p == static_cast<char>('-')) || (*p == static_cast<char>('+'))))
   {
-    // Input string has no decimal point: Append decimal point.
-    str.append(".");
+    my_neg = (*p == static_cast<char>('-'));
+
+    ++p;
   }
 
-  // Shift the decimal point such that the exponent is an even multiple of ef_elem_digits10.
-        std::ptrdiff_t n_shift   = static_cast<std::ptrdiff_t>(0);
-  const std::ptrdiff_t n_exp_rem = static_cast<std::ptrdiff_t>(my_exp % static_cast<std::int64_t>(ef_elem_digits10));
+  // Scan the mantissa. Find its first significant digit and its decimal point.
+  const char*  p_first_sig = nullptr;
+  const char*  p_point     = nullptr;
+  std::int64_t e10         = static_cast<std::int64_t>(-1);
+  bool         has_digits  = false;
 
-  if((my_exp % static_cast<std::int64_t>(ef_elem_digits10)) != static_cast<std::int64_t>(0))
+  for( ; p != p_end; ++p)
   {
-    n_shift = ((my_exp < static_cast<std::int64_t>(0))
-                ? static_cast<std::ptrdiff_t>(n_exp_rem + static_cast<std::ptrdiff_t>(ef_elem_digits10))
-                : static_cast<std::ptrdiff_t>(n_exp_rem));
+    if(is_digit(*p))
+    {
+      has_digits = true;
+
+      if((p_first_sig == nullptr) && (*p != static_cast<char>('0')))
+      {
+        p_first_sig = p;
+      }
+
+      // Count the integer digits starting at the first significant digit,
+      // and count the zeros after the decimal point preceding it.
+      if(p_point == nullptr)
+      {
+        if(p_first_sig != nullptr) { ++e10; }
+      }
+      else
+      {
+        if(p_first_sig == nullptr) { --e10; }
+      }
+    }
+    else if((*p == static_cast<char>('.')) && (p_point == nullptr))
+    {
+      p_point = p;
+    }
+    else
+    {
+      break;
+    }
   }
 
-  // Make sure that there are enough digits for the decimal point shift.
-  pos = str.find(static_cast<char>('.'));
+  const char* const p_mantissa_end = p;
 
-  std::ptrdiff_t pos_plus_one = static_cast<std::ptrdiff_t>(pos + 1);
+  // Get a possible exponent.
+  std::int64_t exp_part = static_cast<std::int64_t>(0);
 
-  if((static_cast<std::ptrdiff_t>(str.length()) - pos_plus_one) < n_shift)
+  if((p != p_end) && ((*p == static_cast<char>('e')) || (*p == static_cast<char>('E'))))
   {
-    const std::ptrdiff_t sz = static_cast<std::ptrdiff_t>(n_shift - (static_cast<std::ptrdiff_t>(str.length()) - pos_plus_one));
+    ++p;
 
-    str.append(std::string(static_cast<std::string::size_type>(sz), static_cast<char>('0')));
-  }
+    bool exp_is_neg = false;
 
-  // Do the decimal point shift.
-  if(n_shift != static_cast<std::ptrdiff_t>(0))
-  {
-    str.insert(static_cast<std::string::size_type>(pos_plus_one + n_shift), ".");
+    if((p != p_end) && ((*p == static_cast<char>('-')) || (*p == static_cast<char>('+'))))
+    {
+      exp_is_neg = (*p == static_cast<char>('-'));
 
-    str.erase(pos, static_cast<std::ptrdiff_t>(1U));
+      ++p;
+    }
 
-    my_exp -= static_cast<std::int64_t>(n_shift);
-  }
+    if((p == p_end) || (!is_digit(*p)))
+    {
+      return false;
+    }
 
-  // Cut the size of the mantissa to <= ef_elem_digits10.
-  pos          = str.find(static_cast<char>('.'));
-  pos_plus_one = static_cast<std::ptrdiff_t>(pos + 1U);
+    // Saturate very large exponents, which result in overflow or underflow anyway.
+    const std::int64_t exp_limit = static_cast<std::int64_t>(std::numeric_limits<std::int64_t>::max() / 20);
 
-  if(pos > static_cast<std::ptrdiff_t>(ef_elem_digits10))
-  {
-    const std::int32_t n_pos         = static_cast<std::int32_t>(pos);
-    const std::int32_t n_rem_is_zero = ((static_cast<std::int32_t>(n_pos % ef_elem_digits10) == static_cast<std::int32_t>(0)) ? static_cast<std::int32_t>(1) : static_cast<std::int32_t>(0));
-    const std::int32_t n             = static_cast<std::int32_t>(static_cast<std::int32_t>(n_pos / ef_elem_digits10) - n_rem_is_zero);
-    
-    str.insert(static_cast<std::size_t>(static_cast<std::int32_t>(n_pos - static_cast<std::int32_t>(n * ef_elem_digits10))), ".");
+    for( ; (p != p_end) && is_digit(*p); ++p)
+    {
+      if(exp_part < exp_limit)
+      {
+        exp_part = static_cast<std::int64_t>((exp_part * 10) + static_cast<std::int64_t>(*p - static_cast<char>('0')));
+      }
+    }
 
-    str.erase(static_cast<std::string::size_type>(pos_plus_one), static_cast<std::size_t>(1U));
+    if(exp_is_neg) { exp_part = -exp_part; }
+  }
 
-    my_exp += static_cast<std::int64_t>(static_cast<std::int64_t>(n) * static_cast<std::int64_t>(ef_elem_digits10));
+  if((!has_digits) || (p != p_end))
+  {
+    return false;
   }
 
-  // Pad the decimal part such that its value is an even
-  // multiple of ef_elem_digits10.
-  pos          = str.find(static_cast<char>('.'));
-  pos_plus_one = static_cast<std::ptrdiff_t>(pos + 1);
+  // Set all the data elements to 0.
+  std::fill(my_data.begin(), my_data.end(), static_cast<array_type::value_type>(0));
 
-  const std::int32_t n_dec = static_cast<std::int32_t>(static_cast<std::int32_t>(str.length() - 1U) - static_cast<std::int32_t>(pos));
-  const std::int32_t n_rem = static_cast<std::int32_t>(n_dec % ef_elem_digits10);
-        std::int32_t n_cnt = ((n_rem != static_cast<std::int32_t>(0)) ? static_cast<std::int32_t>(ef_elem_digits10 - n_rem)
-                                                        : static_cast<std::int32_t>(0));
+  my_fpclass = ef_finite;
 
-  if(n_cnt != static_cast<std::int32_t>(0))
+  if(p_first_sig == nullptr)
   {
-    str.append(static_cast<std::string::size_type>(n_cnt), static_cast<char>('0'));
+    // The string contains nothing but zeros.
+    // This string represents zero.
+    operator=(ef::zero());
+
+    return true;
   }
 
-  // Truncate decimal part if it is too long.
-  const std::ptrdiff_t max_dec = static_cast<std::ptrdiff_t>((ef_elem_number - 1) * ef_elem_digits10);
+  // The value is now d.ddd * 10^(e10 + exp_part). Align the exponent of the first
+  // data element to an even multiple of ef_elem_digits10, such that the first
+  // data element receives 1...ef_elem_digits10 digits.
+  const std::int64_t e10_total = static_cast<std::int64_t>(e10 + exp_part);
+  const std::int64_t e10_rem   = static_cast<std::int64_t>(e10_total % static_cast<std::int64_t>(ef_elem_digits10));
+  const std::int64_t e10_floor = static_cast<std::int64_t>(e10_total - ((e10_rem < 0) ? (e10_rem + static_cast<std::int64_t>(ef_elem_digits10)) : e10_rem));
 
-  if(static_cast<std::ptrdiff_t>(str.length() - pos) > max_dec)
-  {
-    str = str.substr(static_cast<std::string::size_type>(0),
-                     static_cast<std::string::size_type>(pos_plus_one + max_dec));
-  }
+  my_exp = e10_floor;
 
-  // Now the input string has the standard e_float input form.
-  // (See the comment above.)
+  std::int32_t elem_index  = static_cast<std::int32_t>(0);
+  std::int32_t elem_digits = static_cast<std::int32_t>((e10_total - e10_floor) + 1);
+  std::int32_t elem_count  = static_cast<std::int32_t>(0);
+  std::uint32_t elem_value = static_cast<std::uint32_t>(0U);
 
-  // Set all the data elements to 0.
-  std::fill(my_data.begin(), my_data.end(), static_cast<array_type::value_type>(0));
+  // Extract the data. Any digits beyond the last data element are truncated.
+  for(p = p_first_sig; (p != p_mantissa_end) && (elem_index < static_cast<std::int32_t>(ef_elem_number)); ++p)
+  {
+    if(p == p_point)
+    {
+      continue;
+    }
 
-  // Extract the data.
+    elem_value = static_cast<std::uint32_t>((elem_value * 10U) + static_cast<std::uint32_t>(*p - static_cast<char>('0')));
 
-  // First get the digits to the left of the decimal point...
-  my_data[static_cast<array_type::size_type>(0U)] =
-    Util::numeric_cast<array_type::value_type>(str.substr(static_cast<std::ptrdiff_t>(0), pos));
+    ++elem_count;
 
-  // ...then get the remaining digits to the right of the decimal point.
-  const std::string::difference_type i_end = ((static_cast<std::string::difference_type>(str.length()) - pos_plus_one) / static_cast<std::string::difference_type>(ef_elem_digits10));
+    if(elem_count == elem_digits)
+    {
+      my_data[static_cast<array_type::size_type>(elem_index)] = elem_value;
 
-  for(std::string::difference_type i = static_cast<std::string::difference_type>(0); i < i_end; ++i)
-  {
-    const std::string::const_iterator it =   str.cbegin()
-                                           + static_cast<std::string::difference_type>(pos_plus_one)
-                                           + (i * static_cast<std::string::difference_type>(ef_elem_digits10));
+      ++elem_index;
 
-    const array_type::size_type i1 = static_cast<array_type::size_type>(i + 1);
+      elem_digits = static_cast<std::int32_t>(ef_elem_digits10);
+      elem_count  = static_cast<std::int32_t>(0);
+      elem_value  = static_cast<std::uint32_t>(0U);
+    }
+  }
 
-    const std::string str_i1(it,
-                             it + static_cast<std::string::difference_type>(ef_elem_digits10));
+  // Pad a partially filled data element with zeros on the right.
+  if((elem_count != static_cast<std::int32_t>(0)) && (elem_index < static_cast<std::int32_t>(ef_elem_number)))
+  {
+    for( ; elem_count < elem_digits; ++elem_count)
+    {
+      elem_value *= 10U;
+    }
 
-    my_data[i1] = Util::numeric_cast<array_type::value_type>(str_i1);
+    my_data[static_cast<array_type::size_type>(elem_index)] = elem_value;
   }
 
   // Check for overflow...
@@ -2068,3 +2198,61 @@ bool efx::e_float::rd_string(const char* const s)
 
   return true;
 }
+
+void efx::e_float::wr_binary(ef::binary_writer& wr) const
+{
+  // Layout: u8 class, u8 sign, i64 exponent, i32 precision (elements),
+  // u32 number of limbs, followed by the base-10^8 limbs as u32.
+  wr.put_u08(static_cast<std::uint8_t>(my_fpclass));
+  wr.put_u08(static_cast<std::uint8_t>(my_neg ? 1U : 0U));
+  wr.put_i64(my_exp);
+  wr.put_i32(my_prec_elem);
+  wr.put_u32(static_cast<std::uint32_t>(ef_elem_number));
+  wr.put_u32_range(my_data.data(), static_cast<std::size_t>(ef_elem_number));
+}
+
+bool efx::e_float::rd_binary(ef::binary_reader& rd)
+{
+  const std::uint8_t  fpc   = rd.get_u08();
+  const std::uint8_t  sign  = rd.get_u08();
+  const std::int64_t  ex    = rd.get_i64();
+  const std::int32_t  prec  = rd.get_i32();
+  const std::uint32_t count = rd.get_u32();
+
+  if(   (fpc  > static_cast<std::uint8_t>(ef_NaN))
+     || (sign > static_cast<std::uint8_t>(1U))
+     || (prec < static_cast<std::int32_t>(1)))
+  {
+    return false;
+  }
+
+  // Limbs beyond the precision of this build are truncated,
+  // missing limbs are zero.
+  const std::size_t n_keep = (std::min)(static_cast<std::size_t>(count), static_cast<std::size_t>(ef_elem_number));
+
+  rd.get_u32_range(my_data.data(), n_keep);
+
+  std::fill(my_data.begin() + static_cast<std::ptrdiff_t>(n_keep),
+            my_data.end(),
+            static_cast<array_type::value_type>(0U));
+
+  for(std::size_t i = n_keep; (i < static_cast<std::size_t>(count)) && rd.good(); ++i)
+  {
+    static_cast<void>(rd.get_u32());
+  }
+
+  const bool limbs_are_valid =
+    std::all_of(my_data.cbegin(),
+                my_data.cend(),
+                [](const array_type::value_type limb) -> bool
+                {
+                  return (limb < static_cast<array_type::value_type>(ef_elem_mask));
+                });
+
+  my_fpclass   = static_cast<fpclass_type>(fpc);
+  my_neg       = (sign != static_cast<std::uint8_t>(0U));
+  my_exp       = ex;
+  my_prec_elem = (std::min)(prec, ef_elem_number);
+
+  return (limbs_are_valid && rd.good());
+}
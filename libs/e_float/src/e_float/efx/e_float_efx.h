@@ -22,6 +22,9 @@
 
   #include <e_float/e_float_base.h>
   #include <e_float/detail/e_float_detail_dynamic_array.h>
+  #if defined(E_FLOAT_EFX_MAPPED_STORAGE)
+  #include <utility/util_mapped_allocator.h>
+  #endif
 
   namespace efx
   {
@@ -81,10 +84,18 @@
 
       static constexpr std::int32_t ef_elem_mask = static_cast<std::int32_t>(100000000);
 
+      // Define E_FLOAT_EFX_MAPPED_STORAGE in order to back the limbs
+      // and the FFT buffers of large values with memory-mapped files.
+      #if defined(E_FLOAT_EFX_MAPPED_STORAGE)
+      using allocator_type = util::mapped_allocator<std::uint32_t>;
+      #else
+      using allocator_type = std::allocator<std::uint32_t>;
+      #endif
+
       using array_type =
         ef::detail::fixed_dynamic_array<std::uint32_t,
                                         static_cast<std::size_t>(ef_elem_number),
-                                        std::allocator<std::uint32_t>>;
+                                        allocator_type>;
 
       // Default constructor.
       e_float() noexcept : my_data     (),
@@ -141,6 +152,7 @@
       // Constructors from character representations.
       e_float(const char* const  s);
       e_float(const std::string& str);
+      e_float(const char* const  s, const std::size_t len);
 
       // Copy constructor.
       e_float(const e_float& f) : my_data     (f.my_data),
@@ -149,12 +161,12 @@
                                   my_fpclass  (f.my_fpclass),
                                   my_prec_elem(f.my_prec_elem) { }
 
-      // Move constructor.
-      e_float(e_float&& f) : my_data     (static_cast<array_type&&>(f.my_data)),
-                             my_exp      (f.my_exp),
-                             my_neg      (f.my_neg),
-                             my_fpclass  (f.my_fpclass),
-                             my_prec_elem(f.my_prec_elem) { }
+      // Move constructor. This takes over the limb array of f.
+      e_float(e_float&& f) noexcept : my_data     (static_cast<array_type&&>(f.my_data)),
+                                      my_exp      (f.my_exp),
+                                      my_neg      (f.my_neg),
+                                      my_fpclass  (f.my_fpclass),
+                                      my_prec_elem(f.my_prec_elem) { }
 
       // Constructor from mantissa and exponent.
       e_float(const double mantissa, const std::int64_t exponent);
@@ -175,6 +187,12 @@
           my_fpclass  (ef_finite),
           my_prec_elem(ef_elem_number) { }
 
+      // Construct from a range of base-10^8 integer limbs (most significant first), an exponent and sign.
+      e_float(const std::uint32_t* const limb_values,
+              const std::size_t limb_count,
+              const std::int64_t e,
+              const bool is_neg);
+
       virtual ~e_float() = default;
 
       virtual std::int32_t cmp(const e_float&) const;
@@ -183,13 +201,14 @@
       virtual const e_float& my_value_nan() const;
       virtual const e_float& my_value_inf() const;
 
-      virtual void precision(const std::int32_t prec_digits);
+      virtual void         precision(const std::int32_t prec_digits);
+      virtual std::int32_t precision() const { return static_cast<std::int32_t>(my_prec_elem * ef_elem_digits10); }
 
       // Assignment operator.
       virtual e_float& operator=(const e_float& v);
 
       // Move assignment operator.
-      e_float& operator=(e_float&& other);
+      e_float& operator=(e_float&& other) noexcept;
 
       // Binary arithmetic operators.
       virtual e_float& operator+=(const e_float&);
@@ -203,7 +222,7 @@
       virtual e_float& mul_unsigned_long_long(const unsigned long long);
       virtual e_float& div_unsigned_long_long(const unsigned long long);
 
-      void swap(e_float& other);
+      void swap(e_float& other) noexcept;
 
       // Elementary primitives.
       virtual e_float& calculate_inv ();
@@ -238,6 +257,16 @@
       virtual e_float            extract_integer_part      () const;
       virtual e_float            extract_decimal_part      () const;
 
+      // Binary I/O routines.
+      virtual void wr_binary(ef::binary_writer& wr) const;
+      virtual bool rd_binary(ef::binary_reader& rd);
+
+      // Character conversion with explicit lengths and without intermediate strings.
+      // The output writes up to number_of_digits rounded digits into p_digits
+      // and returns the number of digits written.
+      std::size_t get_output_chars(char* const p_digits, const std::size_t number_of_digits, std::int64_t& the_exp) const;
+      bool        rd_chars        (const char* const s, const std::size_t len);
+
     private:
       array_type   my_data;
       std::int64_t my_exp;
@@ -263,6 +292,9 @@
                                       const std::size_t number_of_digits) const;
 
       virtual bool rd_string(const char* const s);
+
+      virtual bool        i_have_my_own_output_digits() const noexcept { return true; }
+      virtual std::size_t get_output_digits(char* const p_digits, const std::size_t first_digit, const std::size_t count) const;
     };
   }
 
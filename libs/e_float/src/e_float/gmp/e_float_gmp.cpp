@@ -16,6 +16,7 @@
 #include <vector>
 
 #include <e_float/e_float_functions.h>
+#include <e_float/e_float_serialize.h>
 
 #include <utility/util_dynamic_array.h>
 #include <utility/util_lexical_cast.h>
@@ -101,6 +102,11 @@ gmp::e_float::e_float(const ::mpf_t& op) : my_rop      (),
 }
 
 gmp::e_float::e_float(std::initializer_list<std::uint32_t> limb_values,
+                      const std::int64_t e,
+                      const bool is_neg) : e_float(limb_values.begin(), limb_values.size(), e, is_neg) { }
+
+gmp::e_float::e_float(const std::uint32_t* const limb_values,
+                      const std::size_t limb_count,
                       const std::int64_t e,
                       const bool is_neg) : my_rop      (),
                                            my_fpclass  (ef_finite),
@@ -108,35 +114,41 @@ gmp::e_float::e_float(std::initializer_list<std::uint32_t> limb_values,
 {
   std::string str;
 
+  str.reserve(static_cast<std::size_t>((limb_count * 8U) + 32U));
+
   if(is_neg)
   {
     str.push_back('-');
   }
 
-  auto it = limb_values.begin();
-
-  if(limb_values.size() > 0U)
+  if(limb_count > 0U)
   {
     std::stringstream strm;
 
-    strm << *it;
-
-    ++it;
+    strm << limb_values[0U];
 
     str += strm.str();
   }
 
-  if(limb_values.size() > 1U)
+  if(limb_count > 1U)
   {
     str.push_back('.');
 
-    for( ; it != limb_values.end(); ++it)
+    // Write the fixed-width limbs directly into the string.
+    for(std::size_t i = static_cast<std::size_t>(1U); i < limb_count; ++i)
     {
-      std::stringstream strm;
+      char limb_chars[8U];
 
-      strm << std::setw(8) << std::setfill('0') << *it;
+      std::uint32_t v = limb_values[i];
 
-      str += strm.str();
+      for(std::size_t j = static_cast<std::size_t>(8U); j > static_cast<std::size_t>(0U); --j)
+      {
+        limb_chars[j - 1U] = static_cast<char>('0' + static_cast<char>(v % 10U));
+
+        v /= 10U;
+      }
+
+      str.append(limb_chars, static_cast<std::size_t>(8U));
     }
   }
 
@@ -616,6 +628,12 @@ e_float& gmp::e_float::operator=(const e_float& v)
 {
   if(this != &v)
   {
+    if(my_rop[0U]._mp_d == nullptr)
+    {
+      // Re-initialize the limbs of a moved-from value.
+      ::mpf_init(my_rop);
+    }
+
     my_fpclass   = v.my_fpclass;
     my_prec_elem = v.my_prec_elem;
 
@@ -627,13 +645,11 @@ e_float& gmp::e_float::operator=(const e_float& v)
 }
 
 // Move assignment operator.
-e_float& gmp::e_float::operator=(e_float&& v)
+e_float& gmp::e_float::operator=(e_float&& v) noexcept
 {
-  my_fpclass   = v.my_fpclass;
-  my_prec_elem = v.my_prec_elem;
-
-  ::mpf_set         (my_rop, v.my_rop);
-  ::mpf_set_prec_raw(my_rop, static_cast<unsigned long>(static_cast<std::uint64_t>(static_cast<double>(my_prec_elem) / local::value_log2)));
+  // Exchange the limbs. The previous limbs of *this
+  // are cleared when v is destroyed.
+  swap(v);
 
   return *this;
 }
@@ -1051,3 +1067,70 @@ bool gmp::e_float::rd_string(const char* const s)
 
   return (n_set_result == static_cast<std::int32_t>(0));
 }
+
+void gmp::e_float::wr_binary(ef::binary_writer& wr) const
+{
+  // Layout: u8 class, u8 sign, i64 exponent (limbs), i32 precision (digits),
+  // u32 number of limbs, followed by the limbs as u64, least significant first.
+  const std::uint32_t count = static_cast<std::uint32_t>((my_rop[0U]._mp_size < 0) ? -my_rop[0U]._mp_size : my_rop[0U]._mp_size);
+
+  wr.put_u08(static_cast<std::uint8_t>(my_fpclass));
+  wr.put_u08(static_cast<std::uint8_t>((my_rop[0U]._mp_size < 0) ? 1U : 0U));
+  wr.put_i64(static_cast<std::int64_t>(my_rop[0U]._mp_exp));
+  wr.put_i32(my_prec_elem);
+  wr.put_u32(count);
+
+  const std::vector<std::uint64_t> limbs(my_rop[0U]._mp_d, my_rop[0U]._mp_d + count);
+
+  wr.put_u64_range(limbs.data(), limbs.size());
+}
+
+bool gmp::e_float::rd_binary(ef::binary_reader& rd)
+{
+  const std::uint8_t  fpc   = rd.get_u08();
+  const std::uint8_t  sign  = rd.get_u08();
+  const std::int64_t  ex    = rd.get_i64();
+  const std::int32_t  prec  = rd.get_i32();
+  const std::uint32_t count = rd.get_u32();
+
+  if(   (fpc  > static_cast<std::uint8_t>(ef_NaN))
+     || (sign > static_cast<std::uint8_t>(1U))
+     || (prec < static_cast<std::int32_t>(1)))
+  {
+    return false;
+  }
+
+  // Do not trust the count for allocation, since the stream might be corrupt.
+  std::vector<std::uint64_t> limbs;
+
+  while((limbs.size() < static_cast<std::size_t>(count)) && rd.good())
+  {
+    const std::size_t n_old = limbs.size();
+    const std::size_t n     = (std::min)(static_cast<std::size_t>(count) - n_old, static_cast<std::size_t>(4096U));
+
+    limbs.resize(n_old + n);
+
+    rd.get_u64_range(limbs.data() + n_old, n);
+  }
+
+  if(!rd.good())
+  {
+    return false;
+  }
+
+  if(prec < my_prec_elem)
+  {
+    precision(prec);
+  }
+
+  // Keep the most significant limbs which fit into the precision of this build.
+  const std::size_t n_keep = (std::min)(limbs.size(), static_cast<std::size_t>(my_rop[0U]._mp_prec + 1));
+
+  std::copy(limbs.cend() - static_cast<std::ptrdiff_t>(n_keep), limbs.cend(), my_rop[0U]._mp_d);
+
+  my_rop[0U]._mp_size = static_cast<int>((sign != static_cast<std::uint8_t>(0U)) ? -static_cast<int>(n_keep) : static_cast<int>(n_keep));
+  my_rop[0U]._mp_exp  = static_cast<mp_exp_t>((n_keep != static_cast<std::size_t>(0U)) ? ex : static_cast<std::int64_t>(0));
+  my_fpclass          = static_cast<fpclass_type>(fpc);
+
+  return true;
+}
@@ -21,6 +21,7 @@
   #include <limits>
   #include <string>
   #include <type_traits>
+  #include <utility>
 
   #include <e_float/e_float_base.h>
   #include <e_float/gmp/e_float_gmp_protos.h>
@@ -121,14 +122,15 @@
         ::mpf_init_set(my_rop, f.my_rop);
       }
 
-      // Move constructor.
-      e_float(e_float&& f) : my_rop      (),
-                             my_fpclass  (f.my_fpclass),
-                             my_prec_elem(f.my_prec_elem)
+      // Move constructor. This takes over the limbs of f. The moved-from
+      // f is left with a null limb pointer and may only be assigned to
+      // or destroyed.
+      e_float(e_float&& f) noexcept : my_rop      (),
+                                      my_fpclass  (f.my_fpclass),
+                                      my_prec_elem(f.my_prec_elem)
       {
-        init();
-
-        ::mpf_init_set(my_rop, f.my_rop);
+        my_rop[0U]   = f.my_rop[0U];
+        f.my_rop[0U] = ::__mpf_struct();
       }
 
       // Constructor from mantissa and exponent.
@@ -151,6 +153,12 @@
                        const std::int64_t e = 0,
                        const bool is_neg = false);
 
+      // Construct from a range of base-10^8 integer limbs (most significant first), an exponent and sign.
+      e_float(const std::uint32_t* const limb_values,
+              const std::size_t limb_count,
+              const std::int64_t e,
+              const bool is_neg);
+
       virtual ~e_float();
 
       virtual std::int32_t cmp(const e_float& v) const;
@@ -159,13 +167,14 @@
       virtual const e_float& my_value_nan() const;
       virtual const e_float& my_value_inf() const;
 
-      virtual void precision(const std::int32_t);
+      virtual void         precision(const std::int32_t);
+      virtual std::int32_t precision() const { return my_prec_elem; }
 
       // Assignment operator.
       virtual e_float& operator=(const e_float&);
 
       // Move assignment operator.
-      e_float& operator=(e_float&&);
+      e_float& operator=(e_float&&) noexcept;
 
       // Binary arithmetic operators.
       virtual e_float& operator+=(const e_float& v);
@@ -179,15 +188,14 @@
       virtual e_float& mul_unsigned_long_long(const unsigned long long n);
       virtual e_float& div_unsigned_long_long(const unsigned long long n);
 
-      void swap(e_float& other_e_float)
+      void swap(e_float& other_e_float) noexcept
       {
         if(this != &other_e_float)
         {
-          const e_float tmp_value_this(*this);
-
-          *this = other_e_float;
+          ::mpf_swap(my_rop, other_e_float.my_rop);
 
-          other_e_float = tmp_value_this;
+          std::swap(my_fpclass,   other_e_float.my_fpclass);
+          std::swap(my_prec_elem, other_e_float.my_prec_elem);
         }
       }
 
@@ -240,6 +248,10 @@
       virtual e_float            extract_integer_part      () const;
       virtual e_float            extract_decimal_part      () const;
 
+      // Binary I/O routines.
+      virtual void wr_binary(ef::binary_writer& wr) const;
+      virtual bool rd_binary(ef::binary_reader& rd);
+
     private:
       ::mpf_t      my_rop;
       fpclass_type my_fpclass;
@@ -49,6 +49,7 @@
     void   __gmpf_init_set_ui     (mpf_ptr, unsigned long int);
     void   __gmpf_init_set_d      (mpf_ptr, double);
     void   __gmpf_clear           (mpf_ptr);
+    void   __gmpf_swap            (mpf_ptr, mpf_ptr);
     void   __gmpf_neg             (mpf_ptr, mpf_srcptr);
     void   __gmpf_add_ui          (mpf_ptr, mpf_srcptr, unsigned long int);
     void   __gmpf_sub_ui          (mpf_ptr, mpf_srcptr, unsigned long int);
@@ -77,6 +78,7 @@
   inline void   mpf_init_set_ui     (mpf_ptr dst, unsigned long int u)                      {        ::__gmpf_init_set_ui        (dst, u); }
   inline void   mpf_init_set_d      (mpf_ptr dst, double d)                                 {        ::__gmpf_init_set_d         (dst, d); }
   inline void   mpf_clear           (mpf_ptr dst)                                           {        ::__gmpf_clear              (dst); }
+  inline void   mpf_swap            (mpf_ptr x, mpf_ptr y)                                  {        ::__gmpf_swap               (x, y); }
   inline void   mpf_neg             (mpf_ptr dst, mpf_srcptr src)                           {        ::__gmpf_neg                (dst, src); }
   inline void   mpf_add_ui          (mpf_ptr dst, mpf_srcptr src, unsigned long int u)      {        ::__gmpf_add_ui             (dst, src, u); }
   inline void   mpf_sub_ui          (mpf_ptr dst, mpf_srcptr src, unsigned long int u)      {        ::__gmpf_sub_ui             (dst, src, u); }
@@ -14,8 +14,10 @@
 #include <cstdio>
 #include <iomanip>
 #include <sstream>
+#include <vector>
 
 #include <e_float/e_float_functions.h>
+#include <e_float/e_float_serialize.h>
 
 #include <utility/util_dynamic_array.h>
 #include <utility/util_lexical_cast.h>
@@ -61,40 +63,51 @@ mpfr::e_float::e_float(const double mantissa, const std::int64_t exponent)
 }
 
 mpfr::e_float::e_float(std::initializer_list<std::uint32_t> limb_values,
+                       const std::int64_t e,
+                       const bool is_neg) : e_float(limb_values.begin(), limb_values.size(), e, is_neg) { }
+
+mpfr::e_float::e_float(const std::uint32_t* const limb_values,
+                       const std::size_t limb_count,
                        const std::int64_t e,
                        const bool is_neg)
 {
   std::string str;
 
+  str.reserve(static_cast<std::size_t>((limb_count * 8U) + 32U));
+
   if(is_neg)
   {
     str.push_back('-');
   }
 
-  auto it = limb_values.begin();
-
-  if(limb_values.size() > 0U)
+  if(limb_count > 0U)
   {
     std::stringstream strm;
 
-    strm << *it;
-
-    ++it;
+    strm << limb_values[0U];
 
     str += strm.str();
   }
 
-  if(limb_values.size() > 1U)
+  if(limb_count > 1U)
   {
     str.push_back('.');
 
-    for( ; it != limb_values.end(); ++it)
+    // Write the fixed-width limbs directly into the string.
+    for(std::size_t i = static_cast<std::size_t>(1U); i < limb_count; ++i)
     {
-      std::stringstream strm;
+      char limb_chars[8U];
+
+      std::uint32_t v = limb_values[i];
+
+      for(std::size_t j = static_cast<std::size_t>(8U); j > static_cast<std::size_t>(0U); --j)
+      {
+        limb_chars[j - 1U] = static_cast<char>('0' + static_cast<char>(v % 10U));
 
-      strm << std::setw(8) << std::setfill('0') << *it;
+        v /= 10U;
+      }
 
-      str += strm.str();
+      str.append(limb_chars, static_cast<std::size_t>(8U));
     }
   }
 
@@ -114,7 +127,10 @@ mpfr::e_float::e_float(std::initializer_list<std::uint32_t> limb_values,
 
 mpfr::e_float::~e_float()
 {
-  ::mpfr_clear(my_rop);
+  if(my_rop[0U]._mpfr_d != nullptr)
+  {
+    ::mpfr_clear(my_rop);
+  }
 }
 
 void mpfr::e_float::from_unsigned_long_long(const unsigned long long u)
@@ -606,6 +622,7 @@ e_float mpfr::e_float::my_own_cbrt         (const e_float& x) { e_float res; sta
 e_float mpfr::e_float::my_own_rootn        (const e_float& x, const std::uint32_t p)
                                                               { e_float res; static_cast<void>(::mpfr_root (res.my_rop, x.my_rop, static_cast<unsigned long int>(p), GMP_RNDN)); return res; }
 e_float mpfr::e_float::my_own_exp          (const e_float& x) { e_float res; static_cast<void>(::mpfr_exp  (res.my_rop, x.my_rop, GMP_RNDN)); return res; }
+e_float mpfr::e_float::my_own_expm1        (const e_float& x) { e_float res; static_cast<void>(::mpfr_expm1(res.my_rop, x.my_rop, GMP_RNDN)); return res; }
 e_float mpfr::e_float::my_own_log          (const e_float& x) { e_float res; static_cast<void>(::mpfr_log  (res.my_rop, x.my_rop, GMP_RNDN)); return res; }
 e_float mpfr::e_float::my_own_sin          (const e_float& x) { e_float res; static_cast<void>(::mpfr_sin  (res.my_rop, x.my_rop, GMP_RNDN)); return res; }
 e_float mpfr::e_float::my_own_cos          (const e_float& x) { e_float res; static_cast<void>(::mpfr_cos  (res.my_rop, x.my_rop, GMP_RNDN)); return res; }
@@ -625,3 +642,102 @@ e_float mpfr::e_float::my_own_cyl_bessel_jn(const std::int32_t n, const e_float&
                                                               { e_float res; static_cast<void>(::mpfr_jn(res.my_rop, static_cast<long>(n), x.my_rop, GMP_RNDN)); return res; }
 e_float mpfr::e_float::my_own_cyl_bessel_yn(const std::int32_t n, const e_float& x)
                                                               { e_float res; static_cast<void>(::mpfr_yn(res.my_rop, static_cast<long>(n), x.my_rop, GMP_RNDN)); return res; }
+
+void mpfr::e_float::wr_binary(ef::binary_writer& wr) const
+{
+  // Layout: u8 class (0 finite, 1 inf, 2 NaN, 3 zero), u8 sign, i64 exponent (bits),
+  // u64 precision (bits), u32 number of limbs, followed by the limbs as u64,
+  // least significant first.
+  const bool b_finite = ((::mpfr_number_p(my_rop) != 0) && (::mpfr_zero_p(my_rop) == 0));
+
+  const std::uint8_t fpc = ((::mpfr_nan_p (my_rop) != 0) ? static_cast<std::uint8_t>(2U)
+                         : ((::mpfr_inf_p (my_rop) != 0) ? static_cast<std::uint8_t>(1U)
+                         : ((::mpfr_zero_p(my_rop) != 0) ? static_cast<std::uint8_t>(3U)
+                                                         : static_cast<std::uint8_t>(0U))));
+
+  const std::uint32_t count =
+    (b_finite ? static_cast<std::uint32_t>((my_rop[0U]._mpfr_prec + ((sizeof(mp_limb_t) * 8U) - 1U)) / (sizeof(mp_limb_t) * 8U))
+              : static_cast<std::uint32_t>(0U));
+
+  wr.put_u08(fpc);
+  wr.put_u08(static_cast<std::uint8_t>((MPFR_SIGN(my_rop) < 0) ? 1U : 0U));
+  wr.put_i64(static_cast<std::int64_t>(b_finite ? my_rop[0U]._mpfr_exp : 0L));
+  wr.put_u64(static_cast<std::uint64_t>(my_rop[0U]._mpfr_prec));
+  wr.put_u32(count);
+
+  const std::vector<std::uint64_t> limbs(my_rop[0U]._mpfr_d, my_rop[0U]._mpfr_d + count);
+
+  wr.put_u64_range(limbs.data(), limbs.size());
+}
+
+bool mpfr::e_float::rd_binary(ef::binary_reader& rd)
+{
+  const std::uint8_t  fpc   = rd.get_u08();
+  const std::uint8_t  sign  = rd.get_u08();
+  const std::int64_t  ex    = rd.get_i64();
+  const std::uint64_t prec  = rd.get_u64();
+  const std::uint32_t count = rd.get_u32();
+
+  const std::uint64_t limb_bits = static_cast<std::uint64_t>(sizeof(mp_limb_t) * 8U);
+
+  if(   (fpc  > static_cast<std::uint8_t>(3U))
+     || (sign > static_cast<std::uint8_t>(1U))
+     || (prec < static_cast<std::uint64_t>(2U))
+     || ((fpc == static_cast<std::uint8_t>(0U)) && (static_cast<std::uint64_t>(count) != ((prec + (limb_bits - 1U)) / limb_bits)))
+     || ((fpc != static_cast<std::uint8_t>(0U)) && (count != static_cast<std::uint32_t>(0U))))
+  {
+    return false;
+  }
+
+  if(fpc == static_cast<std::uint8_t>(2U))
+  {
+    ::mpfr_set_nan(my_rop);
+  }
+  else if(fpc == static_cast<std::uint8_t>(1U))
+  {
+    ::mpfr_set_inf(my_rop, ((sign != static_cast<std::uint8_t>(0U)) ? -1 : 1));
+  }
+  else if(fpc == static_cast<std::uint8_t>(3U))
+  {
+    static_cast<void>(::mpfr_set_ui(my_rop, 0UL, GMP_RNDN));
+
+    if(sign != static_cast<std::uint8_t>(0U))
+    {
+      static_cast<void>(::mpfr_neg(my_rop, my_rop, GMP_RNDN));
+    }
+  }
+  else
+  {
+    // Rebuild the value with its stored precision, then round it to the precision of this build.
+    ::mpfr_t tmp;
+
+    ::mpfr_init2(tmp, static_cast<mpfr_prec_t>(prec));
+
+    std::vector<std::uint64_t> limbs(static_cast<std::size_t>(count));
+
+    rd.get_u64_range(limbs.data(), limbs.size());
+
+    std::copy(limbs.cbegin(), limbs.cend(), tmp[0U]._mpfr_d);
+
+    tmp[0U]._mpfr_exp  = static_cast<mp_exp_t>(ex);
+    tmp[0U]._mpfr_sign = ((sign != static_cast<std::uint8_t>(0U)) ? -1 : 1);
+
+    // The mantissa must be normalized.
+    const bool b_is_normalized =
+      ((tmp[0U]._mpfr_d[count - 1U] >> (limb_bits - 1U)) != static_cast<mp_limb_t>(0U));
+
+    if(b_is_normalized)
+    {
+      static_cast<void>(::mpfr_set(my_rop, tmp, GMP_RNDN));
+    }
+
+    ::mpfr_clear(tmp);
+
+    if(!b_is_normalized)
+    {
+      return false;
+    }
+  }
+
+  return rd.good();
+}
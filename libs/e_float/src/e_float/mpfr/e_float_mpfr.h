@@ -96,12 +96,13 @@
         mpfr_init_set(my_rop, f.my_rop, GMP_RNDN);
       }
 
-      // Move constructor.
-      e_float(e_float&& f) : my_rop()
+      // Move constructor. This takes over the limbs of f. The moved-from
+      // f is left with a null limb pointer and may only be assigned to
+      // or destroyed.
+      e_float(e_float&& f) noexcept : my_rop()
       {
-        init();
-
-        mpfr_init_set(my_rop, f.my_rop, GMP_RNDN);
+        my_rop[0U]   = f.my_rop[0U];
+        f.my_rop[0U] = ::__mpfr_struct();
       }
 
       // Constructor from mantissa and exponent.
@@ -112,6 +113,12 @@
                        const std::int64_t e = 0,
                        const bool is_neg = false);
 
+      // Construct from a range of base-10^8 integer limbs (most significant first), an exponent and sign.
+      e_float(const std::uint32_t* const limb_values,
+              const std::size_t limb_count,
+              const std::int64_t e,
+              const bool is_neg);
+
       virtual ~e_float();
 
       virtual std::int32_t cmp(const e_float&) const;
@@ -120,13 +127,20 @@
       virtual const e_float& my_value_nan() const;
       virtual const e_float& my_value_inf() const;
 
-      virtual void precision(const std::int32_t) { }
+      virtual void         precision(const std::int32_t) { }
+      virtual std::int32_t precision() const { return ef_max_digits10; }
 
       // Assignment operator.
       virtual e_float& operator=(const e_float& other)
       {
         if(this != &other)
         {
+          if(my_rop[0U]._mpfr_d == nullptr)
+          {
+            // Re-initialize the limbs of a moved-from value.
+            ::mpfr_init(my_rop);
+          }
+
           mpfr_set(my_rop, other.my_rop, GMP_RNDN);
         }
 
@@ -134,9 +148,11 @@
       }
 
       // Move assignment operator.
-      virtual e_float& operator=(e_float&& other)
+      virtual e_float& operator=(e_float&& other) noexcept
       {
-        static_cast<void>(::mpfr_set(my_rop, other.my_rop, GMP_RNDN));
+        // Exchange the limbs. The previous limbs of *this
+        // are cleared when the other value is destroyed.
+        swap(other);
 
         return *this;
       }
@@ -153,15 +169,11 @@
       virtual e_float& mul_unsigned_long_long(const unsigned long long);
       virtual e_float& div_unsigned_long_long(const unsigned long long);
 
-      void swap(e_float& other_e_float)
+      void swap(e_float& other_e_float) noexcept
       {
         if(this != &other_e_float)
         {
-          const e_float tmp_value_this(*this);
-
-          *this = other_e_float;
-
-          other_e_float = tmp_value_this;
+          ::mpfr_swap(my_rop, other_e_float.my_rop);
         }
       }
 
@@ -203,9 +215,14 @@
       virtual e_float            extract_integer_part      () const;
       virtual e_float            extract_decimal_part      () const;
 
+      // Binary I/O routines.
+      virtual void wr_binary(ef::binary_writer& wr) const;
+      virtual bool rd_binary(ef::binary_reader& rd);
+
       static e_float my_own_cbrt         (const e_float& x);
       static e_float my_own_rootn        (const e_float& x, const std::uint32_t p);
       static e_float my_own_exp          (const e_float& x);
+      static e_float my_own_expm1        (const e_float& x);
       static e_float my_own_log          (const e_float& x);
       static e_float my_own_sin          (const e_float& x);
       static e_float my_own_cos          (const e_float& x);
@@ -227,6 +244,7 @@
       virtual bool i_have_my_own_cbrt         () const noexcept { return true; }
       virtual bool i_have_my_own_rootn        () const noexcept { return true; }
       virtual bool i_have_my_own_exp          () const noexcept { return true; }
+      virtual bool i_have_my_own_expm1        () const noexcept { return true; }
       virtual bool i_have_my_own_log          () const noexcept { return true; }
       virtual bool i_have_my_own_sin          () const noexcept { return true; }
       virtual bool i_have_my_own_cos          () const noexcept { return true; }
@@ -57,8 +57,10 @@
     #define MPFR_SIGN(x) ((x)->_mpfr_sign)
 
     void mpfr_init            (mpfr_ptr);
+    void mpfr_init2           (mpfr_ptr, mpfr_prec_t);
     void mpfr_set_default_prec(mpfr_prec_t);
     void mpfr_clear           (mpfr_ptr);
+    void mpfr_swap            (mpfr_ptr, mpfr_ptr);
 
     int mpfr_set4    (mpfr_ptr, mpfr_srcptr, mpfr_rnd_t, int);
     #define mpfr_set(x, y, rnd) mpfr_set4((x), (y), (rnd), MPFR_SIGN(y))
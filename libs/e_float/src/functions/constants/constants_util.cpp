@@ -0,0 +1,558 @@
+//          Copyright Christopher Kormanyos 1999 - 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+// This work is based on an earlier work:
+// "Algorithm 910: A Portable C++ Multiple-Precision System for Special-Function Calculations",
+// in ACM TOMS, {VOL 37, ISSUE 4, (February 2011)} (C) ACM, 2011. http://doi.acm.org/10.1145/1916461.1916469
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <deque>
+#include <limits>
+#include <mutex>
+#include <vector>
+
+#include <e_float/e_float_functions.h>
+
+#include <functions/constants/constants_util.h>
+#include <functions/elementary/hyper_g_util.h>
+#include <utility/util_big_int.h>
+
+namespace Constants_Series
+{
+  static void ChudnovskySplit(const std::int64_t k1,
+                              const std::int64_t k2,
+                              const bool b_need_p,
+                              Util::big_int& p,
+                              Util::big_int& q,
+                              Util::big_int& t)
+  {
+    // Binary splitting of the Chudnovsky series in the range k1 <= k < k2, with
+    // the term ratio p(k) / q(k) = -(6k - 5)(2k - 1)(6k - 1) / (k^3 640320^3 / 24)
+    // and the weights a(k) = 13591409 + 545140134 k.
+    if((k2 - k1) == static_cast<std::int64_t>(1))
+    {
+      p = Util::big_int(-((6 * k1) - 5));
+      p.mul_limb(static_cast<std::int32_t>((2 * k1) - 1));
+      p.mul_limb(static_cast<std::int32_t>((6 * k1) - 1));
+
+      q  = Util::big_int((k1 * k1) * k1);
+      q *= Util::big_int(static_cast<std::int64_t>(10939058860032000LL));
+
+      t  = p;
+      t *= Util::big_int(static_cast<std::int64_t>(13591409LL + (545140134LL * k1)));
+
+      return;
+    }
+
+    const std::int64_t k_mid = (k1 + k2) / 2;
+
+    Util::big_int pl, ql, tl;
+    Util::big_int pr, qr, tr;
+
+    ChudnovskySplit(k1,    k_mid, true,     pl, ql, tl);
+    ChudnovskySplit(k_mid, k2,    b_need_p, pr, qr, tr);
+
+    t  = tl * qr;
+    t += (pl * tr);
+    q  = ql * qr;
+
+    if(b_need_p)
+    {
+      p = pl * pr;
+    }
+  }
+
+  static Util::big_int SqrtScaled(const std::int32_t a, const std::size_t n)
+  {
+    // The integer sqrt(a) base^n to within a few units. The Newton iteration
+    // for the integer square root is started from the result for half of
+    // the limbs, and the smallest sizes are seeded with ef::sqrt.
+    const std::size_t n_seed = static_cast<std::size_t>(std::numeric_limits<e_float>::digits10 / 16);
+
+    if(n <= n_seed)
+    {
+      return Util::big_int(ef::sqrt(e_float(a)), static_cast<std::int64_t>(n * 8U));
+    }
+
+    const std::size_t n_half = (n + 1U) / 2U;
+
+    Util::big_int y = SqrtScaled(a, n_half);
+
+    y.shift_limbs(n - n_half);
+
+    // y = (y + (a base^2n / y)) / 2
+    Util::big_int a_scaled(static_cast<std::int64_t>(a));
+
+    a_scaled.shift_limbs(2U * n);
+
+    y += (a_scaled / y);
+    y /= Util::big_int(static_cast<std::int64_t>(2));
+
+    return y;
+  }
+
+  struct brent_mcmillan_split
+  {
+    // The products P, Q of the term ratio n^2 / k^2, the products D of the
+    // harmonic denominators k with C / D being the harmonic sum, and the sums
+    // T / Q and V / (D Q) of the terms without and with the harmonic numbers.
+    Util::big_int p, q, t, d, c, v;
+  };
+
+  static void BrentMcMillanSplit(const std::int64_t n_squared,
+                                 const std::int64_t k1,
+                                 const std::int64_t k2,
+                                 const bool b_need_p,
+                                 brent_mcmillan_split& s)
+  {
+    if((k2 - k1) == static_cast<std::int64_t>(1))
+    {
+      s.p = Util::big_int(n_squared);
+      s.q = Util::big_int(k1 * k1);
+      s.t = s.p;
+      s.d = Util::big_int(k1);
+      s.c = Util::big_int(static_cast<std::int64_t>(1));
+      s.v = s.p;
+
+      return;
+    }
+
+    const std::int64_t k_mid = (k1 + k2) / 2;
+
+    brent_mcmillan_split l;
+    brent_mcmillan_split r;
+
+    BrentMcMillanSplit(n_squared, k1,    k_mid, true,     l);
+    BrentMcMillanSplit(n_squared, k_mid, k2,    b_need_p, r);
+
+    // V = D_r Q_r V_l + P_l (C_l D_r T_r + D_l V_r)
+    Util::big_int w = l.c * r.d;
+    w    *= r.t;
+    w    += (l.d * r.v);
+    w    *= l.p;
+    s.v   = r.d * r.q;
+    s.v  *= l.v;
+    s.v  += w;
+
+    s.t   = l.t * r.q;
+    s.t  += (l.p * r.t);
+    s.c   = l.c * r.d;
+    s.c  += (l.d * r.c);
+    s.q   = l.q * r.q;
+    s.d   = l.d * r.d;
+
+    if(b_need_p)
+    {
+      s.p = l.p * r.p;
+    }
+  }
+
+  static e_float AtanhOfReciprocal(const std::int32_t k)
+  {
+    // atanh(1 / k) = (1 / k) Hypergeometric2F1[1/2, 1, 3/2, 1 / k^2]
+    const std::vector<HyperGUtil::rational_type> a = { HyperGUtil::rational_type(1, 2), HyperGUtil::rational_type(1, 1) };
+    const std::vector<HyperGUtil::rational_type> b = { HyperGUtil::rational_type(3, 2) };
+
+    return HyperGUtil::HypergeometricPFQRational(a, b, HyperGUtil::rational_type(1, k * k)) / k;
+  }
+
+  static const std::array<e_float, 3U>& MachinAtanhTerms()
+  {
+    // The values atanh(1/31), atanh(1/49) and atanh(1/161) are shared
+    // by the Machin-like formulas for ln2 and ln10.
+    static const std::array<e_float, 3U> terms =
+    {{
+      AtanhOfReciprocal(static_cast<std::int32_t>( 31)),
+      AtanhOfReciprocal(static_cast<std::int32_t>( 49)),
+      AtanhOfReciprocal(static_cast<std::int32_t>(161))
+    }};
+
+    return terms;
+  }
+
+  static Util::big_int PrimeProduct(const std::vector<std::uint32_t>& primes, const std::size_t first, const std::size_t last)
+  {
+    // Multiply the primes in the range [first, last) exactly with a product tree.
+    if((last - first) <= static_cast<std::size_t>(16U))
+    {
+      Util::big_int p(static_cast<std::int64_t>(1));
+
+      for(std::size_t i = first; i < last; ++i)
+      {
+        p.mul_limb(static_cast<std::int32_t>(primes[i]));
+      }
+
+      return p;
+    }
+
+    const std::size_t middle = first + ((last - first) / 2U);
+
+    return PrimeProduct(primes, first, middle) * PrimeProduct(primes, middle, last);
+  }
+
+  static e_float LogHyperfactorial(const std::uint32_t big_m)
+  {
+    // Compute sum_{k <= M} k log(k) = sum_{p <= M} c_p log(p) for the primes p,
+    // with the integer exponents c_p = sum_{i >= 1} p^i T(floor(M / p^i)) and
+    // T(n) = n (n + 1) / 2. Let P_b be the product of the primes p for which
+    // bit b of c_p is set. Then the sum is sum_b 2^b log(P_b), which is
+    // evaluated like a power with the bits of the exponents from the top
+    // down. The power is moved into the logarithm before it overflows.
+    // This needs about 2 log2(M) multiplications and a few logarithms.
+    std::deque<std::uint32_t> prime_deque;
+
+    const double xm = static_cast<double>((std::max)(big_m, static_cast<std::uint32_t>(17U)));
+
+    ef::prime(static_cast<std::uint32_t>((1.25506 * xm) / std::log(xm)) + 1U, prime_deque);
+
+    while((!prime_deque.empty()) && (prime_deque.back() > big_m))
+    {
+      prime_deque.pop_back();
+    }
+
+    std::vector<std::uint64_t> c(prime_deque.size());
+
+    std::uint64_t c_max = static_cast<std::uint64_t>(0U);
+
+    for(std::size_t i = static_cast<std::size_t>(0U); i < prime_deque.size(); ++i)
+    {
+      for(std::uint64_t q = prime_deque[i]; q <= big_m; q *= prime_deque[i])
+      {
+        const std::uint64_t n = big_m / q;
+
+        c[i] += q * ((n * (n + 1U)) / 2U);
+      }
+
+      c_max = (std::max)(c_max, c[i]);
+    }
+
+    std::int32_t b_top = static_cast<std::int32_t>(-1);
+
+    while((c_max >> static_cast<std::uint32_t>(b_top + 1)) != static_cast<std::uint64_t>(0U))
+    {
+      ++b_top;
+    }
+
+    // Keep the power well below the largest exponent,
+    // such that its square does not overflow.
+    static const std::int64_t order_limit = static_cast<std::int64_t>(std::numeric_limits<e_float>::max_exponent10 / 8);
+
+    const double exact_digits = static_cast<double>(std::numeric_limits<e_float>::digits10);
+
+    e_float log_sum(ef::zero());
+    e_float power  (ef::one());
+
+    std::vector<std::uint32_t> primes_b;
+
+    for(std::int32_t b = b_top; b >= static_cast<std::int32_t>(0); --b)
+    {
+      primes_b.clear();
+
+      for(std::size_t i = static_cast<std::size_t>(0U); i < prime_deque.size(); ++i)
+      {
+        if(((c[i] >> static_cast<std::uint32_t>(b)) & 1U) != static_cast<std::uint64_t>(0U))
+        {
+          primes_b.push_back(prime_deque[i]);
+        }
+      }
+
+      log_sum *= static_cast<std::int32_t>(2);
+      power   *= power;
+
+      // Multiply the primes in exact partial products of about the
+      // working precision, which are then multiplied as e_float.
+      for(std::size_t first = static_cast<std::size_t>(0U); first < primes_b.size(); )
+      {
+        double      digits = 0.0;
+        std::size_t last   = first;
+
+        while((last < primes_b.size()) && (digits < exact_digits))
+        {
+          digits += std::log10(static_cast<double>(primes_b[last]));
+
+          ++last;
+        }
+
+        power *= PrimeProduct(primes_b, first, last).to_e_float();
+
+        first = last;
+      }
+
+      if(power.order() > order_limit)
+      {
+        log_sum += ef::log(power);
+        power    = ef::one();
+      }
+    }
+
+    return log_sum + ef::log(power);
+  }
+}
+
+e_float ConstantsUtil::CalculatePi()
+{
+  // Use the Chudnovsky series, which gains about 14.18 digits per term.
+  // pi = 426880 sqrt(10005) Q / (13591409 Q + T)
+  const std::int64_t n_terms = static_cast<std::int64_t>(static_cast<double>(ef::tolerance()) / 14.18) + 2;
+
+  Util::big_int p, q, t;
+
+  Constants_Series::ChudnovskySplit(static_cast<std::int64_t>(1), n_terms, false, p, q, t);
+
+  const e_float qf = q.to_e_float();
+
+  return ((ef::sqrt(e_float(static_cast<std::int32_t>(10005))) * static_cast<std::int32_t>(426880)) * qf)
+           / ((qf * static_cast<std::int32_t>(13591409)) + t.to_e_float());
+}
+
+Util::big_int ConstantsUtil::TwoOverPiScaled(const std::size_t n_limbs)
+{
+  // Use the Chudnovsky series in integers with
+  // 2/pi = 2 (13591409 Q + T) sqrt(10005) / (426880 10005 Q).
+  // The value is cached with a size that grows geometrically,
+  // and smaller sizes are truncated from it.
+  static std::mutex    two_over_pi_mutex;
+  static Util::big_int two_over_pi_cache;
+  static std::size_t   two_over_pi_limbs = static_cast<std::size_t>(0U);
+
+  const std::lock_guard<std::mutex> lock(two_over_pi_mutex);
+
+  if(n_limbs > two_over_pi_limbs)
+  {
+    two_over_pi_limbs = (std::max)(n_limbs, static_cast<std::size_t>((two_over_pi_limbs * 3U) / 2U));
+
+    // Two guard limbs absorb the errors of the square root and the truncated series.
+    const std::size_t n_guard = static_cast<std::size_t>(2U);
+    const std::size_t n       = two_over_pi_limbs + n_guard;
+
+    const std::int64_t n_terms = static_cast<std::int64_t>(static_cast<double>(n * 8U) / 14.18) + 2;
+
+    Util::big_int p, q, t;
+
+    Constants_Series::ChudnovskySplit(static_cast<std::int64_t>(1), n_terms, false, p, q, t);
+
+    Util::big_int num(q);
+
+    num.mul_limb(static_cast<std::int32_t>(13591409));
+    num += t;
+    num.mul_limb(static_cast<std::int32_t>(2));
+    num *= Constants_Series::SqrtScaled(static_cast<std::int32_t>(10005), n);
+
+    Util::big_int den(q);
+
+    den.mul_limb(static_cast<std::int32_t>(426880));
+    den.mul_limb(static_cast<std::int32_t>(10005));
+
+    num /= den;
+
+    Util::big_int guard;
+
+    num.split_limbs(n_guard, two_over_pi_cache, guard);
+  }
+
+  Util::big_int c, rest;
+
+  two_over_pi_cache.split_limbs(two_over_pi_limbs - n_limbs, c, rest);
+
+  return c;
+}
+
+e_float ConstantsUtil::CalculateE()
+{
+  // e = Hypergeometric0F0[1]
+  return HyperGUtil::HypergeometricPFQRational(std::vector<HyperGUtil::rational_type>(),
+                                               std::vector<HyperGUtil::rational_type>(),
+                                               HyperGUtil::rational_type(1, 1));
+}
+
+e_float ConstantsUtil::CalculateLn2()
+{
+  // ln2 = 14 atanh(1/31) + 10 atanh(1/49) + 6 atanh(1/161)
+  const std::array<e_float, 3U>& terms = Constants_Series::MachinAtanhTerms();
+
+  return (  (terms[0U] * static_cast<std::int32_t>(14))
+          + (terms[1U] * static_cast<std::int32_t>(10))
+          + (terms[2U] * static_cast<std::int32_t>( 6)));
+}
+
+e_float ConstantsUtil::CalculateLn10()
+{
+  // ln10 = 46 atanh(1/31) + 34 atanh(1/49) + 20 atanh(1/161)
+  const std::array<e_float, 3U>& terms = Constants_Series::MachinAtanhTerms();
+
+  return (  (terms[0U] * static_cast<std::int32_t>(46))
+          + (terms[1U] * static_cast<std::int32_t>(34))
+          + (terms[2U] * static_cast<std::int32_t>(20)));
+}
+
+e_float ConstantsUtil::CalculateEulerGamma()
+{
+  // Use the Brent-McMillan algorithm with n = 2^m:
+  // gamma = A / B - log(n) + O(exp(-4n)), with
+  // A = sum_k (n^k / k!)^2 H_k and B = sum_k (n^k / k!)^2.
+  // The number of terms is alpha n, where alpha (log(alpha) - 1) = 1.
+  std::int64_t m = static_cast<std::int64_t>(0);
+
+  while(static_cast<double>(static_cast<std::int64_t>(1) << m) < (static_cast<double>(ef::tolerance()) * 0.5757))
+  {
+    ++m;
+  }
+
+  const std::int64_t n       = static_cast<std::int64_t>(1) << m;
+  const std::int64_t n_terms = static_cast<std::int64_t>(static_cast<double>(n) * 3.5912) + 2;
+
+  Constants_Series::brent_mcmillan_split s;
+
+  Constants_Series::BrentMcMillanSplit(n * n, static_cast<std::int64_t>(1), n_terms, false, s);
+
+  // A / B = V / (D (Q + T))
+  s.t += s.q;
+  s.t *= s.d;
+
+  return (s.v.to_e_float() / s.t.to_e_float()) - (ef::ln2() * m);
+}
+
+e_float ConstantsUtil::CalculateCatalan()
+{
+  // Catalan = (pi / 8) log(2 + sqrt(3)) + (3 / 8) Hypergeometric3F2[1, 1, 1/2; 3/2, 3/2; 1/4]
+  const std::vector<HyperGUtil::rational_type> a = { HyperGUtil::rational_type(1, 1), HyperGUtil::rational_type(1, 1), HyperGUtil::rational_type(1, 2) };
+  const std::vector<HyperGUtil::rational_type> b = { HyperGUtil::rational_type(3, 2), HyperGUtil::rational_type(3, 2) };
+
+  const e_float h3f2 = HyperGUtil::HypergeometricPFQRational(a, b, HyperGUtil::rational_type(1, 4));
+
+  return ((ef::pi() * ef::log(ef::two() + ef::sqrt(ef::three()))) + (h3f2 * static_cast<std::int32_t>(3))) / static_cast<std::int32_t>(8);
+}
+
+e_float ConstantsUtil::CalculateGlaisher()
+{
+  // Use the Euler-Maclaurin summation around M = 2^m. Its cost is dominated
+  // by the Bernoulli numbers, whose number decreases for larger M, while the
+  // hyperfactorial of large M is cheap in logarithmic form. Use M of about
+  // 256 times the tolerance, limited to 2^26, but at least the tolerance.
+  const std::int64_t m_target = (std::min)(static_cast<std::int64_t>(ef::tolerance() * 256),
+                                           static_cast<std::int64_t>(1LL << 26));
+
+  std::uint32_t big_m = static_cast<std::uint32_t>(1U);
+
+  while(   (static_cast<std::int64_t>(big_m) < m_target)
+        || (static_cast<std::int64_t>(big_m) < ef::tolerance()))
+  {
+    big_m <<= 1U;
+  }
+
+  return ef::exp(CalculateLogGlaisher(big_m));
+}
+
+e_float ConstantsUtil::CalculateLogGlaisher(const std::uint32_t big_m)
+{
+  // Use the Euler-Maclaurin summation of sum_{k <= M} k log(k):
+  // log(A) = sum_{k <= M} k log(k) - (M^2/2 + M/2 + 1/12) log(M) + M^2/4
+  //        + sum_{j >= 2} B_{2j} / [2j (2j - 1) (2j - 2) M^(2j - 2)].
+  // The sum of k log(k) is the logarithm of the hyperfactorial prod_k k^k,
+  // which exceeds the range of the exponent for large M. It is summed
+  // in logarithmic form with Constants_Series::LogHyperfactorial.
+
+  // Find the number of Euler-Maclaurin terms with the logarithm of
+  // |B_{2j}| ~ 2 (2j)! / (2 pi)^(2j).
+  const double log_two_pi = std::log(6.283185307179586);
+  const double log_m      = std::log(static_cast<double>(big_m));
+  const double log_tol    = -static_cast<double>(ef::tolerance()) * std::log(10.0);
+
+  std::int32_t j_max = static_cast<std::int32_t>(2);
+
+  while(   ((std::lgamma(2.0 * j_max + 1.0) + std::log(2.0)) - (2.0 * j_max * log_two_pi) - ((2.0 * j_max - 2.0) * log_m) > log_tol)
+        && (j_max < ef::max_iteration()))
+  {
+    ++j_max;
+  }
+
+  std::vector<e_float> bn;
+  ef::bernoulli_table(bn, static_cast<std::uint32_t>(2 * j_max));
+
+  const e_float big_m_squared = e_float(static_cast<std::uint64_t>(static_cast<std::uint64_t>(big_m) * big_m));
+
+  const e_float one_over_big_m_squared = ef::one() / big_m_squared;
+
+  e_float sum_em(ef::zero());
+  e_float one_over_big_m_pow(ef::one());
+
+  for(std::int32_t j = static_cast<std::int32_t>(2); j <= j_max; ++j)
+  {
+    one_over_big_m_pow *= one_over_big_m_squared;
+
+    const std::int64_t two_j = static_cast<std::int64_t>(2 * j);
+
+    sum_em += ((bn[static_cast<std::size_t>(two_j)] * one_over_big_m_pow) / ((two_j * (two_j - 1)) * (two_j - 2)));
+  }
+
+  const e_float coef_log_m = ((big_m_squared + big_m) / static_cast<std::int32_t>(2)) + (ef::one() / static_cast<std::int32_t>(12));
+
+  return   Constants_Series::LogHyperfactorial(big_m)
+         - (coef_log_m * ef::log(e_float(big_m)))
+         + (big_m_squared / static_cast<std::int32_t>(4))
+         + sum_em;
+}
+
+e_float ConstantsUtil::CalculateKhinchin()
+{
+  // Use the series of Bailey, Borwein and Crandall:
+  // log(K) log(2) = sum_{n >= 1} [zeta(2n, N) / n] A_{2n - 1}
+  //               - sum_{2 <= k < N} log(1 - 1/k) log(1 + 1/k),
+  // where A_m = 1 - 1/2 + 1/3 - ... + (-1)^(m+1) / m and zeta(s, N) is the
+  // Hurwitz zeta function. Here zeta(2n, N) = zeta(2n) - sum_{k < N} k^(-2n),
+  // with zeta(2n) from the Bernoulli numbers.
+  const std::int32_t big_n = static_cast<std::int32_t>(32);
+
+  const std::int32_t n_max = static_cast<std::int32_t>(static_cast<double>(ef::tolerance()) / (2.0 * std::log10(static_cast<double>(big_n)))) + 2;
+
+  std::vector<e_float> bn;
+  ef::bernoulli_table(bn, static_cast<std::uint32_t>(2 * n_max));
+
+  std::vector<e_float> k_pow(static_cast<std::size_t>(big_n), ef::one());
+
+  const e_float four_pi_squared = ef::pi_squared() * static_cast<std::int32_t>(4);
+
+  e_float two_pi_pow_over_fact(ef::one());
+  e_float alternating_sum(ef::one());
+  e_float sum(ef::zero());
+
+  for(std::int32_t n = static_cast<std::int32_t>(1); n <= n_max; ++n)
+  {
+    const std::int32_t two_n = static_cast<std::int32_t>(2 * n);
+
+    // (2 pi)^(2n) / (2n)!
+    two_pi_pow_over_fact *= four_pi_squared;
+    two_pi_pow_over_fact /= static_cast<std::int32_t>(two_n - 1);
+    two_pi_pow_over_fact /= two_n;
+
+    e_float zeta_2n_big_n = (ef::fabs(bn[static_cast<std::size_t>(two_n)]) * two_pi_pow_over_fact) / static_cast<std::int32_t>(2);
+
+    zeta_2n_big_n -= ef::one();
+
+    for(std::int32_t k = static_cast<std::int32_t>(2); k < big_n; ++k)
+    {
+      k_pow[static_cast<std::size_t>(k)] /= static_cast<std::int32_t>(k * k);
+
+      zeta_2n_big_n -= k_pow[static_cast<std::size_t>(k)];
+    }
+
+    sum += ((zeta_2n_big_n * alternating_sum) / n);
+
+    // A_{2n + 1} = A_{2n - 1} - 1 / (2n) + 1 / (2n + 1)
+    alternating_sum -= (ef::one() / two_n);
+    alternating_sum += (ef::one() / static_cast<std::int32_t>(two_n + 1));
+  }
+
+  for(std::int32_t k = static_cast<std::int32_t>(2); k < big_n; ++k)
+  {
+    const e_float log_k = ef::log(e_float(k));
+
+    sum -= ((ef::log(e_float(k - 1)) - log_k) * (ef::log(e_float(k + 1)) - log_k));
+  }
+
+  return ef::exp(sum / ef::ln2());
+}
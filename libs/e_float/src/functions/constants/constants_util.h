@@ -0,0 +1,48 @@
+//          Copyright Christopher Kormanyos 1999 - 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+// This work is based on an earlier work:
+// "Algorithm 910: A Portable C++ Multiple-Precision System for Special-Function Calculations",
+// in ACM TOMS, {VOL 37, ISSUE 4, (February 2011)} (C) ACM, 2011. http://doi.acm.org/10.1145/1916461.1916469
+
+#ifndef CONSTANTS_UTIL_2021_07_24_H_
+  #define CONSTANTS_UTIL_2021_07_24_H_
+
+  #include <cstdint>
+  #include <string>
+
+  #include <e_float/e_float.h>
+
+  #include <utility/util_big_int.h>
+
+  namespace ConstantsUtil
+  {
+    // The decimal digits of pi in the form "3.1415...". For low precision,
+    // these are more digits than an e_float can hold, which is used by the
+    // argument reduction of the trigonometric functions.
+    const std::string& PiDigits();
+
+    // The integer 2/pi base^n_limbs, with the limb base of Util::big_int,
+    // to within one unit. It is used in the reduction of large arguments
+    // of the trigonometric functions, and its cost grows with n_limbs.
+    Util::big_int TwoOverPiScaled(const std::size_t n_limbs);
+
+    // Calculate the constants for precisions beyond the tabulated digits.
+    // Series with rational terms are summed exactly with binary splitting.
+    e_float CalculatePi        ();
+    e_float CalculateE         ();
+    e_float CalculateLn2       ();
+    e_float CalculateLn10      ();
+    e_float CalculateEulerGamma();
+    e_float CalculateCatalan   ();
+    e_float CalculateGlaisher  ();
+    e_float CalculateKhinchin  ();
+
+    // The logarithm of Glaisher's constant from the Euler-Maclaurin
+    // summation around M = big_m, which is accurate for big_m >= tolerance.
+    e_float CalculateLogGlaisher(const std::uint32_t big_m);
+  }
+
+#endif // CONSTANTS_UTIL_2021_07_24_H_
@@ -9,308 +9,545 @@
 // in ACM TOMS, {VOL 37, ISSUE 4, (February 2011)} (C) ACM, 2011. http://doi.acm.org/10.1145/1916461.1916469
 
 #include <algorithm>
-#include <numeric>
-#include <functional>
+#include <cmath>
+#include <vector>
 
 #include <e_float/e_float_functions.h>
+#include <functions/elementary/hyper_g_util.h>
+#include <utility/util_big_int.h>
 
-e_float ef::hypergeometric_0f0(const e_float& x)
+namespace HyperG_Series
 {
-  // Compute the series representation of Hypergeometric0F0 taken from
-  // http://functions.wolfram.com/HypergeometricFunctions/Hypergeometric0F0/06/01/
-  // There are no checks on input range or parameter boundaries.
-
-  e_float x_pow_n_div_n_fact(x);
-  
-  e_float H0F0 = ef::one() + x_pow_n_div_n_fact;
-
-  std::int32_t n;
-
-  // Series expansion of hypergeometric_0f0(; ; x).
-  for(n = static_cast<std::int32_t>(2); n < ef::max_iteration(); n++)
+  // The hypergeometric series sum_n c_n x^n has the coefficient ratio
+  // c_n / c_{n-1} = prod_i (a_i + n - 1) / (n prod_j (b_j + n - 1)).
+  // A parameter which is a small rational number num / den with
+  // den <= 8 contributes the integer factors num + den (n - 1) and den,
+  // which are applied with the fast multiplication and division by
+  // an integer. Other parameters require full multiplications.
+
+  struct parameter
+  {
+    e_float      value;
+    double       approx;
+    bool         is_rational;
+    std::int64_t num;
+    std::int64_t den;
+  };
+
+  static parameter MakeParameter(const e_float& p)
   {
-    x_pow_n_div_n_fact *= x;
-    x_pow_n_div_n_fact /= n;
+    parameter prm = { p, ef::to_double(p), false, static_cast<std::int64_t>(0), static_cast<std::int64_t>(1) };
 
-    if(n > static_cast<std::int32_t>(20))
+    if(ef::fabs(p) < ef::million())
     {
-      const std::int64_t order_check = static_cast<std::int64_t>(x_pow_n_div_n_fact.order() - H0F0.order());
-
-      if(order_check < -ef::tolerance())
+      for(std::int64_t d = static_cast<std::int64_t>(1); d <= static_cast<std::int64_t>(8); ++d)
       {
-        break;
+        const e_float pd = p * d;
+
+        if(ef::isint(pd))
+        {
+          prm.is_rational = true;
+          prm.num         = ef::to_int64(pd);
+          prm.den         = d;
+
+          break;
+        }
       }
     }
 
-    H0F0 += x_pow_n_div_n_fact;
+    return prm;
   }
 
-  return ((n < ef::max_iteration()) ? H0F0 : std::numeric_limits<e_float>::quiet_NaN());
-}
-
-e_float ef::hypergeometric_0f1(const e_float& b, const e_float& x)
-{
-  // Compute the series representation of Hypergeometric0F1 taken from
-  // http://functions.wolfram.com/HypergeometricFunctions/Hypergeometric0F1/06/01/01/
-  // There are no checks on input range or parameter boundaries.
+  static parameter MakeRationalParameter(const HyperGUtil::rational_type& r)
+  {
+    const e_float p = e_float(r.first) / r.second;
 
-  e_float x_pow_n_div_n_fact(x);
-  e_float pochham_b         (b);
-  e_float bp                (b);
+    const parameter prm = { p, ef::to_double(p), true, static_cast<std::int64_t>(r.first), static_cast<std::int64_t>(r.second) };
 
-  e_float H0F1 = ef::one() + (x_pow_n_div_n_fact / pochham_b);
+    return prm;
+  }
 
-  std::int32_t n;
+  static std::int64_t RationalFactor(const parameter& prm, const std::uint32_t n)
+  {
+    // The numerator of (num / den) + n - 1.
+    return static_cast<std::int64_t>(prm.num + (prm.den * static_cast<std::int64_t>(n - 1U)));
+  }
 
-  // Series expansion of hypergeometric_0f1(; b; x).
-  for(n = static_cast<std::int32_t>(2); n < ef::max_iteration(); n++)
+  static bool NumberOfTerms(const std::vector<parameter>& a,
+                            const std::vector<parameter>& b,
+                            const e_float& x,
+                            const std::uint32_t n_max,
+                            std::uint32_t& n_terms)
   {
-    x_pow_n_div_n_fact *= x;
-    x_pow_n_div_n_fact /= n;
+    // Estimate the number of terms needed for convergence using the
+    // logarithms of the coefficient ratios in double precision. Detect
+    // a terminating series and return false for a pole or divergence.
+    // The series is summed to the precision of its argument, which is
+    // less than the full precision within precision-doubling iterations.
+    double       dd;
+    std::int64_t ne;
+    ef::to_parts(x, dd, ne);
+
+    const std::int32_t x_prec = x.precision();
 
-    pochham_b *= ++bp;
+    const double log10_x = std::log10(std::fabs(dd)) + static_cast<double>(ne);
+    const double tol     = static_cast<double>((x_prec < std::numeric_limits<e_float>::digits10) ? static_cast<std::int64_t>(x_prec) : ef::tolerance());
 
-    const e_float term = x_pow_n_div_n_fact / pochham_b;
+    double log10_term     = 0.0;
+    double log10_term_max = 0.0;
 
-    if(n > static_cast<std::int32_t>(20))
+    for(std::uint32_t n = 1U; n < n_max; ++n)
     {
-      const std::int64_t order_check = static_cast<std::int64_t>(term.order() - H0F1.order());
+      double log10_ratio = log10_x - std::log10(static_cast<double>(n));
 
-      if(order_check < -ef::tolerance())
+      for(std::size_t i = 0U; i < a.size(); ++i)
       {
-        break;
+        const double t = (a[i].is_rational ? (static_cast<double>(RationalFactor(a[i], n)) / static_cast<double>(a[i].den))
+                                           : (a[i].approx + static_cast<double>(n - 1U)));
+
+        if(t == 0.0)
+        {
+          // The series terminates.
+          n_terms = n - 1U;
+          return true;
+        }
+
+        log10_ratio += std::log10(std::fabs(t));
       }
-    }
 
-    H0F1 += term;
-  }
+      for(std::size_t j = 0U; j < b.size(); ++j)
+      {
+        const double t = (b[j].is_rational ? (static_cast<double>(RationalFactor(b[j], n)) / static_cast<double>(b[j].den))
+                                           : (b[j].approx + static_cast<double>(n - 1U)));
 
-  return ((n < ef::max_iteration()) ? H0F1 : std::numeric_limits<e_float>::quiet_NaN());
-}
+        if(t == 0.0)
+        {
+          return false;
+        }
 
-e_float ef::hypergeometric_1f0(const e_float& a, const e_float& x)
-{
-  // Compute the series representation of Hypergeometric1F0 taken from
-  // http://functions.wolfram.com/HypergeometricFunctions/Hypergeometric1F0/06/01/01/
-  // and also see the corresponding section for the power function (i.e. x^a).
-  // There are no checks on input range or parameter boundaries.
+        log10_ratio -= std::log10(std::fabs(t));
+      }
 
-  e_float x_pow_n_div_n_fact(x);
-  e_float pochham_a         (a);
-  e_float ap                (a);
+      log10_term += log10_ratio;
 
-  e_float H1F0 = ef::one() + (pochham_a * x_pow_n_div_n_fact);
+      log10_term_max = (std::max)(log10_term_max, log10_term);
 
-  std::int32_t n;
+      if((log10_ratio < 0.0) && (log10_term < (log10_term_max - tol)))
+      {
+        n_terms = n;
+        return true;
+      }
+    }
 
-  // Series expansion of hypergeometric_1f0(a; ; x).
-  for(n = static_cast<std::int32_t>(2); n < ef::max_iteration(); n++)
-  {
-    x_pow_n_div_n_fact *= x;
-    x_pow_n_div_n_fact /= n;
+    return false;
+  }
 
-    pochham_a *= ++ap;
+  class integer_factors
+  {
+  public:
+    // Apply a sequence of integer factors to an e_float, either as
+    // multiplications or as divisions. Factors are accumulated as long
+    // as their product fits in a single limb, such that the fast
+    // multiplication or division by an integer is used.
+    integer_factors(e_float& u, const bool b_divide) : my_u     (u),
+                                                       my_p     (static_cast<std::uint64_t>(1U)),
+                                                       my_divide(b_divide),
+                                                       my_neg   (false) { }
+
+    ~integer_factors()
+    {
+      apply();
 
-    const e_float term = pochham_a * x_pow_n_div_n_fact;
+      if(my_neg)
+      {
+        my_u = -my_u;
+      }
+    }
 
-    if(n > static_cast<std::int32_t>(20))
+    void push(const std::int64_t f)
     {
-      const std::int64_t order_check = static_cast<std::int64_t>(term.order() - H1F0.order());
+      if(f < static_cast<std::int64_t>(0)) { my_neg = (!my_neg); }
 
-      if(order_check < -ef::tolerance())
+      const std::uint64_t af = static_cast<std::uint64_t>((f < static_cast<std::int64_t>(0)) ? -f : f);
+
+      if((my_p * af) >= static_cast<std::uint64_t>(100000000U))
       {
-        break;
+        apply();
       }
+
+      my_p *= af;
     }
 
-    H1F0 += term;
-  }
+  private:
+    e_float&      my_u;
+    std::uint64_t my_p;
+    const bool    my_divide;
+    bool          my_neg;
 
-  return ((n < ef::max_iteration()) ? H1F0 : std::numeric_limits<e_float>::quiet_NaN());
-}
+    void apply()
+    {
+      if(my_p != static_cast<std::uint64_t>(1U))
+      {
+        static_cast<void>(my_divide ? my_u.div_unsigned_long_long(static_cast<unsigned long long>(my_p))
+                                    : my_u.mul_unsigned_long_long(static_cast<unsigned long long>(my_p)));
 
-e_float ef::hypergeometric_1f1(const e_float& a, const e_float& b, const e_float& x)
-{
-  // Compute the series representation of hypergeometric_1f1 taken from
-  // Abramowitz and Stegun 13.1.2, page 504.
-  // There are no checks on input range or parameter boundaries.
+        my_p = static_cast<std::uint64_t>(1U);
+      }
+    }
+
+    integer_factors(const integer_factors&) = delete;
+    integer_factors& operator=(const integer_factors&) = delete;
+  };
 
-  e_float x_pow_n_div_n_fact(x);
-  e_float pochham_a         (a);
-  e_float pochham_b         (b);
-  e_float ap                (a);
-  e_float bp                (b);
-  
-  e_float H1F1 = ef::one() + ((pochham_a / pochham_b) * x_pow_n_div_n_fact);
+  static void ApplyRationalNumerator(e_float& u,
+                                     const std::vector<parameter>& a,
+                                     const std::vector<parameter>& b,
+                                     const std::uint32_t n,
+                                     const bool b_divide)
+  {
+    // The integer numerator of the part of c_n / c_{n-1} which stems
+    // from the rational parameters.
+    integer_factors factors(u, b_divide);
 
-  std::int32_t n;
+    for(std::size_t i = 0U; i < a.size(); ++i) { if(a[i].is_rational) { factors.push(RationalFactor(a[i], n)); } }
+    for(std::size_t j = 0U; j < b.size(); ++j) { if(b[j].is_rational) { factors.push(b[j].den); } }
+  }
 
-  // Series expansion of hypergeometric_1f1(a, b ; x).
-  for(n = static_cast<std::int32_t>(2); n < ef::max_iteration(); n++)
+  static void ApplyRationalDenominator(e_float& u,
+                                       const std::vector<parameter>& a,
+                                       const std::vector<parameter>& b,
+                                       const std::uint32_t n,
+                                       const bool b_divide)
   {
-    x_pow_n_div_n_fact *= x;
-    x_pow_n_div_n_fact /= n;
+    // The integer denominator of the part of c_n / c_{n-1} which stems
+    // from the rational parameters, including the factor n.
+    integer_factors factors(u, b_divide);
+
+    factors.push(static_cast<std::int64_t>(n));
+
+    for(std::size_t j = 0U; j < b.size(); ++j) { if(b[j].is_rational) { factors.push(RationalFactor(b[j], n)); } }
+    for(std::size_t i = 0U; i < a.size(); ++i) { if(a[i].is_rational) { factors.push(a[i].den); } }
+  }
+
+  static e_float SumRectangular(const std::vector<parameter>& a,
+                                const std::vector<parameter>& b,
+                                const e_float& x,
+                                const std::uint32_t n_terms)
+  {
+    // Sum the series with rational parameters by rectangular splitting
+    // (Paterson-Stockmeyer, Smith). The powers x^0...x^m with m ~ Sqrt[n_terms]
+    // are computed once. The blocks of m terms are evaluated from the top with
+    // Horner's rule, in which the coefficient ratios only need the fast
+    // multiplication and division by integers. This requires about
+    // 2 Sqrt[n_terms] full multiplications and no full divisions.
+    const std::uint32_t m = (std::max)(static_cast<std::uint32_t>(1U),
+                                       static_cast<std::uint32_t>(std::ceil(std::sqrt(static_cast<double>(n_terms + 1U)))));
+
+    std::vector<e_float> x_pow(static_cast<std::size_t>(m + 1U));
+
+    x_pow[0U] = ef::one();
+    x_pow[1U] = x;
 
-    pochham_a *= ++ap;
-    pochham_b *= ++bp;
+    for(std::uint32_t j = 2U; j <= m; ++j)
+    {
+      x_pow[j] = x_pow[j / 2U] * x_pow[j - (j / 2U)];
+    }
+
+    const std::uint32_t number_of_blocks = static_cast<std::uint32_t>((n_terms / m) + 1U);
 
-    const e_float term = (pochham_a / pochham_b) * x_pow_n_div_n_fact;
+    e_float sum;
 
-    if(n > static_cast<std::int32_t>(20))
+    for(std::uint32_t i = number_of_blocks; i > 0U; --i)
     {
-      const std::int64_t order_check = static_cast<std::int64_t>(term.order() - H1F1.order());
+      const std::uint32_t base = static_cast<std::uint32_t>((i - 1U) * m);
 
-      if(order_check < -ef::tolerance())
+      // The highest block is summed up to the last term. The other
+      // blocks are linked to the sum of the blocks above them.
+      const std::uint32_t j_top = ((i == number_of_blocks) ? static_cast<std::uint32_t>(n_terms - base) : m);
+
+      e_float u = ((i == number_of_blocks) ? x_pow[j_top] : (sum * x_pow[m]));
+
+      for(std::uint32_t j = j_top; j > 0U; --j)
       {
-        break;
+        ApplyRationalNumerator  (u, a, b, base + j, false);
+        ApplyRationalDenominator(u, a, b, base + j, true);
+
+        u += x_pow[j - 1U];
       }
+
+      sum.swap(u);
     }
 
-    H1F1 += term;
+    return sum;
   }
 
-  return ((n < ef::max_iteration()) ? H1F1 : std::numeric_limits<e_float>::quiet_NaN());
-}
+  static e_float SumBackward(const std::vector<parameter>& a,
+                             const std::vector<parameter>& b,
+                             const e_float& x,
+                             const std::uint32_t n_terms)
+  {
+    // Sum the series with general parameters with the backward recurrence
+    // S_n = 1 + (c_n / c_{n-1}) x S_{n+1}, where S_n = P_n / Q_n is kept
+    // as a fraction. This needs no division per term and only one
+    // single division at the end.
+    e_float p(ef::one());
+    e_float q(ef::one());
+
+    for(std::uint32_t n = n_terms; n > 0U; --n)
+    {
+      p *= x;
 
-e_float ef::hypergeometric_2f0(const e_float& a, const e_float& b, const e_float& x)
-{
-  // Compute the series representation of hypergeometric_2f0.
-  // There are no checks on input range or parameter boundaries.
+      for(std::size_t i = 0U; i < a.size(); ++i)
+      {
+        if(!a[i].is_rational) { p *= (a[i].value + static_cast<std::int32_t>(n - 1U)); }
+      }
 
-  e_float x_pow_n_div_n_fact(x);
-  e_float pochham_a         (a);
-  e_float pochham_b         (b);
-  e_float ap                (a);
-  e_float bp                (b);
+      for(std::size_t j = 0U; j < b.size(); ++j)
+      {
+        if(!b[j].is_rational) { q *= (b[j].value + static_cast<std::int32_t>(n - 1U)); }
+      }
 
-  e_float H2F0 = ef::one() + ((pochham_a * pochham_b) * x_pow_n_div_n_fact);
+      ApplyRationalNumerator  (p, a, b, n, false);
+      ApplyRationalDenominator(q, a, b, n, false);
 
-  std::int32_t n;
+      p += q;
+    }
+
+    return p / q;
+  }
 
-  // Series expansion of hypergeometric_2f0(a, b; ; x).
-  for(n = static_cast<std::int32_t>(2); n < ef::max_iteration(); n++)
+  // Binary splitting is used for rational parameters and rational argument
+  // above this precision. The number of terms is limited such that the
+  // integer factors of the coefficient ratios fit in a single limb.
+  static const std::int32_t  binary_splitting_digits10 = static_cast<std::int32_t>(1000);
+  static const std::uint32_t binary_splitting_n_max    = static_cast<std::uint32_t>(Util::big_int::limb_base / 16U);
+
+  static std::int64_t Gcd(std::int64_t u, std::int64_t v)
   {
-    x_pow_n_div_n_fact *= x;
-    x_pow_n_div_n_fact /= n;
+    while(v != static_cast<std::int64_t>(0))
+    {
+      const std::int64_t r = static_cast<std::int64_t>(u % v);
 
-    pochham_a *= ++ap;
-    pochham_b *= ++bp;
+      u = v;
+      v = r;
+    }
 
-    const e_float term = (pochham_a * pochham_b) * x_pow_n_div_n_fact;
+    return ((u < static_cast<std::int64_t>(0)) ? -u : u);
+  }
 
-    if(n > static_cast<std::int32_t>(20))
-    {
-      const std::int64_t order_check = static_cast<std::int64_t>(term.order() - H2F0.order());
+  static void TermRatio(const std::vector<parameter>& a,
+                        const std::vector<parameter>& b,
+                        const parameter& x,
+                        const std::uint32_t n,
+                        Util::big_int& p,
+                        Util::big_int& q)
+  {
+    // The coefficient ratio times x is p(n) / q(n). Common factors of the
+    // integer factors are cancelled, which keeps the products in binary
+    // splitting small.
+    std::vector<std::int64_t> num(1U, x.num);
+    std::vector<std::int64_t> den(1U, x.den);
+
+    den.push_back(static_cast<std::int64_t>(n));
+
+    for(std::size_t i = 0U; i < a.size(); ++i) { num.push_back(RationalFactor(a[i], n)); den.push_back(a[i].den); }
+    for(std::size_t j = 0U; j < b.size(); ++j) { den.push_back(RationalFactor(b[j], n)); num.push_back(b[j].den); }
 
-      if(order_check < -ef::tolerance())
+    for(std::size_t i = 0U; i < num.size(); ++i)
+    {
+      for(std::size_t j = 0U; j < den.size(); ++j)
       {
-        break;
+        const std::int64_t g = Gcd(num[i], den[j]);
+
+        if(g > static_cast<std::int64_t>(1))
+        {
+          num[i] /= g;
+          den[j] /= g;
+        }
       }
     }
 
-    H2F0 += term;
+    p = Util::big_int(static_cast<std::int64_t>(1));
+    q = Util::big_int(static_cast<std::int64_t>(1));
+
+    for(std::size_t i = 0U; i < num.size(); ++i) { p.mul_limb(static_cast<std::int32_t>(num[i])); }
+    for(std::size_t j = 0U; j < den.size(); ++j) { q.mul_limb(static_cast<std::int32_t>(den[j])); }
   }
 
-  return ((n < ef::max_iteration()) ? H2F0 : std::numeric_limits<e_float>::quiet_NaN());
-}
+  static void BinarySplit(const std::vector<parameter>& a,
+                          const std::vector<parameter>& b,
+                          const parameter& x,
+                          const std::uint32_t n1,
+                          const std::uint32_t n2,
+                          const bool b_need_p,
+                          Util::big_int& p,
+                          Util::big_int& q,
+                          Util::big_int& t)
+  {
+    // With the term ratio p(n) / q(n), compute P = prod p(n), Q = prod q(n)
+    // and T = Q sum_{n1 <= k < n2} prod_{n1 <= n <= k} p(n) / q(n) in the
+    // range n1 <= n < n2.
+    if((n2 - n1) == 1U)
+    {
+      TermRatio(a, b, x, n1, p, q);
 
-e_float ef::hypergeometric_2f1(const e_float& a, const e_float& b, const e_float& c, const e_float& x)
-{
-  // Compute the series representation of hypergeometric_2f1 taken from
-  // Abramowitz and Stegun 15.1.1.
-  // There are no checks on input range or parameter boundaries.
+      t = p;
+
+      return;
+    }
+
+    const std::uint32_t n_mid = static_cast<std::uint32_t>((n1 + n2) / 2U);
+
+    Util::big_int pl, ql, tl;
+    Util::big_int pr, qr, tr;
+
+    BinarySplit(a, b, x, n1,    n_mid, true,     pl, ql, tl);
+    BinarySplit(a, b, x, n_mid, n2,    b_need_p, pr, qr, tr);
+
+    t  = tl * qr;
+    t += (pl * tr);
+    q  = ql * qr;
 
-  e_float x_pow_n_div_n_fact(x);
-  e_float pochham_a         (a);
-  e_float pochham_b         (b);
-  e_float pochham_c         (c);
-  e_float ap                (a);
-  e_float bp                (b);
-  e_float cp                (c);
+    if(b_need_p)
+    {
+      p = pl * pr;
+    }
+  }
+
+  static e_float SumBinarySplitting(const std::vector<parameter>& a,
+                                    const std::vector<parameter>& b,
+                                    const parameter& x,
+                                    const std::uint32_t n_terms)
+  {
+    // The series is summed exactly in integers. There is only one single
+    // division at the end.
+    if(n_terms == 0U)
+    {
+      return ef::one();
+    }
+
+    Util::big_int p, q, t;
 
-  e_float H2F1 = ef::one() + (((pochham_a * pochham_b) / pochham_c) * x_pow_n_div_n_fact);
+    BinarySplit(a, b, x, 1U, n_terms + 1U, false, p, q, t);
 
-  std::int32_t n;
+    return ef::one() + (t.to_e_float() / q.to_e_float());
+  }
 
-  // Series expansion of hypergeometric_2f1(a, b; c; x).
-  for(n = static_cast<std::int32_t>(2); n < ef::max_iteration(); n++)
+  static e_float Sum(const std::vector<e_float>& a, const std::vector<e_float>& b, const e_float& x)
   {
-    x_pow_n_div_n_fact *= x;
-    x_pow_n_div_n_fact /= n;
+    if(ef::iszero(x))
+    {
+      return ef::one();
+    }
+
+    std::vector<parameter> ap;
+    std::vector<parameter> bp;
 
-    pochham_a *= ++ap;
-    pochham_b *= ++bp;
-    pochham_c *= ++cp;
+    bool b_all_rational = true;
 
-    const e_float term = ((pochham_a * pochham_b) / pochham_c) * x_pow_n_div_n_fact;
+    for(std::size_t i = 0U; i < a.size(); ++i) { ap.push_back(MakeParameter(a[i])); b_all_rational = (b_all_rational && ap.back().is_rational); }
+    for(std::size_t j = 0U; j < b.size(); ++j) { bp.push_back(MakeParameter(b[j])); b_all_rational = (b_all_rational && bp.back().is_rational); }
 
-    if(n > static_cast<std::int32_t>(20))
+    std::uint32_t n_terms;
+
+    if(b_all_rational && (std::numeric_limits<e_float>::digits10 >= binary_splitting_digits10))
     {
-      const std::int64_t order_check = static_cast<std::int64_t>(term.order() - H2F1.order());
+      const parameter xp = MakeParameter(x);
 
-      if(order_check < -ef::tolerance())
+      if(xp.is_rational)
       {
-        break;
+        return (NumberOfTerms(ap, bp, x, binary_splitting_n_max, n_terms) ? SumBinarySplitting(ap, bp, xp, n_terms)
+                                                                         : std::numeric_limits<e_float>::quiet_NaN());
       }
     }
 
-    H2F1 += term;
+    if(!NumberOfTerms(ap, bp, x, static_cast<std::uint32_t>(ef::max_iteration()), n_terms))
+    {
+      return std::numeric_limits<e_float>::quiet_NaN();
+    }
+
+    return (b_all_rational ? SumRectangular(ap, bp, x, n_terms)
+                           : SumBackward   (ap, bp, x, n_terms));
   }
+}
+
+e_float ef::hypergeometric_0f0(const e_float& x)
+{
+  // Compute the series representation of Hypergeometric0F0 taken from
+  // http://functions.wolfram.com/HypergeometricFunctions/Hypergeometric0F0/06/01/
+  // There are no checks on input range or parameter boundaries.
 
-  return ((n < ef::max_iteration()) ? H2F1 : std::numeric_limits<e_float>::quiet_NaN());
+  return HyperG_Series::Sum(std::vector<e_float>(), std::vector<e_float>(), x);
 }
 
-e_float ef::hypergeometric_pfq(const std::deque<e_float>& a, const  std::deque<e_float>& b, const e_float& x)
+e_float ef::hypergeometric_0f1(const e_float& b, const e_float& x)
 {
-  // Compute the series representation of hypergeometric_pfq.
+  // Compute the series representation of Hypergeometric0F1 taken from
+  // http://functions.wolfram.com/HypergeometricFunctions/Hypergeometric0F1/06/01/01/
   // There are no checks on input range or parameter boundaries.
 
-  e_float x_pow_n_div_n_fact(x);
+  return HyperG_Series::Sum(std::vector<e_float>(), std::vector<e_float>(1U, b), x);
+}
 
-  // The pochhammer symbols for the multiplications in the series expansion
-  // will be stored in STL-containers.
-  std::vector<e_float> ap(a.cbegin(), a.cend());
-  std::vector<e_float> bp(b.cbegin(), b.cend());
+e_float ef::hypergeometric_1f0(const e_float& a, const e_float& x)
+{
+  // Compute the series representation of Hypergeometric1F0 taken from
+  // http://functions.wolfram.com/HypergeometricFunctions/Hypergeometric1F0/06/01/01/
+  // and also see the corresponding section for the power function (i.e. x^a).
+  // There are no checks on input range or parameter boundaries.
 
-  // Initialize the pochhammer product terms with the products of the form:
-  // [(a0)_1 * (a1)_1 * (a2)_1 * ...], or [(b0)_1 * (b1)_1 * (b2)_1 * ...].
-  e_float pochham_a = std::accumulate(ap.cbegin(), ap.cend(), ef::one(), std::multiplies<e_float>());
-  e_float pochham_b = std::accumulate(bp.cbegin(), bp.cend(), ef::one(), std::multiplies<e_float>());
+  return HyperG_Series::Sum(std::vector<e_float>(1U, a), std::vector<e_float>(), x);
+}
 
-  e_float HPFQ = ef::one() + ((pochham_a / pochham_b) * x_pow_n_div_n_fact);
+e_float ef::hypergeometric_1f1(const e_float& a, const e_float& b, const e_float& x)
+{
+  // Compute the series representation of hypergeometric_1f1 taken from
+  // Abramowitz and Stegun 13.1.2, page 504.
+  // There are no checks on input range or parameter boundaries.
 
-  std::int32_t n;
+  return HyperG_Series::Sum(std::vector<e_float>(1U, a), std::vector<e_float>(1U, b), x);
+}
 
-  // Series expansion of hypergeometric_pfq[{a0, a1, a2, ...}; {b0, b1, b2, ...}; x].
-  for(n = static_cast<std::int32_t>(2); n < ef::max_iteration(); n++)
-  {
-    x_pow_n_div_n_fact *= x;
-    x_pow_n_div_n_fact /= n;
+e_float ef::hypergeometric_2f0(const e_float& a, const e_float& b, const e_float& x)
+{
+  // Compute the series representation of hypergeometric_2f0.
+  // There are no checks on input range or parameter boundaries.
 
-    // Increment each of the pochhammer elements in a and b.
-    std::transform(ap.cbegin(), ap.cend(), ap.begin(), std::bind(std::plus<e_float>(), ef::one(), std::placeholders::_1));
-    std::transform(bp.cbegin(), bp.cend(), bp.begin(), std::bind(std::plus<e_float>(), ef::one(), std::placeholders::_1));
+  return HyperG_Series::Sum(std::vector<e_float>( { a, b } ), std::vector<e_float>(), x);
+}
 
-    // Multiply the pochhammer product terms with the products of the incremented
-    // pochhammer elements. These are products of the form:
-    // [(a0)_k * (a1)_k * (a2)_k * ...], or [(b0)_k * (b1)_k * (b2)_k * ...].
-    pochham_a *= std::accumulate(ap.cbegin(), ap.cend(), ef::one(), std::multiplies<e_float>());
-    pochham_b *= std::accumulate(bp.cbegin(), bp.cend(), ef::one(), std::multiplies<e_float>());
+e_float ef::hypergeometric_2f1(const e_float& a, const e_float& b, const e_float& c, const e_float& x)
+{
+  // Compute the series representation of hypergeometric_2f1 taken from
+  // Abramowitz and Stegun 15.1.1.
+  // There are no checks on input range or parameter boundaries.
 
-    const e_float term = (pochham_a / pochham_b) * x_pow_n_div_n_fact;
+  return HyperG_Series::Sum(std::vector<e_float>( { a, b } ), std::vector<e_float>(1U, c), x);
+}
 
-    if(n > static_cast<std::int32_t>(20))
-    {
-      const std::int64_t order_check = static_cast<std::int64_t>(term.order() - HPFQ.order());
+e_float ef::hypergeometric_pfq(const std::deque<e_float>& a, const  std::deque<e_float>& b, const e_float& x)
+{
+  // Compute the series representation of hypergeometric_pfq.
+  // There are no checks on input range or parameter boundaries.
 
-      if(order_check < -ef::tolerance())
-      {
-        break;
-      }
-    }
+  return HyperG_Series::Sum(std::vector<e_float>(a.cbegin(), a.cend()), std::vector<e_float>(b.cbegin(), b.cend()), x);
+}
 
-    HPFQ += term;
-  }
+e_float HyperGUtil::HypergeometricPFQRational(const std::vector<rational_type>& a,
+                                              const std::vector<rational_type>& b,
+                                              const rational_type& x)
+{
+  std::vector<HyperG_Series::parameter> ap;
+  std::vector<HyperG_Series::parameter> bp;
+
+  for(std::size_t i = 0U; i < a.size(); ++i) { ap.push_back(HyperG_Series::MakeRationalParameter(a[i])); }
+  for(std::size_t j = 0U; j < b.size(); ++j) { bp.push_back(HyperG_Series::MakeRationalParameter(b[j])); }
+
+  const HyperG_Series::parameter xp = HyperG_Series::MakeRationalParameter(x);
+
+  std::uint32_t n_terms;
 
-  return ((n < ef::max_iteration()) ? HPFQ : std::numeric_limits<e_float>::quiet_NaN());
+  return (HyperG_Series::NumberOfTerms(ap, bp, xp.value, HyperG_Series::binary_splitting_n_max, n_terms)
+           ? HyperG_Series::SumBinarySplitting(ap, bp, xp, n_terms)
+           : std::numeric_limits<e_float>::quiet_NaN());
 }
@@ -8,7 +8,10 @@
 // "Algorithm 910: A Portable C++ Multiple-Precision System for Special-Function Calculations",
 // in ACM TOMS, {VOL 37, ISSUE 4, (February 2011)} (C) ACM, 2011. http://doi.acm.org/10.1145/1916461.1916469
 
+#include <algorithm>
 #include <array>
+#include <cmath>
+#include <limits>
 #include <map>
 #include <numeric>
 #include <vector>
@@ -16,6 +19,7 @@
 #include <e_float/e_float_functions.h>
 #include <e_float/detail/e_float_detail_pown_template.h>
 
+#include <utility/util_big_int.h>
 #include <utility/util_lexical_cast.h>
 
 namespace ElementaryTrans_Series
@@ -154,6 +158,353 @@ e_float ef::rootn_inverse(const e_float& x, const std::int32_t p)
   return rtn_inv;
 }
 
+namespace BitBurst_Series
+{
+  // The coefficients q(n) and b(n) of the series below.
+  typedef void(*coefficient_function_type)(const std::uint32_t, std::int32_t&, std::int32_t&);
+
+  static void BinarySplit(const Util::big_int& p,
+                          const std::size_t m,
+                          const coefficient_function_type pfn,
+                          const std::uint32_t n1,
+                          const std::uint32_t n2,
+                          const bool b_need_p,
+                          Util::big_int& pp,
+                          Util::big_int& qq,
+                          Util::big_int& bb,
+                          Util::big_int& tt)
+  {
+    // With u = p / base^m and the term u^n / [b(n) q(1) ... q(n)] of the series,
+    // compute P = p^(n2 - n1), Q = prod q(n), B = prod b(n) and
+    // T = B Q base^(m (n2 - n1)) sum_{n1 <= k < n2} prod_{n1 <= n <= k} [p / (q(n) base^m)] / b(k)
+    // in the range n1 <= n < n2. The powers of the base are limb shifts.
+    if((n2 - n1) == 1U)
+    {
+      std::int32_t qn;
+      std::int32_t bn;
+
+      pfn(n1, qn, bn);
+
+      pp = p;
+      qq = Util::big_int(static_cast<std::int64_t>(qn));
+      bb = Util::big_int(static_cast<std::int64_t>(bn));
+      tt = p;
+
+      return;
+    }
+
+    const std::uint32_t n_mid = static_cast<std::uint32_t>((n1 + n2) / 2U);
+
+    Util::big_int pl, ql, bl, tl;
+    Util::big_int pr, qr, br, tr;
+
+    BinarySplit(p, m, pfn, n1,    n_mid, true,     pl, ql, bl, tl);
+    BinarySplit(p, m, pfn, n_mid, n2,    b_need_p, pr, qr, br, tr);
+
+    tt  = tl * (br * qr);
+    tt.shift_limbs(static_cast<std::size_t>(m * (n2 - n_mid)));
+    tt += ((bl * pl) * tr);
+    qq  = ql * qr;
+    bb  = bl * br;
+
+    if(b_need_p)
+    {
+      pp = pl * pr;
+    }
+  }
+
+  static e_float Sum(const Util::big_int& p,
+                     const std::size_t m,
+                     const coefficient_function_type pfn,
+                     const std::uint32_t n_terms)
+  {
+    // Sum the terms 1 <= n <= n_terms of the series exactly in integers.
+    // There is only one single division at the end.
+    Util::big_int pp, qq, bb, tt;
+
+    BinarySplit(p, m, pfn, 1U, n_terms + 1U, false, pp, qq, bb, tt);
+
+    const e_float scale(1.0, -static_cast<std::int64_t>(m * n_terms) * static_cast<std::int64_t>(8));
+
+    return (tt.to_e_float() / (bb * qq).to_e_float()) * scale;
+  }
+}
+
+namespace Exp_Series
+{
+  static void DivideByProduct(e_float& v, const std::uint32_t lo, const std::uint32_t hi)
+  {
+    // Divide v by the product lo * (lo + 1) * ... * hi. The factors are
+    // grouped such that each divisor remains a single-limb integer.
+    std::uint32_t p = static_cast<std::uint32_t>(1U);
+
+    for(std::uint32_t n = lo; n <= hi; ++n)
+    {
+      if((static_cast<std::uint64_t>(p) * n) >= static_cast<std::uint64_t>(100000000U))
+      {
+        v /= p;
+        p  = static_cast<std::uint32_t>(1U);
+      }
+
+      p *= n;
+    }
+
+    v /= p;
+  }
+
+  static std::int32_t NumberOfTerms(const double log10_r, const std::int32_t n_max = ef::max_iteration())
+  {
+    // Find the number of terms n for which r^n / n! < r * 10^-tolerance,
+    // using Stirling's approximation of Log10[n!].
+    const double tol = static_cast<double>(ef::tolerance());
+
+    std::int32_t n_lo = static_cast<std::int32_t>(1);
+    std::int32_t n_hi = n_max;
+
+    while((n_hi - n_lo) > static_cast<std::int32_t>(1))
+    {
+      const std::int32_t n = static_cast<std::int32_t>((n_lo + n_hi) / 2);
+
+      const double dn = static_cast<double>(n);
+
+      const double log10_n_fact = (dn * std::log10(dn / 2.7182818284590452354)) + (0.5 * std::log10(6.2831853071795864769 * dn));
+
+      ((((dn - 1.0) * log10_r) - log10_n_fact) < -tol) ? n_hi = n : n_lo = n;
+    }
+
+    return n_hi;
+  }
+
+  static double OptimalLog10OfReducedArgument()
+  {
+    // Find the size of the reduced argument r = t / 2^k for which the cost
+    // of the k doublings plus the cost of the rectangular series evaluation
+    // of r is minimal, for the largest reduced argument t = ln2. The cost is
+    // counted in units of full multiplications. The cost of the division by
+    // a small integer and the addition in each term has been calibrated with
+    // efx: it is about one multiplication at 100 digits and falls off like
+    // 1 / digits when the multiplication becomes quadratic. The optimum only
+    // depends on the precision, so smaller arguments simply need fewer halvings.
+    const double tol = static_cast<double>(ef::tolerance());
+
+    const double term_cost = (std::min)(1.0, 200.0 / tol);
+
+    const double log10_ln2 = -0.15917600346297179;
+
+    const std::int32_t k_max = static_cast<std::int32_t>(4.0 * std::sqrt(tol)) + static_cast<std::int32_t>(8);
+
+    double log10_r_best = log10_ln2;
+    double cost_best    = (std::numeric_limits<double>::max)();
+
+    for(std::int32_t k = static_cast<std::int32_t>(0); k <= k_max; ++k)
+    {
+      const double log10_r = log10_ln2 - (static_cast<double>(k) * 0.30102999566398119521);
+
+      const std::int32_t n = NumberOfTerms(log10_r);
+
+      const double cost =   (static_cast<double>(k) * (1.0 + (0.3 * term_cost)))
+                          + (2.0 * std::sqrt(static_cast<double>(n)))
+                          + (term_cost * static_cast<double>(n));
+
+      if(cost < cost_best)
+      {
+        log10_r_best = log10_r;
+        cost_best    = cost;
+      }
+    }
+
+    return log10_r_best;
+  }
+
+  static std::int32_t ReductionPower(const double log10_t, std::int32_t& n_terms)
+  {
+    // Choose the number k of argument halvings from the working precision.
+    static const double       log10_r_opt = OptimalLog10OfReducedArgument();
+    static const std::int32_t n_terms_opt = NumberOfTerms(log10_r_opt);
+
+    if(log10_t > log10_r_opt)
+    {
+      // The reduced argument is at most as large as the optimal one.
+      n_terms = n_terms_opt;
+
+      return static_cast<std::int32_t>(std::ceil((log10_t - log10_r_opt) / 0.30102999566398119521));
+    }
+    else
+    {
+      n_terms = NumberOfTerms(log10_t);
+
+      return static_cast<std::int32_t>(0);
+    }
+  }
+
+  static e_float Expm1Rectangular(const e_float& r, const std::int32_t n_terms)
+  {
+    // Compute Exp[r] - 1 for small positive r with n_terms terms of the Taylor
+    // series. Rectangular splitting (Paterson-Stockmeyer) is used: the powers
+    // r^0...r^m with m ~ Sqrt[n_terms] are computed once. Each block of m terms
+    // is then summed with divisions by small integers and additions only, and
+    // the blocks are combined with Horner's rule in r^m. This requires about
+    // 2 Sqrt[n_terms] full multiplications and no full divisions.
+
+    const std::int32_t m = (std::max)(static_cast<std::int32_t>(2),
+                                      static_cast<std::int32_t>(std::ceil(std::sqrt(static_cast<double>(n_terms)))));
+
+    std::vector<e_float> r_pow(static_cast<std::size_t>(m + 1));
+
+    r_pow[0U] = ef::one();
+    r_pow[1U] = r;
+
+    for(std::int32_t j = static_cast<std::int32_t>(2); j <= m; ++j)
+    {
+      r_pow[static_cast<std::size_t>(j)] = r_pow[static_cast<std::size_t>(j / 2)] * r_pow[static_cast<std::size_t>(j - (j / 2))];
+    }
+
+    const std::int32_t number_of_blocks = static_cast<std::int32_t>((n_terms / m) + 1);
+
+    e_float sum;
+    e_float block_sum;
+    e_float higher_blocks;
+
+    for(std::int32_t i = static_cast<std::int32_t>(number_of_blocks - 1); i >= static_cast<std::int32_t>(0); --i)
+    {
+      const std::uint32_t base = static_cast<std::uint32_t>(i * m);
+
+      // Sum the terms r^j * (base)! / (base + j)! of this block.
+      // The term with j = 0 of the first block (the leading one) is omitted.
+      block_sum = r_pow[static_cast<std::size_t>(m - 1)];
+
+      for(std::int32_t j = static_cast<std::int32_t>(m - 1); j >= static_cast<std::int32_t>(1); --j)
+      {
+        block_sum /= static_cast<std::uint32_t>(base + static_cast<std::uint32_t>(j));
+
+        if((i != static_cast<std::int32_t>(0)) || (j != static_cast<std::int32_t>(1)))
+        {
+          block_sum += r_pow[static_cast<std::size_t>(j - 1)];
+        }
+      }
+
+      if(i != static_cast<std::int32_t>(number_of_blocks - 1))
+      {
+        // Add r^m * (base)! / (base + m)! times the sum of the higher blocks.
+        higher_blocks  = sum;
+        higher_blocks *= r_pow[static_cast<std::size_t>(m)];
+
+        DivideByProduct(higher_blocks, base + 1U, base + static_cast<std::uint32_t>(m));
+
+        block_sum += higher_blocks;
+      }
+
+      sum.swap(block_sum);
+    }
+
+    return sum;
+  }
+
+  // Above this precision, the bit-burst algorithm is faster than the
+  // rectangular splitting with argument halvings.
+  const std::int32_t bit_burst_digits10_crossover = static_cast<std::int32_t>(5000);
+
+  // The bit-burst algorithm leaves the remaining argument to the Taylor
+  // series when this needs at most this number of terms.
+  const std::int32_t bit_burst_series_terms_max = static_cast<std::int32_t>(32);
+
+  static std::int32_t BitBurstNumberOfTerms(const e_float& r)
+  {
+    // For |r| < 1, r^n / n! < 10^-tolerance holds for some n < tolerance.
+    double       dd;
+    std::int64_t ne;
+    ef::to_parts(r, dd, ne);
+
+    return NumberOfTerms(std::log10(std::fabs(dd)) + static_cast<double>(ne),
+                         static_cast<std::int32_t>(ef::tolerance() + static_cast<std::int64_t>(64)));
+  }
+
+  static void ExpCoefficients(const std::uint32_t n, std::int32_t& qn, std::int32_t& bn)
+  {
+    // The terms of Exp[u] - 1 are u^n / n!.
+    qn = static_cast<std::int32_t>(n);
+    bn = static_cast<std::int32_t>(1);
+  }
+
+  static e_float Expm1BitBurst(const e_float& t)
+  {
+    // Compute Exp[t] - 1 for 0 < t < Log[2] with the bit-burst algorithm.
+    // Split off the leading digits a = p / base^m of the argument and use
+    // Exp[t] = Exp[a] Exp[t - a]. The series of Exp[a] - 1 is summed exactly
+    // with binary splitting. The new argument t - a is about as small as t^2,
+    // such that p has twice as many digits in the next step. The factors are
+    // combined with (1 + s) (1 + s_a) - 1 = s + s_a + s s_a, which does not
+    // cancel for small t.
+    e_float s = ef::zero();
+    e_float r = t;
+
+    while((!ef::iszero(r)) && (BitBurstNumberOfTerms(r) > bit_burst_series_terms_max))
+    {
+      // Use base^m > 1 / r^2, such that the new argument is less than r^2.
+      const std::size_t m = static_cast<std::size_t>(((-r.order() * 2) / 8) + 1);
+
+      const Util::big_int p(r, static_cast<std::int64_t>(m * 8U));
+
+      const e_float a = p.to_e_float() * e_float(1.0, -static_cast<std::int64_t>(m * 8U));
+
+      const e_float s_a = BitBurst_Series::Sum(p, m, ExpCoefficients, static_cast<std::uint32_t>(BitBurstNumberOfTerms(a)));
+
+      s += (s_a + (s * s_a));
+
+      r -= a;
+    }
+
+    // The digits of a are rounded, such that the remaining argument
+    // might be negative. This is handled by ef::expm1.
+    const e_float s_r = ef::expm1(r);
+
+    return (s + (s_r + (s * s_r)));
+  }
+
+  static e_float Expm1Reduced(const e_float& t)
+  {
+    // Compute Exp[t] - 1 for 0 < t < Log[2] without losing the relative
+    // precision of the result for small t.
+    if(   (std::numeric_limits<e_float>::digits10 >= bit_burst_digits10_crossover)
+       && (BitBurstNumberOfTerms(t) > bit_burst_series_terms_max))
+    {
+      return Expm1BitBurst(t);
+    }
+
+    double       dd;
+    std::int64_t ne;
+    ef::to_parts(t, dd, ne);
+
+    std::int32_t n_terms = static_cast<std::int32_t>(0);
+
+    const std::int32_t k = ReductionPower(std::log10(dd) + static_cast<double>(ne), n_terms);
+
+    // Scale the argument with r = t / 2^k.
+    e_float r(t);
+
+    for(std::int32_t j = k; j > static_cast<std::int32_t>(0); j -= static_cast<std::int32_t>(26))
+    {
+      r /= static_cast<std::uint32_t>(UINT32_C(1) << (std::min)(j, static_cast<std::int32_t>(26)));
+    }
+
+    // Compute s = exp(r) - 1 and undo the scaling with the k doublings
+    // exp(2r) - 1 = s * (s + 2). Working with s instead of squaring
+    // 1 + s preserves the relative precision of the small quantity s.
+    e_float s = Expm1Rectangular(r, n_terms);
+    e_float s_plus_two;
+
+    for(std::int32_t j = static_cast<std::int32_t>(0); j < k; ++j)
+    {
+      s_plus_two  = s;
+      s_plus_two += ef::two();
+
+      s *= s_plus_two;
+    }
+
+    return s;
+  }
+}
+
 e_float ef::exp(const e_float& x)
 {
   if(x.i_have_my_own_exp())
@@ -197,18 +548,20 @@ e_float ef::exp(const e_float& x)
     return ef::detail::pown_template(ef::e(), ef::to_int64(x));
   }
 
-  // The algorithm for exp has been taken from MPFUN.
+  // The algorithm for exp has been taken from MPFUN, with an adaptive scaling.
   // exp(t) = [ (1 + r + r^2/2! + r^3/3! + r^4/4! ...)^p2 ] * 2^n
-  // where p2 is a power of 2 such as 2048, r = t_prime / p2, and
+  // where p2 = 2^k is a power of 2, r = t_prime / p2, and
   // t_prime = t - n*ln2, with n chosen to minimize the absolute
-  // value of t_prime. In the resulting Taylor series, which is
-  // implemented as a hypergeometric function, |r| is bounded by
-  // ln2 / p2. For small arguments, no scaling is done.
+  // value of t_prime. The number k is chosen from the working
+  // precision such that the k squarings and the Taylor series
+  // of r have minimal total cost. For small arguments, n is zero.
+  // At very high precision, Exp[t_prime] - 1 uses the bit-burst
+  // algorithm instead of the squarings.
 
   const bool b_scale = (xx.order() > static_cast<std::int64_t>(-4));
 
-  // Compute the exponential series of the (possibly) scaled argument.
-  e_float exp_series;
+  e_float      t_prime;
+  std::int64_t n_ln2 = static_cast<std::int64_t>(0);
 
   if(b_scale)
   {
@@ -217,19 +570,68 @@ e_float ef::exp(const e_float& x)
 
     const e_float nf = ef::integer_part(xx * one_over_ln2);
 
-    // The scaling is 2^11 = 2048.
-    const std::int32_t p2 = static_cast<std::int32_t>(std::uint32_t(1U) << 11);
-
-    exp_series = ef::detail::pown_template(ef::hypergeometric_0f0((xx - (nf * ef::ln2())) / p2), static_cast<std::int64_t>(p2)) * ef::pow2(ef::to_int64(nf));
+    t_prime = xx - (nf * ef::ln2());
+    n_ln2   = ef::to_int64(nf);
   }
   else
   {
-    exp_series = ef::hypergeometric_0f0(xx);
+    t_prime = xx;
   }
 
+  if(ef::iszero(t_prime))
+  {
+    const e_float exp_series = ef::pow2(n_ln2);
+
+    return ((!bo_x_is_neg) ? exp_series : (ef::one() / exp_series));
+  }
+
+  const e_float s = Exp_Series::Expm1Reduced(t_prime);
+
+  const e_float exp_series = (b_scale ? ((s + ef::one()) * ef::pow2(n_ln2)) : (s + ef::one()));
+
   return ((!bo_x_is_neg) ? exp_series : (ef::one() / exp_series));
 }
 
+e_float ef::expm1(const e_float& x)
+{
+  if(x.i_have_my_own_expm1())
+  {
+    return e_float::my_own_expm1(x);
+  }
+
+  // Handle special arguments.
+  if(ef::isnan(x))
+  {
+    return std::numeric_limits<e_float>::quiet_NaN();
+  }
+
+  if(ef::isinf(x))
+  {
+    return ((!ef::isneg(x)) ? std::numeric_limits<e_float>::infinity() : -ef::one());
+  }
+
+  if(ef::iszero(x) || (x.order() < -ef::tolerance()))
+  {
+    return x;
+  }
+
+  const bool b_neg = ef::isneg(x);
+
+  const e_float xx = ((!b_neg) ? x : -x);
+
+  // Above Log[2], the subtraction of one loses less than one digit.
+  if(xx > ef::ln2())
+  {
+    return ef::exp(x) - ef::one();
+  }
+
+  // Compute s = Exp[|x|] - 1 from the series and use Exp[-|x|] - 1 = -s / (1 + s)
+  // for negative x. Neither of these cancels.
+  const e_float s = Exp_Series::Expm1Reduced(xx);
+
+  return ((!b_neg) ? s : -(s / (s + ef::one())));
+}
+
 namespace Log_Series
 {
   static e_float AtOne(const e_float& x)
@@ -241,6 +643,142 @@ namespace Log_Series
 
     return x * ef::hypergeometric_2f1( ef::one(), ef::one(), ef::two(), -x);
   }
+
+  // Above this precision, the AGM logarithm is faster than the Newton iteration.
+  const std::int32_t agm_digits10_crossover = static_cast<std::int32_t>(150);
+
+  static e_float Agm(const e_float& x)
+  {
+    // This subroutine computes Log[x] with the arithmetic-geometric mean
+    // (Sasaki and Kanada, Brent). Use Log[s] = Pi / [2 * AGM(1, 4 / s)],
+    // which is accurate when s > 10^(tolerance / 2). Here s = x * 2^m,
+    // and Log[x] = Log[s] - m * Log[2].
+
+    // The terms Log[s] and m * Log[2] cancel each other by about
+    // Log10[tolerance / Log[x]] digits. This loss is absorbed by
+    // the guard digits when x is not too close to one.
+
+    const std::int64_t half_tol = static_cast<std::int64_t>((ef::tolerance() / 2) + 1);
+
+    // Choose m > (half_tol - Log10[x]) / Log10[2] (m is zero for very large x).
+    const double d_m = std::ceil(static_cast<double>(half_tol - x.order()) * 3.3219280948873623479);
+
+    const std::int64_t m = ((d_m > 0.0) ? static_cast<std::int64_t>(d_m) : static_cast<std::int64_t>(0));
+
+    // Set a0 = 1 and b0 = 4 / s.
+    e_float ak(1U);
+    e_float bk = (ef::four() / x) * ef::pow2(-m);
+
+    for(std::int32_t k = static_cast<std::int32_t>(0); k < static_cast<std::int32_t>(64); ++k)
+    {
+      const e_float delta = ak - bk;
+
+      const e_float a = ak;
+      ak += bk;
+      ak /= static_cast<std::int32_t>(2);
+      bk *= a;
+      bk  = ef::sqrt(bk);
+
+      // The AGM converges quadratically. If the previous terms agree
+      // to half of the digits, then the new terms agree to all of them.
+      if(ef::iszero(delta) || (static_cast<std::int64_t>(delta.order() - ak.order()) < -half_tol))
+      {
+        break;
+      }
+    }
+
+    // Compute Log[x] = {Pi / [2 * AGM(1, 4 / s)]} - (m * Log[2]).
+    return (ef::pi() / (ak * static_cast<std::int32_t>(2))) - (ef::ln2() * e_float(m));
+  }
+
+  // The series of ArcTanh[x] is summed term by term when it needs at most
+  // this number of terms. Otherwise the bit-burst algorithm is used.
+  const std::int32_t atanh_series_terms_max = static_cast<std::int32_t>(16);
+
+  static std::int32_t AtanhNumberOfTerms(const e_float& x)
+  {
+    // The number of terms x^(2n + 1) / (2n + 1) with x^(2n) > 10^-tolerance.
+    double       dd;
+    std::int64_t ne;
+    ef::to_parts(x, dd, ne);
+
+    const double log10_x = std::log10(std::fabs(dd)) + static_cast<double>(ne);
+
+    const double d_n = std::ceil(static_cast<double>(ef::tolerance()) / (-2.0 * log10_x));
+
+    return ((d_n < static_cast<double>((std::numeric_limits<std::int32_t>::max)())) ? static_cast<std::int32_t>(d_n)
+                                                                                   : (std::numeric_limits<std::int32_t>::max)());
+  }
+
+  static e_float AtanhSeries(const e_float& x)
+  {
+    const e_float x2 = x * x;
+          e_float xn = x;
+
+    e_float sum = xn;
+
+    // Series representation of (1/2) Log[(1 + x) / (1 - x)] as given in
+    // Schaum's Outlines: Mathematical Handbook of Formulas and Tables,
+    // Second Edition, equation 22.8, page 136.
+    for(std::int32_t n = static_cast<std::int32_t>(3); n < ef::max_iteration(); n += static_cast<std::int32_t>(2))
+    {
+      xn *= x2;
+
+      const e_float term = xn / n;
+
+      if(n > static_cast<std::int32_t>(20))
+      {
+        const std::int64_t order_check = static_cast<std::int64_t>(term.order() - sum.order());
+
+        if(order_check < -ef::tolerance())
+        {
+          break;
+        }
+      }
+
+      sum += term;
+    }
+
+    return sum;
+  }
+
+  static void AtanhCoefficients(const std::uint32_t n, std::int32_t& qn, std::int32_t& bn)
+  {
+    // The terms of ArcTanh[u] / u - 1 are u^(2n) / (2n + 1).
+    qn = static_cast<std::int32_t>(1);
+    bn = static_cast<std::int32_t>((n * 2U) + 1U);
+  }
+
+  static e_float AtanhBitBurst(const e_float& x)
+  {
+    // Compute ArcTanh[x] for |x| < 1/2 with the bit-burst algorithm. Split off
+    // the leading digits a = p / base^m of the argument and use
+    // ArcTanh[x] = ArcTanh[a] + ArcTanh[(x - a) / (1 - a x)]. The series of
+    // ArcTanh[a] is summed exactly with binary splitting. The new argument
+    // is about as small as x^2, such that p has twice as many digits in the
+    // next step. Neither the sum nor the new argument cancel, and there is
+    // no limit on the number of terms.
+    e_float sum = ef::zero();
+    e_float r   = x;
+
+    while((!ef::iszero(r)) && (AtanhNumberOfTerms(r) > atanh_series_terms_max))
+    {
+      // Use base^m > 1 / r^2, such that the new argument is less than r^2.
+      const std::size_t m = static_cast<std::size_t>(((-r.order() * 2) / 8) + 1);
+
+      const Util::big_int p(r, static_cast<std::int64_t>(m * 8U));
+
+      const e_float a = p.to_e_float() * e_float(1.0, -static_cast<std::int64_t>(m * 8U));
+
+      const std::int32_t n_terms = (std::max)(static_cast<std::int32_t>(1), AtanhNumberOfTerms(a));
+
+      sum += a * (ef::one() + BitBurst_Series::Sum(p * p, m * 2U, AtanhCoefficients, static_cast<std::uint32_t>(n_terms)));
+
+      r = (r - a) / (ef::one() - (a * r));
+    }
+
+    return (ef::iszero(r) ? sum : (sum + AtanhSeries(r)));
+  }
 }
 
 e_float ef::log(const e_float& x)
@@ -277,6 +815,20 @@ e_float ef::log(const e_float& x)
     return Log_Series::AtOne(x_minus_one);
   }
 
+  if(std::numeric_limits<e_float>::digits10 >= Log_Series::agm_digits10_crossover)
+  {
+    // Use the AGM for high precision. Arguments within 10^-4 of one are
+    // handled with Log[x] = 2 * ArcTanh[(x - 1) / (x + 1)] instead, since
+    // the AGM would cancel too many digits for these. The ArcTanh uses the
+    // bit-burst algorithm unless it needs only a few terms.
+    if(x_minus_one.order() < static_cast<std::int64_t>(-4))
+    {
+      return ef::log1p1m2(x_minus_one / (xx + ef::one())) * static_cast<std::int32_t>(2);
+    }
+
+    return Log_Series::Agm(xx);
+  }
+
   // For large arguments, the value will be broken into two parts
   // in order to facilitate the convergence of the Newton iteration.
   const bool b_correction = (   (xx.order() > static_cast<std::int64_t>(+1000))
@@ -363,7 +915,7 @@ e_float ef::log1p(const e_float& x)                   { return Log_Series::AtOne
 
 e_float ef::log1p1m2(const e_float& x)
 {
-  // This subroutine calculates the series representation of (1/2) Log[(1 + x) / (1 - x)]
+  // This subroutine calculates (1/2) Log[(1 + x) / (1 - x)] = ArcTanh[x]
   // for small x without losing precision.
 
   if(!ef::isfinite(x))
@@ -376,35 +928,18 @@ e_float ef::log1p1m2(const e_float& x)
     return std::numeric_limits<e_float>::quiet_NaN();
   }
 
-  // for values of x near one.
-  const e_float x2 = x * x;
-        e_float xn = x;
-
-  e_float sum = xn;
-
-  // Series representation of (1/2) Log[(1 + x) / (1 - x)] as given in
-  // Schaum's Outlines: Mathematical Handbook of Formulas and Tables,
-  // Second Edition, equation 22.8, page 136.
-  for(std::int32_t n = static_cast<std::int32_t>(3); n < ef::max_iteration(); n += static_cast<std::int32_t>(2))
+  if(ef::iszero(x) || (Log_Series::AtanhNumberOfTerms(x) <= Log_Series::atanh_series_terms_max))
   {
-    xn *= x2;
-
-    const e_float term = xn / n;
-
-    if(n > static_cast<std::int32_t>(20))
-    {
-      const std::int64_t order_check = static_cast<std::int64_t>(term.order() - sum.order());
-
-      if(order_check < -ef::tolerance())
-      {
-        break;
-      }
-    }
+    return Log_Series::AtanhSeries(x);
+  }
 
-    sum += term;
+  if((ef::fabs(x) * static_cast<std::int32_t>(2)) < ef::one())
+  {
+    return Log_Series::AtanhBitBurst(x);
   }
 
-  return sum;
+  // Far from zero, the quotient is far from one and its logarithm does not cancel.
+  return ef::log((ef::one() + x) / (ef::one() - x)) / static_cast<std::int32_t>(2);
 }
 
 e_float ef::pow(const e_float& x, const e_float& a)
@@ -561,11 +1096,37 @@ void ef::sinhcosh(const e_float& x, e_float* const p_sinh, e_float* const p_cosh
     return;
   }
 
-  const e_float e_px = ef::exp(x);
-  const e_float e_mx = ef::one() / e_px;
+  const bool b_neg = ef::isneg(x);
+
+  const e_float xx = ((!b_neg) ? x : -x);
+
+  e_float sinh_value;
+  e_float cosh_value;
+
+  if(xx < ef::one())
+  {
+    // Use s = Exp[|x|] - 1 with Sinh[|x|] = s (s + 2) / [2 (s + 1)]
+    // and Cosh[x] = 1 + s^2 / [2 (s + 1)]. These do not cancel for
+    // small x and need only one single division.
+    const e_float s = ef::expm1(xx);
+
+    const e_float h = ef::inv(s + ef::one()) / static_cast<std::int32_t>(2);
 
-  if(p_sinh != nullptr) { *p_sinh  = (e_px - e_mx) / static_cast<std::int32_t>(2); }
-  if(p_cosh != nullptr) { *p_cosh  = (e_px + e_mx) / static_cast<std::int32_t>(2); }
+    if(p_sinh != nullptr) { sinh_value = (s * (s + ef::two())) * h; }
+    if(p_cosh != nullptr) { cosh_value = ((s * s) * h) + ef::one(); }
+  }
+  else
+  {
+    // Here Exp[-|x|] is small compared with Exp[|x|].
+    const e_float e_px = ef::exp(xx);
+    const e_float e_mx = ef::one() / e_px;
+
+    if(p_sinh != nullptr) { sinh_value = (e_px - e_mx) / static_cast<std::int32_t>(2); }
+    if(p_cosh != nullptr) { cosh_value = (e_px + e_mx) / static_cast<std::int32_t>(2); }
+  }
+
+  if(p_sinh != nullptr) { *p_sinh = ((!b_neg) ? sinh_value : -sinh_value); }
+  if(p_cosh != nullptr) { *p_cosh = cosh_value; }
 }
 
 e_float ef::tanh(const e_float& x)
@@ -575,9 +1136,24 @@ e_float ef::tanh(const e_float& x)
     return e_float::my_own_tanh(x);
   }
 
-  e_float c, s;
-  ef::sinhcosh(x, &s, &c);
-  return s * c.calculate_inv();
+  if(ef::isnan(x))
+  {
+    return std::numeric_limits<e_float>::quiet_NaN();
+  }
+
+  const bool b_neg = ef::isneg(x);
+
+  if(ef::isinf(x))
+  {
+    return ((!b_neg) ? ef::one() : -ef::one());
+  }
+
+  // Use Tanh[|x|] = s / (s + 2) with s = Exp[2 |x|] - 1.
+  const e_float s = ef::expm1(((!b_neg) ? x : -x) * static_cast<std::int32_t>(2));
+
+  const e_float tanh_value = (ef::isinf(s) ? ef::one() : (s / (s + ef::two())));
+
+  return ((!b_neg) ? tanh_value : -tanh_value);
 }
 
 e_float ef::asinh(const e_float& x)
@@ -20,234 +20,327 @@
 // *****************************************************************************
 
 #include <algorithm>
+#include <cmath>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
 
+#include <e_float/e_float_complex.h>
 #include <e_float/e_float_functions.h>
 
-e_float ef::sin(const e_float& x)
+#include <functions/constants/constants_util.h>
+
+#include <utility/util_big_int.h>
+#include <utility/util_lexical_cast.h>
+
+namespace Trig_Series
 {
-  if(ef::isfinite(x) == false)
+  static const std::vector<e_float>& PiHalfParts(const std::int32_t part_digits)
   {
-    return std::numeric_limits<e_float>::quiet_NaN();
-  }
+    // Split pi/2 into parts of part_digits significant digits each.
+    // The parts are cached for each size, and they use all of the
+    // known digits of pi needed for the largest quotient of this size.
+    // The parts are empty if not enough digits of pi are known.
+    // The entries of the map are never removed, so the returned
+    // references stay valid after the lock is released.
+    static std::mutex                                    parts_mutex;
+    static std::map<std::int32_t, std::vector<e_float>> parts_cache;
 
-  if(x.i_have_my_own_sin())
-  {
-    return e_float::my_own_sin(x);
-  }
+    const std::lock_guard<std::mutex> lock(parts_mutex);
 
-  // Local copy of the argument
-  e_float xx = x;
+    std::vector<e_float>& parts = parts_cache[part_digits];
 
-  // Analyze and prepare the phase of the argument.
-  // Make a local, positive copy of the argument, xx.
-  // The argument xx will be reduced to 0 <= xx <= pi/2.
-  bool b_negate_sin = false;
+    // Omit the decimal point of the digits of pi of the form "3.1415...".
+    const std::string& str_pi = ConstantsUtil::PiDigits();
 
-  if(ef::isneg(x))
-  {
-    xx = -xx;
-    b_negate_sin = !b_negate_sin;
+    const std::size_t n_needed = static_cast<std::size_t>(static_cast<std::int32_t>(ef::tolerance()) + (std::numeric_limits<e_float>::digits10 - part_digits));
+
+    if(parts.empty() && ((str_pi.length() - 1U) >= n_needed))
+    {
+      const std::string str_digits = str_pi.substr(0U, 1U) + str_pi.substr(2U);
+
+      for(std::size_t pos = 0U; pos < n_needed; pos += static_cast<std::size_t>(part_digits))
+      {
+        const std::string str_part =   "0."
+                                     + str_digits.substr(pos, static_cast<std::size_t>(part_digits))
+                                     + "e"
+                                     + Util::lexical_cast(static_cast<std::int64_t>(1) - static_cast<std::int64_t>(pos));
+
+        // Halving the decimal part of pi is exact.
+        parts.push_back(e_float(str_part.c_str()) / static_cast<std::int32_t>(2));
+      }
+    }
+
+    return parts;
   }
 
-  // Remove even multiples of pi.
-  if(xx > ef::pi())
+  static const e_float& TwoOverPi() { static const e_float val = ef::one() / ef::pi_half(); return val; }
+
+  static void ReducePiHalfScaled(e_float& x, std::int32_t& n_quadrant)
   {
-    e_float n_pi = ef::integer_part(xx / ef::pi());
-    xx -= n_pi * ef::pi();
+    // Reduce the positive argument x to |x| <= pi/4 in integers with
+    // x (2/pi) = n + f and the nearest integer n. Here, X = x 10^F is
+    // multiplied by the integer C = 2/pi base^m, which has the digits of
+    // the quotient n plus those of the working precision.
+    // The integer part of the product gives n mod 4 and its fractional
+    // part gives f, which has an absolute error below 10^-F. Should f
+    // have leading zeros, more digits are taken.
+    const std::int64_t n_order = static_cast<std::int64_t>(x.order() + static_cast<std::int64_t>(1));
+    const std::int64_t n_tol   = static_cast<std::int64_t>(ef::tolerance() + static_cast<std::int64_t>(16));
 
-    // Adjust signs if the multiple of pi is not even.
-    const bool b_n_pi_is_even = ef::iszero(ef::decimal_part(n_pi / static_cast<std::int32_t>(2)));
+    std::int64_t n_extra = static_cast<std::int64_t>(0);
 
-    if(!b_n_pi_is_even)
+    for(;;)
     {
-      b_negate_sin = !b_negate_sin;
+      const std::size_t m_f = static_cast<std::size_t>(((n_tol + n_extra) + 7) / 8);
+      const std::size_t m_c = static_cast<std::size_t>((((n_order + n_tol) + n_extra) + 7) / 8) + 1U;
+      const std::size_t m   = m_f + m_c;
+
+      const Util::big_int x_c = Util::big_int(x, static_cast<std::int64_t>(m_f * 8U)) * ConstantsUtil::TwoOverPiScaled(m_c);
+
+      Util::big_int n_big, f_big;
+
+      x_c.split_limbs(m, n_big, f_big);
+
+      n_quadrant = static_cast<std::int32_t>(n_big.low_limb() % 4U);
+
+      // Round to the nearest integer n with f >= 1/2 when 2 f has an integer part.
+      Util::big_int two_f(f_big);
+
+      two_f.mul_limb(static_cast<std::int32_t>(2));
+
+      if(two_f.size() > m)
+      {
+        Util::big_int one(static_cast<std::int64_t>(1));
+
+        f_big -= one.shift_limbs(m);
+
+        n_quadrant = static_cast<std::int32_t>((n_quadrant + 1) % 4);
+      }
+
+      const std::int64_t n_zero_digits = static_cast<std::int64_t>((m - f_big.size()) * 8U);
+
+      if((n_zero_digits <= n_extra) || (n_extra > ((n_order + n_tol) * 2)))
+      {
+        x = (f_big.to_e_float() * e_float(1.0, -static_cast<std::int64_t>(m * 8U))) * ef::pi_half();
+
+        return;
+      }
+
+      n_extra = n_zero_digits + static_cast<std::int64_t>(8);
     }
   }
 
-  // Reduce the argument to 0 <= xx <= pi/2.
-  if(xx > ef::pi_half())
+  static void ReducePiHalf(e_float& x, std::int32_t& n_quadrant)
   {
-    xx = ef::pi() - xx;
-  }
-  
-  const bool b_zero    = ef::iszero(xx);
-  const bool b_pi_half = ef::iszero(xx - ef::pi_half());
+    // Reduce the positive argument x to |x| <= pi/4 with x = n (pi/2) + r
+    // and compute the quadrant n mod 4. The nearest quotient n is obtained
+    // with a multiplication by 2/pi. The product n (pi/2) is subtracted
+    // from x in parts which are small enough for the products of n with
+    // each part to be exact. In this way, the cancellation in the
+    // subtraction loses no significance, as long as enough digits of pi
+    // are known. Otherwise, and for quotients that are too large for
+    // exact products, the reduction is done in integers. A rounding of
+    // the quotient can leave |r| slightly above pi/4, which is harmless.
+    const e_float n_pi_half = ef::integer_part((x * TwoOverPi()) + ef::half());
 
-  // Check if the reduced argument is very close to 0 or pi/2.
-  const bool    b_near_zero    = ef::small_arg(xx);
-  const e_float delta_pi_half  = ef::pi_half() - xx;
-  const bool    b_near_pi_half = ef::small_arg(delta_pi_half);
-  
-  e_float sin_val;
+    const std::int32_t n_digits    = static_cast<std::int32_t>(n_pi_half.order() + static_cast<std::int64_t>(1));
+    const std::int32_t part_digits = static_cast<std::int32_t>((((std::numeric_limits<e_float>::digits10 - 16) - n_digits) / 8) * 8);
 
-  if(b_zero)
-  {
-    sin_val = ef::zero();
-  }
-  else if(b_pi_half)
-  {
-    sin_val = ef::one();
-  }
-  else if(b_near_zero)
-  {
-    const e_float x_squared = xx * xx;
+    static const std::vector<e_float> no_parts;
 
-    sin_val = xx * ef::hypergeometric_0f1(ef::three_half(), -x_squared / static_cast<std::int32_t>(4));
-  }
-  else if(b_near_pi_half)
-  {
-    sin_val = ef::hypergeometric_0f1(ef::half(), -(delta_pi_half * delta_pi_half) / static_cast<std::int32_t>(4));
+    const std::vector<e_float>& parts = ((part_digits >= static_cast<std::int32_t>(8)) ? PiHalfParts(part_digits) : no_parts);
+
+    if(!parts.empty())
+    {
+      e_float r = x;
+
+      for(std::size_t i = 0U; i < parts.size(); ++i)
+      {
+        r -= n_pi_half * parts[i];
+      }
+
+      // The parts determine r to within about n 10^-n_pi_digits. This is only
+      // enough when r is not much closer to zero, as for x near n (pi/2).
+      const std::int64_t n_pi_digits = static_cast<std::int64_t>(ef::tolerance() + static_cast<std::int64_t>(std::numeric_limits<e_float>::digits10 - part_digits));
+
+      if((!ef::iszero(r)) && (r.order() >= ((static_cast<std::int64_t>(n_digits) - n_pi_digits) + ef::tolerance())))
+      {
+        x = r;
+
+        n_quadrant = ef::to_int32(n_pi_half - (ef::integer_part(n_pi_half / static_cast<std::int32_t>(4)) * static_cast<std::int32_t>(4)));
+
+        return;
+      }
+    }
+
+    ReducePiHalfScaled(x, n_quadrant);
   }
-  else
+
+  static e_float SinOfReduced(const e_float& x)
   {
+    // Compute sin(x) for 0 <= x <= pi/4.
+    if(ef::iszero(x))
+    {
+      return ef::zero();
+    }
+
+    if(ef::small_arg(x))
+    {
+      return x * ef::hypergeometric_0f1(ef::three_half(), -(x * x) / static_cast<std::int32_t>(4));
+    }
+
     // Scale to a small argument for an efficient Taylor series,
     // implemented as a hypergeometric function. Use a standard
     // divide by three identity a certain number of times.
     // Here we use division by 3^9 --> (19683 = 3^9).
 
-    const bool b_scale = (xx.order() > static_cast<std::int64_t>(-4));
+    const bool b_scale = (x.order() > static_cast<std::int64_t>(-4));
 
     static const std::int32_t n_scale           = static_cast<std::int32_t>(9);
     static const std::int32_t n_three_pow_scale = static_cast<std::int32_t>(static_cast<std::int64_t>(::pow(3.0, static_cast<double>(n_scale)) + 0.5));
-    
-    if(b_scale)
-    {
-      xx /= n_three_pow_scale;
-    }
+
+    const e_float xx = ((!b_scale) ? x : x / n_three_pow_scale);
 
     // Now with small arguments, we are ready for a series expansion.
-    sin_val = xx * ef::hypergeometric_0f1(ef::three_half(), -(xx * xx) / static_cast<std::int32_t>(4));
+    e_float sin_val = xx * ef::hypergeometric_0f1(ef::three_half(), -(xx * xx) / static_cast<std::int32_t>(4));
 
     // Convert back using multiple angle identity.
     if(b_scale)
     {
       for(std::int32_t k = static_cast<std::int32_t>(0); k < n_scale; k++)
       {
-        // Rescale the cosine value using the multiple angle identity.
+        // Rescale the sine value using the multiple angle identity.
         sin_val  = - ((sin_val * (sin_val * sin_val)) * static_cast<std::int32_t>(4))
                    +  (sin_val * static_cast<std::int32_t>(3));
       }
     }
-  }
 
-  return ((!b_negate_sin) ? sin_val : -sin_val);
+    return sin_val;
+  }
 }
 
-e_float ef::cos(const e_float& x)
+void ef::sincos(const e_float& x, e_float* const p_sin, e_float* const p_cos)
 {
-  if(ef::isfinite(x) == false)
+  if((p_sin == static_cast<e_float*>(0U)) && (p_cos == static_cast<e_float*>(0U)))
   {
-    return std::numeric_limits<e_float>::quiet_NaN();
+    return;
   }
 
-  if(x.i_have_my_own_cos())
+  if(ef::isfinite(x) == false)
   {
-    return e_float::my_own_cos(x);
-  }
+    if(p_sin != static_cast<e_float*>(0U)) { *p_sin = std::numeric_limits<e_float>::quiet_NaN(); }
+    if(p_cos != static_cast<e_float*>(0U)) { *p_cos = std::numeric_limits<e_float>::quiet_NaN(); }
 
-  // Local copy of the argument
-  e_float xx = x;
+    return;
+  }
 
-  // Analyze and prepare the phase of the argument.
-  // Make a local, positive copy of the argument, xx.
-  // The argument xx will be reduced to 0 <= xx <= pi/2.
-  bool b_negate_cos = false;
+  // Take the functions that the backend provides from the backend.
+  // The others are computed below, and not with ef::sin or ef::cos,
+  // which would call ef::sincos again.
+  e_float* p_s = p_sin;
+  e_float* p_c = p_cos;
 
-  if(ef::isneg(x))
+  if((p_s != static_cast<e_float*>(0U)) && x.i_have_my_own_sin())
   {
-    xx = -xx;
+    *p_s = e_float::my_own_sin(x);
+
+    p_s = static_cast<e_float*>(0U);
   }
 
-  // Remove even multiples of pi.
-  if(xx > ef::pi())
+  if((p_c != static_cast<e_float*>(0U)) && x.i_have_my_own_cos())
   {
-    e_float n_pi = ef::integer_part(xx / ef::pi());
-
-    xx -= n_pi * ef::pi();
-
-    // Adjust signs if the multiple of pi is not even.
-    const bool b_n_pi_is_even = ef::iszero(ef::decimal_part(n_pi / static_cast<std::int32_t>(2)));
+    *p_c = e_float::my_own_cos(x);
 
-    if(!b_n_pi_is_even)
-    {
-      b_negate_cos = !b_negate_cos;
-    }
+    p_c = static_cast<e_float*>(0U);
   }
 
-  // Reduce the argument to 0 <= xx <= pi/2.
-  if(xx > ef::pi_half())
+  if((p_s == static_cast<e_float*>(0U)) && (p_c == static_cast<e_float*>(0U)))
   {
-    xx = ef::pi() - xx;
-    b_negate_cos = !b_negate_cos;
+    return;
   }
-  
-  const bool b_zero    = ef::iszero(xx);
-  const bool b_pi_half = ef::iszero(xx - ef::pi_half());
 
-  // Check if the reduced argument is very close to 0 or pi/2.
-  const bool    b_near_zero    = ef::small_arg(xx);
-  const e_float delta_pi_half  = ef::pi_half() - xx;
-  const bool    b_near_pi_half = ef::small_arg(delta_pi_half);
-  
-  e_float cos_val;
+  // Make a local, positive copy of the argument, xx, and reduce
+  // it to |xx| <= pi/4 with xx = |x| - (n * pi/2). The sine
+  // and cosine of x follow from the quadrant n mod 4.
+  e_float xx = ef::fabs(x);
 
-  if(b_zero)
-  {
-    cos_val = ef::one();
-  }
-  else if(b_pi_half)
+  std::int32_t n_quadrant = static_cast<std::int32_t>(0);
+
+  if(xx > (ef::pi_half() / static_cast<std::int32_t>(2)))
   {
-    cos_val = ef::zero();
+    Trig_Series::ReducePiHalf(xx, n_quadrant);
   }
-  else if(b_near_zero)
-  {
-    const e_float x_squared = xx * xx;
 
-    cos_val = ef::hypergeometric_0f1(ef::half(), -x_squared / static_cast<std::int32_t>(4));
-  }
-  else if(b_near_pi_half)
+  // Use sin(-xx) = -sin(xx) for a negative reduced argument.
+  // Here, the cosine follows from the sine without loss of precision.
+  const bool b_neg_xx = ef::isneg(xx);
+
+  if(b_neg_xx)
   {
-    cos_val = delta_pi_half * ef::hypergeometric_0f1(ef::three_half(), -(delta_pi_half * delta_pi_half) / static_cast<std::int32_t>(4));
+    xx = -xx;
   }
-  else
-  {
-    // Scale to a small argument for an efficient Taylor series,
-    // implemented as a hypergeometric function. Use a standard
-    // divide by three identity a certain number of times.
-    // Here we use division by 3^9 --> (19683 = 3^9).
 
-    const bool b_scale = (xx.order() > static_cast<std::int64_t>(-4));
+  // sin(xx + n pi/2) and cos(xx + n pi/2) for the quadrants n = 0, 1, 2, 3.
+  const bool b_odd_quadrant = ((n_quadrant % static_cast<std::int32_t>(2)) != static_cast<std::int32_t>(0));
 
-    static const std::int32_t n_scale           = static_cast<std::int32_t>(9);
-    static const std::int32_t n_three_pow_scale = static_cast<std::int32_t>(static_cast<std::int64_t>(::pow(3.0, static_cast<double>(n_scale)) + 0.5));
-    
-    if(b_scale)
+  // The cosine of the reduced argument is only needed for some quadrants.
+  const bool b_need_cos_xx = ((p_s != static_cast<e_float*>(0U)) && b_odd_quadrant) || ((p_c != static_cast<e_float*>(0U)) && (!b_odd_quadrant));
+
+  const e_float s = Trig_Series::SinOfReduced(xx);
+  const e_float c = ((b_need_cos_xx && (!ef::iszero(s))) ? ef::sqrt(-(s * s) + ef::one()) : ef::one());
+
+  const e_float  sin_xx = ((!b_neg_xx) ? s : -s);
+  const e_float& cos_xx = c;
+
+  const bool b_negate_sin   = ((n_quadrant % static_cast<std::int32_t>(4)) >= static_cast<std::int32_t>(2));
+  const bool b_negate_cos   = (((n_quadrant + static_cast<std::int32_t>(1)) % static_cast<std::int32_t>(4)) >= static_cast<std::int32_t>(2));
+
+  if(p_s != static_cast<e_float*>(0U))
+  {
+    *p_s = ((!b_odd_quadrant) ? sin_xx : cos_xx);
+
+    // The sine is odd.
+    if(b_negate_sin != ef::isneg(x))
     {
-      xx /= n_three_pow_scale;
+      *p_s = -*p_s;
     }
+  }
 
-    // Now with small arguments, we are ready for a series expansion.
-    cos_val = ef::hypergeometric_0f1(ef::half(), -(xx * xx) / static_cast<std::int32_t>(4));
+  if(p_c != static_cast<e_float*>(0U))
+  {
+    *p_c = ((!b_odd_quadrant) ? cos_xx : sin_xx);
 
-    // Convert back using multiple angle identity.
-    if(b_scale)
+    if(b_negate_cos)
     {
-      for(std::int32_t k = static_cast<std::int32_t>(0); k < n_scale; k++)
-      {
-        // Rescale the cosine value using the multiple angle identity.
-        cos_val  =   ((cos_val * (cos_val * cos_val)) * static_cast<std::int32_t>(4))
-                   -  (cos_val * static_cast<std::int32_t>(3));
-      }
+      *p_c = -*p_c;
     }
   }
+}
+
+e_float ef::sin(const e_float& x)
+{
+  if(x.i_have_my_own_sin())
+  {
+    return e_float::my_own_sin(x);
+  }
 
-  return ((!b_negate_cos) ? cos_val : -cos_val);
+  e_float s;
+  ef::sincos(x, &s, static_cast<e_float*>(0U));
+  return s;
 }
 
-void ef::sincos(const e_float& x, e_float* const p_sin, e_float* const p_cos)
+e_float ef::cos(const e_float& x)
 {
-  if(p_sin != static_cast<e_float*>(0U)) { *p_sin = ef::sin(x); }
-  if(p_cos != static_cast<e_float*>(0U)) { *p_cos = ef::cos(x); }
+  if(x.i_have_my_own_cos())
+  {
+    return e_float::my_own_cos(x);
+  }
+
+  e_float c;
+  ef::sincos(x, static_cast<e_float*>(0U), &c);
+  return c;
 }
 
 e_float ef::tan(const e_float& x)
@@ -258,13 +351,31 @@ e_float ef::tan(const e_float& x)
   }
   else
   {
-    return ef::sin(x) / ef::cos(x);
+    e_float s, c;
+    ef::sincos(x, &s, &c);
+    return s / c;
   }
 }
 
 e_float ef::csc(const e_float& x) { return ef::one()  / ef::sin(x); }
 e_float ef::sec(const e_float& x) { return ef::one()  / ef::cos(x); }
-e_float ef::cot(const e_float& x) { return ef::cos(x) / ef::sin(x); }
+
+e_float ef::cot(const e_float& x)
+{
+  e_float s, c;
+  ef::sincos(x, &s, &c);
+  return c / s;
+}
+
+namespace Atan_Series
+{
+  // Above this precision, the complex AGM is faster than the Newton iteration.
+  static const std::int32_t agm_digits10_crossover = static_cast<std::int32_t>(100000);
+
+  static e_float AtZero    (const e_float& x);
+  static e_float AtInfinity(const e_float& x);
+  static e_float Agm       (const e_float& x);
+}
 
 e_float ef::asin(const e_float& x)
 {
@@ -321,6 +432,15 @@ e_float ef::asin(const e_float& x)
     return ((!b_neg) ? asin_value : -asin_value);
   }
 
+  if(std::numeric_limits<e_float>::digits10 >= Atan_Series::agm_digits10_crossover)
+  {
+    // Use ArcSin[x] = ArcTan[x / Sqrt[(1 - x) (1 + x)]] for high precision,
+    // where ef::atan uses the complex AGM.
+    const e_float asin_value = ef::atan(xx / ef::sqrt((ef::one() - xx) * (ef::one() + xx)));
+
+    return ((!b_neg) ? asin_value : -asin_value);
+  }
+
   // Get initial estimate using standard math function asin.
   double        dd;
   std::int64_t  ne;
@@ -334,17 +454,26 @@ e_float ef::asin(const e_float& x)
 
   e_float value = e_float(::asin(dd * ::pow(10.0, de)));
 
-  // Newton-Raphson iteration
-
+  // Newton-Raphson iteration. The number of correct digits doubles in each
+  // step, so each step is carried out with only twice the digits of the
+  // previous one and only the final step uses the full precision.
   static const std::int32_t double_digits10_minus_a_few = static_cast<std::int32_t>(static_cast<std::int32_t>(std::numeric_limits<double>::digits10) - static_cast<std::int32_t>(3));
 
+  e_float x_prec(xx);
+
   for(std::int32_t digits = double_digits10_minus_a_few; digits <= static_cast<std::int32_t>(ef::tolerance()); digits *= static_cast<std::int32_t>(2))
   {
+    // Adjust precision of the terms.
+     value.precision(static_cast<std::int32_t>(digits * static_cast<std::int32_t>(2)));
+    x_prec.precision(static_cast<std::int32_t>(digits * static_cast<std::int32_t>(2)));
+
     e_float s, c;
     ef::sincos(value, &s, &c);
-    value -= (s - xx) / c;
+    value -= (s - x_prec) / c;
   }
 
+  value.precision(static_cast<std::int32_t>(ef::tolerance()));
+
   return ((b_neg == false) ? value : -value);
 }
 
@@ -378,12 +507,6 @@ e_float ef::acos(const e_float& x)
   }
 }
 
-namespace Atan_Series
-{
-  static e_float AtZero    (const e_float& x);
-  static e_float AtInfinity(const e_float& x);
-}
-
 static e_float Atan_Series::AtZero(const e_float& x)
 {
   // http://functions.wolfram.com/ElementaryFunctions/ArcTan/26/01/01/
@@ -402,6 +525,58 @@ static e_float Atan_Series::AtInfinity(const e_float& x)
                                                 -ef::one() / (x * x)) / x;
 }
 
+static e_float Atan_Series::Agm(const e_float& x)
+{
+  // This subroutine computes ArcTan[x] = Arg[1 + i x] for 0 < x <= 1 with the
+  // complex arithmetic-geometric mean (Brent, Salamin). Use the logarithm
+  // Log[s] = Pi / [2 * AGM(1, 4 / s)] with s = (1 + i x) * 2^m, which is
+  // accurate when |s| > 10^(tolerance / 2). The factor 2^m only changes
+  // the real part of the logarithm, such that ArcTan[x] = Im[Log[s]].
+
+  // The imaginary part is obtained with an absolute error of a few units
+  // of the last digit of Log[s], which is absorbed by the guard digits
+  // when x is not too small.
+
+  const std::int64_t half_tol = static_cast<std::int64_t>((ef::tolerance() / 2) + 1);
+
+  // Choose m > half_tol / Log10[2].
+  const std::int64_t m = static_cast<std::int64_t>(std::ceil(static_cast<double>(half_tol) * 3.3219280948873623479));
+
+  // Set a0 = 1 and b0 = 4 / s = [4 * (1 - i x)] / [(1 + x^2) * 2^m].
+  const e_float scale = (ef::four() * ef::pow2(-m)) / ((x * x) + ef::one());
+
+  ef::complex<e_float> ak(ef::one());
+  ef::complex<e_float> bk(scale, -(x * scale));
+
+  for(std::int32_t k = static_cast<std::int32_t>(0); k < static_cast<std::int32_t>(64); ++k)
+  {
+    const ef::complex<e_float> delta = ak - bk;
+
+    const ef::complex<e_float> a = ak;
+    ak = ef::complex<e_float>((ak.real() + bk.real()) / static_cast<std::int32_t>(2),
+                              (ak.imag() + bk.imag()) / static_cast<std::int32_t>(2));
+    bk = ef::sqrt(a * bk);
+
+    // Take the square root for which Re[bk / ak] > 0 (the right choice).
+    if(ef::isneg((ak.real() * bk.real()) + (ak.imag() * bk.imag())))
+    {
+      bk = -bk;
+    }
+
+    // The AGM converges quadratically. If the previous terms agree
+    // to half of the digits, then the new terms agree to all of them.
+    const std::int64_t delta_order = (std::max)(delta.real().order(), delta.imag().order());
+
+    if((ef::iszero(delta.real()) && ef::iszero(delta.imag())) || (static_cast<std::int64_t>(delta_order - ak.real().order()) < -half_tol))
+    {
+      break;
+    }
+  }
+
+  // Compute ArcTan[x] = Im[Pi / (2 * ak)] = -(Pi * Im[ak]) / (2 * |ak|^2).
+  return -(ef::pi() * ak.imag()) / (ef::norm(ak) * static_cast<std::int32_t>(2));
+}
+
 e_float ef::atan(const e_float& x)
 {
   if(ef::isfinite(x) == false)
@@ -439,12 +614,39 @@ e_float ef::atan(const e_float& x)
 
   const e_float xx = ((!b_neg) ? x : -x);
 
-  // Get initial estimate using standard math function atan or a series
-  // expansion for rather large arguments having order 3 or larger.
+  if(std::numeric_limits<e_float>::digits10 >= Atan_Series::agm_digits10_crossover)
+  {
+    // Use the complex AGM for high precision, with ArcTan[x] = Pi/2 - ArcTan[1/x]
+    // for x > 1. Small arguments, for which the absolute error of the AGM
+    // exceeds the guard digits, use the Taylor series instead. Each of its
+    // terms gains at least guard_digits10 digits, such that it needs no more
+    // than about tolerance / guard_digits10 terms.
+    const bool b_inv = (xx > ef::one());
+
+    const e_float x_agm = ((!b_inv) ? xx : ef::one() / xx);
+
+    static const std::int64_t guard_digits10 = static_cast<std::int64_t>(ef::tolerance() - static_cast<std::int64_t>(std::numeric_limits<e_float>::digits10));
+
+    const e_float value_agm = ((x_agm.order() > static_cast<std::int64_t>(-(guard_digits10 / 2))) ? Atan_Series::Agm   (x_agm)
+                                                                                                    : Atan_Series::AtZero(x_agm));
+
+    const e_float value = ((!b_inv) ? value_agm : ef::pi_half() - value_agm);
+
+    return ((b_neg == false) ? value : -value);
+  }
+
+  // Use ArcTan[x] = Pi/2 - ArcTan[1/x] for x > 1. Near Pi/2, the cosine in
+  // the Newton step is small and each step at reduced precision would lose
+  // about log10(x) digits.
+  const bool b_inv = (xx > ef::one());
+
+  const e_float x_red = ((!b_inv) ? xx : ef::one() / xx);
+
+  // Get initial estimate using standard math function atan.
   double       dd;
   std::int64_t ne;
 
-  ef::to_parts(xx, dd, ne);
+  ef::to_parts(x_red, dd, ne);
 
   static const std::int64_t p10_min = static_cast<std::int64_t>(std::numeric_limits<double>::min_exponent10);
   static const std::int64_t p10_max = static_cast<std::int64_t>(std::numeric_limits<double>::max_exponent10);
@@ -456,17 +658,29 @@ e_float ef::atan(const e_float& x)
   using std::atan;
   using std::pow;
 
-  e_float value = ((order < static_cast<std::int64_t>(2)) ? e_float(atan(dd * pow(10.0, de)))
-                                                          : Atan_Series::AtInfinity(xx));
+  e_float value = e_float(atan(dd * pow(10.0, de)));
 
-  // Newton-Raphson iteration
+  // Newton-Raphson iteration with the precision doubled in each step.
   static const std::int32_t double_digits10_minus_a_few = static_cast<std::int32_t>(static_cast<std::int32_t>(std::numeric_limits<double>::digits10) - static_cast<std::int32_t>(3));
 
+  e_float x_prec(x_red);
+
   for(std::int32_t digits = double_digits10_minus_a_few; digits <= static_cast<std::int32_t>(ef::tolerance()); digits *= static_cast<std::int32_t>(2))
   {
+    // Adjust precision of the terms.
+     value.precision(static_cast<std::int32_t>(digits * static_cast<std::int32_t>(2)));
+    x_prec.precision(static_cast<std::int32_t>(digits * static_cast<std::int32_t>(2)));
+
     e_float s, c;
     ef::sincos(value, &s, &c);
-    value += c * ((xx * c) - s);
+    value += c * ((x_prec * c) - s);
+  }
+
+  value.precision(static_cast<std::int32_t>(ef::tolerance()));
+
+  if(b_inv)
+  {
+    value = ef::pi_half() - value;
   }
 
   return ((b_neg == false) ? value : -value);
@@ -0,0 +1,33 @@
+//          Copyright Christopher Kormanyos 1999 - 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+// This work is based on an earlier work:
+// "Algorithm 910: A Portable C++ Multiple-Precision System for Special-Function Calculations",
+// in ACM TOMS, {VOL 37, ISSUE 4, (February 2011)} (C) ACM, 2011. http://doi.acm.org/10.1145/1916461.1916469
+
+#ifndef HYPER_G_UTIL_2021_07_31_H_
+  #define HYPER_G_UTIL_2021_07_31_H_
+
+  #include <cstdint>
+  #include <utility>
+  #include <vector>
+
+  #include <e_float/e_float.h>
+
+  namespace HyperGUtil
+  {
+    // A rational number given by (numerator, denominator). The magnitudes
+    // should be less than 10^6 and the denominator must be positive.
+    typedef std::pair<std::int32_t, std::int32_t> rational_type;
+
+    // Sum the series of HypergeometricPFQ[a, b, x] with rational parameters
+    // and rational argument exactly with binary splitting. This is used for
+    // high precision, where it is much faster than the term-wise summation.
+    e_float HypergeometricPFQRational(const std::vector<rational_type>& a,
+                                      const std::vector<rational_type>& b,
+                                      const rational_type& x);
+  }
+
+#endif // HYPER_G_UTIL_2021_07_31_H_
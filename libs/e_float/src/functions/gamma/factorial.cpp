@@ -9,14 +9,30 @@
 // in ACM TOMS, {VOL 37, ISSUE 4, (February 2011)} (C) ACM, 2011. http://doi.acm.org/10.1145/1916461.1916469
 
 #include <algorithm>
+#include <cmath>
+#include <deque>
+#include <limits>
+#include <vector>
 
 #include <e_float/e_float.h>
 #include <e_float/e_float_functions.h>
+#include <functions/gamma/gamma_util.h>
 #include <functions/tables/tables.h>
+#include <utility/util_big_int.h>
 
 namespace Factorial_Series
 {
+  // Above this argument, the factorial uses the asymptotic expansion
+  // instead of the product of prime powers.
+  static const std::uint32_t prime_swing_n_max = static_cast<std::uint32_t>(20000000U);
+
   e_float AtInfinity(const std::uint32_t n);
+
+  void          PrimesUpTo      (const std::uint32_t n, std::deque<std::uint32_t>& primes);
+  Util::big_int ExactProduct    (const std::vector<std::uint32_t>& factors, const std::size_t first, const std::size_t last);
+  e_float       Product         (const std::vector<std::uint32_t>& factors);
+  e_float       PrimeSwing      (const std::uint32_t n, const std::deque<std::uint32_t>& primes);
+  e_float       FactorialOfPrimes(const std::uint32_t n, const std::deque<std::uint32_t>& primes);
 }
 
 e_float Factorial_Series::AtInfinity(const std::uint32_t n)
@@ -25,28 +41,18 @@ e_float Factorial_Series::AtInfinity(const std::uint32_t n)
         e_float one_over_x_pow_two_n_minus_one = ef::one() / x;
   const e_float one_over_x2                    = one_over_x_pow_two_n_minus_one * one_over_x_pow_two_n_minus_one;
 
-  static const e_float B2 =   Tables::A000367()[static_cast<std::size_t>(1U)]()
-                            / Tables::A002445()[static_cast<std::size_t>(1U)]();
-
-  e_float sum = (B2 * one_over_x_pow_two_n_minus_one) / static_cast<std::int32_t>(2);
+  e_float sum = (ef::bernoulli(static_cast<std::uint32_t>(2U)) * one_over_x_pow_two_n_minus_one) / static_cast<std::int32_t>(2);
 
-  static const std::size_t sz_A000367 = Tables::A000367().size();
-  static const std::size_t sz_A002445 = Tables::A002445().size();
-  static const std::size_t sz_max     = (std::min)(sz_A000367, sz_A002445);
-
-  // Perform the Bernoulli series expansion without explicitly calling the function
-  // ef::Bernoulli in order to avoid any recursive calls of ef::factorial. This is
-  // because ef::bernoulli_b calls ef::factorial for large integers.
-
-  for(std::int32_t k = static_cast<std::int32_t>(2); k < static_cast<std::int32_t>(sz_max); k++)
+  // The Bernoulli numbers beyond the tables use GammaUtil::FactorialOfPrimes,
+  // and not ef::factorial, such that the two can not call each other.
+  for(std::int32_t k = static_cast<std::int32_t>(2); k < ef::max_iteration(); k++)
   {
     one_over_x_pow_two_n_minus_one *= one_over_x2;
 
     const std::int32_t two_k           = static_cast<std::int32_t>(k     * static_cast<std::int32_t>(2));
     const std::int32_t two_k_minus_one = static_cast<std::int32_t>(two_k - static_cast<std::int32_t>(1));
 
-    const e_float B2k =   Tables::A000367()[static_cast<std::size_t>(k)]()
-                        / Tables::A002445()[static_cast<std::size_t>(k)]();
+    const e_float B2k = ef::bernoulli(static_cast<std::uint32_t>(two_k));
 
     const e_float term = ((B2k * one_over_x_pow_two_n_minus_one) / two_k) / two_k_minus_one;
 
@@ -63,10 +69,158 @@ e_float Factorial_Series::AtInfinity(const std::uint32_t n)
   return ef::exp(((((x - ef::half()) * ef::log(x)) - x) + half_ln_two_pi) + sum);
 }
 
+void Factorial_Series::PrimesUpTo(const std::uint32_t n, std::deque<std::uint32_t>& primes)
+{
+  // Generate at least pi(n) primes, using the bound pi(n) < 1.25506 n / log(n)
+  // of Rosser and Schoenfeld, and drop the primes above n.
+  const double xn = static_cast<double>((std::max)(n, static_cast<std::uint32_t>(17U)));
+
+  ef::prime(static_cast<std::uint32_t>((1.25506 * xn) / std::log(xn)) + 1U, primes);
+
+  while((!primes.empty()) && (primes.back() > n))
+  {
+    primes.pop_back();
+  }
+}
+
+Util::big_int Factorial_Series::ExactProduct(const std::vector<std::uint32_t>& factors, const std::size_t first, const std::size_t last)
+{
+  // Multiply the factors in the range [first, last) exactly with a product
+  // tree, such that the operands of each multiplication have similar size.
+  if((last - first) <= static_cast<std::size_t>(16U))
+  {
+    Util::big_int p(static_cast<std::int64_t>(1));
+
+    for(std::size_t i = first; i < last; ++i)
+    {
+      p.mul_limb(static_cast<std::int32_t>(factors[i]));
+    }
+
+    return p;
+  }
+
+  const std::size_t middle = first + ((last - first) / 2U);
+
+  return ExactProduct(factors, first, middle) * ExactProduct(factors, middle, last);
+}
+
+e_float Factorial_Series::Product(const std::vector<std::uint32_t>& factors)
+{
+  // Multiply the factors, each less than 10^8, with a product tree. The leaves
+  // of the tree are exact products which cover the working precision. These
+  // are converted to e_float once and multiplied with the working precision.
+  const double exact_digits = static_cast<double>(std::numeric_limits<e_float>::digits10);
+
+  std::vector<e_float> partial_products;
+
+  std::size_t first = static_cast<std::size_t>(0U);
+
+  while(first < factors.size())
+  {
+    double      digits = 0.0;
+    std::size_t last   = first;
+
+    while((last < factors.size()) && (digits < exact_digits))
+    {
+      digits += std::log10(static_cast<double>(factors[last]));
+
+      ++last;
+    }
+
+    partial_products.push_back(ExactProduct(factors, first, last).to_e_float());
+
+    first = last;
+  }
+
+  // Multiply the partial products pairwise until one value remains.
+  while(partial_products.size() > static_cast<std::size_t>(1U))
+  {
+    std::vector<e_float> next((partial_products.size() + 1U) / 2U);
+
+    for(std::size_t i = static_cast<std::size_t>(0U); i < next.size(); ++i)
+    {
+      next[i] = (((2U * i) + 1U) < partial_products.size()) ? (partial_products[2U * i] * partial_products[(2U * i) + 1U])
+                                                             : partial_products[2U * i];
+    }
+
+    partial_products.swap(next);
+  }
+
+  return (partial_products.empty() ? ef::one() : partial_products.front());
+}
+
+e_float Factorial_Series::PrimeSwing(const std::uint32_t n, const std::deque<std::uint32_t>& primes)
+{
+  // The swinging factorial n! / floor(n/2)!^2 is the product of the
+  // prime powers p^e, where the bits of e are floor(n / p^i) mod 2.
+  // See Peter Luschny, "Divide, Swing and Conquer the Factorial".
+  std::vector<std::uint32_t> factors;
+
+  for(std::size_t i = static_cast<std::size_t>(0U); (i < primes.size()) && (primes[i] <= n); ++i)
+  {
+    const std::uint32_t p = primes[i];
+
+    std::uint32_t q     = n;
+    std::uint32_t p_pow = static_cast<std::uint32_t>(1U);
+
+    while((q /= p) > static_cast<std::uint32_t>(0U))
+    {
+      if((q & 1U) != static_cast<std::uint32_t>(0U))
+      {
+        p_pow *= p;
+      }
+    }
+
+    if(p_pow > static_cast<std::uint32_t>(1U))
+    {
+      factors.push_back(p_pow);
+    }
+  }
+
+  return Product(factors);
+}
+
+e_float Factorial_Series::FactorialOfPrimes(const std::uint32_t n, const std::deque<std::uint32_t>& primes)
+{
+  // n! = floor(n/2)!^2 times the swinging factorial of n.
+  if(static_cast<std::size_t>(n) < Tables::A000142().size())
+  {
+    return Tables::A000142()[n];
+  }
+
+  const e_float f_half = FactorialOfPrimes(static_cast<std::uint32_t>(n / 2U), primes);
+
+  return (f_half * f_half) * PrimeSwing(n, primes);
+}
+
 e_float ef::factorial(const std::uint32_t n)
 {
-  return (static_cast<std::size_t>(n) < Tables::A000142().size()) ? Tables::A000142()[n]()
-                                                                  : Factorial_Series::AtInfinity(static_cast<std::uint32_t>(n + static_cast<std::uint32_t>(1U)));
+  if(static_cast<std::size_t>(n) < Tables::A000142().size())
+  {
+    return Tables::A000142()[n];
+  }
+  else if(n <= Factorial_Series::prime_swing_n_max)
+  {
+    return GammaUtil::FactorialOfPrimes(n);
+  }
+  else
+  {
+    return Factorial_Series::AtInfinity(static_cast<std::uint32_t>(n + static_cast<std::uint32_t>(1U)));
+  }
+}
+
+e_float GammaUtil::FactorialOfPrimes(const std::uint32_t n)
+{
+  if(static_cast<std::size_t>(n) < Tables::A000142().size())
+  {
+    return Tables::A000142()[n];
+  }
+
+  std::deque<std::uint32_t> primes;
+
+  Factorial_Series::PrimesUpTo(n, primes);
+
+  return Factorial_Series::FactorialOfPrimes(n, primes);
 }
 
 e_float ef::binomial(const std::uint32_t n, const std::uint32_t k)
@@ -81,9 +235,49 @@ e_float ef::binomial(const std::uint32_t n, const std::uint32_t k)
   }
   else
   {
-    if(n < static_cast<std::uint32_t>(Tables::A007318().size()))
+    // Row n of Pascal's triangle begins at the index n (n + 1) / 2.
+    const std::size_t row_begin = static_cast<std::size_t>((static_cast<std::uint64_t>(n) * (n + 1U)) / 2U);
+
+    if((row_begin + n) < Tables::A007318().size())
+    {
+      return Tables::A007318()[static_cast<std::size_t>(row_begin + k)];
+    }
+    else if(n <= Factorial_Series::prime_swing_n_max)
     {
-      return Tables::A007318()[static_cast<std::size_t>(n)]()[static_cast<std::size_t>(k)];
+      // The exponent of the prime p in the binomial coefficient is the number
+      // of borrows in the subtraction n - k in base p (Kummer), such that
+      // p^e does not exceed n.
+      std::deque<std::uint32_t> primes;
+
+      Factorial_Series::PrimesUpTo(n, primes);
+
+      std::vector<std::uint32_t> factors;
+
+      for(std::size_t i = static_cast<std::size_t>(0U); i < primes.size(); ++i)
+      {
+        const std::uint32_t p = primes[i];
+
+        std::uint32_t p_pow = static_cast<std::uint32_t>(1U);
+
+        for(std::uint64_t q = p; q <= n; q *= p)
+        {
+          const std::uint64_t borrow =   (n / q)
+                                       - (k / q)
+                                       - ((n - k) / q);
+
+          if(borrow != static_cast<std::uint64_t>(0U))
+          {
+            p_pow *= p;
+          }
+        }
+
+        if(p_pow > static_cast<std::uint32_t>(1U))
+        {
+          factors.push_back(p_pow);
+        }
+      }
+
+      return Factorial_Series::Product(factors);
     }
     else
     {
@@ -41,7 +41,7 @@ e_float ef::factorial2(const std::int32_t n)
 
   if(!n_is_neg)
   {
-    return (static_cast<std::size_t>(n) < Tables::A006882().size()) ? Tables::A006882()[static_cast<std::size_t>(n)]()
+    return (static_cast<std::size_t>(n) < Tables::A006882().size()) ? Tables::A006882()[static_cast<std::size_t>(n)]
                                                                     : Factorial2_Series::AtInfinity(n);
   }
   else
@@ -9,7 +9,10 @@
 // in ACM TOMS, {VOL 37, ISSUE 4, (February 2011)} (C) ACM, 2011. http://doi.acm.org/10.1145/1916461.1916469
 
 #include <array>
+#include <cmath>
+#include <limits>
 #include <numeric>
+#include <vector>
 
 #include <e_float/e_float_complex.h>
 #include <e_float/e_float_functions.h>
@@ -59,10 +62,235 @@ namespace Gamma_Series
 
     return coef;
   }
+
+  std::vector<e_float> MakeZetaOfN()
+  {
+    // The values of Zeta(k) for k < Tolerance / log10(8) + 2, which suffice
+    // for the expansions of log(Gamma(1 + x)) and log(Gamma(2 + x)) with |x| < 1/8.
+    static const double log10_of_8 = std::log10(8.0);
+
+    const std::int32_t n_max = static_cast<std::int32_t>(static_cast<double>(ef::tolerance()) / log10_of_8) + static_cast<std::int32_t>(2);
+
+    std::vector<e_float> zeta_n(static_cast<std::size_t>(n_max), ef::zero());
+
+    for(std::int32_t k = static_cast<std::int32_t>(2); k < n_max; k++)
+    {
+      zeta_n[static_cast<std::size_t>(k)] = ef::riemann_zeta(k);
+    }
+
+    return zeta_n;
+  }
+
+  const std::vector<e_float>& ZetaOfN()
+  {
+    static const std::vector<e_float> zeta_n = MakeZetaOfN();
+
+    return zeta_n;
+  }
+
+  e_float LogOfShiftProduct(const e_float& product, const e_float&, const std::int32_t)
+  {
+    // The product of the recursion is positive for positive real arguments.
+    return ef::log(product);
+  }
+
+  ef::complex<e_float> LogOfShiftProduct(const ef::complex<e_float>& product, const ef::complex<e_float>& z, const std::int32_t n_recur)
+  {
+    // The principal logarithm of the product z (z + 1) ... (z + n_recur - 1) differs
+    // from the sum of the principal logarithms of its factors by a multiple of 2 pi i.
+    // Find this multiple from the sum of the arguments of the factors, which
+    // is accurate enough in double precision.
+    static const double two_pi_d = ef::to_double(ef::two_pi());
+
+    const double x  = ef::to_double(z.real());
+    const double ay = std::fabs(ef::to_double(z.imag()));
+
+    double arg_sum = 0.0;
+
+    for(std::int32_t k = static_cast<std::int32_t>(0); k < n_recur; k++)
+    {
+      arg_sum += std::atan2(ay, x + static_cast<double>(k));
+    }
+
+    if(ef::isneg(z.imag()))
+    {
+      arg_sum = -arg_sum;
+    }
+
+    const ef::complex<e_float> log_product = ef::log(product);
+
+    const std::int32_t n_branch = static_cast<std::int32_t>(std::floor(((arg_sum - ef::to_double(log_product.imag())) / two_pi_d) + 0.5));
+
+    return ef::complex<e_float>(log_product.real(), log_product.imag() + (ef::two_pi() * n_branch));
+  }
 }
 
 namespace GammaTemplate
 {
+  template<typename T,
+           typename TR>
+  std::int32_t RecursionCount(const T& x, const std::int32_t n_offset)
+  {
+    // Get the number of upward unit steps which bring the argument into the range
+    // of the Bernoulli series expansion. The offset enlarges the range for the
+    // derivatives of the series, the coefficients of which grow with their order.
+    // Arguments with a large imaginary part lie in the range if they are not too
+    // close to the negative real axis.
+    using ef::real;
+    using ef::imag;
+    using ef::fabs;
+    using ef::to_int32;
+
+    static const std::int32_t min_arg_n = static_cast<std::int32_t>(240.0 * Util::DigitScale());
+
+    const std::int32_t n_min = static_cast<std::int32_t>(min_arg_n + n_offset);
+
+    const TR rx = real(x);
+    const TR ay = fabs(imag(x));
+
+    if(   (rx >= TR(n_min))
+       || ((ay >= TR(static_cast<std::int32_t>(n_min * static_cast<std::int32_t>(2)))) && (ay >= -rx)))
+    {
+      return static_cast<std::int32_t>(0);
+    }
+    else
+    {
+      return static_cast<std::int32_t>((n_min - to_int32(rx)) + static_cast<std::int32_t>(1));
+    }
+  }
+
+  template<typename T,
+           typename TR>
+  T ShiftProduct(const T& x, const std::int32_t n_recur)
+  {
+    // Compute the product x (x + 1) ... (x + n_recur - 1) of the recursion.
+    T xk     (x);
+    T product(ef::one());
+
+    for(std::int32_t k = static_cast<std::int32_t>(0); k < n_recur; k++)
+    {
+      product *= xk;
+
+      xk += TR(1U);
+    }
+
+    return product;
+  }
+
+  template<typename T,
+           typename TR>
+  T StirlingSum(const T& x, const std::uint32_t j)
+  {
+    // Compute the j-th derivative of the Bernoulli series of log(Gamma(x)), without
+    // its sign (-1)^j, which is Sum[B_2k (2k + j - 2)! / (2k)! x^-(2k + j - 1), {k, 1, Infinity}].
+    // Here j = 0 is used for log(Gamma(x)), j = 1 for digamma(x) and j = n + 1 for polygamma(n, x).
+    using ef::abs;
+    using ef::pow;
+    using ef::one;
+    using ef::bernoulli;
+    using ef::factorial;
+    using ef::tolerance;
+    using ef::max_iteration;
+    using ef::order_of;
+
+    const std::int32_t jj = static_cast<std::int32_t>(j);
+
+    const T one_over_x  = one() / x;
+    const T one_over_x2 = one_over_x * one_over_x;
+
+    T  x_pow = pow(one_over_x, static_cast<std::int64_t>(jj + static_cast<std::int32_t>(1)));
+    TR coef  = factorial(j) / static_cast<std::int32_t>(2);
+    T  sum   = (bernoulli(static_cast<std::uint32_t>(2U)) * coef) * x_pow;
+
+    for(std::int32_t k = static_cast<std::int32_t>(2); k < max_iteration(); k++)
+    {
+      const std::int32_t two_k = static_cast<std::int32_t>(k * static_cast<std::int32_t>(2));
+
+      // The coefficient (2k + j - 2)! / (2k)! follows from the previous one.
+      coef *= static_cast<std::int32_t>((two_k + jj) - static_cast<std::int32_t>(3));
+      coef *= static_cast<std::int32_t>((two_k + jj) - static_cast<std::int32_t>(2));
+      coef /= static_cast<std::int32_t>(two_k - static_cast<std::int32_t>(1));
+      coef /= two_k;
+
+      x_pow *= one_over_x2;
+
+      const T term = (bernoulli(static_cast<std::uint32_t>(two_k)) * coef) * x_pow;
+
+      const std::int64_t order_check = static_cast<std::int64_t>(order_of(abs(term)) - order_of(abs(sum)));
+
+      if((k > static_cast<std::int32_t>(10)) && (order_check < -tolerance()))
+      {
+        break;
+      }
+
+      sum += term;
+    }
+
+    return sum;
+  }
+
+  template<typename T,
+           typename TR>
+  T LogGammaAtInfinity(const T& x)
+  {
+    // Compute log(Gamma(x)) with the asymptotic series of Stirling. The argument
+    // must lie in the range given by RecursionCount.
+    using ef::log;
+    using ef::half;
+    using ef::two_pi;
+
+    static const TR half_ln_two_pi = log(two_pi()) / static_cast<std::int32_t>(2);
+
+    return ((((x - half()) * log(x)) - x) + half_ln_two_pi) + StirlingSum<T, TR>(x, static_cast<std::uint32_t>(0U));
+  }
+
+  template<typename T,
+           typename TR>
+  T LogGammaNearOneOrTwo(const T& dx, const bool is_near_two)
+  {
+    // Compute log(Gamma(1 + dx)) = -EulerGamma dx + Sum[(-1)^k Zeta(k) dx^k / k, {k, 2, Infinity}]
+    // or log(Gamma(2 + dx)) = (1 - EulerGamma) dx + Sum[(-1)^k (Zeta(k) - 1) dx^k / k, {k, 2, Infinity}]
+    // for |dx| < 1/8. These remain accurate close to the zeros at x = 1 and x = 2.
+    using ef::abs;
+    using ef::real;
+    using ef::imag;
+    using ef::iszero;
+    using ef::one;
+    using ef::euler_gamma;
+    using ef::tolerance;
+    using ef::order_of;
+
+    if(iszero(real(dx)) && iszero(imag(dx)))
+    {
+      return T(0U);
+    }
+
+    const std::vector<e_float>& zeta_n = Gamma_Series::ZetaOfN();
+
+    T sum    = (is_near_two ? TR(one() - euler_gamma()) : TR(-euler_gamma())) * dx;
+    T dx_pow = -dx;
+
+    for(std::size_t k = static_cast<std::size_t>(2U); k < zeta_n.size(); k++)
+    {
+      dx_pow *= -dx;
+
+      const TR zeta_k = (is_near_two ? TR(zeta_n[k] - one()) : TR(zeta_n[k]));
+
+      const T term = (zeta_k / static_cast<std::int32_t>(k)) * dx_pow;
+
+      const std::int64_t order_check = static_cast<std::int64_t>(order_of(abs(term)) - order_of(abs(sum)));
+
+      if(order_check < -tolerance())
+      {
+        break;
+      }
+
+      sum += term;
+    }
+
+    return sum;
+  }
+
   template<typename T,
            typename TR>
   T gamma(const T& x)
@@ -73,22 +301,14 @@ namespace GammaTemplate
     using ef::isint;
     using ef::small_arg;
     using ef::abs;
-    using ef::tolerance;
     using ef::exp;
-    using ef::log;
     using ef::real;
     using ef::sin;
     using ef::factorial;
-    using ef::bernoulli;
-    using ef::half;
     using ef::one;
     using ef::pi;
     using ef::pi_half;
-    using ef::two_pi;
-    using ef::max_iteration;
-    using ef::to_int32;
     using ef::to_int64;
-    using ef::order_of;
 
     if(!isfinite(real(x)))
     {
@@ -134,43 +354,13 @@ namespace GammaTemplate
     }
     else
     {
-      // Check if the argument should be scaled up for the Bernoulli series expansion.
-      static const std::int32_t min_arg_n = static_cast<std::int32_t>(240.0 * Util::DigitScale());
-      static const TR           min_arg_x = TR(min_arg_n);
-
-      const TR rx = real(xx);
-
-      const std::int32_t n_recur =
-        ((rx < min_arg_x) ? static_cast<std::int32_t>((min_arg_n - to_int32(rx)) + 1)
-                          : static_cast<std::int32_t>(0));
+      // Scale the argument up if needed for the Bernoulli series expansion.
+      const std::int32_t n_recur = RecursionCount<T, TR>(xx, static_cast<std::int32_t>(0));
 
       // Scale the argument up and use downward recursion later for the final result.
       xx += n_recur;
 
-      // Perform the Bernoulli series expansion.
-            T one_over_x_pow_two_n_minus_one = one() / xx;
-      const T one_over_x2                    = one_over_x_pow_two_n_minus_one * one_over_x_pow_two_n_minus_one;
-            T sum                            = (bernoulli(static_cast<std::uint32_t>(2U)) / static_cast<std::int32_t>(2)) * one_over_x_pow_two_n_minus_one;
-
-      for(std::int32_t n2 = static_cast<std::int32_t>(4); n2 < max_iteration(); n2 += static_cast<std::int32_t>(2))
-      {
-        one_over_x_pow_two_n_minus_one *= one_over_x2;
-
-        const T term = (bernoulli(static_cast<std::uint32_t>(n2)) * one_over_x_pow_two_n_minus_one) / TR(n2 * (n2 - static_cast<std::int32_t>(1)));
-
-        const std::int64_t order_check = static_cast<std::int64_t>(order_of(abs(term)) - order_of(abs(sum)));
-
-        if((n2 > static_cast<std::int32_t>(20)) && (order_check < -tolerance()))
-        {
-          break;
-        }
-
-        sum += term;
-      }
-
-      static const TR half_ln_two_pi = log(two_pi()) / static_cast<std::int32_t>(2);
-
-      G = exp(((((xx - half()) * log(xx)) - xx) + half_ln_two_pi) + sum);
+      G = exp(LogGammaAtInfinity<T, TR>(xx));
 
       // Rescale the result using downward recursion if necessary.
       for(std::int32_t k = static_cast<std::int32_t>(0); k < n_recur; k++)
@@ -210,6 +400,217 @@ namespace GammaTemplate
       return ((!b_neg) ? Gn : -Gn);
     }
   }
+
+  template<typename T,
+           typename TR>
+  T lgamma(const T& x)
+  {
+    // Compute log(Gamma(x)) for arguments which are not on the negative real axis.
+    using ef::abs;
+    using ef::one;
+    using ef::two;
+    using ef::eighth;
+
+    if(abs(x - one()) < eighth())
+    {
+      return LogGammaNearOneOrTwo<T, TR>(x - one(), false);
+    }
+    else if(abs(x - two()) < eighth())
+    {
+      return LogGammaNearOneOrTwo<T, TR>(x - two(), true);
+    }
+    else
+    {
+      const std::int32_t n_recur = RecursionCount<T, TR>(x, static_cast<std::int32_t>(0));
+
+      if(n_recur == static_cast<std::int32_t>(0))
+      {
+        return LogGammaAtInfinity<T, TR>(x);
+      }
+
+      // Use log(Gamma(x)) = log(Gamma(x + n)) - log[x (x + 1) ... (x + n - 1)].
+      return   LogGammaAtInfinity<T, TR>(x + TR(n_recur))
+             - Gamma_Series::LogOfShiftProduct(ShiftProduct<T, TR>(x, n_recur), x, n_recur);
+    }
+  }
+
+  template<typename T,
+           typename TR>
+  T CotDerivative(const std::uint32_t n, const T& x)
+  {
+    // Compute the n-th derivative of cot(u) at u = pi x. With c = cot(u) and
+    // dc/du = -(1 + c^2), it is a polynomial P_n(c) of degree n + 1, where
+    // P_0(c) = c and P_(n + 1)(c) = -(1 + c^2) P_n'(c). The nonzero coefficients
+    // of P_n have equal signs.
+    using ef::real;
+    using ef::iszero;
+    using ef::isneg;
+    using ef::fabs;
+    using ef::integer_part;
+    using ef::sin;
+    using ef::cos;
+    using ef::pi;
+    using ef::half;
+    using ef::quarter;
+
+    // Reduce x with the period one of the cotangent to xr with |Re(xr)| <= 1/2.
+    // For |Re(xr)| > 1/4, use cot(pi xr) = tan(pi h) with h = +-1/2 - xr, which
+    // is exact, such that cot remains accurate close to its zeros.
+    TR x_int = integer_part(real(x));
+
+    if(fabs(real(x) - x_int) > half())
+    {
+      x_int += (isneg(real(x)) ? TR(-1) : TR(1));
+    }
+
+    const T xr = x - x_int;
+
+    T c;
+
+    if(fabs(real(xr)) <= quarter())
+    {
+      const T pi_xr = pi() * xr;
+
+      c = cos(pi_xr) / sin(pi_xr);
+    }
+    else
+    {
+      const T pi_h = pi() * ((isneg(real(xr)) ? TR(-half()) : TR(half())) - xr);
+
+      c = sin(pi_h) / cos(pi_h);
+    }
+
+    std::vector<TR> a(static_cast<std::size_t>(n + 2U), TR(0U));
+
+    a[1U] = TR(1U);
+
+    for(std::uint32_t m = static_cast<std::uint32_t>(0U); m < n; m++)
+    {
+      std::vector<TR> b(a.size(), TR(0U));
+
+      for(std::uint32_t k = static_cast<std::uint32_t>(1U); k <= static_cast<std::uint32_t>(m + 1U); k++)
+      {
+        if(!iszero(a[k]))
+        {
+          const TR k_ak = a[k] * static_cast<std::int32_t>(k);
+
+          b[k - 1U] -= k_ak;
+          b[k + 1U] -= k_ak;
+        }
+      }
+
+      a.swap(b);
+    }
+
+    // The powers of c in P_n have the parity of n + 1. Sum them in powers of c^2.
+    const T c2 = c * c;
+
+    T p(0U);
+
+    for(std::int32_t k = static_cast<std::int32_t>(n + 1U); k >= static_cast<std::int32_t>(0); k -= 2)
+    {
+      p = (p * c2) + a[static_cast<std::size_t>(k)];
+    }
+
+    return (((n % static_cast<std::uint32_t>(2U)) == static_cast<std::uint32_t>(0U)) ? (p * c) : p);
+  }
+
+  template<typename T,
+           typename TR>
+  T polygamma(const std::uint32_t n, const T& x)
+  {
+    using ef::isneg;
+    using ef::real;
+    using ef::log;
+    using ef::pow;
+    using ef::pi;
+    using ef::one;
+    using ef::half;
+    using ef::factorial;
+
+    const bool n_is_odd = ((n % static_cast<std::uint32_t>(2U)) != static_cast<std::uint32_t>(0U));
+
+    if(   isneg(real(x))
+       && (RecursionCount<T, TR>(x, static_cast<std::int32_t>(n)) != static_cast<std::int32_t>(0)))
+    {
+      // Use the reflection formula psi^(n)(x) = (-1)^n psi^(n)(1 - x) - pi^(n + 1) cot^(n)(pi x),
+      // which is the n-th derivative of psi(x) = psi(1 - x) - pi cot(pi x). This avoids
+      // the upward recursion over the whole negative real part.
+      const T psi_reflect = polygamma<T, TR>(n, one() - x);
+
+      const T pi_cot_n = pow(pi(), static_cast<std::int64_t>(n + static_cast<std::uint32_t>(1U))) * CotDerivative<T, TR>(n, x);
+
+      return ((n_is_odd ? -psi_reflect : psi_reflect) - pi_cot_n);
+    }
+
+    // Scale the argument up and use downward recursion later for the final result.
+    const std::int32_t n_recur = RecursionCount<T, TR>(x, static_cast<std::int32_t>(n));
+
+    const T xx = x + TR(n_recur);
+
+    T psi;
+
+    if(n == static_cast<std::uint32_t>(0U))
+    {
+      psi = (log(xx) - (half() / xx)) - StirlingSum<T, TR>(xx, static_cast<std::uint32_t>(1U));
+    }
+    else
+    {
+      // The asymptotic series is the n-th derivative of log(x) - 1/(2x) - Sum[B_2k / (2k x^2k)],
+      // psi^(n)(x) = (-1)^(n + 1) [(n - 1)! / x^n + n! / (2 x^(n + 1)) + Sum[B_2k (2k + n - 1)! / ((2k)! x^(2k + n))]].
+      const T one_over_xx    = one() / xx;
+      const T xx_pow_minus_n = pow(one_over_xx, static_cast<std::int64_t>(n));
+
+      psi =   ((factorial(n - static_cast<std::uint32_t>(1U)) * xx_pow_minus_n) + (((factorial(n) / static_cast<std::int32_t>(2)) * xx_pow_minus_n) * one_over_xx))
+            + StirlingSum<T, TR>(xx, static_cast<std::uint32_t>(n + static_cast<std::uint32_t>(1U)));
+
+      if(!n_is_odd)
+      {
+        psi = -psi;
+      }
+    }
+
+    if(n_recur > static_cast<std::int32_t>(0))
+    {
+      // Use the downward recursion psi^(n)(x) = psi^(n)(x + 1) - (-1)^n n! / x^(n + 1).
+      T sum(0U);
+      T xk (x);
+
+      for(std::int32_t k = static_cast<std::int32_t>(0); k < n_recur; k++)
+      {
+        sum += pow(one() / xk, static_cast<std::int64_t>(n + static_cast<std::uint32_t>(1U)));
+
+        xk += TR(1U);
+      }
+
+      const TR n_factorial = factorial(n);
+
+      psi = (n_is_odd ? (psi + (n_factorial * sum)) : (psi - (n_factorial * sum)));
+    }
+
+    return psi;
+  }
+
+  template<typename T,
+           typename TR>
+  T gamma_ratio(const T& x, const T& a)
+  {
+    // Compute Gamma(x + a) / Gamma(x) for arguments with positive real parts.
+    // Both gamma functions are scaled up with the recursion, and the ratio
+    // is found from the difference of their Stirling series with a single
+    // exponential function.
+    using ef::exp;
+
+    const T x_plus_a = x + a;
+
+    const std::int32_t n_recur_x        = RecursionCount<T, TR>(x,        static_cast<std::int32_t>(0));
+    const std::int32_t n_recur_x_plus_a = RecursionCount<T, TR>(x_plus_a, static_cast<std::int32_t>(0));
+
+    const T log_ratio =   LogGammaAtInfinity<T, TR>(x_plus_a + TR(n_recur_x_plus_a))
+                        - LogGammaAtInfinity<T, TR>(x        + TR(n_recur_x));
+
+    return (exp(log_ratio) * ShiftProduct<T, TR>(x, n_recur_x)) / ShiftProduct<T, TR>(x_plus_a, n_recur_x_plus_a);
+  }
 }
 
 e_float ef::gamma(const e_float& x)
@@ -240,3 +641,120 @@ e_float ef::gamma_near_n(const std::int32_t n, const e_float& x)
 {
   return GammaTemplate::gamma_near_n<e_float, e_float>(n, x);
 }
+
+e_float GammaUtil::GammaOfXPlusAOverGammaOfX(const e_float& x, const e_float& a)
+{
+  return GammaTemplate::gamma_ratio<e_float, e_float>(x, a);
+}
+
+ef::complex<e_float> GammaUtil::GammaOfXPlusAOverGammaOfX(const ef::complex<e_float>& z, const ef::complex<e_float>& a)
+{
+  return GammaTemplate::gamma_ratio<ef::complex<e_float>, e_float>(z, a);
+}
+
+e_float ef::lgamma(const e_float& x)
+{
+  if(ef::isnan(x))
+  {
+    return x;
+  }
+  else if((!ef::isfinite(x)) || (ef::isint(x) && (ef::isneg(x) || ef::iszero(x))))
+  {
+    // This includes the poles at the non-positive integers.
+    return std::numeric_limits<e_float>::infinity();
+  }
+  else if(ef::isneg(x))
+  {
+    // Use the reflection formula |Gamma(x)| = pi / |sin(pi x) Gamma(1 - x)|.
+    static const e_float ln_pi = ef::log(ef::pi());
+
+    return (ln_pi - ef::log(ef::fabs(ef::sin(ef::pi() * x)))) - ef::lgamma(ef::one() - x);
+  }
+  else
+  {
+    return GammaTemplate::lgamma<e_float, e_float>(x);
+  }
+}
+
+ef::complex<e_float> ef::lgamma(const ef::complex<e_float>& z)
+{
+  if(ef::iszero(z.imag()) && (!ef::isneg(z.real())))
+  {
+    return ef::complex<e_float>(ef::lgamma(z.real()));
+  }
+  else if(ef::iszero(z.imag()) && ef::isint(z.real()))
+  {
+    return ef::complex<e_float>(std::numeric_limits<e_float>::infinity());
+  }
+  else if(   ef::isneg(z.real())
+          && (GammaTemplate::RecursionCount<ef::complex<e_float>, e_float>(z, static_cast<std::int32_t>(0)) != static_cast<std::int32_t>(0)))
+  {
+    // Use the reflection formula log(Gamma(z)) = log(pi) - log(sin(pi z)) - log(Gamma(1 - z)).
+    // The principal logarithm of sin(pi z) would need a correction by a multiple of 2 pi i.
+    // For Im(z) > 0, the matching branch is -log(2) + i pi (1/2 - z) + log(1 - exp(2 pi i z)),
+    // in which the principal logarithm is continuous since |exp(2 pi i z)| < 1. The lower
+    // half plane follows from the symmetry under complex conjugation.
+    static const e_float ln_pi = ef::log(ef::pi());
+
+    const bool b_neg_imag = ef::isneg(z.imag());
+
+    const ef::complex<e_float> zz(z.real(), ((!b_neg_imag) ? z.imag() : -z.imag()));
+
+    // The exponential has period one in the real part of z.
+    const e_float x_frac = zz.real() - ef::integer_part(zz.real());
+
+    const ef::complex<e_float> exp_two_pi_i_z = ef::exp(ef::complex<e_float>(-(ef::two_pi() * zz.imag()), ef::two_pi() * x_frac));
+
+    const ef::complex<e_float> log_sin_pi_z =   ef::complex<e_float>((ef::pi() * zz.imag()) - ef::ln2(), ef::pi() * (ef::half() - zz.real()))
+                                              + ef::log(ef::one() - exp_two_pi_i_z);
+
+    const ef::complex<e_float> log_gamma = (ln_pi - log_sin_pi_z) - ef::lgamma(ef::one() - zz);
+
+    return ((!b_neg_imag) ? log_gamma : ef::complex<e_float>(log_gamma.real(), -log_gamma.imag()));
+  }
+  else
+  {
+    // This is the branch of log(Gamma(z)) which is analytic apart from the
+    // cut along the negative real axis, as opposed to log(gamma(z)).
+    return GammaTemplate::lgamma<ef::complex<e_float>, e_float>(z);
+  }
+}
+
+e_float ef::digamma(const e_float& x)
+{
+  return ef::polygamma(static_cast<std::uint32_t>(0U), x);
+}
+
+ef::complex<e_float> ef::digamma(const ef::complex<e_float>& z)
+{
+  return ef::polygamma(static_cast<std::uint32_t>(0U), z);
+}
+
+e_float ef::polygamma(const std::uint32_t n, const e_float& x)
+{
+  if(ef::isnan(x) || (ef::isinf(x) && ef::isneg(x)) || (ef::isint(x) && (ef::isneg(x) || ef::iszero(x))))
+  {
+    // This includes the poles at the non-positive integers.
+    return std::numeric_limits<e_float>::quiet_NaN();
+  }
+  else if(ef::isinf(x))
+  {
+    return ((n == static_cast<std::uint32_t>(0U)) ? x : ef::zero());
+  }
+  else
+  {
+    return GammaTemplate::polygamma<e_float, e_float>(n, x);
+  }
+}
+
+ef::complex<e_float> ef::polygamma(const std::uint32_t n, const ef::complex<e_float>& z)
+{
+  if(ef::iszero(z.imag()))
+  {
+    return ef::complex<e_float>(ef::polygamma(n, z.real()));
+  }
+  else
+  {
+    return GammaTemplate::polygamma<ef::complex<e_float>, e_float>(n, z);
+  }
+}
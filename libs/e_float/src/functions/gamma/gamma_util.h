@@ -12,10 +12,19 @@
   #define GAMMA_UTIL_2008_01_10_H_
   
   #include <e_float/e_float.h>
+  #include <e_float/e_float_complex.h>
 
   namespace GammaUtil
   {
     void GammaOfPlusXMinusX(const e_float& x, e_float& gamma_plus_x, e_float& gamma_minus_x);
+
+    e_float              GammaOfXPlusAOverGammaOfX(const e_float& x, const e_float& a);
+    ef::complex<e_float> GammaOfXPlusAOverGammaOfX(const ef::complex<e_float>& z, const ef::complex<e_float>& a);
+
+    // The factorial n! from the product of prime powers, for all n. Unlike
+    // ef::factorial, it never uses the Bernoulli numbers, such that these
+    // can use it.
+    e_float FactorialOfPrimes(const std::uint32_t n);
   }
   
 #endif // GAMMA_UTIL_2008_01_10_H_
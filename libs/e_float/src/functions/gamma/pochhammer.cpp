@@ -12,6 +12,8 @@
 #include <e_float/e_float_functions.h>
 #include <e_float/e_float_functions_complex.h>
 
+#include <functions/gamma/gamma_util.h>
+
 namespace Pochhammer_Series
 {
   template<typename T,
@@ -19,8 +21,7 @@ namespace Pochhammer_Series
   T Pochhammer_Template(const T& x, const std::uint32_t n)
   {
     using ef::real;
-    using ef::real;
-    using ef::gamma;
+    using ef::zero;
     using ef::gamma;
     using ef::one;
 
@@ -52,7 +53,15 @@ namespace Pochhammer_Series
       {
         const TR nr(n);
 
-        return gamma(x + nr) / gamma(x);
+        if(real(x) > zero())
+        {
+          // Avoid the computation of two full gamma functions.
+          return GammaUtil::GammaOfXPlusAOverGammaOfX(x, T(nr));
+        }
+        else
+        {
+          return gamma(x + nr) / gamma(x);
+        }
       }
     }
   }
@@ -70,11 +79,25 @@ ef::complex<e_float> ef::pochhammer(const ef::complex<e_float>& x, const std::ui
 
 e_float ef::pochhammer(const e_float& x, const e_float& a)
 {
-  return ef::gamma(x + a) / ef::gamma(x);
+  if((x > ef::zero()) && ((x + a) > ef::zero()))
+  {
+    return GammaUtil::GammaOfXPlusAOverGammaOfX(x, a);
+  }
+  else
+  {
+    return ef::gamma(x + a) / ef::gamma(x);
+  }
 }
 
 ef::complex<e_float> ef::pochhammer(const ef::complex<e_float>& z, const ef::complex<e_float>& a)
 {
-  return ef::gamma(z + a) / ef::gamma(z);
+  if((z.real() > ef::zero()) && ((z + a).real() > ef::zero()))
+  {
+    return GammaUtil::GammaOfXPlusAOverGammaOfX(z, a);
+  }
+  else
+  {
+    return ef::gamma(z + a) / ef::gamma(z);
+  }
 }
 
@@ -9,61 +9,182 @@
 // in ACM TOMS, {VOL 37, ISSUE 4, (February 2011)} (C) ACM, 2011. http://doi.acm.org/10.1145/1916461.1916469
 
 #include <algorithm>
+#include <cmath>
+#include <memory>
+#include <mutex>
 
 #include <e_float/e_float_functions.h>
 #include <e_float/detail/e_float_detail_pown_template.h>
 
+#include <functions/gamma/gamma_util.h>
 #include <functions/tables/tables.h>
+#include <utility/util_disk_cache.h>
 
-e_float ef::bernoulli(const std::uint32_t n)
+namespace Bernoulli_Series
 {
-  if(static_cast<std::uint32_t>(n % static_cast<std::uint32_t>(2U)) != static_cast<std::uint32_t>(0U))
+  void AtInfinity(std::vector<e_float>& bn, const std::uint32_t n_first)
   {
-    return (n == static_cast<std::uint32_t>(1U) ? -ef::half() : ef::zero());
+    // Compute the even entries of bn from n_first onward with
+    // B_n = (-1)^(n/2 + 1) [2 n! / (2 pi)^n] Zeta(n),
+    // see Abramowitz & Stegun 23.1.18, page 805. For n at or above the
+    // number of digits, the sum for Zeta(n) has only a few terms.
+    // Consecutive factors in brackets and powers k^-n in the sum follow
+    // from each other with a few multiplications. These are recomputed
+    // directly at the start of each block of 512 numbers, which limits
+    // the accumulation of rounding errors. The factorial is taken from
+    // the product of prime powers, since ef::factorial uses the Bernoulli
+    // numbers for large n.
+    static const e_float one_over_four_pi_squared = ef::one() / (ef::two_pi() * ef::two_pi());
+
+    const std::uint32_t n_end = static_cast<std::uint32_t>(bn.size());
+
+    e_float              factor;
+    std::vector<e_float> k_pow_minus_n;
+    std::vector<e_float> one_over_k_squared;
+
+    for(std::uint32_t n = n_first; n < n_end; n += static_cast<std::uint32_t>(2U))
+    {
+      const bool is_block_start = (((n - n_first) % static_cast<std::uint32_t>(1024U)) == static_cast<std::uint32_t>(0U));
+
+      if(is_block_start)
+      {
+        factor = (GammaUtil::FactorialOfPrimes(n) / ef::detail::pown_template(ef::two_pi(), static_cast<std::int64_t>(n))) * static_cast<std::int32_t>(2);
+
+        // Use the terms k^-n of the sum which exceed the tolerance.
+        const double k_max = std::pow(10.0, static_cast<double>(ef::tolerance()) / static_cast<double>(n));
+
+        const std::uint32_t k_end = static_cast<std::uint32_t>((std::max)(2.0, k_max) + 1.0);
+
+        k_pow_minus_n.resize     (static_cast<std::size_t>(k_end));
+        one_over_k_squared.resize(static_cast<std::size_t>(k_end));
+
+        for(std::uint32_t k = static_cast<std::uint32_t>(2U); k < k_end; k++)
+        {
+          const e_float one_over_k = ef::one() / static_cast<std::int32_t>(k);
+
+          k_pow_minus_n     [k] = ef::detail::pown_template(one_over_k, static_cast<std::int64_t>(n));
+          one_over_k_squared[k] = one_over_k * one_over_k;
+        }
+      }
+      else
+      {
+        factor *= static_cast<std::int32_t>(n - static_cast<std::uint32_t>(1U));
+        factor *= static_cast<std::int32_t>(n);
+        factor *= one_over_four_pi_squared;
+
+        for(std::size_t k = static_cast<std::size_t>(2U); k < k_pow_minus_n.size(); k++)
+        {
+          k_pow_minus_n[k] *= one_over_k_squared[k];
+        }
+      }
+
+      e_float zeta_n = ef::one();
+
+      for(std::size_t k = static_cast<std::size_t>(2U); k < k_pow_minus_n.size(); k++)
+      {
+        zeta_n += k_pow_minus_n[k];
+      }
+
+      const bool b_neg = ((static_cast<std::uint32_t>(n / static_cast<std::uint32_t>(2U)) % static_cast<std::uint32_t>(2U)) == static_cast<std::uint32_t>(0U));
+
+      const e_float b = factor * zeta_n;
+
+      bn[static_cast<std::size_t>(n)] = ((!b_neg) ? b : -b);
+    }
   }
-  else
+
+  std::shared_ptr<const std::vector<e_float>> Values(const std::uint32_t n)
   {
+    // Provide the Bernoulli numbers B_0 ... B_m with m >= n. The set is
+    // cached and grows to at least twice its size when a larger number is
+    // needed, so that a series which calls ef::bernoulli term by term only
+    // rarely triggers the computation. The precision of e_float is fixed at
+    // compile time, so the cached values are valid for all calls. A set
+    // remains valid for its holders when another thread replaces it.
+    static std::mutex                                  cache_mutex;
+    static std::shared_ptr<const std::vector<e_float>> values;
+
+    std::shared_ptr<const std::vector<e_float>> values_old;
+
+    {
+      const std::lock_guard<std::mutex> lock(cache_mutex);
+
+      if(values && (values->size() > static_cast<std::size_t>(n)))
+      {
+        return values;
+      }
+
+      values_old = values;
+    }
+
+    const std::size_t size_old = (values_old ? values_old->size() : static_cast<std::size_t>(0U));
+
+    std::uint32_t m = (std::max)(n, static_cast<std::uint32_t>((std::max)(static_cast<std::size_t>(2U) * size_old, static_cast<std::size_t>(64U))));
+
+    m = static_cast<std::uint32_t>(m + static_cast<std::uint32_t>(m % static_cast<std::uint32_t>(2U)));
+
     static const std::size_t sz_A000367 = Tables::A000367().size();
     static const std::size_t sz_A002445 = Tables::A002445().size();
     static const std::size_t sz_max     = (std::min)(sz_A000367, sz_A002445);
 
-    const std::size_t n_half = static_cast<std::size_t>(n / static_cast<std::uint32_t>(2U));
+    // The first number which is neither known nor tabulated.
+    const std::uint32_t n_beyond = static_cast<std::uint32_t>((std::max)(size_old + (size_old % static_cast<std::size_t>(2U)), static_cast<std::size_t>(2U) * sz_max));
 
-    if(n_half < sz_max)
+    std::vector<e_float> bn;
+
+    // For n >= tolerance / 2, the sum for Zeta(n) has at most 100 terms.
+    // The numbers beyond the tables then follow faster from this sum than
+    // from the tangent numbers, whose cost per number grows with m.
+    if((m < n_beyond) || (n_beyond >= static_cast<std::uint32_t>(ef::tolerance() / 2)))
     {
-      return Tables::A000367()[n_half]() / Tables::A002445()[n_half]();
+      bn.resize(static_cast<std::size_t>(m + static_cast<std::uint32_t>(1U)), ef::zero());
+
+      Bernoulli_Series::AtInfinity(bn, n_beyond);
     }
     else
     {
-      // Do a loop calculation for higher numbered Bernoulli numbers.
-      // See Abramowitz & Stegun 23.1.18, page 805, for x = 0.
-      // See Computation of Special Functions, Zhang & Jin, 1.1.16, page 5.
-
-      e_float sum = ef::one();
-
-      // TBD: Check the power of two using logs and floating point math to see
-      //      if the loop is even necessary.
+      // Compute the numbers beyond the tables in bulk with the tangent numbers.
+      ef::bernoulli_table(bn, m);
+    }
 
-      for(std::int32_t k = static_cast<std::int32_t>(2); k < ef::max_iteration(); k++)
+    // Keep the values which are already known and use the exact
+    // tabulated numbers for the remaining ones in the range of the tables.
+    for(std::size_t i = static_cast<std::size_t>(0U); i < bn.size(); i += static_cast<std::size_t>(2U))
+    {
+      if(i < size_old)
       {
-        const e_float one_over_k = ef::one() / k;
-        const e_float term       = ef::detail::pown_template(one_over_k, static_cast<std::int64_t>(n));
-        
-        if(term.order() < -ef::tolerance())
-        {
-          break;
-        }
-
-        sum += term;
+        bn[i] = (*values_old)[i];
       }
+      else if((i / static_cast<std::size_t>(2U)) < sz_max)
+      {
+        bn[i] = Tables::A000367()[i / static_cast<std::size_t>(2U)] / Tables::A002445()[i / static_cast<std::size_t>(2U)];
+      }
+    }
+
+    bn[1U] = -ef::half();
 
-      const bool b_neg = static_cast<std::uint32_t>(static_cast<std::uint32_t>(n / static_cast<std::uint32_t>(2U)) & static_cast<std::uint32_t>(1U)) == static_cast<std::uint32_t>(0U);
+    const std::shared_ptr<const std::vector<e_float>> values_new = std::make_shared<const std::vector<e_float>>(std::move(bn));
 
-      const e_float factor = ((ef::factorial(n) / ef::detail::pown_template(ef::two_pi(), static_cast<std::int64_t>(n))) * static_cast<std::int32_t>(2));
-      const e_float bn     = sum * factor;
+    const std::lock_guard<std::mutex> lock(cache_mutex);
 
-      return ((!b_neg) ? bn : -bn);
+    if((!values) || (values->size() < values_new->size()))
+    {
+      values = values_new;
     }
+
+    return values_new;
+  }
+}
+
+e_float ef::bernoulli(const std::uint32_t n)
+{
+  if(static_cast<std::uint32_t>(n % static_cast<std::uint32_t>(2U)) != static_cast<std::uint32_t>(0U))
+  {
+    return (n == static_cast<std::uint32_t>(1U) ? -ef::half() : ef::zero());
+  }
+  else
+  {
+    return (*Bernoulli_Series::Values(n))[static_cast<std::size_t>(n)];
   }
 }
 
@@ -75,6 +196,14 @@ void ef::bernoulli_table(std::vector<e_float>& bn, const std::uint32_t n)
 
   const std::uint32_t nn = (((n % static_cast<std::uint32_t>(2)) != static_cast<std::uint32_t>(0U)) ? static_cast<std::uint32_t>(n + 1U) : n);
 
+  // A cached table which is at least as long as the requested one is truncated.
+  if(Util::DiskCacheRead("bernoulli", bn) && (bn.size() > static_cast<std::size_t>(nn)))
+  {
+    bn.resize(static_cast<std::vector<e_float>::size_type>(nn + static_cast<std::uint32_t>(1U)));
+
+    return;
+  }
+
   const std::int32_t m = static_cast<std::int32_t>(nn / static_cast<std::uint32_t>(2U));
 
   std::vector<e_float> tangent_numbers(static_cast<std::vector<e_float>::size_type>(m + 1));
@@ -118,4 +247,6 @@ void ef::bernoulli_table(std::vector<e_float>& bn, const std::uint32_t n)
 
   bn[0U] =  ef::one();
   bn[1U] = -ef::half();
+
+  static_cast<void>(Util::DiskCacheWrite("bernoulli", bn));
 }
@@ -92,23 +92,27 @@ namespace Primes
     primes_data.resize(static_cast<std::size_t>(n), UINT32_C(0));
   }
 
-  std::deque<std::uint32_t>& Data()
+  std::deque<std::uint32_t> MakeData()
   {
-    // Create a static data table of primes and return a reference to it.
-    static std::deque<std::uint32_t> primes;
+    // Select a maximum count of prime numbers to be stored
+    // in the data table. This number is selected such that
+    // the value of the highest prime will slightly exceed
+    // 0x10000 (decimal 65,536). This number is significant
+    // because it is the maximum value which needs to be tested
+    // while computing the prime factors of unsigned 32-bit integers,
+    // as done in the subroutine Factors(...).
+    std::deque<std::uint32_t> primes;
 
-    if(primes.empty())
-    {
-      // Select a maximum count of prime numbers to be stored
-      // in the data table. This number is selected such that
-      // the value of the highest prime will slightly exceed
-      // 0x10000 (decimal 65,536). This number is significant
-      // because it is the maximum value which needs to be tested
-      // while computing the prime factors of unsigned 32-bit integers,
-      // as done in the subroutine Factors(...).
-
-      Primes::Generator(static_cast<std::uint32_t>(6550U), primes);
-    }
+    Primes::Generator(static_cast<std::uint32_t>(6550U), primes);
+
+    return primes;
+  }
+
+  const std::deque<std::uint32_t>& Data()
+  {
+    // Create a static data table of primes and return a reference to it.
+    // The table is filled in the (thread-safe) initialization of the static.
+    static const std::deque<std::uint32_t> primes = MakeData();
 
     return primes;
   }
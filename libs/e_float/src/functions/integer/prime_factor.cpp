@@ -16,7 +16,7 @@
 
 namespace Primes
 {
-  std::deque<std::uint32_t>& Data();
+  const std::deque<std::uint32_t>& Data();
 
   static bool IsPrimeFactor(std::uint32_t& np, const std::uint32_t p)
   {
@@ -75,19 +75,11 @@ namespace Primes
       }
     }
   }
-}
 
-void ef::prime_factors(const std::uint32_t n, std::deque<Util::point<std::uint32_t>>& pf)
-{
-  // Factor the input integer into a list of primes. For small inputs less than 10,000
-  // use the tabulated prime factors list. Calculate the prime factors for larger inputs
-  // above 10,000.
-  static std::vector<std::deque<Util::point<std::uint32_t>>> prime_factors_list;
-
-  if(prime_factors_list.empty())
+  static std::vector<std::deque<Util::point<std::uint32_t>>> MakeFactorsList()
   {
     // Generate a table of the sets of the first 10,000 integer prime factorizations.
-    prime_factors_list.resize(static_cast<std::size_t>(10000U));
+    std::vector<std::deque<Util::point<std::uint32_t>>> prime_factors_list(static_cast<std::size_t>(10000U));
 
     prime_factors_list[static_cast<std::size_t>(0U)] = std::deque<Util::point<std::uint32_t>>(static_cast<std::size_t>(1U), Util::point<std::uint32_t>(static_cast<std::uint32_t>(0U), static_cast<std::uint32_t>(1U)));
     prime_factors_list[static_cast<std::size_t>(1U)] = std::deque<Util::point<std::uint32_t>>(static_cast<std::size_t>(1U), Util::point<std::uint32_t>(static_cast<std::uint32_t>(1U), static_cast<std::uint32_t>(1U)));
@@ -117,7 +109,17 @@ void ef::prime_factors(const std::uint32_t n, std::deque<Util::point<std::uint32
         Primes::Factors(static_cast<std::uint32_t>(i), prime_factors_list[i]);
       }
     }
+
+    return prime_factors_list;
   }
+}
+
+void ef::prime_factors(const std::uint32_t n, std::deque<Util::point<std::uint32_t>>& pf)
+{
+  // Factor the input integer into a list of primes. For small inputs less than 10,000
+  // use the tabulated prime factors list. Calculate the prime factors for larger inputs
+  // above 10,000. The table is filled in the (thread-safe) initialization of the static.
+  static const std::vector<std::deque<Util::point<std::uint32_t>>> prime_factors_list = Primes::MakeFactorsList();
 
   if(static_cast<std::size_t>(n) < prime_factors_list.size())
   {
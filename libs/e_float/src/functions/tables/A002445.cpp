@@ -1,4 +1,3 @@
-
 //          Copyright Christopher Kormanyos 1999 - 2021.
 // Distributed under the Boost Software License, Version 1.0.
 //    (See accompanying file LICENSE_1_0.txt or copy at
@@ -8,7033 +7,255 @@
 // "Algorithm 910: A Portable C++ Multiple-Precision System for Special-Function Calculations",
 // in ACM TOMS, {VOL 37, ISSUE 4, (February 2011)} (C) ACM, 2011. http://doi.acm.org/10.1145/1916461.1916469
 
-// Automatically generated file
-#include <array>
-#include <vector>
-
+// Automatically generated file, see generator/tables_generator.cpp
 #include <functions/tables/tables.h>
 
 namespace A002445_Table
 {
-  static const e_float& A002445_0()
-  {
-    static const e_float val(static_cast<std::int32_t>(1L));
-    return val;
-  }
-
-  static const e_float& A002445_1()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_2()
-  {
-    static const e_float val(static_cast<std::int32_t>(30L));
-    return val;
-  }
-
-  static const e_float& A002445_3()
-  {
-    static const e_float val(static_cast<std::int32_t>(42L));
-    return val;
-  }
-
-  static const e_float& A002445_4()
-  {
-    static const e_float val(static_cast<std::int32_t>(30L));
-    return val;
-  }
-
-  static const e_float& A002445_5()
-  {
-    static const e_float val(static_cast<std::int32_t>(66L));
-    return val;
-  }
-
-  static const e_float& A002445_6()
-  {
-    static const e_float val(static_cast<std::int32_t>(2730L));
-    return val;
-  }
-
-  static const e_float& A002445_7()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_8()
-  {
-    static const e_float val(static_cast<std::int32_t>(510L));
-    return val;
-  }
-
-  static const e_float& A002445_9()
-  {
-    static const e_float val(static_cast<std::int32_t>(798L));
-    return val;
-  }
-
-  static const e_float& A002445_10()
-  {
-    static const e_float val(static_cast<std::int32_t>(330L));
-    return val;
-  }
-
-  static const e_float& A002445_11()
-  {
-    static const e_float val(static_cast<std::int32_t>(138L));
-    return val;
-  }
-
-  static const e_float& A002445_12()
-  {
-    static const e_float val(static_cast<std::int32_t>(2730L));
-    return val;
-  }
-
-  static const e_float& A002445_13()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_14()
-  {
-    static const e_float val(static_cast<std::int32_t>(870L));
-    return val;
-  }
-
-  static const e_float& A002445_15()
-  {
-    static const e_float val(static_cast<std::int32_t>(14322L));
-    return val;
-  }
-
-  static const e_float& A002445_16()
-  {
-    static const e_float val(static_cast<std::int32_t>(510L));
-    return val;
-  }
-
-  static const e_float& A002445_17()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_18()
-  {
-    static const e_float val(static_cast<std::int32_t>(1919190L));
-    return val;
-  }
-
-  static const e_float& A002445_19()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_20()
-  {
-    static const e_float val(static_cast<std::int32_t>(13530L));
-    return val;
-  }
-
-  static const e_float& A002445_21()
-  {
-    static const e_float val(static_cast<std::int32_t>(1806L));
-    return val;
-  }
-
-  static const e_float& A002445_22()
-  {
-    static const e_float val(static_cast<std::int32_t>(690L));
-    return val;
-  }
-
-  static const e_float& A002445_23()
-  {
-    static const e_float val(static_cast<std::int32_t>(282L));
-    return val;
-  }
-
-  static const e_float& A002445_24()
-  {
-    static const e_float val(static_cast<std::int32_t>(46410L));
-    return val;
-  }
-
-  static const e_float& A002445_25()
-  {
-    static const e_float val(static_cast<std::int32_t>(66L));
-    return val;
-  }
-
-  static const e_float& A002445_26()
-  {
-    static const e_float val(static_cast<std::int32_t>(1590L));
-    return val;
-  }
-
-  static const e_float& A002445_27()
-  {
-    static const e_float val(static_cast<std::int32_t>(798L));
-    return val;
-  }
-
-  static const e_float& A002445_28()
-  {
-    static const e_float val(static_cast<std::int32_t>(870L));
-    return val;
-  }
-
-  static const e_float& A002445_29()
-  {
-    static const e_float val(static_cast<std::int32_t>(354L));
-    return val;
-  }
-
-  static const e_float& A002445_30()
-  {
-    static const e_float val(static_cast<std::int32_t>(56786730L));
-    return val;
-  }
-
-  static const e_float& A002445_31()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_32()
-  {
-    static const e_float val(static_cast<std::int32_t>(510L));
-    return val;
-  }
-
-  static const e_float& A002445_33()
-  {
-    static const e_float val(static_cast<std::int32_t>(64722L));
-    return val;
-  }
-
-  static const e_float& A002445_34()
-  {
-    static const e_float val(static_cast<std::int32_t>(30L));
-    return val;
-  }
-
-  static const e_float& A002445_35()
-  {
-    static const e_float val(static_cast<std::int32_t>(4686L));
-    return val;
-  }
-
-  static const e_float& A002445_36()
-  {
-    static const e_float val(static_cast<std::int32_t>(140100870L));
-    return val;
-  }
-
-  static const e_float& A002445_37()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_38()
-  {
-    static const e_float val(static_cast<std::int32_t>(30L));
-    return val;
-  }
-
-  static const e_float& A002445_39()
-  {
-    static const e_float val(static_cast<std::int32_t>(3318L));
-    return val;
-  }
-
-  static const e_float& A002445_40()
-  {
-    static const e_float val(static_cast<std::int32_t>(230010L));
-    return val;
-  }
-
-  static const e_float& A002445_41()
-  {
-    static const e_float val(static_cast<std::int32_t>(498L));
-    return val;
-  }
-
-  static const e_float& A002445_42()
-  {
-    static const e_float val(static_cast<std::int32_t>(3404310L));
-    return val;
-  }
-
-  static const e_float& A002445_43()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_44()
-  {
-    static const e_float val(static_cast<std::int32_t>(61410L));
-    return val;
-  }
-
-  static const e_float& A002445_45()
-  {
-    static const e_float val(static_cast<std::int32_t>(272118L));
-    return val;
-  }
-
-  static const e_float& A002445_46()
-  {
-    static const e_float val(static_cast<std::int32_t>(1410L));
-    return val;
-  }
-
-  static const e_float& A002445_47()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_48()
-  {
-    static const e_float val(static_cast<std::int32_t>(4501770L));
-    return val;
-  }
-
-  static const e_float& A002445_49()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_50()
-  {
-    static const e_float val(static_cast<std::int32_t>(33330L));
-    return val;
-  }
-
-  static const e_float& A002445_51()
-  {
-    static const e_float val(static_cast<std::int32_t>(4326L));
-    return val;
-  }
-
-  static const e_float& A002445_52()
-  {
-    static const e_float val(static_cast<std::int32_t>(1590L));
-    return val;
-  }
-
-  static const e_float& A002445_53()
-  {
-    static const e_float val(static_cast<std::int32_t>(642L));
-    return val;
-  }
-
-  static const e_float& A002445_54()
-  {
-    static const e_float val(static_cast<std::int32_t>(209191710L));
-    return val;
-  }
-
-  static const e_float& A002445_55()
-  {
-    static const e_float val(static_cast<std::int32_t>(1518L));
-    return val;
-  }
-
-  static const e_float& A002445_56()
-  {
-    static const e_float val(static_cast<std::int32_t>(1671270L));
-    return val;
-  }
-
-  static const e_float& A002445_57()
-  {
-    static const e_float val(static_cast<std::int32_t>(42L));
-    return val;
-  }
-
-  static const e_float& A002445_58()
-  {
-    static const e_float val(static_cast<std::int32_t>(1770L));
-    return val;
-  }
-
-  static const e_float& A002445_59()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_60()
-  {
-    static const e_float val(static_cast<std::int64_t>(2328255930LL));
-    return val;
-  }
-
-  static const e_float& A002445_61()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_62()
-  {
-    static const e_float val(static_cast<std::int32_t>(30L));
-    return val;
-  }
-
-  static const e_float& A002445_63()
-  {
-    static const e_float val(static_cast<std::int32_t>(4357878L));
-    return val;
-  }
-
-  static const e_float& A002445_64()
-  {
-    static const e_float val(static_cast<std::int32_t>(510L));
-    return val;
-  }
-
-  static const e_float& A002445_65()
-  {
-    static const e_float val(static_cast<std::int32_t>(8646L));
-    return val;
-  }
-
-  static const e_float& A002445_66()
-  {
-    static const e_float val(static_cast<std::int32_t>(4206930L));
-    return val;
-  }
-
-  static const e_float& A002445_67()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_68()
-  {
-    static const e_float val(static_cast<std::int32_t>(4110L));
-    return val;
-  }
-
-  static const e_float& A002445_69()
-  {
-    static const e_float val(static_cast<std::int32_t>(274386L));
-    return val;
-  }
-
-  static const e_float& A002445_70()
-  {
-    static const e_float val(static_cast<std::int32_t>(679470L));
-    return val;
-  }
-
-  static const e_float& A002445_71()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_72()
-  {
-    static const e_float val(static_cast<std::int64_t>(2381714790LL));
-    return val;
-  }
-
-  static const e_float& A002445_73()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_74()
-  {
-    static const e_float val(static_cast<std::int32_t>(4470L));
-    return val;
-  }
-
-  static const e_float& A002445_75()
-  {
-    static const e_float val(static_cast<std::int32_t>(2162622L));
-    return val;
-  }
-
-  static const e_float& A002445_76()
-  {
-    static const e_float val(static_cast<std::int32_t>(30L));
-    return val;
-  }
-
-  static const e_float& A002445_77()
-  {
-    static const e_float val(static_cast<std::int32_t>(138L));
-    return val;
-  }
-
-  static const e_float& A002445_78()
-  {
-    static const e_float val(static_cast<std::int32_t>(1794590070L));
-    return val;
-  }
-
-  static const e_float& A002445_79()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_80()
-  {
-    static const e_float val(static_cast<std::int32_t>(230010L));
-    return val;
-  }
-
-  static const e_float& A002445_81()
-  {
-    static const e_float val(static_cast<std::int32_t>(130074L));
-    return val;
-  }
-
-  static const e_float& A002445_82()
-  {
-    static const e_float val(static_cast<std::int32_t>(2490L));
-    return val;
-  }
-
-  static const e_float& A002445_83()
-  {
-    static const e_float val(static_cast<std::int32_t>(1002L));
-    return val;
-  }
-
-  static const e_float& A002445_84()
-  {
-    static const e_float val(static_cast<std::int32_t>(3404310L));
-    return val;
-  }
-
-  static const e_float& A002445_85()
-  {
-    static const e_float val(static_cast<std::int32_t>(66L));
-    return val;
-  }
-
-  static const e_float& A002445_86()
-  {
-    static const e_float val(static_cast<std::int32_t>(5190L));
-    return val;
-  }
-
-  static const e_float& A002445_87()
-  {
-    static const e_float val(static_cast<std::int32_t>(2478L));
-    return val;
-  }
-
-  static const e_float& A002445_88()
-  {
-    static const e_float val(static_cast<std::int32_t>(1043970L));
-    return val;
-  }
-
-  static const e_float& A002445_89()
-  {
-    static const e_float val(static_cast<std::int32_t>(1074L));
-    return val;
-  }
-
-  static const e_float& A002445_90()
-  {
-    static const e_float val(static_cast<std::int64_t>(7225713885390LL));
-    return val;
-  }
-
-  static const e_float& A002445_91()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_92()
-  {
-    static const e_float val(static_cast<std::int32_t>(1410L));
-    return val;
-  }
-
-  static const e_float& A002445_93()
-  {
-    static const e_float val(static_cast<std::int32_t>(42L));
-    return val;
-  }
-
-  static const e_float& A002445_94()
-  {
-    static const e_float val(static_cast<std::int32_t>(30L));
-    return val;
-  }
-
-  static const e_float& A002445_95()
-  {
-    static const e_float val(static_cast<std::int32_t>(12606L));
-    return val;
-  }
-
-  static const e_float& A002445_96()
-  {
-    static const e_float val(static_cast<std::int32_t>(868841610L));
-    return val;
-  }
-
-  static const e_float& A002445_97()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_98()
-  {
-    static const e_float val(static_cast<std::int32_t>(171390L));
-    return val;
-  }
-
-  static const e_float& A002445_99()
-  {
-    static const e_float val(static_cast<std::int32_t>(244713882L));
-    return val;
-  }
-
-  static const e_float& A002445_100()
-  {
-    static const e_float val(static_cast<std::int32_t>(1366530L));
-    return val;
-  }
-
-  static const e_float& A002445_101()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_102()
-  {
-    static const e_float val(static_cast<std::int32_t>(281190L));
-    return val;
-  }
-
-  static const e_float& A002445_103()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_104()
-  {
-    static const e_float val(static_cast<std::int32_t>(27030L));
-    return val;
-  }
-
-  static const e_float& A002445_105()
-  {
-    static const e_float val(static_cast<std::int64_t>(9225988926LL));
-    return val;
-  }
-
-  static const e_float& A002445_106()
-  {
-    static const e_float val(static_cast<std::int32_t>(3210L));
-    return val;
-  }
-
-  static const e_float& A002445_107()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_108()
-  {
-    static const e_float val(static_cast<std::int64_t>(15270994830LL));
-    return val;
-  }
-
-  static const e_float& A002445_109()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_110()
-  {
-    static const e_float val(static_cast<std::int32_t>(7590L));
-    return val;
-  }
-
-  static const e_float& A002445_111()
-  {
-    static const e_float val(static_cast<std::int32_t>(9366L));
-    return val;
-  }
-
-  static const e_float& A002445_112()
-  {
-    static const e_float val(static_cast<std::int32_t>(1671270L));
-    return val;
-  }
-
-  static const e_float& A002445_113()
-  {
-    static const e_float val(static_cast<std::int32_t>(1362L));
-    return val;
-  }
-
-  static const e_float& A002445_114()
-  {
-    static const e_float val(static_cast<std::int32_t>(625170L));
-    return val;
-  }
-
-  static const e_float& A002445_115()
-  {
-    static const e_float val(static_cast<std::int32_t>(3102L));
-    return val;
-  }
-
-  static const e_float& A002445_116()
-  {
-    static const e_float val(static_cast<std::int32_t>(412410L));
-    return val;
-  }
-
-  static const e_float& A002445_117()
-  {
-    static const e_float val(static_cast<std::int32_t>(63042L));
-    return val;
-  }
-
-  static const e_float& A002445_118()
-  {
-    static const e_float val(static_cast<std::int32_t>(30L));
-    return val;
-  }
-
-  static const e_float& A002445_119()
-  {
-    static const e_float val(static_cast<std::int32_t>(1434L));
-    return val;
-  }
-
-  static const e_float& A002445_120()
-  {
-    static const e_float val(static_cast<std::int64_t>(9538864545210LL));
-    return val;
-  }
-
-  static const e_float& A002445_121()
-  {
-    static const e_float val(static_cast<std::int32_t>(138L));
-    return val;
-  }
-
-  static const e_float& A002445_122()
-  {
-    static const e_float val(static_cast<std::int32_t>(30L));
-    return val;
-  }
-
-  static const e_float& A002445_123()
-  {
-    static const e_float val(static_cast<std::int32_t>(3486L));
-    return val;
-  }
-
-  static const e_float& A002445_124()
-  {
-    static const e_float val(static_cast<std::int32_t>(30L));
-    return val;
-  }
-
-  static const e_float& A002445_125()
-  {
-    static const e_float val(static_cast<std::int32_t>(16566L));
-    return val;
-  }
-
-  static const e_float& A002445_126()
-  {
-    static const e_float val(static_cast<std::int64_t>(303940201110LL));
-    return val;
-  }
+  static const std::uint32_t limbs[1275U] =
+  {
+    1U, 6U, 30U, 42U, 30U, 66U, 2730U, 6U, 510U, 798U,
+    330U, 138U, 2730U, 6U, 870U, 14322U, 510U, 6U, 1919190U, 6U,
+    13530U, 1806U, 690U, 282U, 46410U, 66U, 1590U, 798U, 870U, 354U,
+    56786730U, 6U, 510U, 64722U, 30U, 4686U, 1U, 40100870U, 6U, 30U,
+    3318U, 230010U, 498U, 3404310U, 6U, 61410U, 272118U, 1410U, 6U, 4501770U,
+    6U, 33330U, 4326U, 1590U, 642U, 2U, 9191710U, 1518U, 1671270U, 42U,
+    1770U, 6U, 23U, 28255930U, 6U, 30U, 4357878U, 510U, 8646U, 4206930U,
+    6U, 4110U, 274386U, 679470U, 6U, 23U, 81714790U, 6U, 4470U, 2162622U,
+    30U, 138U, 17U, 94590070U, 6U, 230010U, 130074U, 2490U, 1002U, 3404310U,
+    66U, 5190U, 2478U, 1043970U, 1074U, 72257U, 13885390U, 6U, 1410U, 42U,
+    30U, 12606U, 8U, 68841610U, 6U, 171390U, 2U, 44713882U, 1366530U, 6U,
+    281190U, 6U, 27030U, 92U, 25988926U, 3210U, 6U, 152U, 70994830U, 6U,
+    7590U, 9366U, 1671270U, 1362U, 625170U, 3102U, 412410U, 63042U, 30U, 1434U,
+    95388U, 64545210U, 138U, 30U, 3486U, 30U, 16566U, 3039U, 40201110U, 6U,
+    131070U, 42U, 2291190U, 1578U, 3U, 74416770U, 6U, 8070U, 73743978U, 69870U,
+    6U, 49U, 40319930U, 6U, 78U, 28173870U, 11886U, 30U, 138U, 2310U,
+    26334630U, 3894U, 8790U, 1806U, 4470U, 6U, 8660U, 54419230U, 6U, 510U,
+    25233558U, 20010U, 20526U, 5617U, 6691910U, 6U, 9510U, 4494U, 230010U, 282U,
+    340U, 98248730U, 6U, 2490U, 73U, 5236862U, 5010U, 6U, 22038U, 71994870U,
+    6U, 330U, 798U, 5190U, 2082U, 56213430U, 4686U, 3U, 68521410U, 42U,
+    5370U, 2154U, 2U, 16265616U, 58972270U, 6U, 46110U, 15414U, 23970U, 66U,
+    1018290U, 138U, 30U, 16U, 51635762U, 63030U, 2298U, 8U, 68841610U, 6U,
+    11670U, 1U, 48218378U, 171390U, 6U, 2336491U, 43825370U, 6U, 93U, 15635010U,
+    42U, 30U, 354U, 157U, 55919270U, 5478U, 30U, 5213334U, 27030U, 57822U,
+    44U, 66179917U, 32222310U, 6U, 3210U, 42U, 30U, 28446U, 1124097U, 92943630U,
+    6U, 30U, 18438U, 27695910U, 2658U, 90709710U, 6U, 7U, 50400230U, 41089818U,
+    6810U, 6U, 2U, 85702690U, 6U, 7150110U, 12U, 88550298U, 7010970U, 2802U,
+    12615U, 96819210U, 66U, 30U, 42U, 207930U, 2874U, 9252698U, 60885370U, 6U,
+    690U, 63346038U, 30U, 2300826U, 226590U, 6U, 510U, 3499986U, 8365830U, 3018U,
+    221876U, 34681030U, 6486U, 15270U, 1475166U, 131070U, 6U, 472290U, 6U, 489U,
+    42109590U, 24623886U, 7890U, 6U, 63U, 65085090U, 7062U, 870U, 7518U, 8070U,
+    6U, 11547U, 12360911U, 49548610U, 6U, 69870U, 78042678U, 30U, 1518U, 49U,
+    40319930U, 6U, 16710U, 798U, 150379U, 22004270U, 3378U, 772590U, 6U, 17070U,
+    15U, 61971642U, 36570U, 498U, 2U, 57273236U, 50731430U, 6U, 19470U, 42U,
+    8790U, 3522U, 6U, 70649070U, 66U, 45062070U, 2U, 44713882U, 30U, 168918U,
+    2U, 13404469U, 44246430U, 6U, 30U, 25494U, 510U, 66U, 372009U, 51384870U,
+    6U, 10U, 98809130U, 25998U, 102630U, 6U, 95490U, 13762470U, 6U, 30U,
+    1U, 40475184U, 16694378U, 9510U, 6U, 292110U, 8142U, 1U, 47436410U, 27006U,
+    40890U, 3882U, 24891U, 72157290U, 8646U, 19590U, 42U, 42330U, 3954U, 1U,
+    91460396U, 8325630U, 6U, 5010U, 177954U, 30U, 66U, 14U, 38709676U, 97108470U,
+    6U, 1076430U, 9534U, 1853610U, 94254U, 4U, 39494510U, 6U, 88230U, 646U,
+    53847566U, 10410U, 6U, 130U, 97729190U, 6U, 481U, 7155470U, 63042U, 3U,
+    68521410U, 6U, 1935570U, 66U, 5370U, 44458302U, 10770U, 4314U, 8860U, 40231168U,
+    9390190U, 6U, 30U, 47052894U, 46110U, 66U, 7U, 34400030U, 6U, 23970U,
+    48946926U, 49170U, 477006U, 1018290U, 6U, 690U, 4076U, 56409622U, 510U, 354U,
+    950U, 49477515U, 77793970U, 6U, 19U, 66599030U, 42U, 11490U, 6U, 1717117U,
+    73909130U, 107778U, 23190U, 798U, 11670U, 6U, 48901341U, 14035170U, 282U, 3U,
+    29240190U, 8693202U, 30U, 66U, 151U, 80184874U, 33428890U, 6U, 23910U, 1806U,
+    93U, 15635010U, 6U, 734370U, 6U, 24270U, 97484U, 37683754U, 51330U, 138U,
+    2678U, 50627590U, 6U, 22487190U, 34566U, 30U, 4962U, 28791542U, 31044910U, 11022U,
+    27030U, 42U, 289110U, 5034U, 514548U, 58827469U, 33233510U, 6U, 30U, 225834U,
+    54570U, 66U, 2328690U, 6U, 25710U, 43U, 92099642U, 24605790U, 5178U, 1U,
+    9037499U, 15532110U, 6U, 870U, 844998U, 30U, 282U, 3079U, 60049670U, 6U,
+    4148U, 1644070U, 38U, 48006274U, 704370U, 5322U, 90709710U, 11814U, 30U, 42U,
+    7U, 50400230U, 6U, 11U, 1993624U, 66082890U, 11454U, 6810U, 38094U, 30U,
+    5U, 59231926U, 48U, 56945730U, 6U, 30U, 231U, 89639802U, 2U, 93154510U,
+    6U, 24289U, 17311730U, 6U, 65U, 13191130U, 4454142U, 14010U, 6U, 2701U,
+    1735016U, 35144730U, 6U, 310530U, 42U, 510U, 130686U, 865410U, 12606U, 271U,
+    47548730U, 85386U, 14370U, 6U, 17U, 85770831U, 50876410U, 6U, 30U, 114U,
+    9244266U, 61410U, 64086U, 166058U, 47131510U, 6U, 498270U, 42U, 657U, 23094690U,
+    5898U, 226590U, 354U, 1590U, 2U, 73725106U, 70045002U, 510U, 6U, 2268U,
+    16592730U, 6U, 3U, 42999030U, 42U, 15090U, 6U, 1449303U, 82562932U, 68734790U,
+    66U, 32851590U, 3318U, 15270U, 6114U, 59718U, 62886990U, 6U, 131070U, 798U,
+    30U, 68046U, 4U, 87875570U, 138U, 129630U, 15142386U, 8320U, 15863030U, 6U,
+    206679U, 35594670U, 6U, 8276610U, 14641736U, 68545126U, 30U, 6U, 2179468U, 78566690U,
+    282U, 37463910U, 848274U, 870U, 498U, 5U, 22388230U, 66U, 137190U, 15078U,
+    30U, 138U, 34560540U, 96208105U, 98989730U, 6U, 30U, 45654U, 69870U, 72006U,
+    133U, 79478995U, 96989590U, 6U, 32910U, 292866U, 766590U, 390462U, 839U, 85438810U,
+    6U, 33270U, 3193806U, 16710U, 6U, 7996U, 13240790U, 6U, 150379U, 22004270U,
+    74U, 86329018U, 16890U, 6U, 8U, 72254110U, 14982U, 30U, 2692U, 16629206U,
+    290190U, 6U, 14182468U, 21361370U, 6U, 3254730U, 16086U, 72210U, 3570402U, 2966U,
+    36041692U, 93338790U, 6U, 30U, 42U, 1U, 85996910U, 1165326U, 1061970U, 14766U,
+    149430U, 32977U, 10692122U, 17610U, 6U, 6U, 70649070U, 6U, 389730U, 42U,
+    45062070U, 7122U, 2U, 54677566U, 76965330U, 1119954U, 35790U, 42U, 44763270U, 6U,
+    42U, 10724767U, 22973141U, 56359710U, 6U, 150510U, 798U, 30U, 1518U, 20U,
+    10074430U, 6U, 620670U, 106554U, 330U, 7338U, 15216U, 71063532U, 34711830U, 6U,
+    36870U, 14U, 63321706U, 21108U, 12338730U, 6U, 20U, 90369190U, 6U, 4207830U,
+    5213334U, 30U, 1074U, 115U, 68916643U, 64527910U, 16566U, 30U, 27118518U, 30U,
+    7554U, 4554U, 10662455U, 63647646U, 91012210U, 6U, 161670U, 42U, 30U, 66U,
+    292110U, 6U, 51986670U, 1020642U, 378U, 91157370U, 7698U, 1755390U, 6U, 52707210U,
+    79U, 69061562U, 19410U, 6U, 2376U, 46667360U, 5761930U, 138U, 3010U, 64657190U,
+    2353218U, 19590U, 7842U, 2730U, 17358U, 42330U, 350322U, 573330U, 7914U, 9229020U,
+    99591606U, 75732270U, 6U, 30U, 2009U, 3848194U, 85170U, 895026U, 637U, 68926130U,
+    16638U, 30U, 42U, 88770U, 138U, 1246742U, 64477283U, 28684790U, 6U, 30U,
+    111U, 35340678U, 1076430U, 6U, 619710U, 6U, 428U, 86974570U, 42U, 471270U,
+    8202U, 146619U, 76348110U, 66U, 2U, 35318470U, 42U, 88230U, 642U, 4520765U,
+    7982571U, 76058830U, 6U, 10410U, 6187451U, 1945726U, 30U, 66U, 2226U, 61396230U,
+    498U, 30U, 27439986U, 5542425U, 38169870U, 6U, 1375140U, 53293890U, 6U, 5192U,
+    46666690U, 4053126U, 30U, 6U, 1935570U, 6U, 330U, 1135554U, 91290U, 402414U,
+    1197557U, 72056830U, 198858U, 15433410U, 20118U, 21570U, 8634U, 859459U, 2423305U, 10848430U,
+    6U, 30U, 60774U, 30U, 5650194U, 44439U, 10573830U, 6U, 88577310U, 924U,
+    21869442U, 96690U, 6U, 7U, 34400030U, 6U, 30U, 66635719U, 87681686U, 23970U,
+    138U, 1177U, 17357030U, 6U, 29U, 85651570U, 4920594U, 69165870U, 8922U, 257U,
+    75974770U, 66U, 44790U, 66499734U, 8413170U, 8994U, 16U, 32521240U, 79274230U, 6U,
+    510U, 21126U, 93810U, 99726U, 69386U, 11858651U, 78959810U, 6U, 30U, 4U,
+    22828826U, 334U, 32183510U, 9138U, 1389570U, 6U, 11490U, 131737U, 8858618U, 30U,
+    6U, 1717117U, 73909130U, 6U, 15627810U, 64806U, 23190U, 6U, 5142U, 98778630U,
+    20526U, 3U, 8099670U, 402738U, 30U, 776382U, 3269540U, 24555003U, 48373810U, 138U,
+    1410U, 385U, 85629362U, 3U, 29240190U, 103686U, 5U, 65058130U, 6U, 30U,
+    66318U, 104610U, 2156046U, 2580U, 63142863U, 68291130U, 6U, 30U, 1532454U, 23910U,
+    6U, 12450U, 423030U, 6U, 149143U, 31651010U, 142842U, 30U, 221766U, 11U,
+    81601330U, 220242U, 2564670U, 42U, 412590U, 9714U, 24743U, 73685152U, 2756249U, 10204330U,
+    6U, 11959890U, 68334U, 102810U, 66U, 259815U, 10876230U, 6U, 49110U, 1883U,
+    16982014U, 9U, 21974790U, 6U, 2246790U, 6U, 510U, 11030U, 90766162U, 719490U,
+    6U, 34826U, 53749414U, 23358510U, 6U, 55110U, 69846U, 27030U, 2390478U, 25U,
+    37898090U, 66U, 25730790U, 798U, 25170U, 6U, 802787U, 68064992U, 97964143U, 10788070U,
+    354U, 30U, 23646U, 30U, 8646U, 9195U, 20393610U, 138U, 92605290U, 71358U,
+    33330U, 282U, 13U, 25024610U, 6U, 1486830U, 296U, 77461198U, 437070U, 6U,
+    23755329U, 72870330U, 6U, 17362U, 9148190U, 2U, 58274254U, 25890U, 6U, 121425U,
+    24943435U, 71301710U, 22902U, 51990U, 4326U, 870U, 138U, 20357435U, 65485630U, 6U,
+    510U, 1394106U, 1410U, 1176186U, 5398539U, 67071510U, 6U, 30U, 43366386U, 1464249U,
+    80356710U, 6U, 5U, 28707019U, 23285610U, 6U, 96498690U, 14322U, 26610U, 6U,
+    16249680U, 30228270U, 6U, 59070U, 711209U, 50811778U, 30U, 10722U, 4883970U, 23694U,
+    1928U, 52859110U, 129U, 84219906U, 30U, 354U, 357U, 474109U, 70232045U, 53137770U,
+    642U, 57270U, 1806U, 115770U, 119526U, 2476110U, 6U, 30U, 484386U, 42976U,
+    97351310U, 10938U, 4711U, 23735810U, 23046U, 30U, 96U, 24054594U, 30U, 1578U,
+    372U, 64565011U, 73812770U, 6U, 49U, 83626670U, 42U, 30U, 11082U, 13U,
+    33791363U, 39029490U, 66U, 30U, 493962U, 65U, 13191130U, 6U, 1U, 22592091U,
+    65793590U, 6U, 14010U, 78414U, 30U, 2840178U, 86003093U, 44655646U, 43347930U, 6U,
+    4U, 39274310U, 78918U, 12731730U, 6U, 2730U, 23406U, 963390U, 144280U, 65690602U,
+    62870002U, 1U, 13043390U, 6U, 865410U, 6U, 121U, 1823030U, 42U, 521504U,
+    41110330U, 11442U, 2U, 5353330U, 25278U, 27489810U, 3818598U, 30U, 6U, 11446U,
+    79102997U, 11778810U, 6U, 236910U, 513114U, 30U, 127446U, 1151U, 54219447U, 74011810U,
+    6U, 1043970U, 2798922U, 1U, 24647270U, 6U, 12122268U, 40600230U, 6U, 58470U,
+    436652U, 82377178U, 498270U, 6U, 1782690U, 24702U, 7571957U, 73923490U, 798U, 29490U,
+    6U, 3852030U, 66U, 3492210U, 3U, 36813582U, 1590U, 558078U, 190734U, 86687664U,
+    45079685U, 32551570U, 6U, 510U, 83454U, 870U, 66U, 4520454U, 69310890U, 6U,
+    59910U, 3U, 55730046U, 23382U, 24387510U,
+  };
+
+  static const std::uint32_t offsets[1002U] =
+  {
+    0U, 1U, 2U, 3U, 4U, 5U, 6U, 7U, 8U, 9U,
+    10U, 11U, 12U, 13U, 14U, 15U, 16U, 17U, 18U, 19U,
+    20U, 21U, 22U, 23U, 24U, 25U, 26U, 27U, 28U, 29U,
+    30U, 31U, 32U, 33U, 34U, 35U, 36U, 38U, 39U, 40U,
+    41U, 42U, 43U, 44U, 45U, 46U, 47U, 48U, 49U, 50U,
+    51U, 52U, 53U, 54U, 55U, 57U, 58U, 59U, 60U, 61U,
+    62U, 64U, 65U, 66U, 67U, 68U, 69U, 70U, 71U, 72U,
+    73U, 74U, 75U, 77U, 78U, 79U, 80U, 81U, 82U, 84U,
+    85U, 86U, 87U, 88U, 89U, 90U, 91U, 92U, 93U, 94U,
+    95U, 97U, 98U, 99U, 100U, 101U, 102U, 104U, 105U, 106U,
+    108U, 109U, 110U, 111U, 112U, 113U, 115U, 116U, 117U, 119U,
+    120U, 121U, 122U, 123U, 124U, 125U, 126U, 127U, 128U, 129U,
+    130U, 132U, 133U, 134U, 135U, 136U, 137U, 139U, 140U, 141U,
+    142U, 143U, 144U, 146U, 147U, 148U, 149U, 150U, 151U, 153U,
+    154U, 156U, 157U, 158U, 159U, 161U, 162U, 163U, 164U, 165U,
+    166U, 168U, 169U, 170U, 171U, 172U, 173U, 175U, 176U, 177U,
+    178U, 179U, 180U, 182U, 183U, 184U, 186U, 187U, 188U, 190U,
+    191U, 192U, 193U, 194U, 195U, 196U, 197U, 199U, 200U, 201U,
+    202U, 205U, 206U, 207U, 208U, 209U, 210U, 211U, 212U, 213U,
+    215U, 216U, 217U, 219U, 220U, 221U, 223U, 224U, 225U, 227U,
+    228U, 230U, 231U, 232U, 233U, 235U, 236U, 237U, 238U, 239U,
+    240U, 243U, 244U, 245U, 246U, 247U, 248U, 250U, 251U, 252U,
+    253U, 254U, 255U, 256U, 257U, 259U, 260U, 261U, 262U, 264U,
+    265U, 266U, 268U, 269U, 270U, 272U, 273U, 274U, 275U, 276U,
+    277U, 279U, 280U, 281U, 282U, 283U, 284U, 285U, 286U, 287U,
+    288U, 289U, 290U, 292U, 293U, 294U, 295U, 296U, 297U, 298U,
+    299U, 301U, 302U, 303U, 304U, 306U, 307U, 308U, 309U, 310U,
+    311U, 314U, 315U, 316U, 317U, 318U, 319U, 321U, 322U, 323U,
+    324U, 326U, 327U, 328U, 329U, 330U, 332U, 333U, 334U, 337U,
+    338U, 339U, 340U, 341U, 342U, 344U, 345U, 346U, 348U, 349U,
+    350U, 353U, 354U, 355U, 356U, 357U, 358U, 360U, 361U, 363U,
+    364U, 365U, 366U, 368U, 369U, 370U, 373U, 374U, 375U, 376U,
+    377U, 379U, 380U, 381U, 382U, 384U, 385U, 386U, 387U, 388U,
+    389U, 392U, 393U, 394U, 395U, 396U, 397U, 400U, 401U, 402U,
+    403U, 404U, 405U, 407U, 408U, 409U, 411U, 412U, 413U, 415U,
+    416U, 418U, 419U, 421U, 422U, 423U, 424U, 425U, 426U, 427U,
+    428U, 431U, 432U, 433U, 434U, 435U, 436U, 438U, 439U, 440U,
+    441U, 442U, 443U, 444U, 445U, 446U, 448U, 449U, 450U, 453U,
+    454U, 456U, 457U, 458U, 459U, 461U, 462U, 463U, 464U, 465U,
+    466U, 468U, 469U, 471U, 472U, 473U, 474U, 477U, 478U, 479U,
+    480U, 482U, 483U, 484U, 485U, 486U, 488U, 489U, 490U, 492U,
+    493U, 494U, 495U, 496U, 497U, 499U, 500U, 501U, 502U, 503U,
+    504U, 507U, 508U, 509U, 510U, 511U, 512U, 513U, 514U, 515U,
+    517U, 518U, 519U, 522U, 523U, 524U, 525U, 526U, 527U, 529U,
+    530U, 532U, 534U, 535U, 536U, 537U, 538U, 539U, 540U, 542U,
+    543U, 546U, 547U, 548U, 549U, 550U, 552U, 554U, 555U, 556U,
+    558U, 560U, 561U, 563U, 564U, 566U, 567U, 568U, 569U, 572U,
+    573U, 574U, 575U, 576U, 577U, 578U, 579U, 581U, 582U, 583U,
+    584U, 587U, 588U, 589U, 591U, 592U, 593U, 595U, 596U, 597U,
+    598U, 600U, 601U, 602U, 603U, 604U, 607U, 608U, 609U, 611U,
+    612U, 614U, 615U, 616U, 617U, 620U, 621U, 622U, 623U, 624U,
+    625U, 627U, 628U, 629U, 630U, 631U, 632U, 634U, 635U, 636U,
+    637U, 639U, 640U, 642U, 643U, 644U, 646U, 647U, 648U, 650U,
+    651U, 652U, 653U, 654U, 655U, 657U, 658U, 659U, 660U, 661U,
+    662U, 665U, 666U, 667U, 668U, 669U, 670U, 673U, 674U, 675U,
+    676U, 677U, 678U, 680U, 681U, 682U, 683U, 684U, 685U, 687U,
+    688U, 690U, 692U, 693U, 694U, 696U, 697U, 698U, 700U, 701U,
+    702U, 704U, 705U, 706U, 707U, 708U, 709U, 712U, 713U, 714U,
+    715U, 717U, 718U, 719U, 720U, 721U, 723U, 724U, 725U, 727U,
+    728U, 729U, 730U, 731U, 732U, 735U, 736U, 737U, 738U, 739U,
+    740U, 744U, 745U, 746U, 747U, 748U, 749U, 751U, 752U, 753U,
+    754U, 755U, 756U, 759U, 760U, 761U, 763U, 765U, 766U, 768U,
+    769U, 770U, 771U, 772U, 773U, 776U, 777U, 778U, 779U, 780U,
+    781U, 785U, 786U, 787U, 788U, 789U, 790U, 791U, 792U, 793U,
+    794U, 796U, 797U, 798U, 799U, 800U, 802U, 803U, 804U, 807U,
+    808U, 810U, 811U, 812U, 813U, 814U, 815U, 816U, 817U, 818U,
+    819U, 822U, 823U, 824U, 826U, 827U, 828U, 830U, 831U, 832U,
+    833U, 834U, 835U, 838U, 839U, 840U, 842U, 843U, 844U, 845U,
+    846U, 848U, 849U, 850U, 851U, 853U, 854U, 856U, 857U, 858U,
+    859U, 862U, 863U, 864U, 866U, 867U, 868U, 870U, 871U, 872U,
+    873U, 875U, 876U, 878U, 879U, 881U, 882U, 883U, 884U, 885U,
+    886U, 887U, 888U, 889U, 890U, 892U, 893U, 894U, 895U, 896U,
+    897U, 900U, 901U, 902U, 903U, 904U, 905U, 907U, 908U, 909U,
+    911U, 912U, 913U, 915U, 916U, 917U, 919U, 920U, 921U, 923U,
+    924U, 926U, 927U, 928U, 929U, 931U, 932U, 933U, 934U, 935U,
+    936U, 939U, 940U, 941U, 942U, 943U, 944U, 947U, 948U, 949U,
+    951U, 953U, 954U, 955U, 956U, 957U, 959U, 960U, 961U, 963U,
+    964U, 965U, 966U, 967U, 968U, 970U, 971U, 973U, 974U, 975U,
+    976U, 979U, 980U, 981U, 983U, 985U, 986U, 988U, 989U, 990U,
+    991U, 992U, 993U, 996U, 997U, 998U, 999U, 1000U, 1001U, 1003U,
+    1004U, 1006U, 1007U, 1008U, 1009U, 1011U, 1012U, 1013U, 1014U, 1015U,
+    1016U, 1020U, 1021U, 1022U, 1023U, 1024U, 1025U, 1027U, 1028U, 1029U,
+    1031U, 1033U, 1034U, 1035U, 1036U, 1037U, 1039U, 1040U, 1041U, 1044U,
+    1045U, 1046U, 1047U, 1048U, 1049U, 1051U, 1052U, 1053U, 1054U, 1055U,
+    1056U, 1060U, 1061U, 1062U, 1063U, 1064U, 1065U, 1067U, 1068U, 1069U,
+    1070U, 1071U, 1072U, 1074U, 1075U, 1076U, 1078U, 1079U, 1080U, 1082U,
+    1083U, 1085U, 1087U, 1088U, 1089U, 1092U, 1093U, 1094U, 1095U, 1096U,
+    1097U, 1099U, 1100U, 1101U, 1102U, 1103U, 1104U, 1106U, 1107U, 1108U,
+    1109U, 1111U, 1112U, 1115U, 1116U, 1117U, 1118U, 1119U, 1120U, 1122U,
+    1123U, 1124U, 1126U, 1127U, 1128U, 1129U, 1130U, 1132U, 1134U, 1135U,
+    1136U, 1140U, 1141U, 1142U, 1143U, 1144U, 1145U, 1146U, 1147U, 1148U,
+    1149U, 1151U, 1152U, 1154U, 1155U, 1156U, 1158U, 1159U, 1160U, 1163U,
+    1164U, 1166U, 1167U, 1168U, 1169U, 1172U, 1173U, 1174U, 1175U, 1177U,
+    1178U, 1181U, 1182U, 1183U, 1184U, 1185U, 1186U, 1189U, 1190U, 1192U,
+    1193U, 1194U, 1195U, 1196U, 1197U, 1198U, 1201U, 1203U, 1204U, 1205U,
+    1206U, 1208U, 1209U, 1211U, 1212U, 1214U, 1215U, 1216U, 1217U, 1218U,
+    1219U, 1222U, 1223U, 1224U, 1225U, 1226U, 1227U, 1230U, 1231U, 1232U,
+    1233U, 1235U, 1236U, 1238U, 1239U, 1240U, 1242U, 1243U, 1244U, 1245U,
+    1246U, 1248U, 1249U, 1250U, 1251U, 1252U, 1253U, 1254U, 1256U, 1257U,
+    1258U, 1262U, 1263U, 1264U, 1265U, 1266U, 1267U, 1269U, 1270U, 1271U,
+    1273U, 1275U,
+  };
+}
 
-  static const e_float& A002445_127()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_128()
-  {
-    static const e_float val(static_cast<std::int32_t>(131070L));
-    return val;
-  }
-
-  static const e_float& A002445_129()
-  {
-    static const e_float val(static_cast<std::int32_t>(42L));
-    return val;
-  }
-
-  static const e_float& A002445_130()
-  {
-    static const e_float val(static_cast<std::int32_t>(2291190L));
-    return val;
-  }
-
-  static const e_float& A002445_131()
-  {
-    static const e_float val(static_cast<std::int32_t>(1578L));
-    return val;
-  }
-
-  static const e_float& A002445_132()
-  {
-    static const e_float val(static_cast<std::int32_t>(374416770L));
-    return val;
-  }
-
-  static const e_float& A002445_133()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_134()
-  {
-    static const e_float val(static_cast<std::int32_t>(8070L));
-    return val;
-  }
-
-  static const e_float& A002445_135()
-  {
-    static const e_float val(static_cast<std::int32_t>(73743978L));
-    return val;
-  }
-
-  static const e_float& A002445_136()
-  {
-    static const e_float val(static_cast<std::int32_t>(69870L));
-    return val;
-  }
-
-  static const e_float& A002445_137()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_138()
-  {
-    static const e_float val(static_cast<std::int64_t>(4940319930LL));
-    return val;
-  }
-
-  static const e_float& A002445_139()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_140()
-  {
-    static const e_float val(static_cast<std::int64_t>(7828173870LL));
-    return val;
-  }
-
-  static const e_float& A002445_141()
-  {
-    static const e_float val(static_cast<std::int32_t>(11886L));
-    return val;
-  }
-
-  static const e_float& A002445_142()
-  {
-    static const e_float val(static_cast<std::int32_t>(30L));
-    return val;
-  }
-
-  static const e_float& A002445_143()
-  {
-    static const e_float val(static_cast<std::int32_t>(138L));
-    return val;
-  }
-
-  static const e_float& A002445_144()
-  {
-    static const e_float val(static_cast<std::int64_t>(231026334630LL));
-    return val;
-  }
-
-  static const e_float& A002445_145()
-  {
-    static const e_float val(static_cast<std::int32_t>(3894L));
-    return val;
-  }
-
-  static const e_float& A002445_146()
-  {
-    static const e_float val(static_cast<std::int32_t>(8790L));
-    return val;
-  }
-
-  static const e_float& A002445_147()
-  {
-    static const e_float val(static_cast<std::int32_t>(1806L));
-    return val;
-  }
-
-  static const e_float& A002445_148()
-  {
-    static const e_float val(static_cast<std::int32_t>(4470L));
-    return val;
-  }
-
-  static const e_float& A002445_149()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_150()
-  {
-    static const e_float val(static_cast<std::int64_t>(866054419230LL));
-    return val;
-  }
-
-  static const e_float& A002445_151()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_152()
-  {
-    static const e_float val(static_cast<std::int32_t>(510L));
-    return val;
-  }
-
-  static const e_float& A002445_153()
-  {
-    static const e_float val(static_cast<std::int32_t>(25233558L));
-    return val;
-  }
-
-  static const e_float& A002445_154()
-  {
-    static const e_float val(static_cast<std::int32_t>(20010L));
-    return val;
-  }
-
-  static const e_float& A002445_155()
-  {
-    static const e_float val(static_cast<std::int32_t>(20526L));
-    return val;
-  }
-
-  static const e_float& A002445_156()
-  {
-    static const e_float val(static_cast<std::int64_t>(561706691910LL));
-    return val;
-  }
-
-  static const e_float& A002445_157()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_158()
-  {
-    static const e_float val(static_cast<std::int32_t>(9510L));
-    return val;
-  }
-
-  static const e_float& A002445_159()
-  {
-    static const e_float val(static_cast<std::int32_t>(4494L));
-    return val;
-  }
-
-  static const e_float& A002445_160()
-  {
-    static const e_float val(static_cast<std::int32_t>(230010L));
-    return val;
-  }
-
-  static const e_float& A002445_161()
-  {
-    static const e_float val(static_cast<std::int32_t>(282L));
-    return val;
-  }
-
-  static const e_float& A002445_162()
-  {
-    static const e_float val(static_cast<std::int64_t>(34098248730LL));
-    return val;
-  }
-
-  static const e_float& A002445_163()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_164()
-  {
-    static const e_float val(static_cast<std::int32_t>(2490L));
-    return val;
-  }
-
-  static const e_float& A002445_165()
-  {
-    static const e_float val(static_cast<std::int64_t>(7305236862LL));
-    return val;
-  }
-
-  static const e_float& A002445_166()
-  {
-    static const e_float val(static_cast<std::int32_t>(5010L));
-    return val;
-  }
-
-  static const e_float& A002445_167()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_168()
-  {
-    static const e_float val(static_cast<std::int64_t>(2203871994870LL));
-    return val;
-  }
-
-  static const e_float& A002445_169()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_170()
-  {
-    static const e_float val(static_cast<std::int32_t>(330L));
-    return val;
-  }
-
-  static const e_float& A002445_171()
-  {
-    static const e_float val(static_cast<std::int32_t>(798L));
-    return val;
-  }
-
-  static const e_float& A002445_172()
-  {
-    static const e_float val(static_cast<std::int32_t>(5190L));
-    return val;
-  }
-
-  static const e_float& A002445_173()
-  {
-    static const e_float val(static_cast<std::int32_t>(2082L));
-    return val;
-  }
-
-  static const e_float& A002445_174()
-  {
-    static const e_float val(static_cast<std::int32_t>(56213430L));
-    return val;
-  }
-
-  static const e_float& A002445_175()
-  {
-    static const e_float val(static_cast<std::int32_t>(4686L));
-    return val;
-  }
-
-  static const e_float& A002445_176()
-  {
-    static const e_float val(static_cast<std::int32_t>(368521410L));
-    return val;
-  }
-
-  static const e_float& A002445_177()
-  {
-    static const e_float val(static_cast<std::int32_t>(42L));
-    return val;
-  }
-
-  static const e_float& A002445_178()
-  {
-    static const e_float val(static_cast<std::int32_t>(5370L));
-    return val;
-  }
-
-  static const e_float& A002445_179()
-  {
-    static const e_float val(static_cast<std::int32_t>(2154L));
-    return val;
-  }
-
-  static const e_float& A002445_180()
-  {
-    static const e_float val(static_cast<std::int64_t>(21626561658972270LL));
-    return val;
-  }
-
-  static const e_float& A002445_181()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_182()
-  {
-    static const e_float val(static_cast<std::int32_t>(46110L));
-    return val;
-  }
-
-  static const e_float& A002445_183()
-  {
-    static const e_float val(static_cast<std::int32_t>(15414L));
-    return val;
-  }
-
-  static const e_float& A002445_184()
-  {
-    static const e_float val(static_cast<std::int32_t>(23970L));
-    return val;
-  }
-
-  static const e_float& A002445_185()
-  {
-    static const e_float val(static_cast<std::int32_t>(66L));
-    return val;
-  }
-
-  static const e_float& A002445_186()
-  {
-    static const e_float val(static_cast<std::int32_t>(1018290L));
-    return val;
-  }
-
-  static const e_float& A002445_187()
-  {
-    static const e_float val(static_cast<std::int32_t>(138L));
-    return val;
-  }
-
-  static const e_float& A002445_188()
-  {
-    static const e_float val(static_cast<std::int32_t>(30L));
-    return val;
-  }
-
-  static const e_float& A002445_189()
-  {
-    static const e_float val(static_cast<std::int32_t>(1651635762L));
-    return val;
-  }
-
-  static const e_float& A002445_190()
-  {
-    static const e_float val(static_cast<std::int32_t>(63030L));
-    return val;
-  }
-
-  static const e_float& A002445_191()
-  {
-    static const e_float val(static_cast<std::int32_t>(2298L));
-    return val;
-  }
-
-  static const e_float& A002445_192()
-  {
-    static const e_float val(static_cast<std::int32_t>(868841610L));
-    return val;
-  }
-
-  static const e_float& A002445_193()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_194()
-  {
-    static const e_float val(static_cast<std::int32_t>(11670L));
-    return val;
-  }
-
-  static const e_float& A002445_195()
-  {
-    static const e_float val(static_cast<std::int32_t>(148218378L));
-    return val;
-  }
-
-  static const e_float& A002445_196()
-  {
-    static const e_float val(static_cast<std::int32_t>(171390L));
-    return val;
-  }
-
-  static const e_float& A002445_197()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_198()
-  {
-    static const e_float val(static_cast<std::int64_t>(233649143825370LL));
-    return val;
-  }
-
-  static const e_float& A002445_199()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_200()
-  {
-    static const e_float val(static_cast<std::int64_t>(9315635010LL));
-    return val;
-  }
-
-  static const e_float& A002445_201()
-  {
-    static const e_float val(static_cast<std::int32_t>(42L));
-    return val;
-  }
-
-  static const e_float& A002445_202()
-  {
-    static const e_float val(static_cast<std::int32_t>(30L));
-    return val;
-  }
-
-  static const e_float& A002445_203()
-  {
-    static const e_float val(static_cast<std::int32_t>(354L));
-    return val;
-  }
-
-  static const e_float& A002445_204()
-  {
-    static const e_float val(static_cast<std::int64_t>(15755919270LL));
-    return val;
-  }
-
-  static const e_float& A002445_205()
-  {
-    static const e_float val(static_cast<std::int32_t>(5478L));
-    return val;
-  }
-
-  static const e_float& A002445_206()
-  {
-    static const e_float val(static_cast<std::int32_t>(30L));
-    return val;
-  }
-
-  static const e_float& A002445_207()
-  {
-    static const e_float val(static_cast<std::int32_t>(5213334L));
-    return val;
-  }
-
-  static const e_float& A002445_208()
-  {
-    static const e_float val(static_cast<std::int32_t>(27030L));
-    return val;
-  }
-
-  static const e_float& A002445_209()
-  {
-    static const e_float val(static_cast<std::int32_t>(57822L));
-    return val;
-  }
-
-  static const e_float& A002445_210()
-  {
-    static const e_float val(static_cast<std::int64_t>(446617991732222310LL));
-    return val;
-  }
-
-  static const e_float& A002445_211()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_212()
-  {
-    static const e_float val(static_cast<std::int32_t>(3210L));
-    return val;
-  }
-
-  static const e_float& A002445_213()
-  {
-    static const e_float val(static_cast<std::int32_t>(42L));
-    return val;
-  }
-
-  static const e_float& A002445_214()
-  {
-    static const e_float val(static_cast<std::int32_t>(30L));
-    return val;
-  }
-
-  static const e_float& A002445_215()
-  {
-    static const e_float val(static_cast<std::int32_t>(28446L));
-    return val;
-  }
-
-  static const e_float& A002445_216()
-  {
-    static const e_float val(static_cast<std::int64_t>(112409792943630LL));
-    return val;
-  }
-
-  static const e_float& A002445_217()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_218()
-  {
-    static const e_float val(static_cast<std::int32_t>(30L));
-    return val;
-  }
-
-  static const e_float& A002445_219()
-  {
-    static const e_float val(static_cast<std::int32_t>(18438L));
-    return val;
-  }
-
-  static const e_float& A002445_220()
-  {
-    static const e_float val(static_cast<std::int32_t>(27695910L));
-    return val;
-  }
-
-  static const e_float& A002445_221()
-  {
-    static const e_float val(static_cast<std::int32_t>(2658L));
-    return val;
-  }
-
-  static const e_float& A002445_222()
-  {
-    static const e_float val(static_cast<std::int32_t>(90709710L));
-    return val;
-  }
-
-  static const e_float& A002445_223()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_224()
-  {
-    static const e_float val(static_cast<std::int32_t>(750400230L));
-    return val;
-  }
-
-  static const e_float& A002445_225()
-  {
-    static const e_float val(static_cast<std::int32_t>(41089818L));
-    return val;
-  }
-
-  static const e_float& A002445_226()
-  {
-    static const e_float val(static_cast<std::int32_t>(6810L));
-    return val;
-  }
-
-  static const e_float& A002445_227()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_228()
-  {
-    static const e_float val(static_cast<std::int32_t>(285702690L));
-    return val;
-  }
-
-  static const e_float& A002445_229()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_230()
-  {
-    static const e_float val(static_cast<std::int32_t>(7150110L));
-    return val;
-  }
-
-  static const e_float& A002445_231()
-  {
-    static const e_float val(static_cast<std::int32_t>(1288550298L));
-    return val;
-  }
-
-  static const e_float& A002445_232()
-  {
-    static const e_float val(static_cast<std::int32_t>(7010970L));
-    return val;
-  }
-
-  static const e_float& A002445_233()
-  {
-    static const e_float val(static_cast<std::int32_t>(2802L));
-    return val;
-  }
-
-  static const e_float& A002445_234()
-  {
-    static const e_float val(static_cast<std::int64_t>(1261596819210LL));
-    return val;
-  }
-
-  static const e_float& A002445_235()
-  {
-    static const e_float val(static_cast<std::int32_t>(66L));
-    return val;
-  }
-
-  static const e_float& A002445_236()
-  {
-    static const e_float val(static_cast<std::int32_t>(30L));
-    return val;
-  }
-
-  static const e_float& A002445_237()
-  {
-    static const e_float val(static_cast<std::int32_t>(42L));
-    return val;
-  }
-
-  static const e_float& A002445_238()
-  {
-    static const e_float val(static_cast<std::int32_t>(207930L));
-    return val;
-  }
-
-  static const e_float& A002445_239()
-  {
-    static const e_float val(static_cast<std::int32_t>(2874L));
-    return val;
-  }
-
-  static const e_float& A002445_240()
-  {
-    static const e_float val(static_cast<std::int64_t>(925269860885370LL));
-    return val;
-  }
-
-  static const e_float& A002445_241()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_242()
-  {
-    static const e_float val(static_cast<std::int32_t>(690L));
-    return val;
-  }
-
-  static const e_float& A002445_243()
-  {
-    static const e_float val(static_cast<std::int32_t>(63346038L));
-    return val;
-  }
-
-  static const e_float& A002445_244()
-  {
-    static const e_float val(static_cast<std::int32_t>(30L));
-    return val;
-  }
-
-  static const e_float& A002445_245()
-  {
-    static const e_float val(static_cast<std::int32_t>(2300826L));
-    return val;
-  }
-
-  static const e_float& A002445_246()
-  {
-    static const e_float val(static_cast<std::int32_t>(226590L));
-    return val;
-  }
-
-  static const e_float& A002445_247()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_248()
-  {
-    static const e_float val(static_cast<std::int32_t>(510L));
-    return val;
-  }
-
-  static const e_float& A002445_249()
-  {
-    static const e_float val(static_cast<std::int32_t>(3499986L));
-    return val;
-  }
-
-  static const e_float& A002445_250()
-  {
-    static const e_float val(static_cast<std::int32_t>(8365830L));
-    return val;
-  }
-
-  static const e_float& A002445_251()
-  {
-    static const e_float val(static_cast<std::int32_t>(3018L));
-    return val;
-  }
-
-  static const e_float& A002445_252()
-  {
-    static const e_float val(static_cast<std::int64_t>(22187634681030LL));
-    return val;
-  }
-
-  static const e_float& A002445_253()
-  {
-    static const e_float val(static_cast<std::int32_t>(6486L));
-    return val;
-  }
-
-  static const e_float& A002445_254()
-  {
-    static const e_float val(static_cast<std::int32_t>(15270L));
-    return val;
-  }
-
-  static const e_float& A002445_255()
-  {
-    static const e_float val(static_cast<std::int32_t>(1475166L));
-    return val;
-  }
-
-  static const e_float& A002445_256()
-  {
-    static const e_float val(static_cast<std::int32_t>(131070L));
-    return val;
-  }
-
-  static const e_float& A002445_257()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_258()
-  {
-    static const e_float val(static_cast<std::int32_t>(472290L));
-    return val;
-  }
-
-  static const e_float& A002445_259()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_260()
-  {
-    static const e_float val(static_cast<std::int64_t>(48942109590LL));
-    return val;
-  }
-
-  static const e_float& A002445_261()
-  {
-    static const e_float val(static_cast<std::int32_t>(24623886L));
-    return val;
-  }
-
-  static const e_float& A002445_262()
-  {
-    static const e_float val(static_cast<std::int32_t>(7890L));
-    return val;
-  }
-
-  static const e_float& A002445_263()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_264()
-  {
-    static const e_float val(static_cast<std::int64_t>(6365085090LL));
-    return val;
-  }
-
-  static const e_float& A002445_265()
-  {
-    static const e_float val(static_cast<std::int32_t>(7062L));
-    return val;
-  }
-
-  static const e_float& A002445_266()
-  {
-    static const e_float val(static_cast<std::int32_t>(870L));
-    return val;
-  }
-
-  static const e_float& A002445_267()
-  {
-    static const e_float val(static_cast<std::int32_t>(7518L));
-    return val;
-  }
-
-  static const e_float& A002445_268()
-  {
-    static const e_float val(static_cast<std::int32_t>(8070L));
-    return val;
-  }
-
-  static const e_float& A002445_269()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_270()
-  {
-    static const e_float val("115471236091149548610");
-    return val;
-  }
-
-  static const e_float& A002445_271()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_272()
-  {
-    static const e_float val(static_cast<std::int32_t>(69870L));
-    return val;
-  }
-
-  static const e_float& A002445_273()
-  {
-    static const e_float val(static_cast<std::int32_t>(78042678L));
-    return val;
-  }
-
-  static const e_float& A002445_274()
-  {
-    static const e_float val(static_cast<std::int32_t>(30L));
-    return val;
-  }
-
-  static const e_float& A002445_275()
-  {
-    static const e_float val(static_cast<std::int32_t>(1518L));
-    return val;
-  }
-
-  static const e_float& A002445_276()
-  {
-    static const e_float val(static_cast<std::int64_t>(4940319930LL));
-    return val;
-  }
-
-  static const e_float& A002445_277()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_278()
-  {
-    static const e_float val(static_cast<std::int32_t>(16710L));
-    return val;
-  }
-
-  static const e_float& A002445_279()
-  {
-    static const e_float val(static_cast<std::int32_t>(798L));
-    return val;
-  }
-
-  static const e_float& A002445_280()
-  {
-    static const e_float val(static_cast<std::int64_t>(15037922004270LL));
-    return val;
-  }
-
-  static const e_float& A002445_281()
-  {
-    static const e_float val(static_cast<std::int32_t>(3378L));
-    return val;
-  }
-
-  static const e_float& A002445_282()
-  {
-    static const e_float val(static_cast<std::int32_t>(772590L));
-    return val;
-  }
-
-  static const e_float& A002445_283()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_284()
-  {
-    static const e_float val(static_cast<std::int32_t>(17070L));
-    return val;
-  }
-
-  static const e_float& A002445_285()
-  {
-    static const e_float val(static_cast<std::int32_t>(1561971642L));
-    return val;
-  }
-
-  static const e_float& A002445_286()
-  {
-    static const e_float val(static_cast<std::int32_t>(36570L));
-    return val;
-  }
-
-  static const e_float& A002445_287()
-  {
-    static const e_float val(static_cast<std::int32_t>(498L));
-    return val;
-  }
-
-  static const e_float& A002445_288()
-  {
-    static const e_float val(static_cast<std::int64_t>(25727323650731430LL));
-    return val;
-  }
-
-  static const e_float& A002445_289()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_290()
-  {
-    static const e_float val(static_cast<std::int32_t>(19470L));
-    return val;
-  }
-
-  static const e_float& A002445_291()
-  {
-    static const e_float val(static_cast<std::int32_t>(42L));
-    return val;
-  }
-
-  static const e_float& A002445_292()
-  {
-    static const e_float val(static_cast<std::int32_t>(8790L));
-    return val;
-  }
-
-  static const e_float& A002445_293()
-  {
-    static const e_float val(static_cast<std::int32_t>(3522L));
-    return val;
-  }
-
-  static const e_float& A002445_294()
-  {
-    static const e_float val(static_cast<std::int32_t>(670649070L));
-    return val;
-  }
-
-  static const e_float& A002445_295()
-  {
-    static const e_float val(static_cast<std::int32_t>(66L));
-    return val;
-  }
-
-  static const e_float& A002445_296()
-  {
-    static const e_float val(static_cast<std::int32_t>(45062070L));
-    return val;
-  }
-
-  static const e_float& A002445_297()
-  {
-    static const e_float val(static_cast<std::int32_t>(244713882L));
-    return val;
-  }
-
-  static const e_float& A002445_298()
-  {
-    static const e_float val(static_cast<std::int32_t>(30L));
-    return val;
-  }
-
-  static const e_float& A002445_299()
-  {
-    static const e_float val(static_cast<std::int32_t>(168918L));
-    return val;
-  }
-
-  static const e_float& A002445_300()
-  {
-    static const e_float val(static_cast<std::int64_t>(21340446944246430LL));
-    return val;
-  }
-
-  static const e_float& A002445_301()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_302()
-  {
-    static const e_float val(static_cast<std::int32_t>(30L));
-    return val;
-  }
-
-  static const e_float& A002445_303()
-  {
-    static const e_float val(static_cast<std::int32_t>(25494L));
-    return val;
-  }
-
-  static const e_float& A002445_304()
-  {
-    static const e_float val(static_cast<std::int32_t>(510L));
-    return val;
-  }
-
-  static const e_float& A002445_305()
-  {
-    static const e_float val(static_cast<std::int32_t>(66L));
-    return val;
-  }
-
-  static const e_float& A002445_306()
-  {
-    static const e_float val(static_cast<std::int64_t>(37200951384870LL));
-    return val;
-  }
-
-  static const e_float& A002445_307()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_308()
-  {
-    static const e_float val(static_cast<std::int32_t>(1098809130L));
-    return val;
-  }
-
-  static const e_float& A002445_309()
-  {
-    static const e_float val(static_cast<std::int32_t>(25998L));
-    return val;
-  }
-
-  static const e_float& A002445_310()
-  {
-    static const e_float val(static_cast<std::int32_t>(102630L));
-    return val;
-  }
-
-  static const e_float& A002445_311()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_312()
-  {
-    static const e_float val(static_cast<std::int64_t>(9549013762470LL));
-    return val;
-  }
-
-  static const e_float& A002445_313()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_314()
-  {
-    static const e_float val(static_cast<std::int32_t>(30L));
-    return val;
-  }
-
-  static const e_float& A002445_315()
-  {
-    static const e_float val(static_cast<std::int64_t>(14047518416694378LL));
-    return val;
-  }
-
-  static const e_float& A002445_316()
-  {
-    static const e_float val(static_cast<std::int32_t>(9510L));
-    return val;
-  }
-
-  static const e_float& A002445_317()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_318()
-  {
-    static const e_float val(static_cast<std::int32_t>(292110L));
-    return val;
-  }
-
-  static const e_float& A002445_319()
-  {
-    static const e_float val(static_cast<std::int32_t>(8142L));
-    return val;
-  }
-
-  static const e_float& A002445_320()
-  {
-    static const e_float val(static_cast<std::int32_t>(147436410L));
-    return val;
-  }
-
-  static const e_float& A002445_321()
-  {
-    static const e_float val(static_cast<std::int32_t>(27006L));
-    return val;
-  }
-
-  static const e_float& A002445_322()
-  {
-    static const e_float val(static_cast<std::int32_t>(40890L));
-    return val;
-  }
-
-  static const e_float& A002445_323()
-  {
-    static const e_float val(static_cast<std::int32_t>(3882L));
-    return val;
-  }
-
-  static const e_float& A002445_324()
-  {
-    static const e_float val(static_cast<std::int64_t>(2489172157290LL));
-    return val;
-  }
-
-  static const e_float& A002445_325()
-  {
-    static const e_float val(static_cast<std::int32_t>(8646L));
-    return val;
-  }
-
-  static const e_float& A002445_326()
-  {
-    static const e_float val(static_cast<std::int32_t>(19590L));
-    return val;
-  }
-
-  static const e_float& A002445_327()
-  {
-    static const e_float val(static_cast<std::int32_t>(42L));
-    return val;
-  }
-
-  static const e_float& A002445_328()
-  {
-    static const e_float val(static_cast<std::int32_t>(42330L));
-    return val;
-  }
-
-  static const e_float& A002445_329()
-  {
-    static const e_float val(static_cast<std::int32_t>(3954L));
-    return val;
-  }
-
-  static const e_float& A002445_330()
-  {
-    static const e_float val(static_cast<std::int64_t>(19146039608325630LL));
-    return val;
-  }
-
-  static const e_float& A002445_331()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_332()
-  {
-    static const e_float val(static_cast<std::int32_t>(5010L));
-    return val;
-  }
-
-  static const e_float& A002445_333()
-  {
-    static const e_float val(static_cast<std::int32_t>(177954L));
-    return val;
-  }
-
-  static const e_float& A002445_334()
-  {
-    static const e_float val(static_cast<std::int32_t>(30L));
-    return val;
-  }
-
-  static const e_float& A002445_335()
-  {
-    static const e_float val(static_cast<std::int32_t>(66L));
-    return val;
-  }
-
-  static const e_float& A002445_336()
-  {
-    static const e_float val(static_cast<std::int64_t>(143870967697108470LL));
-    return val;
-  }
-
-  static const e_float& A002445_337()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_338()
-  {
-    static const e_float val(static_cast<std::int32_t>(1076430L));
-    return val;
-  }
-
-  static const e_float& A002445_339()
-  {
-    static const e_float val(static_cast<std::int32_t>(9534L));
-    return val;
-  }
-
-  static const e_float& A002445_340()
-  {
-    static const e_float val(static_cast<std::int32_t>(1853610L));
-    return val;
-  }
-
-  static const e_float& A002445_341()
-  {
-    static const e_float val(static_cast<std::int32_t>(94254L));
-    return val;
-  }
-
-  static const e_float& A002445_342()
-  {
-    static const e_float val(static_cast<std::int32_t>(439494510L));
-    return val;
-  }
-
-  static const e_float& A002445_343()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_344()
-  {
-    static const e_float val(static_cast<std::int32_t>(88230L));
-    return val;
-  }
-
-  static const e_float& A002445_345()
-  {
-    static const e_float val(static_cast<std::int64_t>(64653847566LL));
-    return val;
-  }
-
-  static const e_float& A002445_346()
-  {
-    static const e_float val(static_cast<std::int32_t>(10410L));
-    return val;
-  }
-
-  static const e_float& A002445_347()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_348()
-  {
-    static const e_float val(static_cast<std::int64_t>(13097729190LL));
-    return val;
-  }
-
-  static const e_float& A002445_349()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_350()
-  {
-    static const e_float val(static_cast<std::int64_t>(48107155470LL));
-    return val;
-  }
-
-  static const e_float& A002445_351()
-  {
-    static const e_float val(static_cast<std::int32_t>(63042L));
-    return val;
-  }
-
-  static const e_float& A002445_352()
-  {
-    static const e_float val(static_cast<std::int32_t>(368521410L));
-    return val;
-  }
-
-  static const e_float& A002445_353()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_354()
-  {
-    static const e_float val(static_cast<std::int32_t>(1935570L));
-    return val;
-  }
-
-  static const e_float& A002445_355()
-  {
-    static const e_float val(static_cast<std::int32_t>(66L));
-    return val;
-  }
-
-  static const e_float& A002445_356()
-  {
-    static const e_float val(static_cast<std::int32_t>(5370L));
-    return val;
-  }
-
-  static const e_float& A002445_357()
-  {
-    static const e_float val(static_cast<std::int32_t>(44458302L));
-    return val;
-  }
-
-  static const e_float& A002445_358()
-  {
-    static const e_float val(static_cast<std::int32_t>(10770L));
-    return val;
-  }
-
-  static const e_float& A002445_359()
-  {
-    static const e_float val(static_cast<std::int32_t>(4314L));
-    return val;
-  }
-
-  static const e_float& A002445_360()
-  {
-    static const e_float val("88604023116809390190");
-    return val;
-  }
-
-  static const e_float& A002445_361()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_362()
-  {
-    static const e_float val(static_cast<std::int32_t>(30L));
-    return val;
-  }
-
-  static const e_float& A002445_363()
-  {
-    static const e_float val(static_cast<std::int32_t>(47052894L));
-    return val;
-  }
-
-  static const e_float& A002445_364()
-  {
-    static const e_float val(static_cast<std::int32_t>(46110L));
-    return val;
-  }
-
-  static const e_float& A002445_365()
-  {
-    static const e_float val(static_cast<std::int32_t>(66L));
-    return val;
-  }
-
-  static const e_float& A002445_366()
-  {
-    static const e_float val(static_cast<std::int32_t>(734400030L));
-    return val;
-  }
-
-  static const e_float& A002445_367()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_368()
-  {
-    static const e_float val(static_cast<std::int32_t>(23970L));
-    return val;
-  }
-
-  static const e_float& A002445_369()
-  {
-    static const e_float val(static_cast<std::int32_t>(48946926L));
-    return val;
-  }
-
-  static const e_float& A002445_370()
-  {
-    static const e_float val(static_cast<std::int32_t>(49170L));
-    return val;
-  }
-
-  static const e_float& A002445_371()
-  {
-    static const e_float val(static_cast<std::int32_t>(477006L));
-    return val;
-  }
-
-  static const e_float& A002445_372()
-  {
-    static const e_float val(static_cast<std::int32_t>(1018290L));
-    return val;
-  }
-
-  static const e_float& A002445_373()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_374()
-  {
-    static const e_float val(static_cast<std::int32_t>(690L));
-    return val;
-  }
-
-  static const e_float& A002445_375()
-  {
-    static const e_float val(static_cast<std::int64_t>(407656409622LL));
-    return val;
-  }
-
-  static const e_float& A002445_376()
-  {
-    static const e_float val(static_cast<std::int32_t>(510L));
-    return val;
-  }
-
-  static const e_float& A002445_377()
-  {
-    static const e_float val(static_cast<std::int32_t>(354L));
-    return val;
-  }
-
-  static const e_float& A002445_378()
-  {
-    static const e_float val("9504947751577793970");
-    return val;
-  }
-
-  static const e_float& A002445_379()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_380()
-  {
-    static const e_float val(static_cast<std::int32_t>(1966599030L));
-    return val;
-  }
-
-  static const e_float& A002445_381()
-  {
-    static const e_float val(static_cast<std::int32_t>(42L));
-    return val;
-  }
-
-  static const e_float& A002445_382()
-  {
-    static const e_float val(static_cast<std::int32_t>(11490L));
-    return val;
-  }
-
-  static const e_float& A002445_383()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_384()
-  {
-    static const e_float val(static_cast<std::int64_t>(171711773909130LL));
-    return val;
-  }
-
-  static const e_float& A002445_385()
-  {
-    static const e_float val(static_cast<std::int32_t>(107778L));
-    return val;
-  }
-
-  static const e_float& A002445_386()
-  {
-    static const e_float val(static_cast<std::int32_t>(23190L));
-    return val;
-  }
-
-  static const e_float& A002445_387()
-  {
-    static const e_float val(static_cast<std::int32_t>(798L));
-    return val;
-  }
-
-  static const e_float& A002445_388()
-  {
-    static const e_float val(static_cast<std::int32_t>(11670L));
-    return val;
-  }
-
-  static const e_float& A002445_389()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_390()
-  {
-    static const e_float val(static_cast<std::int64_t>(4890134114035170LL));
-    return val;
-  }
-
-  static const e_float& A002445_391()
-  {
-    static const e_float val(static_cast<std::int32_t>(282L));
-    return val;
-  }
-
-  static const e_float& A002445_392()
-  {
-    static const e_float val(static_cast<std::int32_t>(329240190L));
-    return val;
-  }
-
-  static const e_float& A002445_393()
-  {
-    static const e_float val(static_cast<std::int32_t>(8693202L));
-    return val;
-  }
-
-  static const e_float& A002445_394()
-  {
-    static const e_float val(static_cast<std::int32_t>(30L));
-    return val;
-  }
-
-  static const e_float& A002445_395()
-  {
-    static const e_float val(static_cast<std::int32_t>(66L));
-    return val;
-  }
-
-  static const e_float& A002445_396()
-  {
-    static const e_float val(static_cast<std::int64_t>(1518018487433428890LL));
-    return val;
-  }
-
-  static const e_float& A002445_397()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_398()
-  {
-    static const e_float val(static_cast<std::int32_t>(23910L));
-    return val;
-  }
-
-  static const e_float& A002445_399()
-  {
-    static const e_float val(static_cast<std::int32_t>(1806L));
-    return val;
-  }
-
-  static const e_float& A002445_400()
-  {
-    static const e_float val(static_cast<std::int64_t>(9315635010LL));
-    return val;
-  }
-
-  static const e_float& A002445_401()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_402()
-  {
-    static const e_float val(static_cast<std::int32_t>(734370L));
-    return val;
-  }
-
-  static const e_float& A002445_403()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_404()
-  {
-    static const e_float val(static_cast<std::int32_t>(24270L));
-    return val;
-  }
-
-  static const e_float& A002445_405()
-  {
-    static const e_float val(static_cast<std::int64_t>(9748437683754LL));
-    return val;
-  }
-
-  static const e_float& A002445_406()
-  {
-    static const e_float val(static_cast<std::int32_t>(51330L));
-    return val;
-  }
-
-  static const e_float& A002445_407()
-  {
-    static const e_float val(static_cast<std::int32_t>(138L));
-    return val;
-  }
-
-  static const e_float& A002445_408()
-  {
-    static const e_float val(static_cast<std::int64_t>(267850627590LL));
-    return val;
-  }
-
-  static const e_float& A002445_409()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_410()
-  {
-    static const e_float val(static_cast<std::int32_t>(22487190L));
-    return val;
-  }
-
-  static const e_float& A002445_411()
-  {
-    static const e_float val(static_cast<std::int32_t>(34566L));
-    return val;
-  }
-
-  static const e_float& A002445_412()
-  {
-    static const e_float val(static_cast<std::int32_t>(30L));
-    return val;
-  }
-
-  static const e_float& A002445_413()
-  {
-    static const e_float val(static_cast<std::int32_t>(4962L));
-    return val;
-  }
-
-  static const e_float& A002445_414()
-  {
-    static const e_float val(static_cast<std::int64_t>(2879154231044910LL));
-    return val;
-  }
-
-  static const e_float& A002445_415()
-  {
-    static const e_float val(static_cast<std::int32_t>(11022L));
-    return val;
-  }
-
-  static const e_float& A002445_416()
-  {
-    static const e_float val(static_cast<std::int32_t>(27030L));
-    return val;
-  }
-
-  static const e_float& A002445_417()
-  {
-    static const e_float val(static_cast<std::int32_t>(42L));
-    return val;
-  }
-
-  static const e_float& A002445_418()
-  {
-    static const e_float val(static_cast<std::int32_t>(289110L));
-    return val;
-  }
-
-  static const e_float& A002445_419()
-  {
-    static const e_float val(static_cast<std::int32_t>(5034L));
-    return val;
-  }
-
-  static const e_float& A002445_420()
-  {
-    static const e_float val("5145485882746933233510");
-    return val;
-  }
-
-  static const e_float& A002445_421()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_422()
-  {
-    static const e_float val(static_cast<std::int32_t>(30L));
-    return val;
-  }
-
-  static const e_float& A002445_423()
-  {
-    static const e_float val(static_cast<std::int32_t>(225834L));
-    return val;
-  }
-
-  static const e_float& A002445_424()
-  {
-    static const e_float val(static_cast<std::int32_t>(54570L));
-    return val;
-  }
-
-  static const e_float& A002445_425()
-  {
-    static const e_float val(static_cast<std::int32_t>(66L));
-    return val;
-  }
-
-  static const e_float& A002445_426()
-  {
-    static const e_float val(static_cast<std::int32_t>(2328690L));
-    return val;
-  }
-
-  static const e_float& A002445_427()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_428()
-  {
-    static const e_float val(static_cast<std::int32_t>(25710L));
-    return val;
-  }
-
-  static const e_float& A002445_429()
-  {
-    static const e_float val(static_cast<std::int64_t>(4392099642LL));
-    return val;
-  }
-
-  static const e_float& A002445_430()
-  {
-    static const e_float val(static_cast<std::int32_t>(24605790L));
-    return val;
-  }
-
-  static const e_float& A002445_431()
-  {
-    static const e_float val(static_cast<std::int32_t>(5178L));
-    return val;
-  }
-
-  static const e_float& A002445_432()
-  {
-    static const e_float val(static_cast<std::int64_t>(10903749915532110LL));
-    return val;
-  }
-
-  static const e_float& A002445_433()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_434()
-  {
-    static const e_float val(static_cast<std::int32_t>(870L));
-    return val;
-  }
-
-  static const e_float& A002445_435()
-  {
-    static const e_float val(static_cast<std::int32_t>(844998L));
-    return val;
-  }
-
-  static const e_float& A002445_436()
-  {
-    static const e_float val(static_cast<std::int32_t>(30L));
-    return val;
-  }
-
-  static const e_float& A002445_437()
-  {
-    static const e_float val(static_cast<std::int32_t>(282L));
-    return val;
-  }
-
-  static const e_float& A002445_438()
-  {
-    static const e_float val(static_cast<std::int64_t>(307960049670LL));
-    return val;
-  }
-
-  static const e_float& A002445_439()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_440()
-  {
-    static const e_float val(static_cast<std::int64_t>(414801644070LL));
-    return val;
-  }
-
-  static const e_float& A002445_441()
-  {
-    static const e_float val(static_cast<std::int64_t>(3848006274LL));
-    return val;
-  }
-
-  static const e_float& A002445_442()
-  {
-    static const e_float val(static_cast<std::int32_t>(704370L));
-    return val;
-  }
-
-  static const e_float& A002445_443()
-  {
-    static const e_float val(static_cast<std::int32_t>(5322L));
-    return val;
-  }
-
-  static const e_float& A002445_444()
-  {
-    static const e_float val(static_cast<std::int32_t>(90709710L));
-    return val;
-  }
-
-  static const e_float& A002445_445()
-  {
-    static const e_float val(static_cast<std::int32_t>(11814L));
-    return val;
-  }
-
-  static const e_float& A002445_446()
-  {
-    static const e_float val(static_cast<std::int32_t>(30L));
-    return val;
-  }
-
-  static const e_float& A002445_447()
-  {
-    static const e_float val(static_cast<std::int32_t>(42L));
-    return val;
-  }
-
-  static const e_float& A002445_448()
-  {
-    static const e_float val(static_cast<std::int32_t>(750400230L));
-    return val;
-  }
-
-  static const e_float& A002445_449()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_450()
-  {
-    static const e_float val(static_cast<std::int64_t>(110199362466082890LL));
-    return val;
-  }
-
-  static const e_float& A002445_451()
-  {
-    static const e_float val(static_cast<std::int32_t>(11454L));
-    return val;
-  }
-
-  static const e_float& A002445_452()
-  {
-    static const e_float val(static_cast<std::int32_t>(6810L));
-    return val;
-  }
-
-  static const e_float& A002445_453()
-  {
-    static const e_float val(static_cast<std::int32_t>(38094L));
-    return val;
-  }
-
-  static const e_float& A002445_454()
-  {
-    static const e_float val(static_cast<std::int32_t>(30L));
-    return val;
-  }
-
-  static const e_float& A002445_455()
-  {
-    static const e_float val(static_cast<std::int32_t>(559231926L));
-    return val;
-  }
-
-  static const e_float& A002445_456()
-  {
-    static const e_float val(static_cast<std::int64_t>(4856945730LL));
-    return val;
-  }
-
-  static const e_float& A002445_457()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_458()
-  {
-    static const e_float val(static_cast<std::int32_t>(30L));
-    return val;
-  }
-
-  static const e_float& A002445_459()
-  {
-    static const e_float val(static_cast<std::int64_t>(23189639802LL));
-    return val;
-  }
-
-  static const e_float& A002445_460()
-  {
-    static const e_float val(static_cast<std::int32_t>(293154510L));
-    return val;
-  }
-
-  static const e_float& A002445_461()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_462()
-  {
-    static const e_float val(static_cast<std::int64_t>(2428917311730LL));
-    return val;
-  }
-
-  static const e_float& A002445_463()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_464()
-  {
-    static const e_float val(static_cast<std::int64_t>(6513191130LL));
-    return val;
-  }
-
-  static const e_float& A002445_465()
-  {
-    static const e_float val(static_cast<std::int32_t>(4454142L));
-    return val;
-  }
-
-  static const e_float& A002445_466()
-  {
-    static const e_float val(static_cast<std::int32_t>(14010L));
-    return val;
-  }
-
-  static const e_float& A002445_467()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_468()
-  {
-    static const e_float val("27010173501635144730");
-    return val;
-  }
-
-  static const e_float& A002445_469()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_470()
-  {
-    static const e_float val(static_cast<std::int32_t>(310530L));
-    return val;
-  }
-
-  static const e_float& A002445_471()
-  {
-    static const e_float val(static_cast<std::int32_t>(42L));
-    return val;
-  }
-
-  static const e_float& A002445_472()
-  {
-    static const e_float val(static_cast<std::int32_t>(510L));
-    return val;
-  }
-
-  static const e_float& A002445_473()
-  {
-    static const e_float val(static_cast<std::int32_t>(130686L));
-    return val;
-  }
-
-  static const e_float& A002445_474()
-  {
-    static const e_float val(static_cast<std::int32_t>(865410L));
-    return val;
-  }
-
-  static const e_float& A002445_475()
-  {
-    static const e_float val(static_cast<std::int32_t>(12606L));
-    return val;
-  }
-
-  static const e_float& A002445_476()
-  {
-    static const e_float val(static_cast<std::int64_t>(27147548730LL));
-    return val;
-  }
-
-  static const e_float& A002445_477()
-  {
-    static const e_float val(static_cast<std::int32_t>(85386L));
-    return val;
-  }
-
-  static const e_float& A002445_478()
-  {
-    static const e_float val(static_cast<std::int32_t>(14370L));
-    return val;
-  }
-
-  static const e_float& A002445_479()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_480()
-  {
-    static const e_float val(static_cast<std::int64_t>(178577083150876410LL));
-    return val;
-  }
-
-  static const e_float& A002445_481()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_482()
-  {
-    static const e_float val(static_cast<std::int32_t>(30L));
-    return val;
-  }
-
-  static const e_float& A002445_483()
-  {
-    static const e_float val(static_cast<std::int64_t>(11409244266LL));
-    return val;
-  }
-
-  static const e_float& A002445_484()
-  {
-    static const e_float val(static_cast<std::int32_t>(61410L));
-    return val;
-  }
-
-  static const e_float& A002445_485()
-  {
-    static const e_float val(static_cast<std::int32_t>(64086L));
-    return val;
-  }
-
-  static const e_float& A002445_486()
-  {
-    static const e_float val(static_cast<std::int64_t>(16605847131510LL));
-    return val;
-  }
-
-  static const e_float& A002445_487()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_488()
-  {
-    static const e_float val(static_cast<std::int32_t>(498270L));
-    return val;
-  }
-
-  static const e_float& A002445_489()
-  {
-    static const e_float val(static_cast<std::int32_t>(42L));
-    return val;
-  }
-
-  static const e_float& A002445_490()
-  {
-    static const e_float val(static_cast<std::int64_t>(65723094690LL));
-    return val;
-  }
-
-  static const e_float& A002445_491()
-  {
-    static const e_float val(static_cast<std::int32_t>(5898L));
-    return val;
-  }
-
-  static const e_float& A002445_492()
-  {
-    static const e_float val(static_cast<std::int32_t>(226590L));
-    return val;
-  }
-
-  static const e_float& A002445_493()
-  {
-    static const e_float val(static_cast<std::int32_t>(354L));
-    return val;
-  }
-
-  static const e_float& A002445_494()
-  {
-    static const e_float val(static_cast<std::int32_t>(1590L));
-    return val;
-  }
-
-  static const e_float& A002445_495()
-  {
-    static const e_float val(static_cast<std::int64_t>(27372510670045002LL));
-    return val;
-  }
-
-  static const e_float& A002445_496()
-  {
-    static const e_float val(static_cast<std::int32_t>(510L));
-    return val;
-  }
-
-  static const e_float& A002445_497()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_498()
-  {
-    static const e_float val(static_cast<std::int64_t>(226816592730LL));
-    return val;
-  }
-
-  static const e_float& A002445_499()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_500()
-  {
-    static const e_float val(static_cast<std::int32_t>(342999030L));
-    return val;
-  }
-
-  static const e_float& A002445_501()
-  {
-    static const e_float val(static_cast<std::int32_t>(42L));
-    return val;
-  }
-
-  static const e_float& A002445_502()
-  {
-    static const e_float val(static_cast<std::int32_t>(15090L));
-    return val;
-  }
-
-  static const e_float& A002445_503()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_504()
-  {
-    static const e_float val("14493038256293268734790");
-    return val;
-  }
-
-  static const e_float& A002445_505()
-  {
-    static const e_float val(static_cast<std::int32_t>(66L));
-    return val;
-  }
-
-  static const e_float& A002445_506()
-  {
-    static const e_float val(static_cast<std::int32_t>(32851590L));
-    return val;
-  }
-
-  static const e_float& A002445_507()
-  {
-    static const e_float val(static_cast<std::int32_t>(3318L));
-    return val;
-  }
-
-  static const e_float& A002445_508()
-  {
-    static const e_float val(static_cast<std::int32_t>(15270L));
-    return val;
-  }
-
-  static const e_float& A002445_509()
-  {
-    static const e_float val(static_cast<std::int32_t>(6114L));
-    return val;
-  }
-
-  static const e_float& A002445_510()
-  {
-    static const e_float val(static_cast<std::int64_t>(5971862886990LL));
-    return val;
-  }
-
-  static const e_float& A002445_511()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_512()
-  {
-    static const e_float val(static_cast<std::int32_t>(131070L));
-    return val;
-  }
-
-  static const e_float& A002445_513()
-  {
-    static const e_float val(static_cast<std::int32_t>(798L));
-    return val;
-  }
-
-  static const e_float& A002445_514()
-  {
-    static const e_float val(static_cast<std::int32_t>(30L));
-    return val;
-  }
-
-  static const e_float& A002445_515()
-  {
-    static const e_float val(static_cast<std::int32_t>(68046L));
-    return val;
-  }
-
-  static const e_float& A002445_516()
-  {
-    static const e_float val(static_cast<std::int32_t>(487875570L));
-    return val;
-  }
-
-  static const e_float& A002445_517()
-  {
-    static const e_float val(static_cast<std::int32_t>(138L));
-    return val;
-  }
-
-  static const e_float& A002445_518()
-  {
-    static const e_float val(static_cast<std::int32_t>(129630L));
-    return val;
-  }
-
-  static const e_float& A002445_519()
-  {
-    static const e_float val(static_cast<std::int32_t>(15142386L));
-    return val;
-  }
-
-  static const e_float& A002445_520()
-  {
-    static const e_float val(static_cast<std::int64_t>(832015863030LL));
-    return val;
-  }
-
-  static const e_float& A002445_521()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_522()
-  {
-    static const e_float val(static_cast<std::int64_t>(20667935594670LL));
-    return val;
-  }
-
-  static const e_float& A002445_523()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_524()
-  {
-    static const e_float val(static_cast<std::int32_t>(8276610L));
-    return val;
-  }
-
-  static const e_float& A002445_525()
-  {
-    static const e_float val(static_cast<std::int64_t>(1464173668545126LL));
-    return val;
-  }
-
-  static const e_float& A002445_526()
-  {
-    static const e_float val(static_cast<std::int32_t>(30L));
-    return val;
-  }
-
-  static const e_float& A002445_527()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_528()
-  {
-    static const e_float val(static_cast<std::int64_t>(217946878566690LL));
-    return val;
-  }
-
-  static const e_float& A002445_529()
-  {
-    static const e_float val(static_cast<std::int32_t>(282L));
-    return val;
-  }
-
-  static const e_float& A002445_530()
-  {
-    static const e_float val(static_cast<std::int32_t>(37463910L));
-    return val;
-  }
-
-  static const e_float& A002445_531()
-  {
-    static const e_float val(static_cast<std::int32_t>(848274L));
-    return val;
-  }
-
-  static const e_float& A002445_532()
-  {
-    static const e_float val(static_cast<std::int32_t>(870L));
-    return val;
-  }
-
-  static const e_float& A002445_533()
-  {
-    static const e_float val(static_cast<std::int32_t>(498L));
-    return val;
-  }
-
-  static const e_float& A002445_534()
-  {
-    static const e_float val(static_cast<std::int32_t>(522388230L));
-    return val;
-  }
-
-  static const e_float& A002445_535()
-  {
-    static const e_float val(static_cast<std::int32_t>(66L));
-    return val;
-  }
-
-  static const e_float& A002445_536()
-  {
-    static const e_float val(static_cast<std::int32_t>(137190L));
-    return val;
-  }
-
-  static const e_float& A002445_537()
-  {
-    static const e_float val(static_cast<std::int32_t>(15078L));
-    return val;
-  }
-
-  static const e_float& A002445_538()
-  {
-    static const e_float val(static_cast<std::int32_t>(30L));
-    return val;
-  }
-
-  static const e_float& A002445_539()
-  {
-    static const e_float val(static_cast<std::int32_t>(138L));
-    return val;
-  }
-
-  static const e_float& A002445_540()
-  {
-    static const e_float val("345605409620810598989730");
-    return val;
-  }
-
-  static const e_float& A002445_541()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_542()
-  {
-    static const e_float val(static_cast<std::int32_t>(30L));
-    return val;
-  }
-
-  static const e_float& A002445_543()
-  {
-    static const e_float val(static_cast<std::int32_t>(45654L));
-    return val;
-  }
-
-  static const e_float& A002445_544()
-  {
-    static const e_float val(static_cast<std::int32_t>(69870L));
-    return val;
-  }
-
-  static const e_float& A002445_545()
-  {
-    static const e_float val(static_cast<std::int32_t>(72006L));
-    return val;
-  }
-
-  static const e_float& A002445_546()
-  {
-    static const e_float val(static_cast<std::int64_t>(1337947899596989590LL));
-    return val;
-  }
-
-  static const e_float& A002445_547()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_548()
-  {
-    static const e_float val(static_cast<std::int32_t>(32910L));
-    return val;
-  }
-
-  static const e_float& A002445_549()
-  {
-    static const e_float val(static_cast<std::int32_t>(292866L));
-    return val;
-  }
-
-  static const e_float& A002445_550()
-  {
-    static const e_float val(static_cast<std::int32_t>(766590L));
-    return val;
-  }
-
-  static const e_float& A002445_551()
-  {
-    static const e_float val(static_cast<std::int32_t>(390462L));
-    return val;
-  }
-
-  static const e_float& A002445_552()
-  {
-    static const e_float val(static_cast<std::int64_t>(83985438810LL));
-    return val;
-  }
-
-  static const e_float& A002445_553()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_554()
-  {
-    static const e_float val(static_cast<std::int32_t>(33270L));
-    return val;
-  }
-
-  static const e_float& A002445_555()
-  {
-    static const e_float val(static_cast<std::int32_t>(3193806L));
-    return val;
-  }
-
-  static const e_float& A002445_556()
-  {
-    static const e_float val(static_cast<std::int32_t>(16710L));
-    return val;
-  }
-
-  static const e_float& A002445_557()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_558()
-  {
-    static const e_float val(static_cast<std::int64_t>(799613240790LL));
-    return val;
-  }
-
-  static const e_float& A002445_559()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_560()
-  {
-    static const e_float val(static_cast<std::int64_t>(15037922004270LL));
-    return val;
-  }
-
-  static const e_float& A002445_561()
-  {
-    static const e_float val(static_cast<std::int64_t>(7486329018LL));
-    return val;
-  }
-
-  static const e_float& A002445_562()
-  {
-    static const e_float val(static_cast<std::int32_t>(16890L));
-    return val;
-  }
-
-  static const e_float& A002445_563()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_564()
-  {
-    static const e_float val(static_cast<std::int32_t>(872254110L));
-    return val;
-  }
-
-  static const e_float& A002445_565()
-  {
-    static const e_float val(static_cast<std::int32_t>(14982L));
-    return val;
-  }
-
-  static const e_float& A002445_566()
-  {
-    static const e_float val(static_cast<std::int32_t>(30L));
-    return val;
-  }
-
-  static const e_float& A002445_567()
-  {
-    static const e_float val(static_cast<std::int64_t>(269216629206LL));
-    return val;
-  }
-
-  static const e_float& A002445_568()
-  {
-    static const e_float val(static_cast<std::int32_t>(290190L));
-    return val;
-  }
-
-  static const e_float& A002445_569()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_570()
-  {
-    static const e_float val(static_cast<std::int64_t>(1418246821361370LL));
-    return val;
-  }
-
-  static const e_float& A002445_571()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_572()
-  {
-    static const e_float val(static_cast<std::int32_t>(3254730L));
-    return val;
-  }
-
-  static const e_float& A002445_573()
-  {
-    static const e_float val(static_cast<std::int32_t>(16086L));
-    return val;
-  }
-
-  static const e_float& A002445_574()
-  {
-    static const e_float val(static_cast<std::int32_t>(72210L));
-    return val;
-  }
-
-  static const e_float& A002445_575()
-  {
-    static const e_float val(static_cast<std::int32_t>(3570402L));
-    return val;
-  }
-
-  static const e_float& A002445_576()
-  {
-    static const e_float val("29663604169293338790");
-    return val;
-  }
-
-  static const e_float& A002445_577()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_578()
-  {
-    static const e_float val(static_cast<std::int32_t>(30L));
-    return val;
-  }
-
-  static const e_float& A002445_579()
-  {
-    static const e_float val(static_cast<std::int32_t>(42L));
-    return val;
-  }
-
-  static const e_float& A002445_580()
-  {
-    static const e_float val(static_cast<std::int32_t>(185996910L));
-    return val;
-  }
-
-  static const e_float& A002445_581()
-  {
-    static const e_float val(static_cast<std::int32_t>(1165326L));
-    return val;
-  }
-
-  static const e_float& A002445_582()
-  {
-    static const e_float val(static_cast<std::int32_t>(1061970L));
-    return val;
-  }
-
-  static const e_float& A002445_583()
-  {
-    static const e_float val(static_cast<std::int32_t>(14766L));
-    return val;
-  }
-
-  static const e_float& A002445_584()
-  {
-    static const e_float val(static_cast<std::int32_t>(149430L));
-    return val;
-  }
-
-  static const e_float& A002445_585()
-  {
-    static const e_float val(static_cast<std::int64_t>(3297710692122LL));
-    return val;
-  }
-
-  static const e_float& A002445_586()
-  {
-    static const e_float val(static_cast<std::int32_t>(17610L));
-    return val;
-  }
-
-  static const e_float& A002445_587()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_588()
-  {
-    static const e_float val(static_cast<std::int32_t>(670649070L));
-    return val;
-  }
-
-  static const e_float& A002445_589()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_590()
-  {
-    static const e_float val(static_cast<std::int32_t>(389730L));
-    return val;
-  }
-
-  static const e_float& A002445_591()
-  {
-    static const e_float val(static_cast<std::int32_t>(42L));
-    return val;
-  }
-
-  static const e_float& A002445_592()
-  {
-    static const e_float val(static_cast<std::int32_t>(45062070L));
-    return val;
-  }
-
-  static const e_float& A002445_593()
-  {
-    static const e_float val(static_cast<std::int32_t>(7122L));
-    return val;
-  }
-
-  static const e_float& A002445_594()
-  {
-    static const e_float val(static_cast<std::int64_t>(25467756676965330LL));
-    return val;
-  }
-
-  static const e_float& A002445_595()
-  {
-    static const e_float val(static_cast<std::int32_t>(1119954L));
-    return val;
-  }
-
-  static const e_float& A002445_596()
-  {
-    static const e_float val(static_cast<std::int32_t>(35790L));
-    return val;
-  }
-
-  static const e_float& A002445_597()
-  {
-    static const e_float val(static_cast<std::int32_t>(42L));
-    return val;
-  }
-
-  static const e_float& A002445_598()
-  {
-    static const e_float val(static_cast<std::int32_t>(44763270L));
-    return val;
-  }
-
-  static const e_float& A002445_599()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_600()
-  {
-    static const e_float val("42107247672297314156359710");
-    return val;
-  }
-
-  static const e_float& A002445_601()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_602()
-  {
-    static const e_float val(static_cast<std::int32_t>(150510L));
-    return val;
-  }
-
-  static const e_float& A002445_603()
-  {
-    static const e_float val(static_cast<std::int32_t>(798L));
-    return val;
-  }
-
-  static const e_float& A002445_604()
-  {
-    static const e_float val(static_cast<std::int32_t>(30L));
-    return val;
-  }
-
-  static const e_float& A002445_605()
-  {
-    static const e_float val(static_cast<std::int32_t>(1518L));
-    return val;
-  }
-
-  static const e_float& A002445_606()
-  {
-    static const e_float val(static_cast<std::int32_t>(2010074430L));
-    return val;
-  }
-
-  static const e_float& A002445_607()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_608()
-  {
-    static const e_float val(static_cast<std::int32_t>(620670L));
-    return val;
-  }
-
-  static const e_float& A002445_609()
-  {
-    static const e_float val(static_cast<std::int32_t>(106554L));
-    return val;
-  }
-
-  static const e_float& A002445_610()
-  {
-    static const e_float val(static_cast<std::int32_t>(330L));
-    return val;
-  }
-
-  static const e_float& A002445_611()
-  {
-    static const e_float val(static_cast<std::int32_t>(7338L));
-    return val;
-  }
-
-  static const e_float& A002445_612()
-  {
-    static const e_float val("152167106353234711830");
-    return val;
-  }
-
-  static const e_float& A002445_613()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_614()
-  {
-    static const e_float val(static_cast<std::int32_t>(36870L));
-    return val;
-  }
-
-  static const e_float& A002445_615()
-  {
-    static const e_float val(static_cast<std::int32_t>(1463321706L));
-    return val;
-  }
-
-  static const e_float& A002445_616()
-  {
-    static const e_float val(static_cast<std::int64_t>(2110812338730LL));
-    return val;
-  }
-
-  static const e_float& A002445_617()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_618()
-  {
-    static const e_float val(static_cast<std::int32_t>(2090369190L));
-    return val;
-  }
-
-  static const e_float& A002445_619()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_620()
-  {
-    static const e_float val(static_cast<std::int32_t>(4207830L));
-    return val;
-  }
-
-  static const e_float& A002445_621()
-  {
-    static const e_float val(static_cast<std::int32_t>(5213334L));
-    return val;
-  }
-
-  static const e_float& A002445_622()
-  {
-    static const e_float val(static_cast<std::int32_t>(30L));
-    return val;
-  }
-
-  static const e_float& A002445_623()
-  {
-    static const e_float val(static_cast<std::int32_t>(1074L));
-    return val;
-  }
-
-  static const e_float& A002445_624()
-  {
-    static const e_float val(static_cast<std::int64_t>(1156891664364527910LL));
-    return val;
-  }
-
-  static const e_float& A002445_625()
-  {
-    static const e_float val(static_cast<std::int32_t>(16566L));
-    return val;
-  }
-
-  static const e_float& A002445_626()
-  {
-    static const e_float val(static_cast<std::int32_t>(30L));
-    return val;
-  }
-
-  static const e_float& A002445_627()
-  {
-    static const e_float val(static_cast<std::int32_t>(27118518L));
-    return val;
-  }
-
-  static const e_float& A002445_628()
-  {
-    static const e_float val(static_cast<std::int32_t>(30L));
-    return val;
-  }
-
-  static const e_float& A002445_629()
-  {
-    static const e_float val(static_cast<std::int32_t>(7554L));
-    return val;
-  }
-
-  static const e_float& A002445_630()
-  {
-    static const e_float val("4554106624556364764691012210");
-    return val;
-  }
-
-  static const e_float& A002445_631()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_632()
-  {
-    static const e_float val(static_cast<std::int32_t>(161670L));
-    return val;
-  }
-
-  static const e_float& A002445_633()
-  {
-    static const e_float val(static_cast<std::int32_t>(42L));
-    return val;
-  }
-
-  static const e_float& A002445_634()
-  {
-    static const e_float val(static_cast<std::int32_t>(30L));
-    return val;
-  }
-
-  static const e_float& A002445_635()
-  {
-    static const e_float val(static_cast<std::int32_t>(66L));
-    return val;
-  }
-
-  static const e_float& A002445_636()
-  {
-    static const e_float val(static_cast<std::int32_t>(292110L));
-    return val;
-  }
-
-  static const e_float& A002445_637()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_638()
-  {
-    static const e_float val(static_cast<std::int32_t>(51986670L));
-    return val;
-  }
-
-  static const e_float& A002445_639()
-  {
-    static const e_float val(static_cast<std::int32_t>(1020642L));
-    return val;
-  }
-
-  static const e_float& A002445_640()
-  {
-    static const e_float val(static_cast<std::int64_t>(37891157370LL));
-    return val;
-  }
-
-  static const e_float& A002445_641()
-  {
-    static const e_float val(static_cast<std::int32_t>(7698L));
-    return val;
-  }
-
-  static const e_float& A002445_642()
-  {
-    static const e_float val(static_cast<std::int32_t>(1755390L));
-    return val;
-  }
-
-  static const e_float& A002445_643()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_644()
-  {
-    static const e_float val(static_cast<std::int32_t>(52707210L));
-    return val;
-  }
-
-  static const e_float& A002445_645()
-  {
-    static const e_float val(static_cast<std::int64_t>(7969061562LL));
-    return val;
-  }
-
-  static const e_float& A002445_646()
-  {
-    static const e_float val(static_cast<std::int32_t>(19410L));
-    return val;
-  }
-
-  static const e_float& A002445_647()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_648()
-  {
-    static const e_float val("23764666736005761930");
-    return val;
-  }
-
-  static const e_float& A002445_649()
-  {
-    static const e_float val(static_cast<std::int32_t>(138L));
-    return val;
-  }
-
-  static const e_float& A002445_650()
-  {
-    static const e_float val(static_cast<std::int64_t>(301064657190LL));
-    return val;
-  }
-
-  static const e_float& A002445_651()
-  {
-    static const e_float val(static_cast<std::int32_t>(2353218L));
-    return val;
-  }
-
-  static const e_float& A002445_652()
-  {
-    static const e_float val(static_cast<std::int32_t>(19590L));
-    return val;
-  }
-
-  static const e_float& A002445_653()
-  {
-    static const e_float val(static_cast<std::int32_t>(7842L));
-    return val;
-  }
-
-  static const e_float& A002445_654()
-  {
-    static const e_float val(static_cast<std::int32_t>(2730L));
-    return val;
-  }
-
-  static const e_float& A002445_655()
-  {
-    static const e_float val(static_cast<std::int32_t>(17358L));
-    return val;
-  }
-
-  static const e_float& A002445_656()
-  {
-    static const e_float val(static_cast<std::int32_t>(42330L));
-    return val;
-  }
-
-  static const e_float& A002445_657()
-  {
-    static const e_float val(static_cast<std::int32_t>(350322L));
-    return val;
-  }
-
-  static const e_float& A002445_658()
-  {
-    static const e_float val(static_cast<std::int32_t>(573330L));
-    return val;
-  }
-
-  static const e_float& A002445_659()
-  {
-    static const e_float val(static_cast<std::int32_t>(7914L));
-    return val;
-  }
-
-  static const e_float& A002445_660()
-  {
-    static const e_float val("92290209959160675732270");
-    return val;
-  }
-
-  static const e_float& A002445_661()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_662()
-  {
-    static const e_float val(static_cast<std::int32_t>(30L));
-    return val;
-  }
-
-  static const e_float& A002445_663()
-  {
-    static const e_float val(static_cast<std::int64_t>(200903848194LL));
-    return val;
-  }
-
-  static const e_float& A002445_664()
-  {
-    static const e_float val(static_cast<std::int32_t>(85170L));
-    return val;
-  }
-
-  static const e_float& A002445_665()
-  {
-    static const e_float val(static_cast<std::int32_t>(895026L));
-    return val;
-  }
-
-  static const e_float& A002445_666()
-  {
-    static const e_float val(static_cast<std::int64_t>(63768926130LL));
-    return val;
-  }
-
-  static const e_float& A002445_667()
-  {
-    static const e_float val(static_cast<std::int32_t>(16638L));
-    return val;
-  }
-
-  static const e_float& A002445_668()
-  {
-    static const e_float val(static_cast<std::int32_t>(30L));
-    return val;
-  }
-
-  static const e_float& A002445_669()
-  {
-    static const e_float val(static_cast<std::int32_t>(42L));
-    return val;
-  }
-
-  static const e_float& A002445_670()
-  {
-    static const e_float val(static_cast<std::int32_t>(88770L));
-    return val;
-  }
-
-  static const e_float& A002445_671()
-  {
-    static const e_float val(static_cast<std::int32_t>(138L));
-    return val;
-  }
-
-  static const e_float& A002445_672()
-  {
-    static const e_float val("12467426447728328684790");
-    return val;
-  }
-
-  static const e_float& A002445_673()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_674()
-  {
-    static const e_float val(static_cast<std::int32_t>(30L));
-    return val;
-  }
-
-  static const e_float& A002445_675()
-  {
-    static const e_float val(static_cast<std::int64_t>(11135340678LL));
-    return val;
-  }
-
-  static const e_float& A002445_676()
-  {
-    static const e_float val(static_cast<std::int32_t>(1076430L));
-    return val;
-  }
-
-  static const e_float& A002445_677()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_678()
-  {
-    static const e_float val(static_cast<std::int32_t>(619710L));
-    return val;
-  }
-
-  static const e_float& A002445_679()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_680()
-  {
-    static const e_float val(static_cast<std::int64_t>(42886974570LL));
-    return val;
-  }
-
-  static const e_float& A002445_681()
-  {
-    static const e_float val(static_cast<std::int32_t>(42L));
-    return val;
-  }
-
-  static const e_float& A002445_682()
-  {
-    static const e_float val(static_cast<std::int32_t>(471270L));
-    return val;
-  }
-
-  static const e_float& A002445_683()
-  {
-    static const e_float val(static_cast<std::int32_t>(8202L));
-    return val;
-  }
-
-  static const e_float& A002445_684()
-  {
-    static const e_float val(static_cast<std::int64_t>(14661976348110LL));
-    return val;
-  }
-
-  static const e_float& A002445_685()
-  {
-    static const e_float val(static_cast<std::int32_t>(66L));
-    return val;
-  }
-
-  static const e_float& A002445_686()
-  {
-    static const e_float val(static_cast<std::int32_t>(235318470L));
-    return val;
-  }
-
-  static const e_float& A002445_687()
-  {
-    static const e_float val(static_cast<std::int32_t>(42L));
-    return val;
-  }
-
-  static const e_float& A002445_688()
-  {
-    static const e_float val(static_cast<std::int32_t>(88230L));
-    return val;
-  }
-
-  static const e_float& A002445_689()
-  {
-    static const e_float val(static_cast<std::int32_t>(642L));
-    return val;
-  }
-
-  static const e_float& A002445_690()
-  {
-    static const e_float val("45207650798257176058830");
-    return val;
-  }
-
-  static const e_float& A002445_691()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_692()
-  {
-    static const e_float val(static_cast<std::int32_t>(10410L));
-    return val;
-  }
-
-  static const e_float& A002445_693()
-  {
-    static const e_float val(static_cast<std::int64_t>(618745101945726LL));
-    return val;
-  }
-
-  static const e_float& A002445_694()
-  {
-    static const e_float val(static_cast<std::int32_t>(30L));
-    return val;
-  }
-
-  static const e_float& A002445_695()
-  {
-    static const e_float val(static_cast<std::int32_t>(66L));
-    return val;
-  }
-
-  static const e_float& A002445_696()
-  {
-    static const e_float val(static_cast<std::int64_t>(222661396230LL));
-    return val;
-  }
-
-  static const e_float& A002445_697()
-  {
-    static const e_float val(static_cast<std::int32_t>(498L));
-    return val;
-  }
-
-  static const e_float& A002445_698()
-  {
-    static const e_float val(static_cast<std::int32_t>(30L));
-    return val;
-  }
-
-  static const e_float& A002445_699()
-  {
-    static const e_float val(static_cast<std::int32_t>(27439986L));
-    return val;
-  }
-
-  static const e_float& A002445_700()
-  {
-    static const e_float val(static_cast<std::int64_t>(554242538169870LL));
-    return val;
-  }
-
-  static const e_float& A002445_701()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_702()
-  {
-    static const e_float val(static_cast<std::int64_t>(137514053293890LL));
-    return val;
-  }
-
-  static const e_float& A002445_703()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_704()
-  {
-    static const e_float val(static_cast<std::int64_t>(519246666690LL));
-    return val;
-  }
-
-  static const e_float& A002445_705()
-  {
-    static const e_float val(static_cast<std::int32_t>(4053126L));
-    return val;
-  }
-
-  static const e_float& A002445_706()
-  {
-    static const e_float val(static_cast<std::int32_t>(30L));
-    return val;
-  }
-
-  static const e_float& A002445_707()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_708()
-  {
-    static const e_float val(static_cast<std::int32_t>(1935570L));
-    return val;
-  }
-
-  static const e_float& A002445_709()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_710()
-  {
-    static const e_float val(static_cast<std::int32_t>(330L));
-    return val;
-  }
-
-  static const e_float& A002445_711()
-  {
-    static const e_float val(static_cast<std::int32_t>(1135554L));
-    return val;
-  }
-
-  static const e_float& A002445_712()
-  {
-    static const e_float val(static_cast<std::int32_t>(91290L));
-    return val;
-  }
-
-  static const e_float& A002445_713()
-  {
-    static const e_float val(static_cast<std::int32_t>(402414L));
-    return val;
-  }
-
-  static const e_float& A002445_714()
-  {
-    static const e_float val(static_cast<std::int64_t>(119755772056830LL));
-    return val;
-  }
-
-  static const e_float& A002445_715()
-  {
-    static const e_float val(static_cast<std::int32_t>(198858L));
-    return val;
-  }
-
-  static const e_float& A002445_716()
-  {
-    static const e_float val(static_cast<std::int32_t>(15433410L));
-    return val;
-  }
-
-  static const e_float& A002445_717()
-  {
-    static const e_float val(static_cast<std::int32_t>(20118L));
-    return val;
-  }
-
-  static const e_float& A002445_718()
-  {
-    static const e_float val(static_cast<std::int32_t>(21570L));
-    return val;
-  }
-
-  static const e_float& A002445_719()
-  {
-    static const e_float val(static_cast<std::int32_t>(8634L));
-    return val;
-  }
-
-  static const e_float& A002445_720()
-  {
-    static const e_float val("8594590242330510848430");
-    return val;
-  }
-
-  static const e_float& A002445_721()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_722()
-  {
-    static const e_float val(static_cast<std::int32_t>(30L));
-    return val;
-  }
-
-  static const e_float& A002445_723()
-  {
-    static const e_float val(static_cast<std::int32_t>(60774L));
-    return val;
-  }
-
-  static const e_float& A002445_724()
-  {
-    static const e_float val(static_cast<std::int32_t>(30L));
-    return val;
-  }
-
-  static const e_float& A002445_725()
-  {
-    static const e_float val(static_cast<std::int32_t>(5650194L));
-    return val;
-  }
-
-  static const e_float& A002445_726()
-  {
-    static const e_float val(static_cast<std::int64_t>(4443910573830LL));
-    return val;
-  }
-
-  static const e_float& A002445_727()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_728()
-  {
-    static const e_float val(static_cast<std::int32_t>(88577310L));
-    return val;
-  }
-
-  static const e_float& A002445_729()
-  {
-    static const e_float val(static_cast<std::int64_t>(92421869442LL));
-    return val;
-  }
-
-  static const e_float& A002445_730()
-  {
-    static const e_float val(static_cast<std::int32_t>(96690L));
-    return val;
-  }
-
-  static const e_float& A002445_731()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_732()
-  {
-    static const e_float val(static_cast<std::int32_t>(734400030L));
-    return val;
-  }
-
-  static const e_float& A002445_733()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_734()
-  {
-    static const e_float val(static_cast<std::int32_t>(30L));
-    return val;
-  }
-
-  static const e_float& A002445_735()
-  {
-    static const e_float val(static_cast<std::int64_t>(6663571987681686LL));
-    return val;
-  }
-
-  static const e_float& A002445_736()
-  {
-    static const e_float val(static_cast<std::int32_t>(23970L));
-    return val;
-  }
-
-  static const e_float& A002445_737()
-  {
-    static const e_float val(static_cast<std::int32_t>(138L));
-    return val;
-  }
-
-  static const e_float& A002445_738()
-  {
-    static const e_float val(static_cast<std::int64_t>(117717357030LL));
-    return val;
-  }
-
-  static const e_float& A002445_739()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_740()
-  {
-    static const e_float val(static_cast<std::int64_t>(2985651570LL));
-    return val;
-  }
-
-  static const e_float& A002445_741()
-  {
-    static const e_float val(static_cast<std::int32_t>(4920594L));
-    return val;
-  }
-
-  static const e_float& A002445_742()
-  {
-    static const e_float val(static_cast<std::int32_t>(69165870L));
-    return val;
-  }
-
-  static const e_float& A002445_743()
-  {
-    static const e_float val(static_cast<std::int32_t>(8922L));
-    return val;
-  }
-
-  static const e_float& A002445_744()
-  {
-    static const e_float val(static_cast<std::int64_t>(25775974770LL));
-    return val;
-  }
-
-  static const e_float& A002445_745()
-  {
-    static const e_float val(static_cast<std::int32_t>(66L));
-    return val;
-  }
-
-  static const e_float& A002445_746()
-  {
-    static const e_float val(static_cast<std::int32_t>(44790L));
-    return val;
-  }
-
-  static const e_float& A002445_747()
-  {
-    static const e_float val(static_cast<std::int32_t>(66499734L));
-    return val;
-  }
-
-  static const e_float& A002445_748()
-  {
-    static const e_float val(static_cast<std::int32_t>(8413170L));
-    return val;
-  }
-
-  static const e_float& A002445_749()
-  {
-    static const e_float val(static_cast<std::int32_t>(8994L));
-    return val;
-  }
-
-  static const e_float& A002445_750()
-  {
-    static const e_float val(static_cast<std::int64_t>(163252124079274230LL));
-    return val;
-  }
-
-  static const e_float& A002445_751()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_752()
-  {
-    static const e_float val(static_cast<std::int32_t>(510L));
-    return val;
-  }
-
-  static const e_float& A002445_753()
-  {
-    static const e_float val(static_cast<std::int32_t>(21126L));
-    return val;
-  }
-
-  static const e_float& A002445_754()
-  {
-    static const e_float val(static_cast<std::int32_t>(93810L));
-    return val;
-  }
-
-  static const e_float& A002445_755()
-  {
-    static const e_float val(static_cast<std::int32_t>(99726L));
-    return val;
-  }
-
-  static const e_float& A002445_756()
-  {
-    static const e_float val("693861185865178959810");
-    return val;
-  }
-
-  static const e_float& A002445_757()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_758()
-  {
-    static const e_float val(static_cast<std::int32_t>(30L));
-    return val;
-  }
-
-  static const e_float& A002445_759()
-  {
-    static const e_float val(static_cast<std::int32_t>(422828826L));
-    return val;
-  }
-
-  static const e_float& A002445_760()
-  {
-    static const e_float val(static_cast<std::int64_t>(33432183510LL));
-    return val;
-  }
-
-  static const e_float& A002445_761()
-  {
-    static const e_float val(static_cast<std::int32_t>(9138L));
-    return val;
-  }
-
-  static const e_float& A002445_762()
-  {
-    static const e_float val(static_cast<std::int32_t>(1389570L));
-    return val;
-  }
-
-  static const e_float& A002445_763()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_764()
-  {
-    static const e_float val(static_cast<std::int32_t>(11490L));
-    return val;
-  }
-
-  static const e_float& A002445_765()
-  {
-    static const e_float val(static_cast<std::int64_t>(13173708858618LL));
-    return val;
-  }
-
-  static const e_float& A002445_766()
-  {
-    static const e_float val(static_cast<std::int32_t>(30L));
-    return val;
-  }
-
-  static const e_float& A002445_767()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_768()
-  {
-    static const e_float val(static_cast<std::int64_t>(171711773909130LL));
-    return val;
-  }
-
-  static const e_float& A002445_769()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_770()
-  {
-    static const e_float val(static_cast<std::int32_t>(15627810L));
-    return val;
-  }
-
-  static const e_float& A002445_771()
-  {
-    static const e_float val(static_cast<std::int32_t>(64806L));
-    return val;
-  }
-
-  static const e_float& A002445_772()
-  {
-    static const e_float val(static_cast<std::int32_t>(23190L));
-    return val;
-  }
-
-  static const e_float& A002445_773()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_774()
-  {
-    static const e_float val(static_cast<std::int64_t>(514298778630LL));
-    return val;
-  }
-
-  static const e_float& A002445_775()
-  {
-    static const e_float val(static_cast<std::int32_t>(20526L));
-    return val;
-  }
-
-  static const e_float& A002445_776()
-  {
-    static const e_float val(static_cast<std::int32_t>(308099670L));
-    return val;
-  }
-
-  static const e_float& A002445_777()
-  {
-    static const e_float val(static_cast<std::int32_t>(402738L));
-    return val;
-  }
-
-  static const e_float& A002445_778()
-  {
-    static const e_float val(static_cast<std::int32_t>(30L));
-    return val;
-  }
-
-  static const e_float& A002445_779()
-  {
-    static const e_float val(static_cast<std::int32_t>(776382L));
-    return val;
-  }
-
-  static const e_float& A002445_780()
-  {
-    static const e_float val("32695402455500348373810");
-    return val;
-  }
-
-  static const e_float& A002445_781()
-  {
-    static const e_float val(static_cast<std::int32_t>(138L));
-    return val;
-  }
-
-  static const e_float& A002445_782()
-  {
-    static const e_float val(static_cast<std::int32_t>(1410L));
-    return val;
-  }
-
-  static const e_float& A002445_783()
-  {
-    static const e_float val(static_cast<std::int64_t>(38585629362LL));
-    return val;
-  }
-
-  static const e_float& A002445_784()
-  {
-    static const e_float val(static_cast<std::int32_t>(329240190L));
-    return val;
-  }
-
-  static const e_float& A002445_785()
-  {
-    static const e_float val(static_cast<std::int32_t>(103686L));
-    return val;
-  }
-
-  static const e_float& A002445_786()
-  {
-    static const e_float val(static_cast<std::int32_t>(565058130L));
-    return val;
-  }
-
-  static const e_float& A002445_787()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_788()
-  {
-    static const e_float val(static_cast<std::int32_t>(30L));
-    return val;
-  }
-
-  static const e_float& A002445_789()
-  {
-    static const e_float val(static_cast<std::int32_t>(66318L));
-    return val;
-  }
-
-  static const e_float& A002445_790()
-  {
-    static const e_float val(static_cast<std::int32_t>(104610L));
-    return val;
-  }
-
-  static const e_float& A002445_791()
-  {
-    static const e_float val(static_cast<std::int32_t>(2156046L));
-    return val;
-  }
-
-  static const e_float& A002445_792()
-  {
-    static const e_float val("25806314286368291130");
-    return val;
-  }
-
-  static const e_float& A002445_793()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_794()
-  {
-    static const e_float val(static_cast<std::int32_t>(30L));
-    return val;
-  }
-
-  static const e_float& A002445_795()
-  {
-    static const e_float val(static_cast<std::int32_t>(1532454L));
-    return val;
-  }
-
-  static const e_float& A002445_796()
-  {
-    static const e_float val(static_cast<std::int32_t>(23910L));
-    return val;
-  }
-
-  static const e_float& A002445_797()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_798()
-  {
-    static const e_float val(static_cast<std::int64_t>(1245000423030LL));
-    return val;
-  }
-
-  static const e_float& A002445_799()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_800()
-  {
-    static const e_float val(static_cast<std::int64_t>(14914331651010LL));
-    return val;
-  }
-
-  static const e_float& A002445_801()
-  {
-    static const e_float val(static_cast<std::int32_t>(142842L));
-    return val;
-  }
-
-  static const e_float& A002445_802()
-  {
-    static const e_float val(static_cast<std::int32_t>(30L));
-    return val;
-  }
-
-  static const e_float& A002445_803()
-  {
-    static const e_float val(static_cast<std::int32_t>(221766L));
-    return val;
-  }
-
-  static const e_float& A002445_804()
-  {
-    static const e_float val(static_cast<std::int32_t>(1181601330L));
-    return val;
-  }
-
-  static const e_float& A002445_805()
-  {
-    static const e_float val(static_cast<std::int32_t>(220242L));
-    return val;
-  }
-
-  static const e_float& A002445_806()
-  {
-    static const e_float val(static_cast<std::int32_t>(2564670L));
-    return val;
-  }
-
-  static const e_float& A002445_807()
-  {
-    static const e_float val(static_cast<std::int32_t>(42L));
-    return val;
-  }
-
-  static const e_float& A002445_808()
-  {
-    static const e_float val(static_cast<std::int32_t>(412590L));
-    return val;
-  }
-
-  static const e_float& A002445_809()
-  {
-    static const e_float val(static_cast<std::int32_t>(9714L));
-    return val;
-  }
-
-  static const e_float& A002445_810()
-  {
-    static const e_float val("24743736851520275624910204330");
-    return val;
-  }
-
-  static const e_float& A002445_811()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_812()
-  {
-    static const e_float val(static_cast<std::int32_t>(11959890L));
-    return val;
-  }
-
-  static const e_float& A002445_813()
-  {
-    static const e_float val(static_cast<std::int32_t>(68334L));
-    return val;
-  }
-
-  static const e_float& A002445_814()
-  {
-    static const e_float val(static_cast<std::int32_t>(102810L));
-    return val;
-  }
-
-  static const e_float& A002445_815()
-  {
-    static const e_float val(static_cast<std::int32_t>(66L));
-    return val;
-  }
-
-  static const e_float& A002445_816()
-  {
-    static const e_float val(static_cast<std::int64_t>(25981510876230LL));
-    return val;
-  }
-
-  static const e_float& A002445_817()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_818()
-  {
-    static const e_float val(static_cast<std::int32_t>(49110L));
-    return val;
-  }
-
-  static const e_float& A002445_819()
-  {
-    static const e_float val(static_cast<std::int64_t>(188316982014LL));
-    return val;
-  }
-
-  static const e_float& A002445_820()
-  {
-    static const e_float val(static_cast<std::int32_t>(921974790L));
-    return val;
-  }
-
-  static const e_float& A002445_821()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_822()
-  {
-    static const e_float val(static_cast<std::int32_t>(2246790L));
-    return val;
-  }
-
-  static const e_float& A002445_823()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_824()
-  {
-    static const e_float val(static_cast<std::int32_t>(510L));
-    return val;
-  }
-
-  static const e_float& A002445_825()
-  {
-    static const e_float val(static_cast<std::int64_t>(1103090766162LL));
-    return val;
-  }
-
-  static const e_float& A002445_826()
-  {
-    static const e_float val(static_cast<std::int32_t>(719490L));
-    return val;
-  }
-
-  static const e_float& A002445_827()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_828()
-  {
-    static const e_float val("348265374941423358510");
-    return val;
-  }
-
-  static const e_float& A002445_829()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_830()
-  {
-    static const e_float val(static_cast<std::int32_t>(55110L));
-    return val;
-  }
-
-  static const e_float& A002445_831()
-  {
-    static const e_float val(static_cast<std::int32_t>(69846L));
-    return val;
-  }
-
-  static const e_float& A002445_832()
-  {
-    static const e_float val(static_cast<std::int32_t>(27030L));
-    return val;
-  }
-
-  static const e_float& A002445_833()
-  {
-    static const e_float val(static_cast<std::int32_t>(2390478L));
-    return val;
-  }
-
-  static const e_float& A002445_834()
-  {
-    static const e_float val(static_cast<std::int64_t>(2537898090LL));
-    return val;
-  }
-
-  static const e_float& A002445_835()
-  {
-    static const e_float val(static_cast<std::int32_t>(66L));
-    return val;
-  }
-
-  static const e_float& A002445_836()
-  {
-    static const e_float val(static_cast<std::int32_t>(25730790L));
-    return val;
-  }
-
-  static const e_float& A002445_837()
-  {
-    static const e_float val(static_cast<std::int32_t>(798L));
-    return val;
-  }
-
-  static const e_float& A002445_838()
-  {
-    static const e_float val(static_cast<std::int32_t>(25170L));
-    return val;
-  }
-
-  static const e_float& A002445_839()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_840()
-  {
-    static const e_float val("802787680649929796414310788070");
-    return val;
-  }
-
-  static const e_float& A002445_841()
-  {
-    static const e_float val(static_cast<std::int32_t>(354L));
-    return val;
-  }
-
-  static const e_float& A002445_842()
-  {
-    static const e_float val(static_cast<std::int32_t>(30L));
-    return val;
-  }
-
-  static const e_float& A002445_843()
-  {
-    static const e_float val(static_cast<std::int32_t>(23646L));
-    return val;
-  }
-
-  static const e_float& A002445_844()
-  {
-    static const e_float val(static_cast<std::int32_t>(30L));
-    return val;
-  }
-
-  static const e_float& A002445_845()
-  {
-    static const e_float val(static_cast<std::int32_t>(8646L));
-    return val;
-  }
-
-  static const e_float& A002445_846()
-  {
-    static const e_float val(static_cast<std::int64_t>(919520393610LL));
-    return val;
-  }
-
-  static const e_float& A002445_847()
-  {
-    static const e_float val(static_cast<std::int32_t>(138L));
-    return val;
-  }
-
-  static const e_float& A002445_848()
-  {
-    static const e_float val(static_cast<std::int32_t>(92605290L));
-    return val;
-  }
-
-  static const e_float& A002445_849()
-  {
-    static const e_float val(static_cast<std::int32_t>(71358L));
-    return val;
-  }
-
-  static const e_float& A002445_850()
-  {
-    static const e_float val(static_cast<std::int32_t>(33330L));
-    return val;
-  }
-
-  static const e_float& A002445_851()
-  {
-    static const e_float val(static_cast<std::int32_t>(282L));
-    return val;
-  }
-
-  static const e_float& A002445_852()
-  {
-    static const e_float val(static_cast<std::int32_t>(1325024610L));
-    return val;
-  }
-
-  static const e_float& A002445_853()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_854()
-  {
-    static const e_float val(static_cast<std::int32_t>(1486830L));
-    return val;
-  }
-
-  static const e_float& A002445_855()
-  {
-    static const e_float val(static_cast<std::int64_t>(29677461198LL));
-    return val;
-  }
-
-  static const e_float& A002445_856()
-  {
-    static const e_float val(static_cast<std::int32_t>(437070L));
-    return val;
-  }
-
-  static const e_float& A002445_857()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_858()
-  {
-    static const e_float val(static_cast<std::int64_t>(2375532972870330LL));
-    return val;
-  }
-
-  static const e_float& A002445_859()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_860()
-  {
-    static const e_float val(static_cast<std::int64_t>(1736209148190LL));
-    return val;
-  }
-
-  static const e_float& A002445_861()
-  {
-    static const e_float val(static_cast<std::int32_t>(258274254L));
-    return val;
-  }
-
-  static const e_float& A002445_862()
-  {
-    static const e_float val(static_cast<std::int32_t>(25890L));
-    return val;
-  }
-
-  static const e_float& A002445_863()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_864()
-  {
-    static const e_float val("1214252494343571301710");
-    return val;
-  }
-
-  static const e_float& A002445_865()
-  {
-    static const e_float val(static_cast<std::int32_t>(22902L));
-    return val;
-  }
-
-  static const e_float& A002445_866()
-  {
-    static const e_float val(static_cast<std::int32_t>(51990L));
-    return val;
-  }
-
-  static const e_float& A002445_867()
-  {
-    static const e_float val(static_cast<std::int32_t>(4326L));
-    return val;
-  }
-
-  static const e_float& A002445_868()
-  {
-    static const e_float val(static_cast<std::int32_t>(870L));
-    return val;
-  }
-
-  static const e_float& A002445_869()
-  {
-    static const e_float val(static_cast<std::int32_t>(138L));
-    return val;
-  }
-
-  static const e_float& A002445_870()
-  {
-    static const e_float val(static_cast<std::int64_t>(2035743565485630LL));
-    return val;
-  }
-
-  static const e_float& A002445_871()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_872()
-  {
-    static const e_float val(static_cast<std::int32_t>(510L));
-    return val;
-  }
-
-  static const e_float& A002445_873()
-  {
-    static const e_float val(static_cast<std::int32_t>(1394106L));
-    return val;
-  }
-
-  static const e_float& A002445_874()
-  {
-    static const e_float val(static_cast<std::int32_t>(1410L));
-    return val;
-  }
-
-  static const e_float& A002445_875()
-  {
-    static const e_float val(static_cast<std::int32_t>(1176186L));
-    return val;
-  }
-
-  static const e_float& A002445_876()
-  {
-    static const e_float val(static_cast<std::int64_t>(539853967071510LL));
-    return val;
-  }
-
-  static const e_float& A002445_877()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_878()
-  {
-    static const e_float val(static_cast<std::int32_t>(30L));
-    return val;
-  }
-
-  static const e_float& A002445_879()
-  {
-    static const e_float val(static_cast<std::int32_t>(43366386L));
-    return val;
-  }
-
-  static const e_float& A002445_880()
-  {
-    static const e_float val(static_cast<std::int64_t>(146424980356710LL));
-    return val;
-  }
-
-  static const e_float& A002445_881()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_882()
-  {
-    static const e_float val(static_cast<std::int64_t>(52870701923285610LL));
-    return val;
-  }
-
-  static const e_float& A002445_883()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_884()
-  {
-    static const e_float val(static_cast<std::int32_t>(96498690L));
-    return val;
-  }
-
-  static const e_float& A002445_885()
-  {
-    static const e_float val(static_cast<std::int32_t>(14322L));
-    return val;
-  }
-
-  static const e_float& A002445_886()
-  {
-    static const e_float val(static_cast<std::int32_t>(26610L));
-    return val;
-  }
-
-  static const e_float& A002445_887()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_888()
-  {
-    static const e_float val(static_cast<std::int64_t>(1624968030228270LL));
-    return val;
-  }
-
-  static const e_float& A002445_889()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_890()
-  {
-    static const e_float val(static_cast<std::int32_t>(59070L));
-    return val;
-  }
-
-  static const e_float& A002445_891()
-  {
-    static const e_float val(static_cast<std::int64_t>(71120950811778LL));
-    return val;
-  }
-
-  static const e_float& A002445_892()
-  {
-    static const e_float val(static_cast<std::int32_t>(30L));
-    return val;
-  }
-
-  static const e_float& A002445_893()
-  {
-    static const e_float val(static_cast<std::int32_t>(10722L));
-    return val;
-  }
-
-  static const e_float& A002445_894()
-  {
-    static const e_float val(static_cast<std::int32_t>(4883970L));
-    return val;
-  }
-
-  static const e_float& A002445_895()
-  {
-    static const e_float val(static_cast<std::int32_t>(23694L));
-    return val;
-  }
-
-  static const e_float& A002445_896()
-  {
-    static const e_float val(static_cast<std::int64_t>(192852859110LL));
-    return val;
-  }
-
-  static const e_float& A002445_897()
-  {
-    static const e_float val(static_cast<std::int64_t>(12984219906LL));
-    return val;
-  }
-
-  static const e_float& A002445_898()
-  {
-    static const e_float val(static_cast<std::int32_t>(30L));
-    return val;
-  }
-
-  static const e_float& A002445_899()
-  {
-    static const e_float val(static_cast<std::int32_t>(354L));
-    return val;
-  }
-
-  static const e_float& A002445_900()
-  {
-    static const e_float val("357004741097023204553137770");
-    return val;
-  }
-
-  static const e_float& A002445_901()
-  {
-    static const e_float val(static_cast<std::int32_t>(642L));
-    return val;
-  }
-
-  static const e_float& A002445_902()
-  {
-    static const e_float val(static_cast<std::int32_t>(57270L));
-    return val;
-  }
-
-  static const e_float& A002445_903()
-  {
-    static const e_float val(static_cast<std::int32_t>(1806L));
-    return val;
-  }
-
-  static const e_float& A002445_904()
-  {
-    static const e_float val(static_cast<std::int32_t>(115770L));
-    return val;
-  }
-
-  static const e_float& A002445_905()
-  {
-    static const e_float val(static_cast<std::int32_t>(119526L));
-    return val;
-  }
-
-  static const e_float& A002445_906()
-  {
-    static const e_float val(static_cast<std::int32_t>(2476110L));
-    return val;
-  }
-
-  static const e_float& A002445_907()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_908()
-  {
-    static const e_float val(static_cast<std::int32_t>(30L));
-    return val;
-  }
-
-  static const e_float& A002445_909()
-  {
-    static const e_float val(static_cast<std::int32_t>(484386L));
-    return val;
-  }
-
-  static const e_float& A002445_910()
-  {
-    static const e_float val(static_cast<std::int64_t>(4297697351310LL));
-    return val;
-  }
-
-  static const e_float& A002445_911()
-  {
-    static const e_float val(static_cast<std::int32_t>(10938L));
-    return val;
-  }
-
-  static const e_float& A002445_912()
-  {
-    static const e_float val(static_cast<std::int64_t>(471123735810LL));
-    return val;
-  }
-
-  static const e_float& A002445_913()
-  {
-    static const e_float val(static_cast<std::int32_t>(23046L));
-    return val;
-  }
-
-  static const e_float& A002445_914()
-  {
-    static const e_float val(static_cast<std::int32_t>(30L));
-    return val;
-  }
-
-  static const e_float& A002445_915()
-  {
-    static const e_float val(static_cast<std::int64_t>(9624054594LL));
-    return val;
-  }
-
-  static const e_float& A002445_916()
-  {
-    static const e_float val(static_cast<std::int32_t>(30L));
-    return val;
-  }
-
-  static const e_float& A002445_917()
-  {
-    static const e_float val(static_cast<std::int32_t>(1578L));
-    return val;
-  }
-
-  static const e_float& A002445_918()
-  {
-    static const e_float val(static_cast<std::int64_t>(3726456501173812770LL));
-    return val;
-  }
-
-  static const e_float& A002445_919()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_920()
-  {
-    static const e_float val(static_cast<std::int64_t>(4983626670LL));
-    return val;
-  }
-
-  static const e_float& A002445_921()
-  {
-    static const e_float val(static_cast<std::int32_t>(42L));
-    return val;
-  }
-
-  static const e_float& A002445_922()
-  {
-    static const e_float val(static_cast<std::int32_t>(30L));
-    return val;
-  }
-
-  static const e_float& A002445_923()
-  {
-    static const e_float val(static_cast<std::int32_t>(11082L));
-    return val;
-  }
-
-  static const e_float& A002445_924()
-  {
-    static const e_float val(static_cast<std::int64_t>(133379136339029490LL));
-    return val;
-  }
-
-  static const e_float& A002445_925()
-  {
-    static const e_float val(static_cast<std::int32_t>(66L));
-    return val;
-  }
-
-  static const e_float& A002445_926()
-  {
-    static const e_float val(static_cast<std::int32_t>(30L));
-    return val;
-  }
-
-  static const e_float& A002445_927()
-  {
-    static const e_float val(static_cast<std::int32_t>(493962L));
-    return val;
-  }
-
-  static const e_float& A002445_928()
-  {
-    static const e_float val(static_cast<std::int64_t>(6513191130LL));
-    return val;
-  }
-
-  static const e_float& A002445_929()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_930()
-  {
-    static const e_float val(static_cast<std::int64_t>(12259209165793590LL));
-    return val;
-  }
-
-  static const e_float& A002445_931()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_932()
-  {
-    static const e_float val(static_cast<std::int32_t>(14010L));
-    return val;
-  }
-
-  static const e_float& A002445_933()
-  {
-    static const e_float val(static_cast<std::int32_t>(78414L));
-    return val;
-  }
-
-  static const e_float& A002445_934()
-  {
-    static const e_float val(static_cast<std::int32_t>(30L));
-    return val;
-  }
-
-  static const e_float& A002445_935()
-  {
-    static const e_float val(static_cast<std::int32_t>(2840178L));
-    return val;
-  }
-
-  static const e_float& A002445_936()
-  {
-    static const e_float val("860030934465564643347930");
-    return val;
-  }
-
-  static const e_float& A002445_937()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_938()
-  {
-    static const e_float val(static_cast<std::int32_t>(439274310L));
-    return val;
-  }
-
-  static const e_float& A002445_939()
-  {
-    static const e_float val(static_cast<std::int32_t>(78918L));
-    return val;
-  }
-
-  static const e_float& A002445_940()
-  {
-    static const e_float val(static_cast<std::int32_t>(12731730L));
-    return val;
-  }
-
-  static const e_float& A002445_941()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_942()
-  {
-    static const e_float val(static_cast<std::int32_t>(2730L));
-    return val;
-  }
-
-  static const e_float& A002445_943()
-  {
-    static const e_float val(static_cast<std::int32_t>(23406L));
-    return val;
-  }
-
-  static const e_float& A002445_944()
-  {
-    static const e_float val(static_cast<std::int32_t>(963390L));
-    return val;
-  }
-
-  static const e_float& A002445_945()
-  {
-    static const e_float val("1442806569060262870002");
-    return val;
-  }
-
-  static const e_float& A002445_946()
-  {
-    static const e_float val(static_cast<std::int32_t>(113043390L));
-    return val;
-  }
-
-  static const e_float& A002445_947()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_948()
-  {
-    static const e_float val(static_cast<std::int32_t>(865410L));
-    return val;
-  }
-
-  static const e_float& A002445_949()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_950()
-  {
-    static const e_float val(static_cast<std::int64_t>(12101823030LL));
-    return val;
-  }
-
-  static const e_float& A002445_951()
-  {
-    static const e_float val(static_cast<std::int32_t>(42L));
-    return val;
-  }
-
-  static const e_float& A002445_952()
-  {
-    static const e_float val(static_cast<std::int64_t>(52150441110330LL));
-    return val;
-  }
-
-  static const e_float& A002445_953()
-  {
-    static const e_float val(static_cast<std::int32_t>(11442L));
-    return val;
-  }
-
-  static const e_float& A002445_954()
-  {
-    static const e_float val(static_cast<std::int32_t>(205353330L));
-    return val;
-  }
-
-  static const e_float& A002445_955()
-  {
-    static const e_float val(static_cast<std::int32_t>(25278L));
-    return val;
-  }
-
-  static const e_float& A002445_956()
-  {
-    static const e_float val(static_cast<std::int32_t>(27489810L));
-    return val;
-  }
-
-  static const e_float& A002445_957()
-  {
-    static const e_float val(static_cast<std::int32_t>(3818598L));
-    return val;
-  }
-
-  static const e_float& A002445_958()
-  {
-    static const e_float val(static_cast<std::int32_t>(30L));
-    return val;
-  }
-
-  static const e_float& A002445_959()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_960()
-  {
-    static const e_float val("114467910299711778810");
-    return val;
-  }
-
-  static const e_float& A002445_961()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_962()
-  {
-    static const e_float val(static_cast<std::int32_t>(236910L));
-    return val;
-  }
-
-  static const e_float& A002445_963()
-  {
-    static const e_float val(static_cast<std::int32_t>(513114L));
-    return val;
-  }
-
-  static const e_float& A002445_964()
-  {
-    static const e_float val(static_cast<std::int32_t>(30L));
-    return val;
-  }
-
-  static const e_float& A002445_965()
-  {
-    static const e_float val(static_cast<std::int32_t>(127446L));
-    return val;
-  }
-
-  static const e_float& A002445_966()
-  {
-    static const e_float val("11515421944774011810");
-    return val;
-  }
-
-  static const e_float& A002445_967()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_968()
-  {
-    static const e_float val(static_cast<std::int32_t>(1043970L));
-    return val;
-  }
-
-  static const e_float& A002445_969()
-  {
-    static const e_float val(static_cast<std::int32_t>(2798922L));
-    return val;
-  }
-
-  static const e_float& A002445_970()
-  {
-    static const e_float val(static_cast<std::int32_t>(124647270L));
-    return val;
-  }
-
-  static const e_float& A002445_971()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_972()
-  {
-    static const e_float val(static_cast<std::int64_t>(1212226840600230LL));
-    return val;
-  }
-
-  static const e_float& A002445_973()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_974()
-  {
-    static const e_float val(static_cast<std::int32_t>(58470L));
-    return val;
-  }
-
-  static const e_float& A002445_975()
-  {
-    static const e_float val(static_cast<std::int64_t>(43665282377178LL));
-    return val;
-  }
-
-  static const e_float& A002445_976()
-  {
-    static const e_float val(static_cast<std::int32_t>(498270L));
-    return val;
-  }
-
-  static const e_float& A002445_977()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_978()
-  {
-    static const e_float val(static_cast<std::int32_t>(1782690L));
-    return val;
-  }
-
-  static const e_float& A002445_979()
-  {
-    static const e_float val(static_cast<std::int32_t>(24702L));
-    return val;
-  }
-
-  static const e_float& A002445_980()
-  {
-    static const e_float val(static_cast<std::int64_t>(757195773923490LL));
-    return val;
-  }
-
-  static const e_float& A002445_981()
-  {
-    static const e_float val(static_cast<std::int32_t>(798L));
-    return val;
-  }
-
-  static const e_float& A002445_982()
-  {
-    static const e_float val(static_cast<std::int32_t>(29490L));
-    return val;
-  }
-
-  static const e_float& A002445_983()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_984()
-  {
-    static const e_float val(static_cast<std::int32_t>(3852030L));
-    return val;
-  }
-
-  static const e_float& A002445_985()
-  {
-    static const e_float val(static_cast<std::int32_t>(66L));
-    return val;
-  }
-
-  static const e_float& A002445_986()
-  {
-    static const e_float val(static_cast<std::int32_t>(3492210L));
-    return val;
-  }
-
-  static const e_float& A002445_987()
-  {
-    static const e_float val(static_cast<std::int32_t>(336813582L));
-    return val;
-  }
-
-  static const e_float& A002445_988()
-  {
-    static const e_float val(static_cast<std::int32_t>(1590L));
-    return val;
-  }
-
-  static const e_float& A002445_989()
-  {
-    static const e_float val(static_cast<std::int32_t>(558078L));
-    return val;
-  }
-
-  static const e_float& A002445_990()
-  {
-    static const e_float val("190734866876644507968532551570");
-    return val;
-  }
-
-  static const e_float& A002445_991()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_992()
-  {
-    static const e_float val(static_cast<std::int32_t>(510L));
-    return val;
-  }
-
-  static const e_float& A002445_993()
-  {
-    static const e_float val(static_cast<std::int32_t>(83454L));
-    return val;
-  }
-
-  static const e_float& A002445_994()
-  {
-    static const e_float val(static_cast<std::int32_t>(870L));
-    return val;
-  }
-
-  static const e_float& A002445_995()
-  {
-    static const e_float val(static_cast<std::int32_t>(66L));
-    return val;
-  }
-
-  static const e_float& A002445_996()
-  {
-    static const e_float val(static_cast<std::int64_t>(452045469310890LL));
-    return val;
-  }
-
-  static const e_float& A002445_997()
-  {
-    static const e_float val(static_cast<std::int32_t>(6L));
-    return val;
-  }
-
-  static const e_float& A002445_998()
-  {
-    static const e_float val(static_cast<std::int32_t>(59910L));
-    return val;
-  }
-
-  static const e_float& A002445_999()
-  {
-    static const e_float val(static_cast<std::int32_t>(355730046L));
-    return val;
-  }
-
-  static const e_float& A002445_1000()
-  {
-    static const e_float val(static_cast<std::int64_t>(2338224387510LL));
-    return val;
-  }
-
-}
-
-namespace Tables
+const Tables::integer_table& Tables::A002445()
 {
-  const std::vector<pfn_efloat>& A002445()
-  {
-    static const std::array<pfn_efloat, 1001U> A002445_data =
-    {{
-      A002445_Table::A002445_0,
-      A002445_Table::A002445_1,
-      A002445_Table::A002445_2,
-      A002445_Table::A002445_3,
-      A002445_Table::A002445_4,
-      A002445_Table::A002445_5,
-      A002445_Table::A002445_6,
-      A002445_Table::A002445_7,
-      A002445_Table::A002445_8,
-      A002445_Table::A002445_9,
-      A002445_Table::A002445_10,
-      A002445_Table::A002445_11,
-      A002445_Table::A002445_12,
-      A002445_Table::A002445_13,
-      A002445_Table::A002445_14,
-      A002445_Table::A002445_15,
-      A002445_Table::A002445_16,
-      A002445_Table::A002445_17,
-      A002445_Table::A002445_18,
-      A002445_Table::A002445_19,
-      A002445_Table::A002445_20,
-      A002445_Table::A002445_21,
-      A002445_Table::A002445_22,
-      A002445_Table::A002445_23,
-      A002445_Table::A002445_24,
-      A002445_Table::A002445_25,
-      A002445_Table::A002445_26,
-      A002445_Table::A002445_27,
-      A002445_Table::A002445_28,
-      A002445_Table::A002445_29,
-      A002445_Table::A002445_30,
-      A002445_Table::A002445_31,
-      A002445_Table::A002445_32,
-      A002445_Table::A002445_33,
-      A002445_Table::A002445_34,
-      A002445_Table::A002445_35,
-      A002445_Table::A002445_36,
-      A002445_Table::A002445_37,
-      A002445_Table::A002445_38,
-      A002445_Table::A002445_39,
-      A002445_Table::A002445_40,
-      A002445_Table::A002445_41,
-      A002445_Table::A002445_42,
-      A002445_Table::A002445_43,
-      A002445_Table::A002445_44,
-      A002445_Table::A002445_45,
-      A002445_Table::A002445_46,
-      A002445_Table::A002445_47,
-      A002445_Table::A002445_48,
-      A002445_Table::A002445_49,
-      A002445_Table::A002445_50,
-      A002445_Table::A002445_51,
-      A002445_Table::A002445_52,
-      A002445_Table::A002445_53,
-      A002445_Table::A002445_54,
-      A002445_Table::A002445_55,
-      A002445_Table::A002445_56,
-      A002445_Table::A002445_57,
-      A002445_Table::A002445_58,
-      A002445_Table::A002445_59,
-      A002445_Table::A002445_60,
-      A002445_Table::A002445_61,
-      A002445_Table::A002445_62,
-      A002445_Table::A002445_63,
-      A002445_Table::A002445_64,
-      A002445_Table::A002445_65,
-      A002445_Table::A002445_66,
-      A002445_Table::A002445_67,
-      A002445_Table::A002445_68,
-      A002445_Table::A002445_69,
-      A002445_Table::A002445_70,
-      A002445_Table::A002445_71,
-      A002445_Table::A002445_72,
-      A002445_Table::A002445_73,
-      A002445_Table::A002445_74,
-      A002445_Table::A002445_75,
-      A002445_Table::A002445_76,
-      A002445_Table::A002445_77,
-      A002445_Table::A002445_78,
-      A002445_Table::A002445_79,
-      A002445_Table::A002445_80,
-      A002445_Table::A002445_81,
-      A002445_Table::A002445_82,
-      A002445_Table::A002445_83,
-      A002445_Table::A002445_84,
-      A002445_Table::A002445_85,
-      A002445_Table::A002445_86,
-      A002445_Table::A002445_87,
-      A002445_Table::A002445_88,
-      A002445_Table::A002445_89,
-      A002445_Table::A002445_90,
-      A002445_Table::A002445_91,
-      A002445_Table::A002445_92,
-      A002445_Table::A002445_93,
-      A002445_Table::A002445_94,
-      A002445_Table::A002445_95,
-      A002445_Table::A002445_96,
-      A002445_Table::A002445_97,
-      A002445_Table::A002445_98,
-      A002445_Table::A002445_99,
-      A002445_Table::A002445_100,
-      A002445_Table::A002445_101,
-      A002445_Table::A002445_102,
-      A002445_Table::A002445_103,
-      A002445_Table::A002445_104,
-      A002445_Table::A002445_105,
-      A002445_Table::A002445_106,
-      A002445_Table::A002445_107,
-      A002445_Table::A002445_108,
-      A002445_Table::A002445_109,
-      A002445_Table::A002445_110,
-      A002445_Table::A002445_111,
-      A002445_Table::A002445_112,
-      A002445_Table::A002445_113,
-      A002445_Table::A002445_114,
-      A002445_Table::A002445_115,
-      A002445_Table::A002445_116,
-      A002445_Table::A002445_117,
-      A002445_Table::A002445_118,
-      A002445_Table::A002445_119,
-      A002445_Table::A002445_120,
-      A002445_Table::A002445_121,
-      A002445_Table::A002445_122,
-      A002445_Table::A002445_123,
-      A002445_Table::A002445_124,
-      A002445_Table::A002445_125,
-      A002445_Table::A002445_126,
-      A002445_Table::A002445_127,
-      A002445_Table::A002445_128,
-      A002445_Table::A002445_129,
-      A002445_Table::A002445_130,
-      A002445_Table::A002445_131,
-      A002445_Table::A002445_132,
-      A002445_Table::A002445_133,
-      A002445_Table::A002445_134,
-      A002445_Table::A002445_135,
-      A002445_Table::A002445_136,
-      A002445_Table::A002445_137,
-      A002445_Table::A002445_138,
-      A002445_Table::A002445_139,
-      A002445_Table::A002445_140,
-      A002445_Table::A002445_141,
-      A002445_Table::A002445_142,
-      A002445_Table::A002445_143,
-      A002445_Table::A002445_144,
-      A002445_Table::A002445_145,
-      A002445_Table::A002445_146,
-      A002445_Table::A002445_147,
-      A002445_Table::A002445_148,
-      A002445_Table::A002445_149,
-      A002445_Table::A002445_150,
-      A002445_Table::A002445_151,
-      A002445_Table::A002445_152,
-      A002445_Table::A002445_153,
-      A002445_Table::A002445_154,
-      A002445_Table::A002445_155,
-      A002445_Table::A002445_156,
-      A002445_Table::A002445_157,
-      A002445_Table::A002445_158,
-      A002445_Table::A002445_159,
-      A002445_Table::A002445_160,
-      A002445_Table::A002445_161,
-      A002445_Table::A002445_162,
-      A002445_Table::A002445_163,
-      A002445_Table::A002445_164,
-      A002445_Table::A002445_165,
-      A002445_Table::A002445_166,
-      A002445_Table::A002445_167,
-      A002445_Table::A002445_168,
-      A002445_Table::A002445_169,
-      A002445_Table::A002445_170,
-      A002445_Table::A002445_171,
-      A002445_Table::A002445_172,
-      A002445_Table::A002445_173,
-      A002445_Table::A002445_174,
-      A002445_Table::A002445_175,
-      A002445_Table::A002445_176,
-      A002445_Table::A002445_177,
-      A002445_Table::A002445_178,
-      A002445_Table::A002445_179,
-      A002445_Table::A002445_180,
-      A002445_Table::A002445_181,
-      A002445_Table::A002445_182,
-      A002445_Table::A002445_183,
-      A002445_Table::A002445_184,
-      A002445_Table::A002445_185,
-      A002445_Table::A002445_186,
-      A002445_Table::A002445_187,
-      A002445_Table::A002445_188,
-      A002445_Table::A002445_189,
-      A002445_Table::A002445_190,
-      A002445_Table::A002445_191,
-      A002445_Table::A002445_192,
-      A002445_Table::A002445_193,
-      A002445_Table::A002445_194,
-      A002445_Table::A002445_195,
-      A002445_Table::A002445_196,
-      A002445_Table::A002445_197,
-      A002445_Table::A002445_198,
-      A002445_Table::A002445_199,
-      A002445_Table::A002445_200,
-      A002445_Table::A002445_201,
-      A002445_Table::A002445_202,
-      A002445_Table::A002445_203,
-      A002445_Table::A002445_204,
-      A002445_Table::A002445_205,
-      A002445_Table::A002445_206,
-      A002445_Table::A002445_207,
-      A002445_Table::A002445_208,
-      A002445_Table::A002445_209,
-      A002445_Table::A002445_210,
-      A002445_Table::A002445_211,
-      A002445_Table::A002445_212,
-      A002445_Table::A002445_213,
-      A002445_Table::A002445_214,
-      A002445_Table::A002445_215,
-      A002445_Table::A002445_216,
-      A002445_Table::A002445_217,
-      A002445_Table::A002445_218,
-      A002445_Table::A002445_219,
-      A002445_Table::A002445_220,
-      A002445_Table::A002445_221,
-      A002445_Table::A002445_222,
-      A002445_Table::A002445_223,
-      A002445_Table::A002445_224,
-      A002445_Table::A002445_225,
-      A002445_Table::A002445_226,
-      A002445_Table::A002445_227,
-      A002445_Table::A002445_228,
-      A002445_Table::A002445_229,
-      A002445_Table::A002445_230,
-      A002445_Table::A002445_231,
-      A002445_Table::A002445_232,
-      A002445_Table::A002445_233,
-      A002445_Table::A002445_234,
-      A002445_Table::A002445_235,
-      A002445_Table::A002445_236,
-      A002445_Table::A002445_237,
-      A002445_Table::A002445_238,
-      A002445_Table::A002445_239,
-      A002445_Table::A002445_240,
-      A002445_Table::A002445_241,
-      A002445_Table::A002445_242,
-      A002445_Table::A002445_243,
-      A002445_Table::A002445_244,
-      A002445_Table::A002445_245,
-      A002445_Table::A002445_246,
-      A002445_Table::A002445_247,
-      A002445_Table::A002445_248,
-      A002445_Table::A002445_249,
-      A002445_Table::A002445_250,
-      A002445_Table::A002445_251,
-      A002445_Table::A002445_252,
-      A002445_Table::A002445_253,
-      A002445_Table::A002445_254,
-      A002445_Table::A002445_255,
-      A002445_Table::A002445_256,
-      A002445_Table::A002445_257,
-      A002445_Table::A002445_258,
-      A002445_Table::A002445_259,
-      A002445_Table::A002445_260,
-      A002445_Table::A002445_261,
-      A002445_Table::A002445_262,
-      A002445_Table::A002445_263,
-      A002445_Table::A002445_264,
-      A002445_Table::A002445_265,
-      A002445_Table::A002445_266,
-      A002445_Table::A002445_267,
-      A002445_Table::A002445_268,
-      A002445_Table::A002445_269,
-      A002445_Table::A002445_270,
-      A002445_Table::A002445_271,
-      A002445_Table::A002445_272,
-      A002445_Table::A002445_273,
-      A002445_Table::A002445_274,
-      A002445_Table::A002445_275,
-      A002445_Table::A002445_276,
-      A002445_Table::A002445_277,
-      A002445_Table::A002445_278,
-      A002445_Table::A002445_279,
-      A002445_Table::A002445_280,
-      A002445_Table::A002445_281,
-      A002445_Table::A002445_282,
-      A002445_Table::A002445_283,
-      A002445_Table::A002445_284,
-      A002445_Table::A002445_285,
-      A002445_Table::A002445_286,
-      A002445_Table::A002445_287,
-      A002445_Table::A002445_288,
-      A002445_Table::A002445_289,
-      A002445_Table::A002445_290,
-      A002445_Table::A002445_291,
-      A002445_Table::A002445_292,
-      A002445_Table::A002445_293,
-      A002445_Table::A002445_294,
-      A002445_Table::A002445_295,
-      A002445_Table::A002445_296,
-      A002445_Table::A002445_297,
-      A002445_Table::A002445_298,
-      A002445_Table::A002445_299,
-      A002445_Table::A002445_300,
-      A002445_Table::A002445_301,
-      A002445_Table::A002445_302,
-      A002445_Table::A002445_303,
-      A002445_Table::A002445_304,
-      A002445_Table::A002445_305,
-      A002445_Table::A002445_306,
-      A002445_Table::A002445_307,
-      A002445_Table::A002445_308,
-      A002445_Table::A002445_309,
-      A002445_Table::A002445_310,
-      A002445_Table::A002445_311,
-      A002445_Table::A002445_312,
-      A002445_Table::A002445_313,
-      A002445_Table::A002445_314,
-      A002445_Table::A002445_315,
-      A002445_Table::A002445_316,
-      A002445_Table::A002445_317,
-      A002445_Table::A002445_318,
-      A002445_Table::A002445_319,
-      A002445_Table::A002445_320,
-      A002445_Table::A002445_321,
-      A002445_Table::A002445_322,
-      A002445_Table::A002445_323,
-      A002445_Table::A002445_324,
-      A002445_Table::A002445_325,
-      A002445_Table::A002445_326,
-      A002445_Table::A002445_327,
-      A002445_Table::A002445_328,
-      A002445_Table::A002445_329,
-      A002445_Table::A002445_330,
-      A002445_Table::A002445_331,
-      A002445_Table::A002445_332,
-      A002445_Table::A002445_333,
-      A002445_Table::A002445_334,
-      A002445_Table::A002445_335,
-      A002445_Table::A002445_336,
-      A002445_Table::A002445_337,
-      A002445_Table::A002445_338,
-      A002445_Table::A002445_339,
-      A002445_Table::A002445_340,
-      A002445_Table::A002445_341,
-      A002445_Table::A002445_342,
-      A002445_Table::A002445_343,
-      A002445_Table::A002445_344,
-      A002445_Table::A002445_345,
-      A002445_Table::A002445_346,
-      A002445_Table::A002445_347,
-      A002445_Table::A002445_348,
-      A002445_Table::A002445_349,
-      A002445_Table::A002445_350,
-      A002445_Table::A002445_351,
-      A002445_Table::A002445_352,
-      A002445_Table::A002445_353,
-      A002445_Table::A002445_354,
-      A002445_Table::A002445_355,
-      A002445_Table::A002445_356,
-      A002445_Table::A002445_357,
-      A002445_Table::A002445_358,
-      A002445_Table::A002445_359,
-      A002445_Table::A002445_360,
-      A002445_Table::A002445_361,
-      A002445_Table::A002445_362,
-      A002445_Table::A002445_363,
-      A002445_Table::A002445_364,
-      A002445_Table::A002445_365,
-      A002445_Table::A002445_366,
-      A002445_Table::A002445_367,
-      A002445_Table::A002445_368,
-      A002445_Table::A002445_369,
-      A002445_Table::A002445_370,
-      A002445_Table::A002445_371,
-      A002445_Table::A002445_372,
-      A002445_Table::A002445_373,
-      A002445_Table::A002445_374,
-      A002445_Table::A002445_375,
-      A002445_Table::A002445_376,
-      A002445_Table::A002445_377,
-      A002445_Table::A002445_378,
-      A002445_Table::A002445_379,
-      A002445_Table::A002445_380,
-      A002445_Table::A002445_381,
-      A002445_Table::A002445_382,
-      A002445_Table::A002445_383,
-      A002445_Table::A002445_384,
-      A002445_Table::A002445_385,
-      A002445_Table::A002445_386,
-      A002445_Table::A002445_387,
-      A002445_Table::A002445_388,
-      A002445_Table::A002445_389,
-      A002445_Table::A002445_390,
-      A002445_Table::A002445_391,
-      A002445_Table::A002445_392,
-      A002445_Table::A002445_393,
-      A002445_Table::A002445_394,
-      A002445_Table::A002445_395,
-      A002445_Table::A002445_396,
-      A002445_Table::A002445_397,
-      A002445_Table::A002445_398,
-      A002445_Table::A002445_399,
-      A002445_Table::A002445_400,
-      A002445_Table::A002445_401,
-      A002445_Table::A002445_402,
-      A002445_Table::A002445_403,
-      A002445_Table::A002445_404,
-      A002445_Table::A002445_405,
-      A002445_Table::A002445_406,
-      A002445_Table::A002445_407,
-      A002445_Table::A002445_408,
-      A002445_Table::A002445_409,
-      A002445_Table::A002445_410,
-      A002445_Table::A002445_411,
-      A002445_Table::A002445_412,
-      A002445_Table::A002445_413,
-      A002445_Table::A002445_414,
-      A002445_Table::A002445_415,
-      A002445_Table::A002445_416,
-      A002445_Table::A002445_417,
-      A002445_Table::A002445_418,
-      A002445_Table::A002445_419,
-      A002445_Table::A002445_420,
-      A002445_Table::A002445_421,
-      A002445_Table::A002445_422,
-      A002445_Table::A002445_423,
-      A002445_Table::A002445_424,
-      A002445_Table::A002445_425,
-      A002445_Table::A002445_426,
-      A002445_Table::A002445_427,
-      A002445_Table::A002445_428,
-      A002445_Table::A002445_429,
-      A002445_Table::A002445_430,
-      A002445_Table::A002445_431,
-      A002445_Table::A002445_432,
-      A002445_Table::A002445_433,
-      A002445_Table::A002445_434,
-      A002445_Table::A002445_435,
-      A002445_Table::A002445_436,
-      A002445_Table::A002445_437,
-      A002445_Table::A002445_438,
-      A002445_Table::A002445_439,
-      A002445_Table::A002445_440,
-      A002445_Table::A002445_441,
-      A002445_Table::A002445_442,
-      A002445_Table::A002445_443,
-      A002445_Table::A002445_444,
-      A002445_Table::A002445_445,
-      A002445_Table::A002445_446,
-      A002445_Table::A002445_447,
-      A002445_Table::A002445_448,
-      A002445_Table::A002445_449,
-      A002445_Table::A002445_450,
-      A002445_Table::A002445_451,
-      A002445_Table::A002445_452,
-      A002445_Table::A002445_453,
-      A002445_Table::A002445_454,
-      A002445_Table::A002445_455,
-      A002445_Table::A002445_456,
-      A002445_Table::A002445_457,
-      A002445_Table::A002445_458,
-      A002445_Table::A002445_459,
-      A002445_Table::A002445_460,
-      A002445_Table::A002445_461,
-      A002445_Table::A002445_462,
-      A002445_Table::A002445_463,
-      A002445_Table::A002445_464,
-      A002445_Table::A002445_465,
-      A002445_Table::A002445_466,
-      A002445_Table::A002445_467,
-      A002445_Table::A002445_468,
-      A002445_Table::A002445_469,
-      A002445_Table::A002445_470,
-      A002445_Table::A002445_471,
-      A002445_Table::A002445_472,
-      A002445_Table::A002445_473,
-      A002445_Table::A002445_474,
-      A002445_Table::A002445_475,
-      A002445_Table::A002445_476,
-      A002445_Table::A002445_477,
-      A002445_Table::A002445_478,
-      A002445_Table::A002445_479,
-      A002445_Table::A002445_480,
-      A002445_Table::A002445_481,
-      A002445_Table::A002445_482,
-      A002445_Table::A002445_483,
-      A002445_Table::A002445_484,
-      A002445_Table::A002445_485,
-      A002445_Table::A002445_486,
-      A002445_Table::A002445_487,
-      A002445_Table::A002445_488,
-      A002445_Table::A002445_489,
-      A002445_Table::A002445_490,
-      A002445_Table::A002445_491,
-      A002445_Table::A002445_492,
-      A002445_Table::A002445_493,
-      A002445_Table::A002445_494,
-      A002445_Table::A002445_495,
-      A002445_Table::A002445_496,
-      A002445_Table::A002445_497,
-      A002445_Table::A002445_498,
-      A002445_Table::A002445_499,
-      A002445_Table::A002445_500,
-      A002445_Table::A002445_501,
-      A002445_Table::A002445_502,
-      A002445_Table::A002445_503,
-      A002445_Table::A002445_504,
-      A002445_Table::A002445_505,
-      A002445_Table::A002445_506,
-      A002445_Table::A002445_507,
-      A002445_Table::A002445_508,
-      A002445_Table::A002445_509,
-      A002445_Table::A002445_510,
-      A002445_Table::A002445_511,
-      A002445_Table::A002445_512,
-      A002445_Table::A002445_513,
-      A002445_Table::A002445_514,
-      A002445_Table::A002445_515,
-      A002445_Table::A002445_516,
-      A002445_Table::A002445_517,
-      A002445_Table::A002445_518,
-      A002445_Table::A002445_519,
-      A002445_Table::A002445_520,
-      A002445_Table::A002445_521,
-      A002445_Table::A002445_522,
-      A002445_Table::A002445_523,
-      A002445_Table::A002445_524,
-      A002445_Table::A002445_525,
-      A002445_Table::A002445_526,
-      A002445_Table::A002445_527,
-      A002445_Table::A002445_528,
-      A002445_Table::A002445_529,
-      A002445_Table::A002445_530,
-      A002445_Table::A002445_531,
-      A002445_Table::A002445_532,
-      A002445_Table::A002445_533,
-      A002445_Table::A002445_534,
-      A002445_Table::A002445_535,
-      A002445_Table::A002445_536,
-      A002445_Table::A002445_537,
-      A002445_Table::A002445_538,
-      A002445_Table::A002445_539,
-      A002445_Table::A002445_540,
-      A002445_Table::A002445_541,
-      A002445_Table::A002445_542,
-      A002445_Table::A002445_543,
-      A002445_Table::A002445_544,
-      A002445_Table::A002445_545,
-      A002445_Table::A002445_546,
-      A002445_Table::A002445_547,
-      A002445_Table::A002445_548,
-      A002445_Table::A002445_549,
-      A002445_Table::A002445_550,
-      A002445_Table::A002445_551,
-      A002445_Table::A002445_552,
-      A002445_Table::A002445_553,
-      A002445_Table::A002445_554,
-      A002445_Table::A002445_555,
-      A002445_Table::A002445_556,
-      A002445_Table::A002445_557,
-      A002445_Table::A002445_558,
-      A002445_Table::A002445_559,
-      A002445_Table::A002445_560,
-      A002445_Table::A002445_561,
-      A002445_Table::A002445_562,
-      A002445_Table::A002445_563,
-      A002445_Table::A002445_564,
-      A002445_Table::A002445_565,
-      A002445_Table::A002445_566,
-      A002445_Table::A002445_567,
-      A002445_Table::A002445_568,
-      A002445_Table::A002445_569,
-      A002445_Table::A002445_570,
-      A002445_Table::A002445_571,
-      A002445_Table::A002445_572,
-      A002445_Table::A002445_573,
-      A002445_Table::A002445_574,
-      A002445_Table::A002445_575,
-      A002445_Table::A002445_576,
-      A002445_Table::A002445_577,
-      A002445_Table::A002445_578,
-      A002445_Table::A002445_579,
-      A002445_Table::A002445_580,
-      A002445_Table::A002445_581,
-      A002445_Table::A002445_582,
-      A002445_Table::A002445_583,
-      A002445_Table::A002445_584,
-      A002445_Table::A002445_585,
-      A002445_Table::A002445_586,
-      A002445_Table::A002445_587,
-      A002445_Table::A002445_588,
-      A002445_Table::A002445_589,
-      A002445_Table::A002445_590,
-      A002445_Table::A002445_591,
-      A002445_Table::A002445_592,
-      A002445_Table::A002445_593,
-      A002445_Table::A002445_594,
-      A002445_Table::A002445_595,
-      A002445_Table::A002445_596,
-      A002445_Table::A002445_597,
-      A002445_Table::A002445_598,
-      A002445_Table::A002445_599,
-      A002445_Table::A002445_600,
-      A002445_Table::A002445_601,
-      A002445_Table::A002445_602,
-      A002445_Table::A002445_603,
-      A002445_Table::A002445_604,
-      A002445_Table::A002445_605,
-      A002445_Table::A002445_606,
-      A002445_Table::A002445_607,
-      A002445_Table::A002445_608,
-      A002445_Table::A002445_609,
-      A002445_Table::A002445_610,
-      A002445_Table::A002445_611,
-      A002445_Table::A002445_612,
-      A002445_Table::A002445_613,
-      A002445_Table::A002445_614,
-      A002445_Table::A002445_615,
-      A002445_Table::A002445_616,
-      A002445_Table::A002445_617,
-      A002445_Table::A002445_618,
-      A002445_Table::A002445_619,
-      A002445_Table::A002445_620,
-      A002445_Table::A002445_621,
-      A002445_Table::A002445_622,
-      A002445_Table::A002445_623,
-      A002445_Table::A002445_624,
-      A002445_Table::A002445_625,
-      A002445_Table::A002445_626,
-      A002445_Table::A002445_627,
-      A002445_Table::A002445_628,
-      A002445_Table::A002445_629,
-      A002445_Table::A002445_630,
-      A002445_Table::A002445_631,
-      A002445_Table::A002445_632,
-      A002445_Table::A002445_633,
-      A002445_Table::A002445_634,
-      A002445_Table::A002445_635,
-      A002445_Table::A002445_636,
-      A002445_Table::A002445_637,
-      A002445_Table::A002445_638,
-      A002445_Table::A002445_639,
-      A002445_Table::A002445_640,
-      A002445_Table::A002445_641,
-      A002445_Table::A002445_642,
-      A002445_Table::A002445_643,
-      A002445_Table::A002445_644,
-      A002445_Table::A002445_645,
-      A002445_Table::A002445_646,
-      A002445_Table::A002445_647,
-      A002445_Table::A002445_648,
-      A002445_Table::A002445_649,
-      A002445_Table::A002445_650,
-      A002445_Table::A002445_651,
-      A002445_Table::A002445_652,
-      A002445_Table::A002445_653,
-      A002445_Table::A002445_654,
-      A002445_Table::A002445_655,
-      A002445_Table::A002445_656,
-      A002445_Table::A002445_657,
-      A002445_Table::A002445_658,
-      A002445_Table::A002445_659,
-      A002445_Table::A002445_660,
-      A002445_Table::A002445_661,
-      A002445_Table::A002445_662,
-      A002445_Table::A002445_663,
-      A002445_Table::A002445_664,
-      A002445_Table::A002445_665,
-      A002445_Table::A002445_666,
-      A002445_Table::A002445_667,
-      A002445_Table::A002445_668,
-      A002445_Table::A002445_669,
-      A002445_Table::A002445_670,
-      A002445_Table::A002445_671,
-      A002445_Table::A002445_672,
-      A002445_Table::A002445_673,
-      A002445_Table::A002445_674,
-      A002445_Table::A002445_675,
-      A002445_Table::A002445_676,
-      A002445_Table::A002445_677,
-      A002445_Table::A002445_678,
-      A002445_Table::A002445_679,
-      A002445_Table::A002445_680,
-      A002445_Table::A002445_681,
-      A002445_Table::A002445_682,
-      A002445_Table::A002445_683,
-      A002445_Table::A002445_684,
-      A002445_Table::A002445_685,
-      A002445_Table::A002445_686,
-      A002445_Table::A002445_687,
-      A002445_Table::A002445_688,
-      A002445_Table::A002445_689,
-      A002445_Table::A002445_690,
-      A002445_Table::A002445_691,
-      A002445_Table::A002445_692,
-      A002445_Table::A002445_693,
-      A002445_Table::A002445_694,
-      A002445_Table::A002445_695,
-      A002445_Table::A002445_696,
-      A002445_Table::A002445_697,
-      A002445_Table::A002445_698,
-      A002445_Table::A002445_699,
-      A002445_Table::A002445_700,
-      A002445_Table::A002445_701,
-      A002445_Table::A002445_702,
-      A002445_Table::A002445_703,
-      A002445_Table::A002445_704,
-      A002445_Table::A002445_705,
-      A002445_Table::A002445_706,
-      A002445_Table::A002445_707,
-      A002445_Table::A002445_708,
-      A002445_Table::A002445_709,
-      A002445_Table::A002445_710,
-      A002445_Table::A002445_711,
-      A002445_Table::A002445_712,
-      A002445_Table::A002445_713,
-      A002445_Table::A002445_714,
-      A002445_Table::A002445_715,
-      A002445_Table::A002445_716,
-      A002445_Table::A002445_717,
-      A002445_Table::A002445_718,
-      A002445_Table::A002445_719,
-      A002445_Table::A002445_720,
-      A002445_Table::A002445_721,
-      A002445_Table::A002445_722,
-      A002445_Table::A002445_723,
-      A002445_Table::A002445_724,
-      A002445_Table::A002445_725,
-      A002445_Table::A002445_726,
-      A002445_Table::A002445_727,
-      A002445_Table::A002445_728,
-      A002445_Table::A002445_729,
-      A002445_Table::A002445_730,
-      A002445_Table::A002445_731,
-      A002445_Table::A002445_732,
-      A002445_Table::A002445_733,
-      A002445_Table::A002445_734,
-      A002445_Table::A002445_735,
-      A002445_Table::A002445_736,
-      A002445_Table::A002445_737,
-      A002445_Table::A002445_738,
-      A002445_Table::A002445_739,
-      A002445_Table::A002445_740,
-      A002445_Table::A002445_741,
-      A002445_Table::A002445_742,
-      A002445_Table::A002445_743,
-      A002445_Table::A002445_744,
-      A002445_Table::A002445_745,
-      A002445_Table::A002445_746,
-      A002445_Table::A002445_747,
-      A002445_Table::A002445_748,
-      A002445_Table::A002445_749,
-      A002445_Table::A002445_750,
-      A002445_Table::A002445_751,
-      A002445_Table::A002445_752,
-      A002445_Table::A002445_753,
-      A002445_Table::A002445_754,
-      A002445_Table::A002445_755,
-      A002445_Table::A002445_756,
-      A002445_Table::A002445_757,
-      A002445_Table::A002445_758,
-      A002445_Table::A002445_759,
-      A002445_Table::A002445_760,
-      A002445_Table::A002445_761,
-      A002445_Table::A002445_762,
-      A002445_Table::A002445_763,
-      A002445_Table::A002445_764,
-      A002445_Table::A002445_765,
-      A002445_Table::A002445_766,
-      A002445_Table::A002445_767,
-      A002445_Table::A002445_768,
-      A002445_Table::A002445_769,
-      A002445_Table::A002445_770,
-      A002445_Table::A002445_771,
-      A002445_Table::A002445_772,
-      A002445_Table::A002445_773,
-      A002445_Table::A002445_774,
-      A002445_Table::A002445_775,
-      A002445_Table::A002445_776,
-      A002445_Table::A002445_777,
-      A002445_Table::A002445_778,
-      A002445_Table::A002445_779,
-      A002445_Table::A002445_780,
-      A002445_Table::A002445_781,
-      A002445_Table::A002445_782,
-      A002445_Table::A002445_783,
-      A002445_Table::A002445_784,
-      A002445_Table::A002445_785,
-      A002445_Table::A002445_786,
-      A002445_Table::A002445_787,
-      A002445_Table::A002445_788,
-      A002445_Table::A002445_789,
-      A002445_Table::A002445_790,
-      A002445_Table::A002445_791,
-      A002445_Table::A002445_792,
-      A002445_Table::A002445_793,
-      A002445_Table::A002445_794,
-      A002445_Table::A002445_795,
-      A002445_Table::A002445_796,
-      A002445_Table::A002445_797,
-      A002445_Table::A002445_798,
-      A002445_Table::A002445_799,
-      A002445_Table::A002445_800,
-      A002445_Table::A002445_801,
-      A002445_Table::A002445_802,
-      A002445_Table::A002445_803,
-      A002445_Table::A002445_804,
-      A002445_Table::A002445_805,
-      A002445_Table::A002445_806,
-      A002445_Table::A002445_807,
-      A002445_Table::A002445_808,
-      A002445_Table::A002445_809,
-      A002445_Table::A002445_810,
-      A002445_Table::A002445_811,
-      A002445_Table::A002445_812,
-      A002445_Table::A002445_813,
-      A002445_Table::A002445_814,
-      A002445_Table::A002445_815,
-      A002445_Table::A002445_816,
-      A002445_Table::A002445_817,
-      A002445_Table::A002445_818,
-      A002445_Table::A002445_819,
-      A002445_Table::A002445_820,
-      A002445_Table::A002445_821,
-      A002445_Table::A002445_822,
-      A002445_Table::A002445_823,
-      A002445_Table::A002445_824,
-      A002445_Table::A002445_825,
-      A002445_Table::A002445_826,
-      A002445_Table::A002445_827,
-      A002445_Table::A002445_828,
-      A002445_Table::A002445_829,
-      A002445_Table::A002445_830,
-      A002445_Table::A002445_831,
-      A002445_Table::A002445_832,
-      A002445_Table::A002445_833,
-      A002445_Table::A002445_834,
-      A002445_Table::A002445_835,
-      A002445_Table::A002445_836,
-      A002445_Table::A002445_837,
-      A002445_Table::A002445_838,
-      A002445_Table::A002445_839,
-      A002445_Table::A002445_840,
-      A002445_Table::A002445_841,
-      A002445_Table::A002445_842,
-      A002445_Table::A002445_843,
-      A002445_Table::A002445_844,
-      A002445_Table::A002445_845,
-      A002445_Table::A002445_846,
-      A002445_Table::A002445_847,
-      A002445_Table::A002445_848,
-      A002445_Table::A002445_849,
-      A002445_Table::A002445_850,
-      A002445_Table::A002445_851,
-      A002445_Table::A002445_852,
-      A002445_Table::A002445_853,
-      A002445_Table::A002445_854,
-      A002445_Table::A002445_855,
-      A002445_Table::A002445_856,
-      A002445_Table::A002445_857,
-      A002445_Table::A002445_858,
-      A002445_Table::A002445_859,
-      A002445_Table::A002445_860,
-      A002445_Table::A002445_861,
-      A002445_Table::A002445_862,
-      A002445_Table::A002445_863,
-      A002445_Table::A002445_864,
-      A002445_Table::A002445_865,
-      A002445_Table::A002445_866,
-      A002445_Table::A002445_867,
-      A002445_Table::A002445_868,
-      A002445_Table::A002445_869,
-      A002445_Table::A002445_870,
-      A002445_Table::A002445_871,
-      A002445_Table::A002445_872,
-      A002445_Table::A002445_873,
-      A002445_Table::A002445_874,
-      A002445_Table::A002445_875,
-      A002445_Table::A002445_876,
-      A002445_Table::A002445_877,
-      A002445_Table::A002445_878,
-      A002445_Table::A002445_879,
-      A002445_Table::A002445_880,
-      A002445_Table::A002445_881,
-      A002445_Table::A002445_882,
-      A002445_Table::A002445_883,
-      A002445_Table::A002445_884,
-      A002445_Table::A002445_885,
-      A002445_Table::A002445_886,
-      A002445_Table::A002445_887,
-      A002445_Table::A002445_888,
-      A002445_Table::A002445_889,
-      A002445_Table::A002445_890,
-      A002445_Table::A002445_891,
-      A002445_Table::A002445_892,
-      A002445_Table::A002445_893,
-      A002445_Table::A002445_894,
-      A002445_Table::A002445_895,
-      A002445_Table::A002445_896,
-      A002445_Table::A002445_897,
-      A002445_Table::A002445_898,
-      A002445_Table::A002445_899,
-      A002445_Table::A002445_900,
-      A002445_Table::A002445_901,
-      A002445_Table::A002445_902,
-      A002445_Table::A002445_903,
-      A002445_Table::A002445_904,
-      A002445_Table::A002445_905,
-      A002445_Table::A002445_906,
-      A002445_Table::A002445_907,
-      A002445_Table::A002445_908,
-      A002445_Table::A002445_909,
-      A002445_Table::A002445_910,
-      A002445_Table::A002445_911,
-      A002445_Table::A002445_912,
-      A002445_Table::A002445_913,
-      A002445_Table::A002445_914,
-      A002445_Table::A002445_915,
-      A002445_Table::A002445_916,
-      A002445_Table::A002445_917,
-      A002445_Table::A002445_918,
-      A002445_Table::A002445_919,
-      A002445_Table::A002445_920,
-      A002445_Table::A002445_921,
-      A002445_Table::A002445_922,
-      A002445_Table::A002445_923,
-      A002445_Table::A002445_924,
-      A002445_Table::A002445_925,
-      A002445_Table::A002445_926,
-      A002445_Table::A002445_927,
-      A002445_Table::A002445_928,
-      A002445_Table::A002445_929,
-      A002445_Table::A002445_930,
-      A002445_Table::A002445_931,
-      A002445_Table::A002445_932,
-      A002445_Table::A002445_933,
-      A002445_Table::A002445_934,
-      A002445_Table::A002445_935,
-      A002445_Table::A002445_936,
-      A002445_Table::A002445_937,
-      A002445_Table::A002445_938,
-      A002445_Table::A002445_939,
-      A002445_Table::A002445_940,
-      A002445_Table::A002445_941,
-      A002445_Table::A002445_942,
-      A002445_Table::A002445_943,
-      A002445_Table::A002445_944,
-      A002445_Table::A002445_945,
-      A002445_Table::A002445_946,
-      A002445_Table::A002445_947,
-      A002445_Table::A002445_948,
-      A002445_Table::A002445_949,
-      A002445_Table::A002445_950,
-      A002445_Table::A002445_951,
-      A002445_Table::A002445_952,
-      A002445_Table::A002445_953,
-      A002445_Table::A002445_954,
-      A002445_Table::A002445_955,
-      A002445_Table::A002445_956,
-      A002445_Table::A002445_957,
-      A002445_Table::A002445_958,
-      A002445_Table::A002445_959,
-      A002445_Table::A002445_960,
-      A002445_Table::A002445_961,
-      A002445_Table::A002445_962,
-      A002445_Table::A002445_963,
-      A002445_Table::A002445_964,
-      A002445_Table::A002445_965,
-      A002445_Table::A002445_966,
-      A002445_Table::A002445_967,
-      A002445_Table::A002445_968,
-      A002445_Table::A002445_969,
-      A002445_Table::A002445_970,
-      A002445_Table::A002445_971,
-      A002445_Table::A002445_972,
-      A002445_Table::A002445_973,
-      A002445_Table::A002445_974,
-      A002445_Table::A002445_975,
-      A002445_Table::A002445_976,
-      A002445_Table::A002445_977,
-      A002445_Table::A002445_978,
-      A002445_Table::A002445_979,
-      A002445_Table::A002445_980,
-      A002445_Table::A002445_981,
-      A002445_Table::A002445_982,
-      A002445_Table::A002445_983,
-      A002445_Table::A002445_984,
-      A002445_Table::A002445_985,
-      A002445_Table::A002445_986,
-      A002445_Table::A002445_987,
-      A002445_Table::A002445_988,
-      A002445_Table::A002445_989,
-      A002445_Table::A002445_990,
-      A002445_Table::A002445_991,
-      A002445_Table::A002445_992,
-      A002445_Table::A002445_993,
-      A002445_Table::A002445_994,
-      A002445_Table::A002445_995,
-      A002445_Table::A002445_996,
-      A002445_Table::A002445_997,
-      A002445_Table::A002445_998,
-      A002445_Table::A002445_999,
-      A002445_Table::A002445_1000,
-    }};
-
-    static const std::vector<pfn_efloat> A002445_vect(A002445_data.cbegin(), A002445_data.cend());
+  static const integer_table table(A002445_Table::limbs,
+                                   A002445_Table::offsets,
+                                   nullptr,
+                                   static_cast<std::size_t>(1001U));
 
-    return A002445_vect;
-  }
+  return table;
 }
@@ -0,0 +1,494 @@
+//          Copyright Christopher Kormanyos 1999 - 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+// This work is based on an earlier work:
+// "Algorithm 910: A Portable C++ Multiple-Precision System for Special-Function Calculations",
+// in ACM TOMS, {VOL 37, ISSUE 4, (February 2011)} (C) ACM, 2011. http://doi.acm.org/10.1145/1916461.1916469
+
+// Generator of the integer tables A000142, A000367, A002445, A006882 and A007318.
+// The entries are calculated exactly and written as packed base 10^8 limbs.
+// This is a stand-alone program. Build and run it in the tables directory:
+//   g++ -std=c++11 -O2 generator/tables_generator.cpp -o tables_generator
+//   ./tables_generator
+
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace
+{
+  // A non-negative integer in base 10^8 limbs, least significant limb first.
+  typedef std::vector<std::uint32_t> natural;
+
+  const std::uint32_t limb_base = static_cast<std::uint32_t>(100000000U);
+
+  // The sizes of the tables.
+  const std::uint32_t factorial_max = static_cast<std::uint32_t>(1000U);
+  const std::uint32_t bernoulli_max = static_cast<std::uint32_t>(1000U);
+  const std::uint32_t pascal_rows   = static_cast<std::uint32_t>(161U);
+
+  void normalize(natural& u)
+  {
+    while((u.size() > static_cast<std::size_t>(1U)) && (u.back() == static_cast<std::uint32_t>(0U)))
+    {
+      u.pop_back();
+    }
+  }
+
+  void mul_small(natural& u, const std::uint32_t n)
+  {
+    std::uint64_t carry = static_cast<std::uint64_t>(0U);
+
+    for(std::size_t i = static_cast<std::size_t>(0U); i < u.size(); ++i)
+    {
+      const std::uint64_t t = (static_cast<std::uint64_t>(u[i]) * n) + carry;
+
+      carry = t / limb_base;
+      u[i]  = static_cast<std::uint32_t>(t % limb_base);
+    }
+
+    while(carry != static_cast<std::uint64_t>(0U))
+    {
+      u.push_back(static_cast<std::uint32_t>(carry % limb_base));
+
+      carry /= limb_base;
+    }
+
+    normalize(u);
+  }
+
+  void div_small(natural& u, const std::uint32_t n)
+  {
+    std::uint64_t rem = static_cast<std::uint64_t>(0U);
+
+    for(std::size_t i = u.size(); i > static_cast<std::size_t>(0U); --i)
+    {
+      const std::uint64_t t = (rem * limb_base) + u[i - 1U];
+
+      u[i - 1U] = static_cast<std::uint32_t>(t / n);
+      rem       = t % n;
+    }
+
+    normalize(u);
+  }
+
+  natural sum(const natural& u, const natural& v)
+  {
+    natural r((std::max)(u.size(), v.size()) + 1U, static_cast<std::uint32_t>(0U));
+
+    std::uint32_t carry = static_cast<std::uint32_t>(0U);
+
+    for(std::size_t i = static_cast<std::size_t>(0U); i < r.size(); ++i)
+    {
+      const std::uint32_t t =   ((i < u.size()) ? u[i] : static_cast<std::uint32_t>(0U))
+                              + ((i < v.size()) ? v[i] : static_cast<std::uint32_t>(0U))
+                              + carry;
+
+      carry = ((t >= limb_base) ? static_cast<std::uint32_t>(1U) : static_cast<std::uint32_t>(0U));
+      r[i]  = ((t >= limb_base) ? (t - limb_base) : t);
+    }
+
+    normalize(r);
+
+    return r;
+  }
+
+  // Divide u by v, where the division is known to be exact.
+  // This is the long division of Knuth, TAOCP Vol. 2, Algorithm 4.3.1 D.
+  natural div_exact(natural u, natural v)
+  {
+    const std::size_t n = v.size();
+
+    if(n == static_cast<std::size_t>(1U))
+    {
+      div_small(u, v[0U]);
+
+      return u;
+    }
+
+    // Normalize such that the leading limb of v is at least limb_base / 2.
+    const std::uint32_t d = static_cast<std::uint32_t>(limb_base / (static_cast<std::uint64_t>(v.back()) + 1U));
+
+    mul_small(u, d);
+    mul_small(v, d);
+
+    u.resize(u.size() + 1U, static_cast<std::uint32_t>(0U));
+
+    const std::size_t m = u.size() - n;
+
+    natural q(m, static_cast<std::uint32_t>(0U));
+
+    for(std::size_t j = m; j > static_cast<std::size_t>(0U); --j)
+    {
+      const std::size_t k = j - 1U;
+
+      const std::uint64_t num = (static_cast<std::uint64_t>(u[k + n]) * limb_base) + u[k + n - 1U];
+
+      std::uint64_t q_hat = num / v[n - 1U];
+      std::uint64_t r_hat = num % v[n - 1U];
+
+      while(   (q_hat >= limb_base)
+            || ((q_hat * v[n - 2U]) > ((r_hat * limb_base) + u[k + n - 2U])))
+      {
+        --q_hat;
+        r_hat += v[n - 1U];
+
+        if(r_hat >= limb_base)
+        {
+          break;
+        }
+      }
+
+      // Multiply and subtract.
+      std::int64_t borrow = static_cast<std::int64_t>(0);
+      std::uint64_t carry = static_cast<std::uint64_t>(0U);
+
+      for(std::size_t i = static_cast<std::size_t>(0U); i < n; ++i)
+      {
+        const std::uint64_t p = (q_hat * v[i]) + carry;
+
+        carry = p / limb_base;
+
+        const std::int64_t t =   static_cast<std::int64_t>(u[i + k])
+                               - static_cast<std::int64_t>(p % limb_base)
+                               + borrow;
+
+        u[i + k] = static_cast<std::uint32_t>((t < 0) ? (t + limb_base) : t);
+        borrow   = ((t < 0) ? static_cast<std::int64_t>(-1) : static_cast<std::int64_t>(0));
+      }
+
+      const std::int64_t t = static_cast<std::int64_t>(u[k + n]) - static_cast<std::int64_t>(carry) + borrow;
+
+      u[k + n] = static_cast<std::uint32_t>((t < 0) ? (t + limb_base) : t);
+
+      if(t < 0)
+      {
+        // Add back.
+        --q_hat;
+
+        std::uint32_t c = static_cast<std::uint32_t>(0U);
+
+        for(std::size_t i = static_cast<std::size_t>(0U); i < n; ++i)
+        {
+          const std::uint32_t s = u[i + k] + v[i] + c;
+
+          c        = ((s >= limb_base) ? static_cast<std::uint32_t>(1U) : static_cast<std::uint32_t>(0U));
+          u[i + k] = ((s >= limb_base) ? (s - limb_base) : s);
+        }
+
+        u[k + n] = static_cast<std::uint32_t>((u[k + n] + c) % limb_base);
+      }
+
+      q[k] = static_cast<std::uint32_t>(q_hat);
+    }
+
+    normalize(q);
+
+    return q;
+  }
+
+  struct entry
+  {
+    natural value;
+    bool    is_neg;
+  };
+
+  std::string header()
+  {
+    return std::string(
+      "//          Copyright Christopher Kormanyos 1999 - 2021.\n"
+      "// Distributed under the Boost Software License, Version 1.0.\n"
+      "//    (See accompanying file LICENSE_1_0.txt or copy at\n"
+      "//          http://www.boost.org/LICENSE_1_0.txt)\n"
+      "\n"
+      "// This work is based on an earlier work:\n"
+      "// \"Algorithm 910: A Portable C++ Multiple-Precision System for Special-Function Calculations\",\n"
+      "// in ACM TOMS, {VOL 37, ISSUE 4, (February 2011)} (C) ACM, 2011. http://doi.acm.org/10.1145/1916461.1916469\n"
+      "\n"
+      "// Automatically generated file, see generator/tables_generator.cpp\n"
+      "#include <functions/tables/tables.h>\n"
+      "\n");
+  }
+
+  void write_numbers(std::ostream& os, const std::vector<std::uint32_t>& numbers, const char* suffix)
+  {
+    const std::size_t numbers_per_line = static_cast<std::size_t>(10U);
+
+    for(std::size_t i = static_cast<std::size_t>(0U); i < numbers.size(); ++i)
+    {
+      os << (((i % numbers_per_line) == static_cast<std::size_t>(0U)) ? "    " : " ")
+         << numbers[i]
+         << suffix
+         << ",";
+
+      if((((i + 1U) % numbers_per_line) == static_cast<std::size_t>(0U)) || ((i + 1U) == numbers.size()))
+      {
+        os << "\n";
+      }
+    }
+  }
+
+  bool write_table(const std::string& name, const std::vector<entry>& entries, const bool has_signs)
+  {
+    std::vector<std::uint32_t> limbs;
+    std::vector<std::uint32_t> offsets;
+    std::vector<std::uint32_t> signs;
+
+    for(std::size_t i = static_cast<std::size_t>(0U); i < entries.size(); ++i)
+    {
+      offsets.push_back(static_cast<std::uint32_t>(limbs.size()));
+
+      limbs.insert(limbs.end(), entries[i].value.rbegin(), entries[i].value.rend());
+
+      signs.push_back(entries[i].is_neg ? static_cast<std::uint32_t>(1U) : static_cast<std::uint32_t>(0U));
+    }
+
+    offsets.push_back(static_cast<std::uint32_t>(limbs.size()));
+
+    std::ofstream out((name + ".cpp").c_str());
+
+    out << header();
+
+    out << "namespace " << name << "_Table\n";
+    out << "{\n";
+    out << "  static const std::uint32_t limbs[" << limbs.size() << "U] =\n";
+    out << "  {\n";
+    write_numbers(out, limbs, "U");
+    out << "  };\n";
+    out << "\n";
+    out << "  static const std::uint32_t offsets[" << offsets.size() << "U] =\n";
+    out << "  {\n";
+    write_numbers(out, offsets, "U");
+    out << "  };\n";
+
+    if(has_signs)
+    {
+      out << "\n";
+      out << "  static const std::uint8_t signs[" << signs.size() << "U] =\n";
+      out << "  {\n";
+      write_numbers(out, signs, "U");
+      out << "  };\n";
+    }
+
+    out << "}\n";
+    out << "\n";
+    out << "const Tables::integer_table& Tables::" << name << "()\n";
+    out << "{\n";
+    out << "  static const integer_table table(" << name << "_Table::limbs,\n";
+    out << "                                   " << name << "_Table::offsets,\n";
+    out << "                                   " << (has_signs ? (name + "_Table::signs") : std::string("nullptr")) << ",\n";
+    out << "                                   static_cast<std::size_t>(" << entries.size() << "U));\n";
+    out << "\n";
+    out << "  return table;\n";
+    out << "}\n";
+
+    return out.good();
+  }
+
+  natural one() { return natural(static_cast<std::size_t>(1U), static_cast<std::uint32_t>(1U)); }
+
+  std::vector<entry> factorials()
+  {
+    std::vector<entry> entries;
+
+    natural f = one();
+
+    for(std::uint32_t n = static_cast<std::uint32_t>(0U); n <= factorial_max; ++n)
+    {
+      if(n > static_cast<std::uint32_t>(1U))
+      {
+        mul_small(f, n);
+      }
+
+      const entry e = { f, false };
+
+      entries.push_back(e);
+    }
+
+    return entries;
+  }
+
+  std::vector<entry> double_factorials()
+  {
+    std::vector<entry> entries;
+
+    for(std::uint32_t n = static_cast<std::uint32_t>(0U); n <= factorial_max; ++n)
+    {
+      const entry e = { ((n < static_cast<std::uint32_t>(2U)) ? one() : entries[n - 2U].value), false };
+
+      entries.push_back(e);
+
+      if(n > static_cast<std::uint32_t>(1U))
+      {
+        mul_small(entries.back().value, n);
+      }
+    }
+
+    return entries;
+  }
+
+  std::vector<entry> pascal_triangle()
+  {
+    std::vector<entry> entries;
+
+    std::vector<natural> row(static_cast<std::size_t>(1U), one());
+
+    for(std::uint32_t n = static_cast<std::uint32_t>(0U); n < pascal_rows; ++n)
+    {
+      for(std::size_t k = static_cast<std::size_t>(0U); k < row.size(); ++k)
+      {
+        const entry e = { row[k], false };
+
+        entries.push_back(e);
+      }
+
+      std::vector<natural> next(row.size() + 1U, one());
+
+      for(std::size_t k = static_cast<std::size_t>(1U); k < row.size(); ++k)
+      {
+        next[k] = sum(row[k - 1U], row[k]);
+      }
+
+      row.swap(next);
+    }
+
+    return entries;
+  }
+
+  void bernoulli_numbers(std::vector<entry>& numerators, std::vector<entry>& denominators)
+  {
+    // B_2n = (-1)^(n - 1) 2n T_n / (4^n (4^n - 1)) with the tangent numbers T_n,
+    // see "Computing Bernoulli and Tangent Numbers", Richard P. Brent.
+    // The denominator of B_2n is the product of the primes p with (p - 1) | 2n
+    // (von Staudt-Clausen).
+    const std::uint32_t m = bernoulli_max;
+
+    std::vector<natural> tangent_numbers(m + 1U, natural(static_cast<std::size_t>(1U), static_cast<std::uint32_t>(0U)));
+
+    tangent_numbers[1U] = one();
+
+    for(std::uint32_t k = static_cast<std::uint32_t>(2U); k <= m; ++k)
+    {
+      tangent_numbers[k] = tangent_numbers[k - 1U];
+
+      mul_small(tangent_numbers[k], k - 1U);
+    }
+
+    for(std::uint32_t k = static_cast<std::uint32_t>(2U); k <= m; ++k)
+    {
+      for(std::uint32_t j = k; j <= m; ++j)
+      {
+        natural a = tangent_numbers[j - 1U];
+        natural b = tangent_numbers[j];
+
+        mul_small(a, j - k);
+        mul_small(b, (j - k) + 2U);
+
+        tangent_numbers[j] = sum(a, b);
+      }
+    }
+
+    std::vector<std::uint32_t> primes;
+
+    for(std::uint32_t p = static_cast<std::uint32_t>(2U); p <= (2U * m) + 1U; ++p)
+    {
+      bool is_prime = true;
+
+      for(std::size_t i = static_cast<std::size_t>(0U); is_prime && (i < primes.size()) && ((primes[i] * primes[i]) <= p); ++i)
+      {
+        is_prime = ((p % primes[i]) != static_cast<std::uint32_t>(0U));
+      }
+
+      if(is_prime)
+      {
+        primes.push_back(p);
+      }
+    }
+
+    const entry b0_num = { one(), false };
+    const entry b0_den = { one(), false };
+
+    numerators.push_back  (b0_num);
+    denominators.push_back(b0_den);
+
+    natural four_pow_n = one();
+
+    for(std::uint32_t n = static_cast<std::uint32_t>(1U); n <= m; ++n)
+    {
+      mul_small(four_pow_n, 4U);
+
+      natural den = one();
+
+      for(std::size_t i = static_cast<std::size_t>(0U); i < primes.size(); ++i)
+      {
+        if(((2U * n) % (primes[i] - 1U)) == static_cast<std::uint32_t>(0U))
+        {
+          mul_small(den, primes[i]);
+        }
+      }
+
+      // The numerator is 2n T_n den / (4^n (4^n - 1)). The denominator is
+      // a product of small primes, which are multiplied in one by one.
+      natural num = tangent_numbers[n];
+
+      mul_small(num, 2U * n);
+
+      for(std::size_t i = static_cast<std::size_t>(0U); i < primes.size(); ++i)
+      {
+        if(((2U * n) % (primes[i] - 1U)) == static_cast<std::uint32_t>(0U))
+        {
+          mul_small(num, primes[i]);
+        }
+      }
+
+      for(std::uint32_t i = static_cast<std::uint32_t>(0U); i < n; ++i)
+      {
+        div_small(num, 4U);
+      }
+
+      natural four_pow_n_minus_one = four_pow_n;
+
+      std::size_t i = static_cast<std::size_t>(0U);
+
+      while(four_pow_n_minus_one[i] == static_cast<std::uint32_t>(0U))
+      {
+        four_pow_n_minus_one[i] = limb_base - 1U;
+
+        ++i;
+      }
+
+      --four_pow_n_minus_one[i];
+
+      normalize(four_pow_n_minus_one);
+
+      const entry e_num = { div_exact(num, four_pow_n_minus_one), ((n % 2U) == static_cast<std::uint32_t>(0U)) };
+      const entry e_den = { den, false };
+
+      numerators.push_back  (e_num);
+      denominators.push_back(e_den);
+    }
+  }
+}
+
+int main()
+{
+  std::vector<entry> numerators;
+  std::vector<entry> denominators;
+
+  bernoulli_numbers(numerators, denominators);
+
+  const bool result_is_ok =    write_table("A000142", factorials(),        false)
+                            && write_table("A000367", numerators,          true)
+                            && write_table("A002445", denominators,        false)
+                            && write_table("A006882", double_factorials(), false)
+                            && write_table("A007318", pascal_triangle(),   false);
+
+  std::cout << (result_is_ok ? "Tables written" : "Error writing the tables") << std::endl;
+
+  return (result_is_ok ? 0 : 1);
+}
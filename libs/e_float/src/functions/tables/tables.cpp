@@ -0,0 +1,93 @@
+//          Copyright Christopher Kormanyos 1999 - 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+// This work is based on an earlier work:
+// "Algorithm 910: A Portable C++ Multiple-Precision System for Special-Function Calculations",
+// in ACM TOMS, {VOL 37, ISSUE 4, (February 2011)} (C) ACM, 2011. http://doi.acm.org/10.1145/1916461.1916469
+
+#include <algorithm>
+#include <string>
+
+#include <functions/tables/tables.h>
+
+Tables::integer_table::integer_table(const std::uint32_t* limbs,
+                                     const std::uint32_t* offsets,
+                                     const std::uint8_t*  signs,
+                                     const std::size_t    count) : my_limbs  (limbs),
+                                                                   my_offsets(offsets),
+                                                                   my_signs  (signs),
+                                                                   my_count  (count),
+                                                                   my_values (new std::atomic<const e_float*>[count])
+{
+  for(std::size_t i = static_cast<std::size_t>(0U); i < my_count; ++i)
+  {
+    my_values[i].store(nullptr);
+  }
+}
+
+Tables::integer_table::~integer_table()
+{
+  for(std::size_t i = static_cast<std::size_t>(0U); i < my_count; ++i)
+  {
+    delete my_values[i].load();
+  }
+
+  delete [] my_values;
+}
+
+const e_float& Tables::integer_table::operator[](const std::size_t i) const
+{
+  const e_float* p = my_values[i].load(std::memory_order_acquire);
+
+  if(p == nullptr)
+  {
+    // Concurrent first accesses may both convert the entry.
+    // Only one of the results is kept.
+    const e_float* p_new = new e_float(make_value(i));
+
+    if(my_values[i].compare_exchange_strong(p, p_new, std::memory_order_acq_rel))
+    {
+      p = p_new;
+    }
+    else
+    {
+      delete p_new;
+    }
+  }
+
+  return *p;
+}
+
+e_float Tables::integer_table::make_value(const std::size_t i) const
+{
+  const std::size_t limb_begin = static_cast<std::size_t>(my_offsets[i]);
+  const std::size_t limb_count = static_cast<std::size_t>(my_offsets[i + 1U] - my_offsets[i]);
+
+  // Use the leading limbs which cover the working precision with guard
+  // digits and scale with the power of ten of the remaining limbs.
+  const std::size_t n_keep = (std::min)(limb_count,
+                                        static_cast<std::size_t>((std::numeric_limits<e_float>::digits10 / 8) + 4));
+
+  const bool is_neg = ((my_signs != nullptr) && (my_signs[i] != static_cast<std::uint8_t>(0U)));
+
+  std::string str((is_neg ? "-" : ""));
+
+  str.reserve(static_cast<std::size_t>((n_keep * 8U) + 32U));
+
+  str += std::to_string(my_limbs[limb_begin]);
+
+  for(std::size_t j = static_cast<std::size_t>(1U); j < n_keep; ++j)
+  {
+    const std::string limb_str = std::to_string(my_limbs[limb_begin + j]);
+
+    str.append(static_cast<std::size_t>(8U - limb_str.size()), '0');
+    str += limb_str;
+  }
+
+  str += "e";
+  str += std::to_string(static_cast<std::uint64_t>((limb_count - n_keep) * 8U));
+
+  return e_float(str.c_str());
+}
@@ -1,4 +1,3 @@
-
 //          Copyright Christopher Kormanyos 1999 - 2021.
 // Distributed under the Boost Software License, Version 1.0.
 //    (See accompanying file LICENSE_1_0.txt or copy at
@@ -11,20 +10,55 @@
 #ifndef TABLES_2008_01_10_H_
   #define TABLES_2008_01_10_H_
 
-  #include <vector>
+  #include <atomic>
+  #include <cstddef>
+  #include <cstdint>
 
   #include <e_float/e_float.h>
+  #include <utility/util_noncopyable.h>
 
   namespace Tables
   {
-    typedef const e_float&              (*pfn_efloat)       ();
-    typedef const std::vector<e_float>& (*pfn_vector_efloat)();
-
-    const std::vector<pfn_efloat>&        A000142();
-    const std::vector<pfn_efloat>&        A000367();
-    const std::vector<pfn_efloat>&        A002445();
-    const std::vector<pfn_efloat>&        A006882();
-    const std::vector<pfn_vector_efloat>& A007318();
+    // A table of exact integers stored as packed base 10^8 limbs, most
+    // significant limb first. Entry i occupies the limbs in the range
+    // [offsets[i], offsets[i + 1]). The optional signs mark negative entries.
+    // Each entry is converted to e_float on its first access and kept.
+    class integer_table : private util::noncopyable
+    {
+    public:
+      integer_table(const std::uint32_t* limbs,
+                    const std::uint32_t* offsets,
+                    const std::uint8_t*  signs,
+                    const std::size_t    count);
+
+      ~integer_table();
+
+      std::size_t size() const { return my_count; }
+
+      const e_float& operator[](const std::size_t i) const;
+
+    private:
+      const std::uint32_t*               my_limbs;
+      const std::uint32_t*               my_offsets;
+      const std::uint8_t*                my_signs;
+      const std::size_t                  my_count;
+      std::atomic<const e_float*>* const my_values;
+
+      e_float make_value(const std::size_t i) const;
+    };
+
+    // Factorials n!.
+    const integer_table& A000142();
+
+    // Numerators and denominators of the Bernoulli numbers B_2n.
+    const integer_table& A000367();
+    const integer_table& A002445();
+
+    // Double factorials n!!.
+    const integer_table& A006882();
+
+    // Pascal's triangle, read by rows. Row n begins at the index n (n + 1) / 2.
+    const integer_table& A007318();
   }
 
 #endif // TABLES_2008_01_10_H_
@@ -10,6 +10,11 @@
 
 #include <algorithm>
 #include <cmath>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
 
 #include <e_float/e_float_complex.h>
 #include <e_float/e_float_functions.h>
@@ -44,6 +49,395 @@ namespace Zeta_Series
     return (is_in_table && (is_pos_and_even || is_neg));
   }
 
+  std::int32_t BorweinTerms(const double abs_imag_s)
+  {
+    // Use N = (digits * 1.45) + {|imag(s)| * 1.1}. The imaginary contribution
+    // is rounded up to a multiple of 32, so that nearby arguments, such as
+    // in a scan along the critical line, share a set of coefficients.
+    static const std::int32_t nd = static_cast<std::int32_t>(static_cast<double>(std::numeric_limits<e_float>::digits10) * static_cast<double>(1.45));
+           const std::int32_t ni = static_cast<std::int32_t>(static_cast<double>(1.10 * abs_imag_s));
+
+    return nd + (((ni + static_cast<std::int32_t>(31)) / static_cast<std::int32_t>(32)) * static_cast<std::int32_t>(32));
+  }
+
+  std::shared_ptr<const std::vector<e_float>> BorweinCoefficients(const std::int32_t n)
+  {
+    // Provide the coefficients of the alternating series of Borwein
+    // with n terms. Element 0 holds d_0 and the elements j = 1...n hold
+    // the signed coefficients (-1)^(j - 1) d_j of the powers j^-s.
+    // These do not depend on s. The most recently used set is kept,
+    // so repeated evaluations only need to compute the powers.
+    // A set remains valid for its holders when another thread
+    // replaces the cached one.
+    static std::mutex                                  cache_mutex;
+    static std::shared_ptr<const std::vector<e_float>> d_cached;
+
+    {
+      const std::lock_guard<std::mutex> lock(cache_mutex);
+
+      if(d_cached && (d_cached->size() == static_cast<std::size_t>(n + static_cast<std::int32_t>(1))))
+      {
+        return d_cached;
+      }
+    }
+
+    std::vector<e_float> d(static_cast<std::size_t>(n + static_cast<std::int32_t>(1)));
+
+    // All d_j are scaled with the same constant, which cancels in the
+    // quotient of the sum and d_0. Begin with the last term set to one
+    // and descend with the ratio of the consecutive terms
+    // t_(j - 1) / t_j = [2j (2j - 1)] / [4 (n + j - 1) (n - j + 1)].
+    e_float t_j = ef::one();
+    e_float d_j = ef::one();
+
+    for(std::int32_t j = n; j > static_cast<std::int32_t>(0); j--)
+    {
+      const bool j_is_odd = ((j % static_cast<std::int32_t>(2)) != static_cast<std::int32_t>(0));
+
+      d[static_cast<std::size_t>(j)] = (j_is_odd ? d_j : -d_j);
+
+      t_j *= static_cast<std::int32_t>(static_cast<std::int32_t>(2) * j);
+      t_j *= static_cast<std::int32_t>((static_cast<std::int32_t>(2) * j) - static_cast<std::int32_t>(1));
+      t_j /= static_cast<std::int32_t>(static_cast<std::int32_t>(4) * ((n + j) - static_cast<std::int32_t>(1)));
+      t_j /= static_cast<std::int32_t>((n - j) + static_cast<std::int32_t>(1));
+
+      d_j += t_j;
+    }
+
+    d.front() = d_j;
+
+    const std::shared_ptr<const std::vector<e_float>> d_new = std::make_shared<const std::vector<e_float>>(std::move(d));
+
+    const std::lock_guard<std::mutex> lock(cache_mutex);
+
+    d_cached = d_new;
+
+    return d_new;
+  }
+
+  void BorweinLineSums(const std::vector<e_float>&              dk,
+                       std::vector<ef::complex<e_float>>&       j_pow_minus_s,
+                       const std::vector<ef::complex<e_float>>& j_pow_minus_ds,
+                       const std::size_t                        j_begin,
+                       const std::size_t                        j_end,
+                       std::vector<ef::complex<e_float>>&       sums)
+  {
+    // Compute the partial sums of dk * j^-s over the range of j for the
+    // consecutive points s, s + ds, s + 2ds, ... and advance the powers
+    // from one point to the next with j^-(s + ds) = j^-s * j^-ds.
+    // Only arithmetic is used here, so that disjoint ranges of j
+    // can be processed in separate threads.
+    for(std::size_t k = static_cast<std::size_t>(0U); k < sums.size(); k++)
+    {
+      ef::complex<e_float> sum(ef::zero());
+
+      for(std::size_t j = j_begin; j < j_end; j++)
+      {
+        sum += (dk[j] * j_pow_minus_s[j]);
+
+        j_pow_minus_s[j] *= j_pow_minus_ds[j];
+      }
+
+      sums[k] = sum;
+    }
+  }
+
+  double RiemannSiegelStripWidth()
+  {
+    // The trapezoidal rule for the Riemann-Siegel integral converges like
+    // exp(2 pi w^2 - 2 pi w / h) for the step size h, where w is the
+    // half-width of a strip around the line of integration in which the
+    // integrand is analytic, except for the poles which are corrected for.
+    // Use w near 1 / 2h for the step size needed at the full precision.
+    // The strip is bounded halfway between two rows of poles, which are
+    // spaced 1 / sqrt(2) apart.
+    static const double pi      = 3.14159265358979323846;
+    static const double sqrt2   = 1.41421356237309504880;
+    static const double tol     = static_cast<double>(static_cast<std::int32_t>(ef::tolerance())) * 2.30258509299404568402;
+    static const double h0      = std::sqrt(pi / (2.0 * tol));
+    static const double w_sqrt2 = (std::max)(1.0, std::floor((0.5 / h0) * sqrt2));
+
+    return w_sqrt2 / sqrt2;
+  }
+
+  std::int32_t RiemannSiegelPoles()
+  {
+    // The poles at the integers N + 1 - P, ..., N + P of the integrand lie
+    // inside of the strip and are corrected for.
+    static const std::int32_t P = static_cast<std::int32_t>(static_cast<std::int32_t>(RiemannSiegelStripWidth() * 1.41421356237309504880) + static_cast<std::int32_t>(2));
+
+    return P;
+  }
+
+  double RiemannSiegelMinimumImag()
+  {
+    // Use the Riemann-Siegel formula at and above this height. The cost of the
+    // series of Borwein grows linearly with the height, whereas the cost of the
+    // Riemann-Siegel formula mainly depends on the precision. The crossover
+    // was measured to be close to 30 times the number of digits. Independent
+    // of this, the line of integration must stay well away from the branch
+    // point of x^-s at the origin.
+    static const double ni = static_cast<double>(RiemannSiegelPoles() + static_cast<std::int32_t>(2));
+    static const double t0 = (std::max)(2.0 * 3.14159265358979323846 * (ni * ni),
+                                        30.0 * static_cast<double>(std::numeric_limits<e_float>::digits10));
+
+    return t0;
+  }
+
+  bool UsesRiemannSiegel(const ef::complex<e_float>& s)
+  {
+    // These are the complex arguments for which the Riemann-Siegel formula is used.
+    return ((!ef::isneg(s.real())) && (ef::fabs(ef::to_double(s.imag())) >= RiemannSiegelMinimumImag()));
+  }
+
+  bool UsesBorweinSeries(const ef::complex<e_float>& s)
+  {
+    // These are the complex arguments for which ZetaTemplate uses
+    // the alternating series of Borwein.
+    return ((!ef::isneg(s.real())) && (!ef::iszero(s.imag())) && (!UsesRiemannSiegel(s)));
+  }
+
+  double RiemannSiegelLogMagnitude(const double sigma, const double t, const double c, const double u, const double v)
+  {
+    // Estimate the logarithm of the absolute value of the Riemann-Siegel
+    // integrand at x = c + (u + iv) e^(i pi/4). This is only used for
+    // choosing the step size, so double precision suffices.
+    const double pi    = 3.14159265358979323846;
+    const double x_re  = c + ((u - v) * 0.70710678118654752440);
+    const double x_im  =      (u + v) * 0.70710678118654752440;
+    const double sn_re = std::sin (pi * x_re);
+    const double sh_im = std::sinh(pi * x_im);
+
+    const double log_abs_x = 0.5 * std::log((x_re * x_re) + (x_im * x_im));
+
+    return ((((-2.0 * pi) * (x_re * x_im)) - (sigma * log_abs_x)) + (t * std::atan2(x_im, x_re)))
+           - std::log(2.0 * std::sqrt((sn_re * sn_re) + (sh_im * sh_im)));
+  }
+
+  ef::complex<e_float> RiemannSiegelIntegral(const ef::complex<e_float>&              s,
+                                             const std::int32_t                       N,
+                                             const std::vector<ef::complex<e_float>>& n_pow_minus_s)
+  {
+    // Compute the integral of x^-s exp(i pi x^2) / [exp(i pi x) - exp(-i pi x)]
+    // along the line of slope 1 which crosses the real axis at c = N + 1/2,
+    // directed from the upper right to the lower left. This is the remainder
+    // of the Riemann-Siegel formula with N terms in the form of H. M. Edwards,
+    // "Riemann's Zeta Function", Section 7.9. It is computed exactly instead of
+    // with the asymptotic expansion in terms of the derivatives of
+    // cos[2 pi (p^2 - p - 1/16)] / cos(2 pi p), whose high-order derivatives
+    // can not be obtained to the full precision.
+
+    // Parameterize the line with x = c + r e^(i pi/4). The integrand decays like
+    // exp(-2 pi r^2) and is integrated with the trapezoidal rule in r. The poles
+    // of the integrand at the integers n with the residues n^-s / (2 pi i)
+    // limit the convergence. Their contributions to the error of the trapezoidal
+    // rule are known and are subtracted. The remaining error is given by the
+    // size of the integrand on the boundaries of the strip of half-width w.
+    static const double pi  = 3.14159265358979323846;
+    static const double tol = static_cast<double>(static_cast<std::int32_t>(ef::tolerance())) * 2.30258509299404568402;
+
+    const double sd = ef::to_double(s.real());
+    const double td = ef::to_double(s.imag());
+    const double cd = static_cast<double>(N) + 0.5;
+    const double w  = RiemannSiegelStripWidth();
+
+    double log_peak = -(std::numeric_limits<double>::max)();
+
+    for(double u = -4.0; u <= 4.0; u += 0.25)
+    {
+      log_peak = (std::max)(log_peak, RiemannSiegelLogMagnitude(sd, td, cd, u, 0.0));
+    }
+
+    double log_edge = -(std::numeric_limits<double>::max)();
+
+    for(double u = -((2.0 * w) + 6.0); u <= ((2.0 * w) + 6.0); u += 0.25)
+    {
+      log_edge = (std::max)(log_edge, RiemannSiegelLogMagnitude(sd, td, cd, u,  w));
+      log_edge = (std::max)(log_edge, RiemannSiegelLogMagnitude(sd, td, cd, u, -w));
+    }
+
+    const e_float h(((2.0 * pi) * w) / (tol + (std::max)(0.0, log_edge - log_peak)));
+
+    const e_float              c         = e_float(N) + ef::half();
+    const e_float              sqrt_half = ef::sqrt(ef::half());
+    const ef::complex<e_float> omega(sqrt_half, sqrt_half);
+    const ef::complex<e_float> i_pi(ef::zero(), ef::pi());
+
+    // The factors exp(i pi x) are advanced along the line with
+    // exp[i pi (x + h e^(i pi/4))] = exp(i pi x) exp(i pi h e^(i pi/4)).
+    // Here exp(i pi c) = i (-1)^N.
+    const bool N_is_even = ((N % static_cast<std::int32_t>(2)) == static_cast<std::int32_t>(0));
+
+    const ef::complex<e_float> exp_i_pi_c(ef::zero(), (N_is_even ? ef::one() : -ef::one()));
+    const ef::complex<e_float> exp_i_pi_step = ef::exp(i_pi * (omega * h));
+
+    ef::complex<e_float> trapezoid_sum(ef::zero());
+
+    e_float max_abs_term(ef::zero());
+
+    for(std::int32_t direction = static_cast<std::int32_t>(1); direction >= static_cast<std::int32_t>(-1); direction -= static_cast<std::int32_t>(2))
+    {
+      const ef::complex<e_float> exp_i_pi_ratio = ((direction > static_cast<std::int32_t>(0)) ? exp_i_pi_step : ef::one() / exp_i_pi_step);
+
+      ef::complex<e_float> exp_i_pi_x = exp_i_pi_c;
+
+      std::int32_t n_small = static_cast<std::int32_t>(0);
+
+      for(std::int32_t j = ((direction > static_cast<std::int32_t>(0)) ? static_cast<std::int32_t>(0) : static_cast<std::int32_t>(1)); j < ef::max_iteration(); j++)
+      {
+        if(j > static_cast<std::int32_t>(0))
+        {
+          exp_i_pi_x *= exp_i_pi_ratio;
+        }
+
+        const ef::complex<e_float> x = c + (omega * (h * static_cast<std::int32_t>(direction * j)));
+
+        const ef::complex<e_float> term =   ef::exp((i_pi * (x * x)) - (s * ef::log(x)))
+                                          / (exp_i_pi_x - (ef::one() / exp_i_pi_x));
+
+        trapezoid_sum += term;
+
+        const e_float abs_term = ef::abs(term);
+
+        if(abs_term > max_abs_term)
+        {
+          max_abs_term = abs_term;
+        }
+
+        // Stop the sum after a few consecutive negligible terms.
+        const bool term_is_negligible =
+          (static_cast<std::int64_t>(ef::order_of(abs_term) - ef::order_of(max_abs_term)) < -ef::tolerance());
+
+        n_small = (term_is_negligible ? static_cast<std::int32_t>(n_small + static_cast<std::int32_t>(1)) : static_cast<std::int32_t>(0));
+
+        if(n_small > static_cast<std::int32_t>(3))
+        {
+          break;
+        }
+      }
+    }
+
+    ef::complex<e_float> integral = (trapezoid_sum * omega) * h;
+
+    // Add the parts of the integral which the trapezoidal rule misses because of
+    // the poles at x = n, located at r_n = (n - c) e^(-i pi/4). These are
+    // 2 pi i R q / (q - 1) for a pole above the line (n <= N) and
+    // 2 pi i R q^-1 / (1 - q^-1) for a pole below the line (n > N),
+    // where q = exp(2 pi i r_n / h) and R is the residue.
+    const ef::complex<e_float> two_pi_i(ef::zero(), ef::two_pi());
+    const ef::complex<e_float> two_pi_i_over_h = two_pi_i / h;
+
+    const std::int32_t P = RiemannSiegelPoles();
+
+    for(std::int32_t n = static_cast<std::int32_t>((N + static_cast<std::int32_t>(1)) - P); n <= static_cast<std::int32_t>(N + P); n++)
+    {
+      const ef::complex<e_float> r_n = ef::complex<e_float>(sqrt_half, -sqrt_half) * (e_float(n) - c);
+
+      // The residue R, multiplied by 2 pi i.
+      const ef::complex<e_float>& two_pi_i_residue = n_pow_minus_s[static_cast<std::size_t>(n)];
+
+      if(n <= N)
+      {
+        const ef::complex<e_float> q = ef::exp(two_pi_i_over_h * r_n);
+
+        integral += (two_pi_i_residue * q) / (q - ef::one());
+      }
+      else
+      {
+        const ef::complex<e_float> q_inv = ef::exp(-(two_pi_i_over_h * r_n));
+
+        integral += (two_pi_i_residue * q_inv) / (ef::one() - q_inv);
+      }
+    }
+
+    // Account for the direction of the line.
+    return -integral;
+  }
+
+  ef::complex<e_float> RiemannSiegel(const ef::complex<e_float>& s)
+  {
+    // Compute Zeta(s) for large imaginary parts with the Riemann-Siegel formula
+    // Zeta(s) = Sum[n^-s, {n, 1, N}] + I(s) + chi(s) {Sum[n^(s - 1), {n, 1, N}] + I*(1 - s*)},
+    // with N = Floor[Sqrt[t / (2 pi)]], chi(s) = pi^(s - 1/2) Gamma[(1 - s) / 2] / Gamma[s / 2]
+    // and the remainder integral I(s) from Zeta_Series::RiemannSiegelIntegral.
+    // Here * denotes the complex conjugate. The cost of the sums grows
+    // with the square root of the imaginary part t.
+    if(ef::isneg(s.imag()))
+    {
+      // Use Zeta(s*) = Zeta(s)*.
+      const ef::complex<e_float> z = RiemannSiegel(ef::complex<e_float>(s.real(), -s.imag()));
+
+      return ef::complex<e_float>(z.real(), -z.imag());
+    }
+
+    const std::int32_t N = ef::to_int32(ef::sqrt(s.imag() / ef::two_pi()));
+
+    const std::size_t n_end = static_cast<std::size_t>(N + RiemannSiegelPoles() + static_cast<std::int32_t>(1));
+
+    // The powers up to N are needed for the sums, and those up to N + P
+    // are needed for the residues in the remainder integrals.
+    std::vector<ef::complex<e_float>> n_pow_minus_s     (n_end);
+    std::vector<ef::complex<e_float>> n_pow_s_minus_one (n_end);
+
+    std::map<std::uint32_t, ef::complex<e_float>> n_pow_minus_s_prime_factor_map;
+    std::map<std::uint32_t, ef::complex<e_float>> n_pow_s_minus_one_prime_factor_map;
+
+    const ef::complex<e_float> s_minus_one = s - ef::one();
+
+    ef::complex<e_float> sum_minus_s    (ef::zero());
+    ef::complex<e_float> sum_s_minus_one(ef::zero());
+
+    for(std::size_t n = static_cast<std::size_t>(1U); n < n_end; n++)
+    {
+      n_pow_minus_s    [n] = Util::j_pow_x(static_cast<std::uint32_t>(n), -s,          n_pow_minus_s_prime_factor_map);
+      n_pow_s_minus_one[n] = Util::j_pow_x(static_cast<std::uint32_t>(n), s_minus_one, n_pow_s_minus_one_prime_factor_map);
+
+      if(n <= static_cast<std::size_t>(N))
+      {
+        sum_minus_s     += n_pow_minus_s[n];
+        sum_s_minus_one += n_pow_s_minus_one[n];
+      }
+    }
+
+    const ef::complex<e_float> integral = RiemannSiegelIntegral(s, N, n_pow_minus_s);
+
+    ef::complex<e_float> integral_reflected;
+
+    if(s.real() == ef::half())
+    {
+      // On the critical line, 1 - s* = s.
+      integral_reflected = ef::complex<e_float>(integral.real(), -integral.imag());
+    }
+    else
+    {
+      // Here n^-(1 - s*) = [n^(s - 1)]*.
+      for(std::size_t n = static_cast<std::size_t>(1U); n < n_end; n++)
+      {
+        n_pow_s_minus_one[n] = ef::complex<e_float>(n_pow_s_minus_one[n].real(), -n_pow_s_minus_one[n].imag());
+      }
+
+      const ef::complex<e_float> z = RiemannSiegelIntegral(ef::complex<e_float>(ef::one() - s.real(), s.imag()), N, n_pow_s_minus_one);
+
+      integral_reflected = ef::complex<e_float>(z.real(), -z.imag());
+    }
+
+    static const e_float ln_pi = ef::log(ef::pi());
+
+    const ef::complex<e_float> chi = ef::exp(  ((s - ef::half()) * ln_pi)
+                                             + (ef::lgamma((ef::one() - s) * ef::half()) - ef::lgamma(s * ef::half())));
+
+    return (sum_minus_s + integral) + (chi * (sum_s_minus_one + integral_reflected));
+  }
+
+  std::vector<std::uint32_t> FirstPrimes(const std::uint32_t n)
+  {
+    std::deque<std::uint32_t> prime_data;
+
+    ef::prime(n, prime_data);
+
+    return std::vector<std::uint32_t>(prime_data.cbegin(), prime_data.cend());
+  }
+
   template<typename T,
            typename TR>
   T Reflection(const T& s)
@@ -75,7 +469,6 @@ namespace Zeta_Series
     using ef::pow;
     using ef::real;
     using ef::tolerance;
-    using ef::prime;
     using ef::isneg;
     using ef::iszero;
     using ef::isint;
@@ -87,8 +480,6 @@ namespace Zeta_Series
     using ef::one;
     using ef::two;
     using ef::four;
-    using ef::hundred;
-    using ef::million;
 
     using std::fabs;
 
@@ -122,14 +513,7 @@ namespace Zeta_Series
     std::map<std::uint32_t, T> n_pow_s_prime_factor_map;
 
     // Generate a list of the first 300 prime numbers.
-    static std::deque<std::uint32_t> prime_data;
-
-    if(prime_data.empty())
-    {
-      prime(static_cast<std::uint32_t>(300U), prime_data);
-    }
-
-    static const std::vector<std::uint32_t> primes(prime_data.cbegin(), prime_data.cend());
+    static const std::vector<std::uint32_t> primes = Zeta_Series::FirstPrimes(static_cast<std::uint32_t>(300U));
 
     using std::log10;
 
@@ -162,79 +546,35 @@ namespace Zeta_Series
     }
     else
     {
-      static const TR very_large = million() + hundred();
-
-      if(fabs(TR(imag(s))) > very_large)
-      {
-        // Return NaN if s has a very large imaginary part.
-        return std::numeric_limits<TR>::quiet_NaN();
-      }
-
       // Use the accelerated alternating converging series for Zeta as shown in:
       // http://numbers.computation.free.fr/Constants/Miscellaneous/zetaevaluations.html
       // taken from P. Borwein, "An Efficient Algorithm for the Riemann Zeta Function",
       // January 1995.
 
-      // Compute the coefficients dk in a loop and calculate the zeta function sum
-      // within the same loop on the fly.
-
-      // Set up the factorials and powers for the calculation of the coefficients dk.
-      // Note that j = n at this stage in the calculation. Also note that the value of
-      // dn is equal to the value of d0 at the end of the loop.
+      // The coefficients dk do not depend on s. They are taken from a cache
+      // and the loop computes only the sum of the terms dk * j^-s.
 
       using std::fabs;
 
-      // Use N = (digits * 1.45) + {|imag(s)| * 1.1}
-      static const double nd = static_cast<double>(std::numeric_limits<TR>::digits10) * static_cast<double>(1.45);
-             const double ni = static_cast<double>(1.10 * fabs(to_double(imag(s))));
-
-      const std::int32_t N        = static_cast<std::int32_t>(static_cast<std::int64_t>(static_cast<double>(nd + ni)));
-            bool         neg_term = (N % static_cast<std::int32_t>(2)) == static_cast<std::int32_t>(0);
-
-      TR n_plus_j_minus_one_fact = factorial(static_cast<std::uint32_t>((N + N) - 1));
-      TR four_pow_j              = ef::detail::pown_template(four(), static_cast<std::int64_t>(N));
-      TR n_minus_j_fact          = one();
-      TR two_j_fact              = n_plus_j_minus_one_fact * static_cast<std::int32_t>(static_cast<std::int32_t>(2) * N);
+      const std::int32_t N = Zeta_Series::BorweinTerms(fabs(to_double(imag(s))));
 
-      TR dn = (n_plus_j_minus_one_fact * four_pow_j) / (n_minus_j_fact * two_j_fact);
+      const std::shared_ptr<const std::vector<e_float>> dk_set = Zeta_Series::BorweinCoefficients(N);
 
-      T jps = Util::j_pow_x(static_cast<std::uint32_t>(N), s, n_pow_s_prime_factor_map);
+      const std::vector<e_float>& dk = *dk_set;
 
-      T dn_term = ((!neg_term) ? dn : -dn);
+      const T minus_s = -s;
 
-      T zs = dn_term / jps;
+      T zs = ef::zero();
 
-      for(std::int32_t j = N - static_cast<std::int32_t>(1); j >= static_cast<std::int32_t>(0); j--)
+      for(std::int32_t j = N; j > static_cast<std::int32_t>(0); j--)
       {
-        const bool j_is_zero = (j == static_cast<std::int32_t>(0));
-
-        const std::int32_t two_jp1_two_j =
-            static_cast<std::int32_t>((static_cast<std::int32_t>(2) * j) + static_cast<std::int32_t>(1))
-          * static_cast<std::int32_t> (static_cast<std::int32_t>(2) * ((!j_is_zero) ? j : static_cast<std::int32_t>(1)));
-
-        n_plus_j_minus_one_fact /= static_cast<std::int32_t>(N + j);
-        four_pow_j              /= static_cast<std::int32_t>(4);
-        n_minus_j_fact          *= static_cast<std::int32_t>(N - j);
-        two_j_fact              /= two_jp1_two_j;
-
-        dn += ((n_plus_j_minus_one_fact * four_pow_j) / (n_minus_j_fact * two_j_fact));
-
-        if((!j_is_zero))
-        {
-          // Increment the zeta function sum.
-          jps = Util::j_pow_x(static_cast<std::uint32_t>(j), s, n_pow_s_prime_factor_map);
-
-          neg_term = (!neg_term);
-
-          dn_term = ((!neg_term) ? dn : -dn);
-
-          zs += (dn_term / jps);
-        }
+        // Increment the zeta function sum.
+        zs += (dk[static_cast<std::size_t>(j)] * Util::j_pow_x(static_cast<std::uint32_t>(j), minus_s, n_pow_s_prime_factor_map));
       }
 
       const T two_pow_one_minus_s = pow(two(), one() - s);
 
-      return zs / (dn * (one() - two_pow_one_minus_s));
+      return zs / (dk.front() * (one() - two_pow_one_minus_s));
     }
   }
 }
@@ -311,8 +651,164 @@ ef::complex<e_float> ef::riemann_zeta(const ef::complex<e_float>& s)
   {
     return ef::complex<e_float>(Zeta_Series::ZetaTemplate<e_float, e_float>(s.real()));
   }
+  else if(Zeta_Series::UsesRiemannSiegel(s))
+  {
+    return Zeta_Series::RiemannSiegel(s);
+  }
   else
   {
     return Zeta_Series::ZetaTemplate<ef::complex<e_float>, e_float>(s);
   }
 }
+
+void ef::riemann_zeta_table(std::vector<ef::complex<e_float>>& zeta_values,
+                            const ef::complex<e_float>& s0,
+                            const ef::complex<e_float>& ds,
+                            const std::uint32_t n)
+{
+  // Compute zeta_values[k] = Zeta[s0 + (k * ds)] for k = 0, 1, ..., n - 1.
+  // The powers j^-s of the Borwein series are advanced from one point to
+  // the next with a single multiplication and the sums are spread over
+  // threads. Points outside of the Borwein series are computed one by one.
+  zeta_values.resize(static_cast<std::size_t>(n));
+
+  std::vector<ef::complex<e_float>> s(static_cast<std::size_t>(n));
+
+  bool use_line_sums = false;
+
+  e_float abs_imag_max(ef::zero());
+
+  for(std::uint32_t k = static_cast<std::uint32_t>(0U); k < n; k++)
+  {
+    s[k]  = ds;
+    s[k] *= k;
+    s[k] += s0;
+
+    if(Zeta_Series::UsesBorweinSeries(s[k]))
+    {
+      use_line_sums = true;
+
+      abs_imag_max = (std::max)(abs_imag_max, ef::fabs(s[k].imag()));
+    }
+  }
+
+  if(n < static_cast<std::uint32_t>(2U))
+  {
+    use_line_sums = false;
+  }
+
+  if(!use_line_sums)
+  {
+    for(std::uint32_t k = static_cast<std::uint32_t>(0U); k < n; k++)
+    {
+      zeta_values[k] = ef::riemann_zeta(s[k]);
+    }
+
+    return;
+  }
+
+  // Use enough terms for the point with the largest imaginary part.
+  const std::int32_t N = Zeta_Series::BorweinTerms(ef::to_double(abs_imag_max));
+
+  // Hold the set of coefficients, since the points computed
+  // one by one may replace the cached set.
+  const std::shared_ptr<const std::vector<e_float>> dk_set = Zeta_Series::BorweinCoefficients(N);
+
+  const std::vector<e_float>& dk = *dk_set;
+
+  const std::size_t j_end = static_cast<std::size_t>(N + static_cast<std::int32_t>(1));
+
+  std::vector<ef::complex<e_float>> j_pow_minus_s (j_end);
+  std::vector<ef::complex<e_float>> j_pow_minus_ds(j_end);
+
+  std::map<std::uint32_t, ef::complex<e_float>> n_pow_ds_prime_factor_map;
+
+  for(std::size_t j = static_cast<std::size_t>(1U); j < j_end; j++)
+  {
+    j_pow_minus_ds[j] = Util::j_pow_x(static_cast<std::uint32_t>(j), -ds, n_pow_ds_prime_factor_map);
+  }
+
+  // Each thread handles a range of at least 64 indices j.
+  const std::size_t n_threads =
+    (std::max)(static_cast<std::size_t>(1U),
+               (std::min)(static_cast<std::size_t>(std::thread::hardware_concurrency()),
+                          static_cast<std::size_t>(N / static_cast<std::int32_t>(64))));
+
+  // The powers are recomputed directly after a number of points, which
+  // limits the accumulation of rounding errors from the advancing.
+  const std::uint32_t restart_period = static_cast<std::uint32_t>(64U);
+
+  std::vector<std::size_t> j_bounds(n_threads + 1U);
+
+  for(std::size_t t = static_cast<std::size_t>(0U); t <= n_threads; t++)
+  {
+    j_bounds[t] = static_cast<std::size_t>(1U) + ((t * (j_end - 1U)) / n_threads);
+  }
+
+  std::vector<std::vector<ef::complex<e_float>>> partial_sums(n_threads);
+
+  for(std::uint32_t k0 = static_cast<std::uint32_t>(0U); k0 < n; k0 += restart_period)
+  {
+    const std::uint32_t k1 = (std::min)(static_cast<std::uint32_t>(k0 + restart_period), n);
+
+    std::map<std::uint32_t, ef::complex<e_float>> n_pow_s_prime_factor_map;
+
+    const ef::complex<e_float> minus_s = -s[k0];
+
+    for(std::size_t t = static_cast<std::size_t>(0U); t < n_threads; t++)
+    {
+      partial_sums[t].resize(static_cast<std::size_t>(k1 - k0));
+    }
+
+    for(std::size_t j = static_cast<std::size_t>(1U); j < j_end; j++)
+    {
+      j_pow_minus_s[j] = Util::j_pow_x(static_cast<std::uint32_t>(j), minus_s, n_pow_s_prime_factor_map);
+    }
+
+    std::vector<std::thread> workers;
+
+    for(std::size_t t = static_cast<std::size_t>(1U); t < n_threads; t++)
+    {
+      workers.push_back(std::thread(Zeta_Series::BorweinLineSums,
+                                    std::cref(dk),
+                                    std::ref(j_pow_minus_s),
+                                    std::cref(j_pow_minus_ds),
+                                    j_bounds[t],
+                                    j_bounds[t + 1U],
+                                    std::ref(partial_sums[t])));
+    }
+
+    Zeta_Series::BorweinLineSums(dk,
+                                 j_pow_minus_s,
+                                 j_pow_minus_ds,
+                                 j_bounds[0U],
+                                 j_bounds[1U],
+                                 partial_sums.front());
+
+    for(std::size_t t = static_cast<std::size_t>(0U); t < workers.size(); t++)
+    {
+      workers[t].join();
+    }
+
+    for(std::uint32_t k = k0; k < k1; k++)
+    {
+      if(Zeta_Series::UsesBorweinSeries(s[k]))
+      {
+        ef::complex<e_float> zs(ef::zero());
+
+        for(std::size_t t = static_cast<std::size_t>(0U); t < n_threads; t++)
+        {
+          zs += partial_sums[t][k - k0];
+        }
+
+        const ef::complex<e_float> two_pow_one_minus_s = ef::pow(ef::two(), ef::one() - s[k]);
+
+        zeta_values[k] = zs / (dk.front() * (ef::one() - two_pow_one_minus_s));
+      }
+      else
+      {
+        zeta_values[k] = ef::riemann_zeta(s[k]);
+      }
+    }
+  }
+}
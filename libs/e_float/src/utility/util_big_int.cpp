@@ -0,0 +1,728 @@
+
+//          Copyright Christopher Kormanyos 1999 - 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+// This work is based on an earlier work:
+// "Algorithm 910: A Portable C++ Multiple-Precision System for Special-Function Calculations",
+// in ACM TOMS, {VOL 37, ISSUE 4, (February 2011)} (C) ACM, 2011. http://doi.acm.org/10.1145/1916461.1916469
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <memory>
+#include <sstream>
+#include <type_traits>
+
+#include <e_float/e_float_functions.h>
+#include <e_float/detail/e_float_detail_fft.h>
+
+#include <utility/util_big_int.h>
+
+// Moves take over the limb vector. They must not throw so that vectors
+// of big_int in the binary-splitting trees move rather than copy them.
+static_assert(std::is_nothrow_move_constructible<Util::big_int>::value, "Error: big_int must be nothrow move constructible");
+static_assert(std::is_nothrow_move_assignable   <Util::big_int>::value, "Error: big_int must be nothrow move assignable");
+
+namespace BigInt_Series
+{
+  typedef Util::big_int::limb_type limb_type;
+  typedef std::vector<limb_type>   array_type;
+
+  static const limb_type limb_base = Util::big_int::limb_base;
+
+  // Below this number of limbs, the schoolbook multiplication is used.
+  static const std::size_t karatsuba_threshold = static_cast<std::size_t>(32U);
+
+  // From this number of limbs of the shorter operand, the product is
+  // computed with the floating-point FFT of the efx back-end.
+  static const std::size_t fft_threshold = static_cast<std::size_t>(192U);
+
+  // The largest FFT size in points. The rounding error of the convolution
+  // grows with the size. For operands consisting of all nines, it reaches
+  // 0.04 at this size and exceeds 0.25 at four times this size. Larger
+  // products are split with Karatsuba multiplication down to this size.
+  static const std::uint32_t fft_max_points = static_cast<std::uint32_t>(1UL << 17U);
+
+  static void Normalize(array_type& u)
+  {
+    while((!u.empty()) && (u.back() == static_cast<limb_type>(0U)))
+    {
+      u.pop_back();
+    }
+  }
+
+  static std::int32_t CompareMagnitude(const array_type& u, const array_type& v)
+  {
+    if(u.size() != v.size())
+    {
+      return ((u.size() > v.size()) ? static_cast<std::int32_t>(1) : static_cast<std::int32_t>(-1));
+    }
+
+    for(std::size_t i = u.size(); i > static_cast<std::size_t>(0U); --i)
+    {
+      if(u[i - 1U] != v[i - 1U])
+      {
+        return ((u[i - 1U] > v[i - 1U]) ? static_cast<std::int32_t>(1) : static_cast<std::int32_t>(-1));
+      }
+    }
+
+    return static_cast<std::int32_t>(0);
+  }
+
+  static void AddAt(array_type& r, const limb_type* p, const std::size_t np, const std::size_t offset)
+  {
+    // Add p * base^offset to r. The sum is known to fit in r, such that
+    // excess limbs of p, if any, are zero.
+    limb_type   carry = static_cast<limb_type>(0U);
+    std::size_t i     = offset;
+
+    for(std::size_t j = static_cast<std::size_t>(0U); (j < np) && (i < r.size()); ++i, ++j)
+    {
+      const limb_type t = static_cast<limb_type>(r[i] + p[j] + carry);
+
+      carry = ((t >= limb_base) ? static_cast<limb_type>(1U) : static_cast<limb_type>(0U));
+      r[i]  = ((t >= limb_base) ? static_cast<limb_type>(t - limb_base) : t);
+    }
+
+    for( ; (carry != static_cast<limb_type>(0U)) && (i < r.size()); ++i)
+    {
+      const limb_type t = static_cast<limb_type>(r[i] + carry);
+
+      carry = ((t >= limb_base) ? static_cast<limb_type>(1U) : static_cast<limb_type>(0U));
+      r[i]  = ((t >= limb_base) ? static_cast<limb_type>(t - limb_base) : t);
+    }
+  }
+
+  static void SubtractMagnitude(array_type& r, const array_type& v)
+  {
+    // Compute r - v in r, where the magnitude of r is not less than that of v.
+    limb_type borrow = static_cast<limb_type>(0U);
+
+    for(std::size_t i = static_cast<std::size_t>(0U); i < r.size(); ++i)
+    {
+      const limb_type vi = ((i < v.size()) ? v[i] : static_cast<limb_type>(0U));
+
+      if((i >= v.size()) && (borrow == static_cast<limb_type>(0U)))
+      {
+        break;
+      }
+
+      const limb_type s = static_cast<limb_type>(vi + borrow);
+
+      borrow = ((r[i] < s) ? static_cast<limb_type>(1U) : static_cast<limb_type>(0U));
+      r[i]   = ((r[i] < s) ? static_cast<limb_type>((r[i] + limb_base) - s) : static_cast<limb_type>(r[i] - s));
+    }
+  }
+
+  static array_type Add(const limb_type* u, const std::size_t nu, const limb_type* v, const std::size_t nv)
+  {
+    array_type r(static_cast<std::size_t>((std::max)(nu, nv) + 1U), static_cast<limb_type>(0U));
+
+    AddAt(r, u, nu, static_cast<std::size_t>(0U));
+    AddAt(r, v, nv, static_cast<std::size_t>(0U));
+
+    return r;
+  }
+
+  template<const bool is_forward_fft>
+  static void Rfft(double* data, const std::uint32_t n_fft)
+  {
+    using ef::detail::fft::rfft_lanczos_template;
+
+    switch(n_fft)
+    {
+      default:
+      case   64U        : { rfft_lanczos_template<  64U        , is_forward_fft, double>::rfft(data); break; }
+      case  128U        : { rfft_lanczos_template< 128U        , is_forward_fft, double>::rfft(data); break; }
+      case  256U        : { rfft_lanczos_template< 256U        , is_forward_fft, double>::rfft(data); break; }
+      case  512U        : { rfft_lanczos_template< 512U        , is_forward_fft, double>::rfft(data); break; }
+      case 1024U        : { rfft_lanczos_template<1024U        , is_forward_fft, double>::rfft(data); break; }
+      case 2048U        : { rfft_lanczos_template<2048U        , is_forward_fft, double>::rfft(data); break; }
+      case 4096U        : { rfft_lanczos_template<4096U        , is_forward_fft, double>::rfft(data); break; }
+      case (1ULL << 13U): { rfft_lanczos_template<(1ULL << 13U), is_forward_fft, double>::rfft(data); break; }
+      case (1ULL << 14U): { rfft_lanczos_template<(1ULL << 14U), is_forward_fft, double>::rfft(data); break; }
+      case (1ULL << 15U): { rfft_lanczos_template<(1ULL << 15U), is_forward_fft, double>::rfft(data); break; }
+      case (1ULL << 16U): { rfft_lanczos_template<(1ULL << 16U), is_forward_fft, double>::rfft(data); break; }
+      case (1ULL << 17U): { rfft_lanczos_template<(1ULL << 17U), is_forward_fft, double>::rfft(data); break; }
+    }
+  }
+
+  static bool MultiplyFft(array_type& r, const limb_type* u, const std::size_t nu, const limb_type* v, const std::size_t nv)
+  {
+    // Multiply with the FFT in the same way as efx::e_float::mul_loop_fft,
+    // with the limbs split into half-limbs of base 10^4. Here, however, the
+    // full product is kept. The result is rejected and r is cleared if any
+    // point of the convolution is not close to an integer, such that the
+    // product is either exact or computed otherwise.
+    std::uint32_t n_fft = static_cast<std::uint32_t>(64U);
+
+    while(n_fft < static_cast<std::uint32_t>((nu + nv) * 2U))
+    {
+      n_fft <<= 1U;
+    }
+
+    if(n_fft > fft_max_points)
+    {
+      return false;
+    }
+
+    std::allocator<double> fft_alloc;
+
+    double* af = fft_alloc.allocate(n_fft);
+    double* bf = fft_alloc.allocate(n_fft);
+
+    for(std::size_t i = static_cast<std::size_t>(0U); i < nu; ++i)
+    {
+      af[(i * 2U)]      = static_cast<double>(u[i] % 10000U);
+      af[(i * 2U) + 1U] = static_cast<double>(u[i] / 10000U);
+    }
+
+    for(std::size_t i = static_cast<std::size_t>(0U); i < nv; ++i)
+    {
+      bf[(i * 2U)]      = static_cast<double>(v[i] % 10000U);
+      bf[(i * 2U) + 1U] = static_cast<double>(v[i] / 10000U);
+    }
+
+    std::fill(af + (nu * 2U), af + n_fft, 0.0);
+    std::fill(bf + (nv * 2U), bf + n_fft, 0.0);
+
+    Rfft<true>(af, n_fft);
+    Rfft<true>(bf, n_fft);
+
+    af[0U] *= bf[0U];
+    af[1U] *= bf[1U];
+
+    for(std::uint32_t j = static_cast<std::uint32_t>(2U); j < n_fft; j += 2U)
+    {
+      const double tmp_aj = af[j];
+
+      af[j + 0U] = (tmp_aj * bf[j + 0U]) - (af[j + 1U] * bf[j + 1U]);
+      af[j + 1U] = (tmp_aj * bf[j + 1U]) + (af[j + 1U] * bf[j + 0U]);
+    }
+
+    fft_alloc.deallocate(bf, n_fft);
+
+    Rfft<false>(af, n_fft);
+
+    // Release the carries from the least significant half-limb upward
+    // and re-combine the low and high parts into the limbs of r.
+    const double scale = 2.0 / static_cast<double>(n_fft);
+
+    bool          is_exact = true;
+    std::uint64_t carry    = static_cast<std::uint64_t>(0U);
+
+    for(std::size_t i = static_cast<std::size_t>(0U); (i < (nu + nv)) && is_exact; ++i)
+    {
+      std::uint32_t half_limbs[2U];
+
+      for(std::size_t j = static_cast<std::size_t>(0U); j < static_cast<std::size_t>(2U); ++j)
+      {
+        const double x  = af[(i * 2U) + j] * scale;
+        const double xr = std::floor(x + 0.5);
+
+        if(std::fabs(x - xr) > 0.25)
+        {
+          is_exact = false;
+        }
+
+        const std::uint64_t t = static_cast<std::uint64_t>(xr) + carry;
+
+        carry         = static_cast<std::uint64_t>(t / 10000U);
+        half_limbs[j] = static_cast<std::uint32_t>(t - (carry * 10000U));
+      }
+
+      r[i] = static_cast<limb_type>((half_limbs[1U] * 10000U) + half_limbs[0U]);
+    }
+
+    fft_alloc.deallocate(af, n_fft);
+
+    if(!is_exact)
+    {
+      std::fill(r.begin(), r.end(), static_cast<limb_type>(0U));
+    }
+
+    return is_exact;
+  }
+
+  static array_type Multiply(const limb_type* u, std::size_t nu, const limb_type* v, std::size_t nv)
+  {
+    if(nu < nv)
+    {
+      std::swap(u,  v);
+      std::swap(nu, nv);
+    }
+
+    array_type r(static_cast<std::size_t>(nu + nv), static_cast<limb_type>(0U));
+
+    if(nv == static_cast<std::size_t>(0U))
+    {
+      return r;
+    }
+
+    if((nv >= fft_threshold) && MultiplyFft(r, u, nu, v, nv))
+    {
+      return r;
+    }
+
+    if(nv < karatsuba_threshold)
+    {
+      // Schoolbook multiplication. The carry of each row goes into a limb
+      // which has not been written by the previous rows.
+      for(std::size_t i = static_cast<std::size_t>(0U); i < nu; ++i)
+      {
+        std::uint64_t carry = static_cast<std::uint64_t>(0U);
+
+        for(std::size_t j = static_cast<std::size_t>(0U); j < nv; ++j)
+        {
+          const std::uint64_t t =   static_cast<std::uint64_t>(r[i + j])
+                                  + (static_cast<std::uint64_t>(u[i]) * static_cast<std::uint64_t>(v[j]))
+                                  + carry;
+
+          carry    = static_cast<std::uint64_t>(t / limb_base);
+          r[i + j] = static_cast<limb_type>(t - (carry * limb_base));
+        }
+
+        r[i + nv] = static_cast<limb_type>(carry);
+      }
+    }
+    else if(nu >= static_cast<std::size_t>(nv * 2U))
+    {
+      // Unbalanced operands are multiplied in slices of the shorter length.
+      for(std::size_t offset = static_cast<std::size_t>(0U); offset < nu; offset += nv)
+      {
+        const std::size_t n_slice = (std::min)(nv, static_cast<std::size_t>(nu - offset));
+
+        const array_type p = Multiply(u + offset, n_slice, v, nv);
+
+        AddAt(r, p.data(), p.size(), offset);
+      }
+    }
+    else
+    {
+      // Karatsuba multiplication with u = u1 base^m + u0 and v = v1 base^m + v0.
+      const std::size_t m = static_cast<std::size_t>(nu / 2U);
+
+      const array_type z0 = Multiply(u,     m,      v,     m);
+      const array_type z2 = Multiply(u + m, nu - m, v + m, nv - m);
+
+      const array_type su = Add(u, m, u + m, nu - m);
+      const array_type sv = Add(v, m, v + m, nv - m);
+
+      array_type z1 = Multiply(su.data(), su.size(), sv.data(), sv.size());
+
+      SubtractMagnitude(z1, z0);
+      SubtractMagnitude(z1, z2);
+
+      AddAt(r, z0.data(), z0.size(), static_cast<std::size_t>(0U));
+      AddAt(r, z1.data(), z1.size(), m);
+      AddAt(r, z2.data(), z2.size(), static_cast<std::size_t>(m * 2U));
+    }
+
+    return r;
+  }
+
+  static array_type DivideMagnitude(const array_type& u, const array_type& v)
+  {
+    // The quotient of the magnitudes with Knuth's algorithm D. Both operands
+    // are scaled with d = base / (v_top + 1), such that the estimate of each
+    // quotient limb from the leading limbs is at most two too large.
+    if(CompareMagnitude(u, v) < static_cast<std::int32_t>(0))
+    {
+      return array_type();
+    }
+
+    const std::size_t n = v.size();
+
+    array_type q(static_cast<std::size_t>((u.size() - n) + 1U), static_cast<limb_type>(0U));
+
+    if(n == static_cast<std::size_t>(1U))
+    {
+      std::uint64_t r = static_cast<std::uint64_t>(0U);
+
+      for(std::size_t i = u.size(); i > static_cast<std::size_t>(0U); --i)
+      {
+        const std::uint64_t t = (r * limb_base) + u[i - 1U];
+
+        q[i - 1U] = static_cast<limb_type>(t / v[0U]);
+        r         = static_cast<std::uint64_t>(t - (static_cast<std::uint64_t>(q[i - 1U]) * v[0U]));
+      }
+
+      Normalize(q);
+
+      return q;
+    }
+
+    const std::uint64_t d = static_cast<std::uint64_t>(limb_base / (static_cast<std::uint64_t>(v.back()) + 1U));
+
+    array_type un(static_cast<std::size_t>(u.size() + 1U), static_cast<limb_type>(0U));
+    array_type vn(n,                                       static_cast<limb_type>(0U));
+
+    std::uint64_t carry = static_cast<std::uint64_t>(0U);
+
+    for(std::size_t i = static_cast<std::size_t>(0U); i < u.size(); ++i)
+    {
+      const std::uint64_t t = (static_cast<std::uint64_t>(u[i]) * d) + carry;
+
+      carry = static_cast<std::uint64_t>(t / limb_base);
+      un[i] = static_cast<limb_type>(t - (carry * limb_base));
+    }
+
+    un[u.size()] = static_cast<limb_type>(carry);
+
+    carry = static_cast<std::uint64_t>(0U);
+
+    for(std::size_t i = static_cast<std::size_t>(0U); i < n; ++i)
+    {
+      const std::uint64_t t = (static_cast<std::uint64_t>(v[i]) * d) + carry;
+
+      carry = static_cast<std::uint64_t>(t / limb_base);
+      vn[i] = static_cast<limb_type>(t - (carry * limb_base));
+    }
+
+    const std::uint64_t v1 = static_cast<std::uint64_t>(vn[n - 1U]);
+    const std::uint64_t v2 = static_cast<std::uint64_t>(vn[n - 2U]);
+
+    for(std::size_t j = q.size(); j > static_cast<std::size_t>(0U); )
+    {
+      --j;
+
+      // Estimate the quotient limb from the leading limbs.
+      const std::uint64_t num = (static_cast<std::uint64_t>(un[j + n]) * limb_base) + un[(j + n) - 1U];
+
+      std::uint64_t q_hat = static_cast<std::uint64_t>(num / v1);
+      std::uint64_t r_hat = static_cast<std::uint64_t>(num - (q_hat * v1));
+
+      while((q_hat >= limb_base) || ((q_hat * v2) > ((r_hat * limb_base) + un[(j + n) - 2U])))
+      {
+        --q_hat;
+
+        r_hat += v1;
+
+        if(r_hat >= limb_base)
+        {
+          break;
+        }
+      }
+
+      // Subtract q_hat times the divisor.
+      std::int64_t borrow = static_cast<std::int64_t>(0);
+
+      carry = static_cast<std::uint64_t>(0U);
+
+      for(std::size_t i = static_cast<std::size_t>(0U); i < n; ++i)
+      {
+        const std::uint64_t p = (q_hat * vn[i]) + carry;
+
+        carry = static_cast<std::uint64_t>(p / limb_base);
+
+        const std::int64_t t =   static_cast<std::int64_t>(un[i + j])
+                               - static_cast<std::int64_t>(p - (carry * limb_base))
+                               - borrow;
+
+        borrow    = ((t < static_cast<std::int64_t>(0)) ? static_cast<std::int64_t>(1) : static_cast<std::int64_t>(0));
+        un[i + j] = static_cast<limb_type>(t + (borrow * static_cast<std::int64_t>(limb_base)));
+      }
+
+      std::int64_t t_top = static_cast<std::int64_t>(un[j + n]) - static_cast<std::int64_t>(carry) - borrow;
+
+      if(t_top < static_cast<std::int64_t>(0))
+      {
+        // The estimate was one too large. Add the divisor back.
+        --q_hat;
+
+        limb_type c = static_cast<limb_type>(0U);
+
+        for(std::size_t i = static_cast<std::size_t>(0U); i < n; ++i)
+        {
+          const limb_type s = static_cast<limb_type>(un[i + j] + vn[i] + c);
+
+          c         = ((s >= limb_base) ? static_cast<limb_type>(1U) : static_cast<limb_type>(0U));
+          un[i + j] = ((s >= limb_base) ? static_cast<limb_type>(s - limb_base) : s);
+        }
+
+        t_top += static_cast<std::int64_t>(c);
+      }
+
+      un[j + n] = static_cast<limb_type>(t_top);
+      q[j]      = static_cast<limb_type>(q_hat);
+    }
+
+    Normalize(q);
+
+    return q;
+  }
+}
+
+Util::big_int::big_int(const std::int64_t n) : my_data(),
+                                                my_neg (n < static_cast<std::int64_t>(0))
+{
+  std::uint64_t un = static_cast<std::uint64_t>(my_neg ? -n : n);
+
+  while(un != static_cast<std::uint64_t>(0U))
+  {
+    my_data.push_back(static_cast<limb_type>(un % limb_base));
+
+    un /= limb_base;
+  }
+}
+
+Util::big_int::big_int(const std::string& str) : my_data(),
+                                                my_neg (false)
+{
+  std::size_t first = static_cast<std::size_t>(0U);
+
+  if((!str.empty()) && ((str[0U] == static_cast<char>('-')) || (str[0U] == static_cast<char>('+'))))
+  {
+    my_neg = (str[0U] == static_cast<char>('-'));
+
+    ++first;
+  }
+
+  // Read the digits in groups of eight, starting with the least significant ones.
+  for(std::size_t last = str.length(); last > first; )
+  {
+    const std::size_t begin = ((last - first) > static_cast<std::size_t>(8U)) ? static_cast<std::size_t>(last - 8U) : first;
+
+    limb_type limb = static_cast<limb_type>(0U);
+
+    for(std::size_t i = begin; i < last; ++i)
+    {
+      limb = static_cast<limb_type>((limb * 10U) + static_cast<limb_type>(str[i] - static_cast<char>('0')));
+    }
+
+    my_data.push_back(limb);
+
+    last = begin;
+  }
+
+  BigInt_Series::Normalize(my_data);
+
+  if(my_data.empty())
+  {
+    my_neg = false;
+  }
+}
+
+Util::big_int::big_int(const e_float& x, const std::int64_t n) : my_data(),
+                                                                 my_neg (false)
+{
+  // Take the digits from the decimal representation of x, which is exact
+  // for efx. Rounded to n_digits digits after the leading one, these are
+  // the digits of x 10^n up to one unit.
+  const std::int64_t n_digits = static_cast<std::int64_t>(n + x.order());
+
+  if((!ef::isfinite(x)) || ef::iszero(x) || (n_digits < static_cast<std::int64_t>(0)))
+  {
+    return;
+  }
+
+  std::stringstream ss;
+
+  ss << std::scientific << std::setprecision(static_cast<int>(n_digits)) << x;
+
+  const std::string str = ss.str();
+
+  const std::size_t pos_e = str.find_first_of("eE");
+
+  std::string str_digits;
+
+  for(std::size_t i = static_cast<std::size_t>(0U); i < pos_e; ++i)
+  {
+    if(str[i] != static_cast<char>('.')) { str_digits.push_back(str[i]); }
+  }
+
+  // The digits d0.d1...dk represent the integer d0d1...dk times 10^(exp - k).
+  const std::int64_t exp10 = static_cast<std::int64_t>(std::atoll(str.c_str() + (pos_e + 1U)));
+
+  const std::int64_t shift = static_cast<std::int64_t>((exp10 - n_digits) + n);
+
+  if(shift < static_cast<std::int64_t>(0))
+  {
+    str_digits.erase(static_cast<std::size_t>(static_cast<std::int64_t>(str_digits.length()) + shift));
+  }
+  else
+  {
+    str_digits.append(static_cast<std::size_t>(shift), static_cast<char>('0'));
+  }
+
+  *this = big_int(str_digits);
+}
+
+void Util::big_int::add_magnitude(const big_int& v, const bool v_neg)
+{
+  if(my_neg == v_neg)
+  {
+    my_data.resize(static_cast<std::size_t>((std::max)(my_data.size(), v.my_data.size()) + 1U), static_cast<limb_type>(0U));
+
+    BigInt_Series::AddAt(my_data, v.my_data.data(), v.my_data.size(), static_cast<std::size_t>(0U));
+  }
+  else if(BigInt_Series::CompareMagnitude(my_data, v.my_data) >= static_cast<std::int32_t>(0))
+  {
+    BigInt_Series::SubtractMagnitude(my_data, v.my_data);
+  }
+  else
+  {
+    std::vector<limb_type> r(v.my_data);
+
+    BigInt_Series::SubtractMagnitude(r, my_data);
+
+    my_data.swap(r);
+    my_neg = v_neg;
+  }
+
+  BigInt_Series::Normalize(my_data);
+
+  if(my_data.empty())
+  {
+    my_neg = false;
+  }
+}
+
+Util::big_int& Util::big_int::operator+=(const big_int& v)
+{
+  if(this == &v)
+  {
+    return mul_limb(static_cast<std::int32_t>(2));
+  }
+
+  add_magnitude(v, v.my_neg);
+
+  return *this;
+}
+
+Util::big_int& Util::big_int::operator-=(const big_int& v)
+{
+  if(this == &v)
+  {
+    my_data.clear();
+    my_neg = false;
+
+    return *this;
+  }
+
+  add_magnitude(v, (!v.my_neg));
+
+  return *this;
+}
+
+Util::big_int& Util::big_int::operator*=(const big_int& v)
+{
+  if(iszero() || v.iszero())
+  {
+    my_data.clear();
+    my_neg = false;
+
+    return *this;
+  }
+
+  std::vector<limb_type> r = BigInt_Series::Multiply(my_data.data(), my_data.size(), v.my_data.data(), v.my_data.size());
+
+  BigInt_Series::Normalize(r);
+
+  my_data.swap(r);
+  my_neg = (my_neg != v.my_neg);
+
+  return *this;
+}
+
+Util::big_int& Util::big_int::operator/=(const big_int& v)
+{
+  const bool q_neg = (my_neg != v.my_neg);
+
+  std::vector<limb_type> q = BigInt_Series::DivideMagnitude(my_data, v.my_data);
+
+  my_data.swap(q);
+  my_neg = ((!my_data.empty()) && q_neg);
+
+  return *this;
+}
+
+Util::big_int& Util::big_int::mul_limb(const std::int32_t n)
+{
+  if(n == static_cast<std::int32_t>(0))
+  {
+    my_data.clear();
+    my_neg = false;
+
+    return *this;
+  }
+
+  const std::uint64_t un = static_cast<std::uint64_t>((n < static_cast<std::int32_t>(0)) ? -static_cast<std::int64_t>(n) : static_cast<std::int64_t>(n));
+
+  std::uint64_t carry = static_cast<std::uint64_t>(0U);
+
+  for(std::size_t i = static_cast<std::size_t>(0U); i < my_data.size(); ++i)
+  {
+    const std::uint64_t t = (static_cast<std::uint64_t>(my_data[i]) * un) + carry;
+
+    carry      = static_cast<std::uint64_t>(t / limb_base);
+    my_data[i] = static_cast<limb_type>(t - (carry * limb_base));
+  }
+
+  while(carry != static_cast<std::uint64_t>(0U))
+  {
+    my_data.push_back(static_cast<limb_type>(carry % limb_base));
+
+    carry /= limb_base;
+  }
+
+  if(n < static_cast<std::int32_t>(0))
+  {
+    negate();
+  }
+
+  return *this;
+}
+
+void Util::big_int::split_limbs(const std::size_t n, big_int& hi, big_int& lo) const
+{
+  const std::size_t n_lo = (std::min)(n, my_data.size());
+
+  big_int h;
+  big_int l;
+
+  h.my_data.assign(my_data.begin() + static_cast<std::ptrdiff_t>(n_lo), my_data.end());
+  l.my_data.assign(my_data.begin(), my_data.begin() + static_cast<std::ptrdiff_t>(n_lo));
+
+  BigInt_Series::Normalize(l.my_data);
+
+  h.my_neg = ((!h.my_data.empty()) && my_neg);
+  l.my_neg = ((!l.my_data.empty()) && my_neg);
+
+  hi = std::move(h);
+  lo = std::move(l);
+}
+
+Util::big_int& Util::big_int::shift_limbs(const std::size_t n)
+{
+  if(!iszero())
+  {
+    my_data.insert(my_data.begin(), n, static_cast<limb_type>(0U));
+  }
+
+  return *this;
+}
+
+e_float Util::big_int::to_e_float() const
+{
+  if(iszero())
+  {
+    return ef::zero();
+  }
+
+  // Use the leading limbs which cover the working precision with guard
+  // limbs. These have the same base as the decimal limbs of the e_float
+  // constructor and scale with the power of ten of the remaining limbs.
+  const std::size_t n_keep = (std::min)(my_data.size(),
+                                        static_cast<std::size_t>((std::numeric_limits<e_float>::digits10 / 8) + 4));
+
+  std::vector<limb_type> leading_limbs(my_data.rbegin(), my_data.rbegin() + static_cast<std::ptrdiff_t>(n_keep));
+
+  return e_float(leading_limbs.data(),
+                 n_keep,
+                 static_cast<std::int64_t>((my_data.size() - 1U) * 8U),
+                 my_neg);
+}
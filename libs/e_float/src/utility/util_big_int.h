@@ -0,0 +1,111 @@
+//          Copyright Christopher Kormanyos 1999 - 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+// This work is based on an earlier work:
+// "Algorithm 910: A Portable C++ Multiple-Precision System for Special-Function Calculations",
+// in ACM TOMS, {VOL 37, ISSUE 4, (February 2011)} (C) ACM, 2011. http://doi.acm.org/10.1145/1916461.1916469
+
+#ifndef UTIL_BIG_INT_2021_07_31_H_
+  #define UTIL_BIG_INT_2021_07_31_H_
+
+  #include <cstdint>
+  #include <string>
+  #include <utility>
+  #include <vector>
+
+  #include <e_float/e_float.h>
+
+  namespace Util
+  {
+    // A signed integer of arbitrary size for exact intermediate results such
+    // as the products in binary splitting. The magnitude is stored in base 10^8
+    // limbs with the least significant limb first. Large products use the
+    // floating-point FFT of efx, with Karatsuba multiplication above its
+    // exact range. The conversion to e_float copies the leading limbs
+    // and is independent of the e_float back-end.
+    class big_int
+    {
+    public:
+      typedef std::uint32_t limb_type;
+
+      static const limb_type limb_base = static_cast<limb_type>(100000000U);
+
+      big_int() : my_data(), my_neg(false) { }
+
+      explicit big_int(const std::int64_t n);
+
+      // Construct from the decimal digits of an integer with an optional sign.
+      explicit big_int(const std::string& str);
+
+      // Construct the integer nearest to x 10^n.
+      big_int(const e_float& x, const std::int64_t n);
+
+      big_int(const big_int& other) : my_data(other.my_data), my_neg(other.my_neg) { }
+
+      big_int(big_int&& other) noexcept : my_data(std::move(other.my_data)), my_neg(other.my_neg) { }
+
+      ~big_int() { }
+
+      big_int& operator=(const big_int& other)
+      {
+        if(this != &other)
+        {
+          my_data = other.my_data;
+          my_neg  = other.my_neg;
+        }
+
+        return *this;
+      }
+
+      big_int& operator=(big_int&& other) noexcept
+      {
+        my_data = std::move(other.my_data);
+        my_neg  = other.my_neg;
+
+        return *this;
+      }
+
+      big_int& operator+=(const big_int& v);
+      big_int& operator-=(const big_int& v);
+      big_int& operator*=(const big_int& v);
+
+      // Divide with truncation toward zero. The divisor must not be zero.
+      big_int& operator/=(const big_int& v);
+
+      // Multiply with an integer having magnitude less than limb_base.
+      big_int& mul_limb(const std::int32_t n);
+
+      // Multiply with limb_base^n.
+      big_int& shift_limbs(const std::size_t n);
+
+      bool iszero() const { return my_data.empty(); }
+      bool isneg () const { return my_neg; }
+
+      std::size_t size() const { return my_data.size(); }
+
+      limb_type low_limb() const { return (iszero() ? static_cast<limb_type>(0U) : my_data.front()); }
+
+      // Split into hi base^n + lo, where lo has at most n limbs.
+      void split_limbs(const std::size_t n, big_int& hi, big_int& lo) const;
+
+      big_int& negate() { if(!iszero()) { my_neg = (!my_neg); } return *this; }
+
+      // Convert to e_float, keeping the leading digits of the working precision.
+      e_float to_e_float() const;
+
+    private:
+      std::vector<limb_type> my_data;
+      bool                   my_neg;
+
+      void add_magnitude(const big_int& v, const bool v_neg);
+    };
+
+    inline big_int operator+(const big_int& u, const big_int& v) { return big_int(u) += v; }
+    inline big_int operator-(const big_int& u, const big_int& v) { return big_int(u) -= v; }
+    inline big_int operator*(const big_int& u, const big_int& v) { return big_int(u) *= v; }
+    inline big_int operator/(const big_int& u, const big_int& v) { return big_int(u) /= v; }
+  }
+
+#endif // UTIL_BIG_INT_2021_07_31_H_
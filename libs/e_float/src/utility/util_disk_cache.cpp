@@ -0,0 +1,183 @@
+//          Copyright Christopher Kormanyos 1999 - 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+// This work is based on an earlier work:
+// "Algorithm 910: A Portable C++ Multiple-Precision System for Special-Function Calculations",
+// in ACM TOMS, {VOL 37, ISSUE 4, (February 2011)} (C) ACM, 2011. http://doi.acm.org/10.1145/1916461.1916469
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <random>
+#include <thread>
+
+#if defined(__unix__) || defined(__APPLE__)
+  #include <sys/stat.h>
+  #include <unistd.h>
+  #define UTIL_DISK_CACHE_HAS_POSIX
+#endif
+
+#include <e_float/e_float_serialize.h>
+
+#include <utility/util_disk_cache.h>
+
+namespace DiskCache_Series
+{
+  #if defined(E_FLOAT_TYPE_EFX)
+  static const char* const backend_name = "efx";
+  #elif defined(E_FLOAT_TYPE_GMP)
+  static const char* const backend_name = "gmp";
+  #elif defined(E_FLOAT_TYPE_MPFR)
+  static const char* const backend_name = "mpfr";
+  #endif
+
+  static const std::string& Directory()
+  {
+    // The environment is read once, at the first use of the cache.
+    static const std::string str_dir((std::getenv("E_FLOAT_CACHE_DIR") != nullptr) ? std::getenv("E_FLOAT_CACHE_DIR") : "");
+
+    return str_dir;
+  }
+
+  static std::string FileName(const std::string& name)
+  {
+    return   Directory()
+           + "/e_float_"
+           + backend_name
+           + "_"
+           + std::to_string(std::numeric_limits<e_float>::digits10)
+           + "_"
+           + name
+           + ".efbn";
+  }
+
+  // Create a new temporary file next to str_file, and return its name
+  // in str_temp. The name is unique among concurrent processes.
+  static bool CreateTempFile(const std::string& str_file, std::string& str_temp)
+  {
+    #if defined(UTIL_DISK_CACHE_HAS_POSIX)
+
+      str_temp = str_file + ".XXXXXX";
+
+      const int fd = ::mkstemp(&str_temp[0U]);
+
+      if(fd < 0)
+      {
+        return false;
+      }
+
+      // The mode of mkstemp is 0600. Make the entry readable
+      // by other users of a shared cache directory.
+      static_cast<void>(::fchmod(fd, static_cast<mode_t>(0644)));
+      static_cast<void>(::close(fd));
+
+      return true;
+
+    #else
+
+      // Without mkstemp, use a random suffix, mixed with the clock
+      // and the thread, and do not overwrite an existing file.
+      std::random_device rd;
+
+      const unsigned long long suffix =   ((static_cast<unsigned long long>(rd()) << 32) | static_cast<unsigned long long>(rd()))
+                                        ^ static_cast<unsigned long long>(std::chrono::steady_clock::now().time_since_epoch().count())
+                                        ^ static_cast<unsigned long long>(std::hash<std::thread::id>()(std::this_thread::get_id()));
+
+      str_temp = str_file + "." + std::to_string(suffix) + ".tmp";
+
+      std::ifstream probe(str_temp.c_str(), std::ios::in | std::ios::binary);
+
+      return (!probe.is_open());
+
+    #endif
+  }
+}
+
+bool Util::DiskCacheEnabled()
+{
+  return (!DiskCache_Series::Directory().empty());
+}
+
+bool Util::DiskCacheRead(const std::string& name, std::vector<e_float>& values)
+{
+  if(!DiskCacheEnabled())
+  {
+    return false;
+  }
+
+  std::ifstream in(DiskCache_Series::FileName(name).c_str(), std::ios::in | std::ios::binary);
+
+  return (in.is_open() && ef::read_binary(in, values));
+}
+
+bool Util::DiskCacheWrite(const std::string& name, const std::vector<e_float>& values)
+{
+  if(!DiskCacheEnabled())
+  {
+    return false;
+  }
+
+  // Write to a temporary file and rename it afterwards, such that
+  // concurrent processes never read a partially written entry.
+  const std::string str_file = DiskCache_Series::FileName(name);
+
+  std::string str_temp;
+
+  if(!DiskCache_Series::CreateTempFile(str_file, str_temp))
+  {
+    return false;
+  }
+
+  bool write_is_ok;
+
+  {
+    std::ofstream out(str_temp.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+
+    write_is_ok = (out.is_open() && ef::write_binary(out, values));
+  }
+
+  #if defined(UTIL_DISK_CACHE_HAS_POSIX)
+
+    // The rename atomically replaces an existing entry.
+    write_is_ok = (write_is_ok && (std::rename(str_temp.c_str(), str_file.c_str()) == 0));
+
+  #else
+
+    if(write_is_ok && (std::rename(str_temp.c_str(), str_file.c_str()) != 0))
+    {
+      // Some platforms do not rename onto an existing file. A reader
+      // might briefly miss the entry here, and then computes it again.
+      static_cast<void>(std::remove(str_file.c_str()));
+
+      write_is_ok = (std::rename(str_temp.c_str(), str_file.c_str()) == 0);
+    }
+
+  #endif
+
+  if(!write_is_ok)
+  {
+    static_cast<void>(std::remove(str_temp.c_str()));
+  }
+
+  return write_is_ok;
+}
+
+e_float Util::DiskCachedValue(const std::string& name, e_float (*pfn_calculate)())
+{
+  std::vector<e_float> values;
+
+  if(DiskCacheRead(name, values) && (values.size() == static_cast<std::size_t>(1U)))
+  {
+    return values.front();
+  }
+
+  values.assign(static_cast<std::size_t>(1U), pfn_calculate());
+
+  static_cast<void>(DiskCacheWrite(name, values));
+
+  return values.front();
+}
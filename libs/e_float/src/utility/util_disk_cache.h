@@ -0,0 +1,37 @@
+//          Copyright Christopher Kormanyos 1999 - 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+// This work is based on an earlier work:
+// "Algorithm 910: A Portable C++ Multiple-Precision System for Special-Function Calculations",
+// in ACM TOMS, {VOL 37, ISSUE 4, (February 2011)} (C) ACM, 2011. http://doi.acm.org/10.1145/1916461.1916469
+
+#ifndef UTIL_DISK_CACHE_2021_08_07_H_
+  #define UTIL_DISK_CACHE_2021_08_07_H_
+
+  #include <string>
+  #include <vector>
+
+  #include <e_float/e_float.h>
+
+  namespace Util
+  {
+    // An optional on-disk cache for values which are expensive to compute
+    // at high precision, such as constants and Bernoulli tables. The cache
+    // is enabled by setting the environment variable E_FLOAT_CACHE_DIR to
+    // an existing, writable directory. Each entry is stored in its own file
+    // keyed by the name of the entry, the backend and digits10, using the
+    // checksummed binary serialization. Missing or invalid entries are
+    // reported as not found, such that the caller computes them again.
+
+    bool DiskCacheEnabled();
+
+    bool DiskCacheRead (const std::string& name,       std::vector<e_float>& values);
+    bool DiskCacheWrite(const std::string& name, const std::vector<e_float>& values);
+
+    // Read a single value from the cache, or compute and store it.
+    e_float DiskCachedValue(const std::string& name, e_float (*pfn_calculate)());
+  }
+
+#endif // UTIL_DISK_CACHE_2021_08_07_H_
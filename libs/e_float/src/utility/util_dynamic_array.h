@@ -106,8 +106,8 @@
       }
 
       // Move constructor.
-      dynamic_array(dynamic_array&& other) : elem_count(other.elem_count),
-                                             elems     (other.elems)
+      dynamic_array(dynamic_array&& other) noexcept : elem_count(other.elem_count),
+                                                      elems     (other.elems)
       {
         other.elem_count = 0U;
         other.elems      = nullptr;
@@ -136,36 +136,34 @@
       {
         if(this != &other)
         {
-          std::copy(other.elems,
-                    other.elems + (std::min)(elem_count, other.elem_count),
-                    elems);
+          if((elems == nullptr) && (other.elem_count > 0U))
+          {
+            // This array has been moved from. Re-allocate its range
+            // so that it can receive the elements of the other array.
+            allocator_type my_a;
+
+            elems      = std::allocator_traits<allocator_type>::allocate(my_a, other.elem_count);
+            elem_count = other.elem_count;
+
+            std::uninitialized_copy(other.elems, other.elems + elem_count, elems);
+          }
+          else
+          {
+            std::copy(other.elems,
+                      other.elems + (std::min)(elem_count, other.elem_count),
+                      elems);
+          }
         }
 
         return *this;
       }
 
       // Move assignment operator.
-      dynamic_array& operator=(dynamic_array&& other)
+      dynamic_array& operator=(dynamic_array&& other) noexcept
       {
-        // Destroy the elements and deallocate the range.
-        pointer p = elems;
-
-        allocator_type my_a;
-
-        while(p != elems + elem_count)
-        {
-          std::allocator_traits<allocator_type>::destroy(my_a, p);
-
-          ++p;
-        }
-
-        std::allocator_traits<allocator_type>::deallocate(my_a, elems, elem_count);
-
-        elem_count = other.elem_count;
-        elems      = other.elems;
-
-        other.elem_count = 0U;
-        other.elems      = nullptr;
+        // Exchange the ranges. The elements previously held by *this
+        // are destroyed and deallocated along with the other array.
+        swap(other);
 
         return *this;
       }
@@ -212,7 +210,7 @@
         std::fill_n(begin(), elem_count, v);
       }
 
-      void swap(dynamic_array& other)
+      void swap(dynamic_array& other) noexcept
       {
         const size_type tmp_elem_count = elem_count;
         const pointer   tmp_elems      = elems;
@@ -224,7 +222,7 @@
         other.elems      = tmp_elems;
       }
 
-      void swap(dynamic_array&& other)
+      void swap(dynamic_array&& other) noexcept
       {
         const size_type tmp_elem_count = elem_count;
         const pointer   tmp_elems      = elems;
@@ -330,7 +328,7 @@
 
     template<typename ValueType, typename AllocatorType>
     void swap(dynamic_array<ValueType, AllocatorType>& x,
-              dynamic_array<ValueType, AllocatorType>& y)
+              dynamic_array<ValueType, AllocatorType>& y) noexcept
     {
       x.swap(y);
     }
@@ -0,0 +1,154 @@
+///////////////////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2021.
+//  Distributed under the Boost Software License,
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef UTIL_MAPPED_ALLOCATOR_2021_07_17_H_
+  #define UTIL_MAPPED_ALLOCATOR_2021_07_17_H_
+
+  #include <cstddef>
+  #include <cstdlib>
+  #include <new>
+  #include <string>
+
+  #if defined(__unix__) || defined(__APPLE__)
+    #include <sys/mman.h>
+    #include <unistd.h>
+    #define UTIL_MAPPED_ALLOCATOR_HAS_MMAP
+  #endif
+
+  namespace util
+  {
+    // A stateless allocator that backs large ranges with a memory-mapped
+    // temporary file instead of the heap. The operating system pages the
+    // range to and from the file, so the total storage may exceed the
+    // physical memory. The directory of the temporary files is taken from
+    // the environment variable E_FLOAT_MAPPED_STORAGE_DIR (default /tmp).
+    // Small ranges and platforms without mmap use the ordinary heap.
+
+    template<typename T>
+    class mapped_allocator
+    {
+    public:
+      using value_type      = T;
+      using pointer         = value_type*;
+      using const_pointer   = const value_type*;
+      using size_type       = std::size_t;
+      using difference_type = std::ptrdiff_t;
+
+      // Ranges smaller than this are allocated on the heap.
+      static constexpr size_type minimum_mapped_bytes = static_cast<size_type>(1UL << 20U);
+
+      template<typename U>
+      struct rebind { using other = mapped_allocator<U>; };
+
+      mapped_allocator() noexcept { }
+
+      template<typename U>
+      mapped_allocator(const mapped_allocator<U>&) noexcept { }
+
+      pointer allocate(const size_type count)
+      {
+        const size_type number_of_bytes = static_cast<size_type>(count * sizeof(value_type));
+
+        if(number_of_bytes < minimum_mapped_bytes)
+        {
+          return static_cast<pointer>(::operator new(number_of_bytes));
+        }
+
+        void* p = map_temporary_file(number_of_bytes);
+
+        if(p == nullptr)
+        {
+          throw std::bad_alloc();
+        }
+
+        return static_cast<pointer>(p);
+      }
+
+      void deallocate(pointer p, const size_type count) noexcept
+      {
+        if(p == nullptr)
+        {
+          return;
+        }
+
+        const size_type number_of_bytes = static_cast<size_type>(count * sizeof(value_type));
+
+        if(number_of_bytes < minimum_mapped_bytes)
+        {
+          ::operator delete(static_cast<void*>(p));
+        }
+        else
+        {
+          unmap(static_cast<void*>(p), number_of_bytes);
+        }
+      }
+
+    private:
+      #if defined(UTIL_MAPPED_ALLOCATOR_HAS_MMAP)
+
+      static void* map_temporary_file(const size_type number_of_bytes)
+      {
+        const char* p_dir = std::getenv("E_FLOAT_MAPPED_STORAGE_DIR");
+
+        std::string str_name = std::string((p_dir != nullptr) ? p_dir : "/tmp") + "/e_float_mapped_XXXXXX";
+
+        const int fd = ::mkstemp(&str_name[0U]);
+
+        if(fd < 0)
+        {
+          return nullptr;
+        }
+
+        // The file is unlinked immediately. Its storage lives
+        // as long as the mapping and is reclaimed on exit.
+        static_cast<void>(::unlink(str_name.c_str()));
+
+        void* p = nullptr;
+
+        if(::ftruncate(fd, static_cast<off_t>(number_of_bytes)) == 0)
+        {
+          p = ::mmap(nullptr, number_of_bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+
+          if(p == MAP_FAILED)
+          {
+            p = nullptr;
+          }
+        }
+
+        static_cast<void>(::close(fd));
+
+        return p;
+      }
+
+      static void unmap(void* p, const size_type number_of_bytes) noexcept
+      {
+        static_cast<void>(::munmap(p, number_of_bytes));
+      }
+
+      #else
+
+      static void* map_temporary_file(const size_type number_of_bytes)
+      {
+        return ::operator new(number_of_bytes, std::nothrow);
+      }
+
+      static void unmap(void* p, const size_type) noexcept
+      {
+        ::operator delete(p);
+      }
+
+      #endif
+    };
+
+    template<typename T, typename U>
+    bool operator==(const mapped_allocator<T>&, const mapped_allocator<U>&) noexcept { return true; }
+
+    template<typename T, typename U>
+    bool operator!=(const mapped_allocator<T>&, const mapped_allocator<U>&) noexcept { return false; }
+  }
+
+#endif // UTIL_MAPPED_ALLOCATOR_2021_07_17_H_
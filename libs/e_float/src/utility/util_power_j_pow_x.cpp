@@ -8,35 +8,190 @@
 // "Algorithm 910: A Portable C++ Multiple-Precision System for Special-Function Calculations",
 // in ACM TOMS, {VOL 37, ISSUE 4, (February 2011)} (C) ACM, 2011. http://doi.acm.org/10.1145/1916461.1916469
 
+#include <algorithm>
+#include <atomic>
+#include <list>
+#include <mutex>
+#include <utility>
+#include <vector>
+
 #include <e_float/e_float_functions.h>
 #include <e_float/detail/e_float_detail_pown_template.h>
 
 #include <functions/integer/prime_factors.h>
+#include <utility/util_noncopyable.h>
 #include <utility/util_point.h>
 #include <utility/util_power_j_pow_x.h>
 
 namespace Util
 {
-  static e_float logn(const std::uint32_t n)
+  class logn_cache : private util::noncopyable
   {
-    static std::map<std::uint32_t, e_float> ln_data;
+  public:
+    static logn_cache& instance()
+    {
+      // The precision of e_float is fixed at compile time,
+      // so a single cache serves all calls.
+      static logn_cache the_cache;
+
+      return the_cache;
+    }
 
-    const std::map<std::uint32_t, e_float>::const_iterator it = ln_data.find(n);
+    ~logn_cache() { clear(); }
 
-    if(it == ln_data.cend())
+    e_float value(const std::uint32_t n)
     {
-      const e_float ln = ef::log(e_float(n));
+      if(n < logn_cache_flat_size)
+      {
+        const e_float* p = my_flat[n].load(std::memory_order_acquire);
 
-      ln_data[n] = ln;
+        return ((p != nullptr) ? *p : *store(n, ef::log(e_float(n))));
+      }
+      else
+      {
+        return lru_value(n);
+      }
+    }
 
-      return ln;
+    void warm_up(const std::uint32_t n_max)
+    {
+      const std::uint32_t n_end = static_cast<std::uint32_t>((std::min)(static_cast<std::uint64_t>(static_cast<std::uint64_t>(n_max) + 1U),
+                                                                        static_cast<std::uint64_t>(logn_cache_flat_size)));
+
+      // Sieve the smallest prime factor of each n. Only the logarithms of
+      // the primes are computed. Those of the composite numbers follow from
+      // log(n) = log(p) + log(n / p) with the smallest prime factor p of n.
+      std::vector<std::uint32_t> smallest_factor(static_cast<std::size_t>(n_end), static_cast<std::uint32_t>(0U));
+
+      for(std::uint32_t p = static_cast<std::uint32_t>(2U); static_cast<std::uint64_t>(static_cast<std::uint64_t>(p) * p) < n_end; p++)
+      {
+        if(smallest_factor[p] == static_cast<std::uint32_t>(0U))
+        {
+          for(std::uint32_t j = static_cast<std::uint32_t>(p * p); j < n_end; j += p)
+          {
+            if(smallest_factor[j] == static_cast<std::uint32_t>(0U))
+            {
+              smallest_factor[j] = p;
+            }
+          }
+        }
+      }
+
+      for(std::uint32_t n = static_cast<std::uint32_t>(1U); n < n_end; n++)
+      {
+        if(my_flat[n].load(std::memory_order_acquire) == nullptr)
+        {
+          const std::uint32_t p = smallest_factor[n];
+
+          if(p == static_cast<std::uint32_t>(0U))
+          {
+            static_cast<void>(store(n, ef::log(e_float(n))));
+          }
+          else
+          {
+            // Both factors are smaller than n and have already been stored.
+            static_cast<void>(store(n, *my_flat[p].load(std::memory_order_acquire) + *my_flat[n / p].load(std::memory_order_acquire)));
+          }
+        }
+      }
     }
-    else
+
+    void clear()
     {
-      return it->second;
+      for(std::size_t i = static_cast<std::size_t>(0U); i < static_cast<std::size_t>(logn_cache_flat_size); i++)
+      {
+        delete my_flat[i].exchange(nullptr, std::memory_order_acq_rel);
+      }
+
+      const std::lock_guard<std::mutex> lock(my_mutex);
+
+      my_lru_list.clear();
+      my_lru_index.clear();
     }
-  }
 
+  private:
+    typedef std::list<std::pair<std::uint32_t, e_float>> lru_list_type;
+
+    std::atomic<const e_float*>                       my_flat[logn_cache_flat_size];
+    std::mutex                                        my_mutex;
+    lru_list_type                                     my_lru_list;
+    std::map<std::uint32_t, lru_list_type::iterator> my_lru_index;
+
+    logn_cache()
+    {
+      for(std::size_t i = static_cast<std::size_t>(0U); i < static_cast<std::size_t>(logn_cache_flat_size); i++)
+      {
+        my_flat[i].store(nullptr);
+      }
+    }
+
+    const e_float* store(const std::uint32_t n, const e_float& ln)
+    {
+      // Concurrent first accesses may both compute the entry.
+      // Only one of the results is kept.
+      const e_float* p_new = new e_float(ln);
+      const e_float* p     = nullptr;
+
+      if(my_flat[n].compare_exchange_strong(p, p_new, std::memory_order_acq_rel))
+      {
+        p = p_new;
+      }
+      else
+      {
+        delete p_new;
+      }
+
+      return p;
+    }
+
+    e_float lru_value(const std::uint32_t n)
+    {
+      {
+        const std::lock_guard<std::mutex> lock(my_mutex);
+
+        const std::map<std::uint32_t, lru_list_type::iterator>::const_iterator it = my_lru_index.find(n);
+
+        if(it != my_lru_index.cend())
+        {
+          // Move the entry to the front of the list of recently used entries.
+          my_lru_list.splice(my_lru_list.begin(), my_lru_list, it->second);
+
+          return it->second->second;
+        }
+      }
+
+      // Compute the logarithm without holding the lock.
+      const e_float ln = ef::log(e_float(n));
+
+      const std::lock_guard<std::mutex> lock(my_mutex);
+
+      if(my_lru_index.find(n) == my_lru_index.cend())
+      {
+        my_lru_list.push_front(std::make_pair(n, ln));
+
+        my_lru_index[n] = my_lru_list.begin();
+
+        if(my_lru_list.size() > logn_cache_lru_capacity)
+        {
+          my_lru_index.erase(my_lru_list.back().first);
+
+          my_lru_list.pop_back();
+        }
+      }
+
+      return ln;
+    }
+  };
+}
+
+e_float Util::logn(const std::uint32_t n) { return Util::logn_cache::instance().value(n); }
+
+void Util::logn_cache_warm_up(const std::uint32_t n_max) { Util::logn_cache::instance().warm_up(n_max); }
+
+void Util::logn_cache_clear() { Util::logn_cache::instance().clear(); }
+
+namespace Util
+{
   template<typename T> inline T j_pow_x_template(const std::uint32_t j, const T& x, std::map<std::uint32_t, T>& n_pow_x_prime_factor_map)
   {
     using ef::exp;
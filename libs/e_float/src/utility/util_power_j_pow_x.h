@@ -18,6 +18,23 @@
 
   namespace Util
   {
+    // The natural logarithm of the integer n. The values are cached.
+    // Those of n below Util::logn_cache_flat_size are kept in a table
+    // with lock-free reads. The others are kept in a mutex-protected
+    // cache which discards the least recently used entries beyond
+    // Util::logn_cache_lru_capacity. All functions are thread-safe,
+    // except that logn_cache_clear() may not overlap with other calls.
+    const std::uint32_t logn_cache_flat_size    = static_cast<std::uint32_t>(16384U);
+    const std::size_t   logn_cache_lru_capacity = static_cast<std::size_t>(4096U);
+
+    e_float logn(const std::uint32_t n);
+
+    // Fill the table for all n <= n_max, limited to the table size.
+    void logn_cache_warm_up(const std::uint32_t n_max);
+
+    // Release all cached logarithms.
+    void logn_cache_clear();
+
     e_float    j_pow_x(const std::uint32_t j, const e_float&    x, std::map<std::uint32_t, e_float>&    n_pow_x_prime_factor_map);
     ef::complex<e_float> j_pow_x(const std::uint32_t j, const ef::complex<e_float>& x, std::map<std::uint32_t, ef::complex<e_float>>& n_pow_x_prime_factor_map);
   }
@@ -0,0 +1,113 @@
+
+//          Copyright Christopher Kormanyos 1999 - 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+// This work is based on an earlier work:
+// "Algorithm 910: A Portable C++ Multiple-Precision System for Special-Function Calculations",
+// in ACM TOMS, {VOL 37, ISSUE 4, (February 2011)} (C) ACM, 2011. http://doi.acm.org/10.1145/1916461.1916469
+
+// Automatically generated file
+#include <array>
+
+#include <e_float/e_float_complex.h>
+#include <e_float/e_float_functions.h>
+#include <e_float/e_float_functions_complex.h>
+
+#include <../test/imag/test_case_imag.h>
+
+namespace test
+{
+  namespace imag
+  {
+    class TestCase_case_02203_z_lgamma_polygamma : public TestCaseImag
+    {
+    public:
+      TestCase_case_02203_z_lgamma_polygamma() { }
+      virtual ~TestCase_case_02203_z_lgamma_polygamma() { }
+    private:
+      virtual const std::string& name() const
+      {
+        static const std::string str("TestCase_case_02203_z_lgamma_polygamma");
+        return str;
+      }
+      virtual void e_float_test(std::vector<ef::complex<e_float>>& data) const
+      {
+        data.clear();
+
+        // The imaginary parts of log(Gamma(z)) follow the branch which
+        // is analytic apart from the cut along the negative real axis.
+        for(std::int32_t k = static_cast<std::int32_t>(0); k < static_cast<std::int32_t>(31); k++)
+        {
+          const e_float x = ef::tenth()   + ((static_cast<std::int32_t>(k - 15) * ef::pi()) / 2);
+          const e_float y = ef::quarter() + ((static_cast<std::int32_t>(k - 15) * ef::euler_gamma()) * 2);
+          data.push_back(ef::lgamma(ef::complex<e_float>(x, y)));
+        }
+
+        data.push_back(ef::lgamma (ef::complex<e_float>(ef::third(), 1000 * ef::pi())));
+        data.push_back(ef::lgamma (ef::complex<e_float>(-100 * ef::catalan(), -ef::euler_gamma())));
+        data.push_back(ef::digamma(ef::complex<e_float>(-ef::pi(), ef::euler_gamma())));
+        data.push_back(ef::digamma(ef::complex<e_float>(ef::third(), -1000 * ef::pi())));
+        data.push_back(ef::polygamma(2U, ef::complex<e_float>(ef::euler_gamma(), ef::catalan())));
+        data.push_back(ef::polygamma(7U, ef::complex<e_float>(-ef::pi(), -ef::third())));
+        data.push_back(ef::lgamma (ef::complex<e_float>(-100000 - ef::half(), 1)));
+        data.push_back(ef::lgamma (ef::complex<e_float>(-10 * ef::pi(), -ef::third())));
+        data.push_back(ef::polygamma(3U, ef::complex<e_float>(-250 - ef::eighth(), ef::euler_gamma())));
+      }
+      virtual const std::vector<ef::complex<e_float>>& control_data() const
+      {
+        static const std::array<ef::complex<e_float>, 40U> a =
+        {{
+           ef::complex<e_float>(e_float("-99.20177620905298956599795821497499818038296661307529515972669365821462924407462238739116225515435191923578763038049457180588184522509702239633589260007444402380523768020334061485976972001531475366372884152205820431683378157485312922519532666813520643924395989183592819219836812640303017609413579696060148718958291259345639463095729281802160499907936299007279487634138498124468158203213046952697243911"), e_float("19.80225620758913921343736186677896506698588801353338492025136554385654361668130808527225402628219012873543410000817968246962925644890927477878579256129007695610962036197472556090949962170633824091113216069198448433465520356069483113984142081399344598677158269904288980251735532163215337256846295899235939026353334230704768991144442690365535440442531265236855943709181346988612806288484558292821280083")),
+           ef::complex<e_float>(e_float("-91.03020101725568666349655658149130194945535146680761577955495983724310396195953137868524533683833673115913918032914774666950240206999603114694707491703922793953565233275832063011007188020495268691488946932931333717404522377897045352682447433243177184303701689782971994104090522366885427215741570244157534675263748084292748215231320918584224128163637784687211197954496511840773698840907665440496018471"), e_float("19.70346146425013495995744181821969328617900221748670398744432434163352243141222053428466635372062734565459590127557514911860616338700670546935923788168197198189165191962325033276633401136635738408270041321584837025495409386561759333113386938923777766209732185216656199730377078995234225905243546416208506781352098555228803334547230343144472420884699111268695766452299026758644809789912062244618075243")),
+           ef::complex<e_float>(e_float("-82.96885553941798255578985019462008153393767273618340106157712449887282699009081418617723098653034938364474897042437876530213430432090726600975481665727090946893944254646216496694545545790513079159944521441562198346827676922470257733401618272034343353258484614473901702688157389403129632481015668142200205902290158314231161966458698414882914877175675753836210028388222393393183549561267927339516444321"), e_float("19.52089079980472120725361435206580933545158699037497118045838958423875596222493280087394940194071596863084281713576290296322733008311061835626122030442343151958792341780725479138566603582812810897282985849693444223138318939940423233080990766479180535319197217789749634274722730290450620504464938575471614821182756760830080767270285042711809134953002579827381309804494223302492299241429326358825247322")),
+           ef::complex<e_float>(e_float("-75.02606166872771831250199881817325825455850719550028058226794409907457391262608280655824353564603708689956228443469023742107570158970072281031447703065189085997783884829756194668012598644461798455276020828341906089534741780316390435454016906858895348246913069649508903259204904345978556805751942963442454901026888314236199180227577357540243021007683908651864188965238934019070828850799005245870018951"), e_float("19.24798693912439648582939155184463960684412572220523187048661461386961767107013336505616460039125477880036990979612049014109688836536601144956464779587943845676462180362411043227602611784225223916852038725423632073047820322950608484271652025273536240376987705094108873705931693014498225260779331891623763172723976631535500487188009824911048713020205412873648990630986630550273848114390934913980197580")),
+           ef::complex<e_float>(e_float("-67.21150093651896758351403540812083392017575793924044144524297670074501801886111279947082125569854324036086117926903948076697770235811524229773544683013143487296769383246465353602807878887462136111539183833916683694333464495896440954643095495178489142715065024130410702799165077989664942323037411077744224952773899914954720640689031178264274302151836023284698355437781803550318786343159391989047795520"), e_float("18.87707851165854840971986173838514340597689629170660893903314434341683434959112652653906505009635356672272599023168147732960804042411210554126584423818088296743821013410797865350788833180623249572386925717363953252565041830344216734966577991765480974946647220080050662065599482124123694105390690323392364934297848334533414782196243430051059998849530655211049538476883081536205433305637843106697566081")),
+           ef::complex<e_float>(e_float("-59.53657749985493587553008817960863014637412144945442498569150639026259292188680630698331127643037823389036125114520446062640437231478444493054559144674490518555287079407181829890139113442219114280977334077849812054611971147101241035807397306383077550622578320086503406387984570873653662273623612064361634758151826946293702266837526217265811900323033132559961495717938775555517901489339075972949982068"), e_float("18.39906961042105616996098376121720972748834830476488183148762980541147856974223583604916512297929072771261259853486470635051386342160580058804489821891945235762637506531330492316859296882314070065648951221095239355251942824909736222028883287801612409855348564559608880506037681861834442622846280890024773634581759779829740052037929326270153836698051816687821110096857968326607239599246254264329784959")),
+           ef::complex<e_float>(e_float("-52.01492301682475870157017643085412848440156446353764306362108383342691610992213203797136933141877398814408768408954811769391457318055968262006257294226970556118322121853134092499458470212810398360581667935678176014324795696041203940497928641678705446349993113613609137587465411909134815395490870220915394413158094824497657545379401477643514689319014132979366002857957959023373652633689340639147309256"), e_float("17.80300212406341238152044109087686367732643123998735988582162140812908053012457026390223910620649679985277170148961195842007201706628759807541356629486811799343521587891130798864214656476849952720812697795335501673143448966338711839776295373662755458731215757406651560962958716143115058909595901052298088998369897853009035484728131792359212796449729201304762617560413344256346203889382307486433407898")),
+           ef::complex<e_float>(e_float("-44.66312027434660010759713183186927636266197270789548039052618106871756853931262128393211521445663524174626864191796905110866763378089468091795146328014734522992296478874051993750349934073223480962538963562915632498620971473591387703570490285906212936439296474134021106514366259934435636623686463540080444298961404843559488033177067143054167866929379630671503995353776385841797109779180525307538653463"), e_float("17.07541816805526628537030109804174667827296230261712247859574642290603347469887879854874073906954269281162896654937536809772304985809094157126302703529149533578898843845788968569866509835485847744643195006364592165307162632770659237363016028516905565823588907791889187139556900811142762350500698633091509155303411917711383356766690327316473406350216891744164256730609658010016893738747593088501854920")),
+           ef::complex<e_float>(e_float("-37.50177848899960196450453278652001781706263577998614770098761581725386177865696008086462882981013067118039803089909119911587810863048659811236211250596205589218474554490576406838864844102847663200408692127310580539837037582317693926074011248123392967897119976009696962814924967815253132777966976132277618884296378961147281266470197108961254582527845180002680502447433963614443696729028646477929999803"), e_float("16.19939364209266777535841473484413681568303662449189818697106946021572841728827043353428671839690782570930647182691496213192814452823031628504422247834609564044286727996867960386405628784480516150896059268206617122823916994543291173697401393743938374841638060032298582007988281884876993260017410829766018259555378074225548694844997047783202751701407680309681383779151882621114033068639599869451783396")),
+           ef::complex<e_float>(e_float("-30.55720355347816661355701246449041229356186658951382663187702666038493458550245498456571947522493071935581236134874525651333988739758533997455779857399287585508722809271429563259187994858918978324728645218124559301338418117248414584852584994058530564535147545030821085693343052644474871754512105394970177515357841385919030971245246588541611488462930204952833610122809208841292632103403103921338528027"), e_float("15.15299913352696254607797015986528466588803530873954798793354976938670934774851243413930304073395156000350476374901250140681761302835013561083933239903683179263404969581692284155014818082816049161456115220321031493971291637874044563227154114445633333851321855476801568053002413754027233525059994912544434909124618490087994197597223404051849326549438753297618837952248301835471830394253237934294740239")),
+           ef::complex<e_float>(e_float("-23.86414087406739944674430252668301604831935738548161270299566846392822419785302548774157809971759436347368346745138212920048418082460995153607645901739154213651076602167029351801491007286885709746247582075105801513034562750136215942832399266945666916485162155207079930180481871794568634650618468475120413682297688488903787678269794753539754860367414432691679189145173353547555305560426459331140123743"), e_float("13.90668930359712460604031636943627879360600439930975315447022798191949402552772138192959008337653431504731625671623529902882965939670933909045267299482851577743951374229862750300486992556688845414746741554628505909342321439549782928320968527594752093461834592114954708644153996951259018407704820230470734386054300898170699751375807659054471816744995008492889455767573074252930008577728321831939052150")),
+           ef::complex<e_float>(e_float("-17.47061632108659369752020412692946179649862474194382837403655321264388630029991604546018851783952000226831726510926535826140474262691750635227991231322349577238735434248241220111725486777064220483938328915361011760500757388550201618764961699588278421274322701423966517588358169654510015570755997654070550562219211171073266699867194962960728138475239235054334268262368807907216548699116340081285361387"), e_float("12.41848855321384008808133799315150201988060436740997130422433036305215917808132835888743690289141695201287851715993539504507487116687803985338618118679012315772624101548672804057292893125902156626019902058702354957885684009638752958742026849841976545672557259226354191619558241045923657832061382774328160927068451952897037899819993004039500318463264934781722203535825878428300129544507964004778491439")),
+           ef::complex<e_float>(e_float("-11.44735216656199150968457527659490195613477833006659794979811225498724178141800603246453914585365626073069846015617062036927225917184541313142595452944267288339513596194336539482854979157010079016300723602883748075400317991331351631879609620222684085913196180156029346586346182696032818632906283581294047914034922130638793028174765202325604037186702456574134773810657933663721178421592033357392887348"), e_float("10.62401213778570177444405924324990772730804448426558411380566377927038445691950623406779815475750360881122787594837028749508065897384060172295270533359609291963996694442651386897206855147221952114576833644109461478093425019781611976996304426440533425772842556699196125776312392338366291975244776267389146811306990436768568845106700512331418978468538784449640377238456817853472810826417843788348007936")),
+           ef::complex<e_float>(e_float("-5.908783525800757276565978017544061034875147430879676581650316946945962481281892741493439213022293249495757406071046912604796420385983063164809009809050145528257141451768388352008379280428909163327216151634408598302756251639099187563802913430897859331099801540447520092689887678323671332484434057887949713254155864867213808665778074731243760382006685630748765809573243653633973042325821609268447438818"), e_float("8.411780609240399155606930382154608246824473318146896438682057186048268497258736866014741811891327083229151000602628406956044626382329183542963995360100058689186038404426432868342210205650116873293937156866967934892064787120144982883762810135691852093673633175651852403464774590324970818778989206531571889471821204004566302348562075963690102420877408831425440565313002267104584277587723930483100326269")),
+           ef::complex<e_float>(e_float("-1.073835565828924823556772272144607211127512026565681070428382806778164110211657715199104654551916148908928746711482044383119383996964929090697867670063693642298624038312166060630735100151917606140043306666762647880801663052682765612345106038163213274316331044269967359306566082558578443317699926302851024345491888073244760673452889131304611254483684536633156388501810308733863727957587711216287036444"), e_float("5.540739960857720428663889505269672581878922648056594353844370292867858290275631633491398186528057721103573316538682709587029112248042206655887046973980153503200235215521328280062548898498609930092239646277338208241840277306505813417635589000518956329899851604595686640183951354483532936138304900594995309299895754629860796981890753965960016334261366028909974533218515181073070417101741714831348063213")),
+           ef::complex<e_float>(e_float("1.218133195241194223436657931460310491600745576432483705535933547710872359257983490329893667107419020161779479876062483643738550576157332890810108176152044421798156354547609189674729663398853310241644685823553462658810392352190902629571674959398975458269869058363227309844536072580626885301193506644075216000953288403572334116220608724802638480318671436861233622170331272729940542124813631454235251869"), e_float("-1.291503797742252897578047826424752156800652521801545485057957213122195661486187253155331110008830103635497485154051023187904932169170542093782432371667331840225806310553985864236144240953370855842372058020104976780542440854365049738311778520657032612640930082789057036113420767301109138337559283435082224524815524109776224796732646844578064949585181688162947240696442927008379070754154594005080530320")),
+           ef::complex<e_float>(e_float("-0.7903499540297236926138469470795203195849175718006084872394250541983556857546776991142608674324244247460756499102676301144529769174534581891564374332061863857256984572333129237722606447294956789770139688128722461826861600526819709543111752862714829512614622750201342221815644197944743984152480485887097703700920552192214628427595287224517784120138243353650973145578778074498951641124105551098872633366"), e_float("0.4858381914781099508616705165050074012439939095526725656053106263795722223124973268412645332451999876864940611616426992664420629404003233732541744524594511043196329245765888198089874352009197053352338862783989832039636552748591260221396085872389935534439289634423665795975478972869400084606069549552931889660083828434345654413263261637771532108334431060960699090889732512629408570978438554876446779600")),
+           ef::complex<e_float>(e_float("-0.1284774419522318080167718593132023548949637321781695759491405962787207255445603691333194707308476805834383873206404619799218357918878740806090669378595324937922501815781255770167309986607738154822526476433169916733626463538059742893502961550424460344766068567175373996899098073928762251049755226089897617888656825995512271649500553205850977310683927994116074449482578330941980949349257365465548488020"), e_float("2.889784459350660797292581939284187059180604100350667849475344608368256449795531366368510432899210616022579259604170612716778680956432263247246341328953109203018643739077255739072846970012318482486867152667506087734653937493063363225385432286698130369866564804979014139459811585110861445664786704627259544367692315910322426200468695479456701348500055999494486431652423147365067284782999390917197720108")),
+           ef::complex<e_float>(e_float("1.459858311289325438349653558192322646242600151371885830608946366934986205094258057952384951258388488139123767059160128303769908314280111730154311902183180670744114918335191070854640579676310940125927688257518451693015746536824144378054075865748680064359246066405457288563457453069751737223969382405332354218591280231712901047029262008824988956456206233114999664930811477929409377471797664056168805104"), e_float("5.813969736559574925429152901747217080074427867788845660257149876016832780886431108364464062093881082051390653039804825188551943889805760565901061298562008334608072671146096183851405113094069449093050870814665275523774700256807679133588030323707741472757712908884722159650413257450833271941157247014118095650171415886774912959984668940929550543605988489782104932146970528177424488410934584801685382508")),
+           ef::complex<e_float>(e_float("3.626536270258612020146808721308338040049419624521916468776129596394547750089871799322582426868124752379214288854879756281191011688704805707183662056653397409453505027564627546401218918235232225853848150727202535775784187697868658157082664036006478197441286879788023762329389810229570474330686825849951574296915548115750311528523736908466975256178425575331911822636751924461033019134719142812154679997"), e_float("9.097741707531423500042785573690515564291789821473418996456338410846670304441800425696696962850829782348001845786943741118160634446375173469130422727561329798552373542538482366392841703168381125749151354720701229272034264559481084252470218657196783538532092354035489839135564949345148072799144986518534299340703579510516551949744062118919636360320547223142780248100211572127646033940744508569419583824")),
+           ef::complex<e_float>(e_float("6.214937487227575113449308825423431396178227362447198055428933613769235753732982213784743792631642257699676234120920013112612547853354169493986018494062515654006020348035983790005489925969895961831462011992542611015708212468290003107588751461323819923703157302890703881979231444921887799043000715629042480966230148868072363087598080117325720242387666693638682496820355365277421776957470116804343746346"), e_float("12.65573150305832222503999786262887277722995031413661087185905028643488987463612055377170453318509681879900463581333251203472980316297558770304591322037978463354188886254835134041145152664656489860495772593912381028990323871421495655677051669411551824414705721835161743071452406344630556698253666079676436336172091083665980125020226524169404742387625536351658219127717212079103382013094950701891678658")),
+           ef::complex<e_float>(e_float("9.135468388930475298906195484518687084498800244601060884678069638394369180771452651356952059189366987271953057293540647298387819959013091892803867541253226997875646685874630840157094833368047845973322819357748019469696198051438605090171618194407411427247522553672105836871910605507437715123189768243236887278023327954953993732138186543295949675027884670442383217252861996106933897619562283119374150625"), e_float("16.43528483258550927906599926245196233926237891987731831853577492105594850977880323139915220999816366587545493482645678299998845468548850212407661624024352770015901802089569808299179257991708406875110288978680255847499809833246318294955729279909709357427018975515755493202265990872939442074309718148085340007938512982891040460050332526884871695693441748010772102944737868115093366483182236406651091838")),
+           ef::complex<e_float>(e_float("12.33001708769913759158178852335335512807554328565904473638983680603750413203710890458492237217919431504318371457996704598786949930946176168930784868758055509247294163165036059047213643981686036322030903462055355693329570612388807523899490095647776549713401202263285452719320527081579103186142757483755580835426909791078140835108213808110135419746356185404773434974608023428160262003763665583205418824"), e_float("20.40070761572170475324719688786164156916935076346137766217665125988230043334929108903138077910952643819026505763065377028668094641954665042741634875140596875070695788232296616705351377081514263603812723541554561414255053967603750049963299532318283311668357700913240670647437446427891968863519354239318090945174901952378975794913596900472863132733674599690808300611778530417445428197455668001856943492")),
+           ef::complex<e_float>(e_float("15.75781146331351165302118580778914390149181126026643838892695390169120358056430981598306759560034737931125432165554245392859977587279347142631599089473348307201210136216869032660484786700850029893896721302942343710351415289326024846234688888236424182223393554241988178139496761280037896981958546501093967114159768764854555624178827408661396889701469714412362557153636474288490667923623063054143429428"), e_float("24.52621185837790892451478011782917672465187237388120656779786371490553126322261828140441482116667157591002671207892171171207448985197186858684828260729659287911887743781764508985013055102931731540246522603452583887823168434123822408228654690933281549935704444655661513511864162101673618501226164108942678108602578648553189421552868770636576708728765709305042059873606139474409769230507116226558700980")),
+           ef::complex<e_float>(e_float("19.38865583051909584646598161328623522896196516400104558575649067141924617252482018936785033279939998529755940557845812862108334402512087263133240668605366650132535115645098215631633840492567679323284970318020885801052718185122055226963046166680805649657256397285770396051359067956595408558482393268011219431046635369028109834383616103001524866700146505432706991521015063864383397977323365588535325231"), e_float("28.79229478341269852040704905117451479068365534902145753664199680784270829921892446419506416760108946670294255718786705869503926363922181560622071423638866830844880848425178109540064124564221942397074790331283604985003087320663759013526492278445492207828027735945268795835078961103219102813199584064269829322800332519416152587976104376512544195371056829401010555125034213884808532764831820915332480393")),
+           ef::complex<e_float>(e_float("23.19928396344559385173330164478267206316662617470067081632705353182068109077273703421725459542106657822722932587222770680240872110052033444180048153339539232812337326572993434072840663003207267628030274244481624080016279394270306557921607195314949932553305502784301075027645968988049709578404664878949975362495930099541882665771036310853873930568426783886642120418808746809821995594272801622296620591"), e_float("33.18369055328405873343593342046948169917562279546014644299336642918374717442846323477592257021331253124580481108496875571933603558955677291624081892356619022576640160630224950184289535456913507532869307037491035425949619171458225505856418104269085820810756228465368664152522067681903371483867223063901527573296020149296435813144098059019519144859874817518494527959917753898070879503717325140448795661")),
+           ef::complex<e_float>(e_float("27.17121740407864437444144071387395040092722001096225196622834370917576844260680237786642539954454949771476572984425907694242769370365377588912125469256079602191497794358496934842997652783631980407232655581234036773333826240070907578697371676851917733429760960223737637750206837420923026076075161239906673659692951921244185026757779314171498430933193968378502707144906456851465811236330976211355303913"), e_float("37.68812473209247603286411959733105061003201996449874297448155415944726612126130863773820797614431052100559596845197390664722118198936322171070791688495776487094211770635945235991939207270282969009063908222472637510008310510289298757821822466270087076988177675826113480165041324508417880803324588990193086907213005086051648074894243426146664223224563645155467128818598375047272083169944047910763401559")),
+           ef::complex<e_float>(e_float("31.28942451680180314217805576041237980856370278883595672314620794142221765934685211261063320508175628038260456412052965874320802816490903469329859467633782261688450329516986684897021391434624079914078504260110813438514349643608949555331920784009023565851931184929163433295861949682629686767329971397502873003574193807571558385417958772246339939383307420456820169698903205686004231061749201986483047961"), e_float("42.29551338379046057824789246070188203022932182968438266125718097594122505115575130912456951413270162680819869710684145767883783843958383567564379003289439679240790886727797528328794310246717600514620661779420272780064390297533098850582347968918027359634922173300911970253142936816468316514390624332977021946696376902403188349766619061676084141118176696451863184950450106536714190642403930624764663534")),
+           ef::complex<e_float>(e_float("35.54143782558348575044664881418300194117311358151218050391890147582364901473844667534235543866022912252949801583150800404372747080547974242522713549533626419559018389884982252144096631511918777008853601694440969872222836165307402017737180570956123625070890205334300757637351073200467959943860444769358121744929103853071792199818651185026030247296343141243812099845051367386778726209570454340364259768"), e_float("46.99742466384979023857752286790059270800184028168716282234227712985677884570489963552941671177278613713060921095947592959499760500666553068892556352746127253904575233335491639243699185883023262017283793777612432068176751290265924981187178357703586130616549459437002403072585957824097789266134031334468108945701274989124543251743552064163632286716138489592135811377411489149132783394626965313995875810")),
+           ef::complex<e_float>(e_float("39.91674916895984805139707412143537434859486324321996389831347975102693547504422559960688054424533410891411911860976087262244160950206622300126116332610616635429875097775741728963086095428427578188323570965659208071684936438284260678039216964670406987110777643907369444869281478567978159837226397547922327580861294206224271297761147357325508808447758694941695325724527742483194006013552571523670590543"), e_float("51.78670350942548434101697069081444070679732708729221623666246502436207630013460499648687748863844206923542119703847430861605612887219762847606596723284244140947298802857311670896870221216932818121973362475960176594705269451296447149078912520212340128754041313606045823864232329082173436620046573763534282549491585299143906178780439591186025523275257429693182344626584073084472672298854990996693526155")),
+           ef::complex<e_float>(e_float("44.40638129641658738081004467397721497187227411946186539159988810312930067749822524765493157075235764118880872278374723532758969574212630942518860130183756413375661357824416612061936644444371104422225102436383867713627049088116635773232720727697642959021227807534206827765807162483783297760921271459170170544286720926722293153094383513393985898732001920202902620571751017458398118278460416557724742771"), e_float("56.65720201562572568847327252006031267829648179151778048857093262187101289944752656443569730758586156954894541709990290989372720176548650280064577686742434455104798351353645595081978204388022403654824772932530348115307326959180085951184847450014666000851610995938543928701304087887273875457401092628567408987365066037746862561427304086876803723980418515104916061211911338816934929622218964851660577646")),
+           ef::complex<e_float>(e_float("-4935.225342871654453464070077254350135116186624921931864811814688134386988176160325548776210434647268397881044495190055112164993958563972853297438081746195076699344498684234232674442889951664438784954899993181252616014399119733260867508357912559465004178726514832678803981679242012241249321700022846234114441296308532556907070422872230898390269128137459689173110875241177037105921633158599879055936367"), e_float("22155.77379283990157367480324117003160520980824867420238808139829892025950115747917473903301913902912485844369024341330458052735952261573210494191163929242940984782425691934994050537285032710779007713130998868384239602413589233918830757290661501963675893307037267278657523408073219054014040330567718571594692316582618246852437704026895903954411211769606748080566442746033756631878324144018800795598905")),
+           ef::complex<e_float>(e_float("-325.3551272731818935132402567556163704048873166481493891305616076088268335136285663208485304244135551553888073878603905045807506907149854479425383046932507835206458122142359754371105313030082708809071626506963903011568673327967345928376867896988222407569245075226009669066199536923555406567809881180021076897270146117816552634140204821281394820762816738627075169225250220635381638394743972557735619025"), e_float("286.7043730150423251592860681588053463216990572949132772536294359501241643527043525819482703390376103752488344958508821892667545735135226547490650245398986951540331418125516699658242126044493582275644148225130280278849008262006930754494087332095795090640960618078855518239559299853409116875474899454581895383078030028271606447324320766981158187384930422923043663109738787198199163684350622229495111983")),
+           ef::complex<e_float>(e_float("1.441963907692728899454077339527129327650300554697883640778067280489495242547440403414295263701328896406945577723640307802722902755776107047059468826596534826781045935082779797567131726578003444449964113035287862675190837040743164668095282792403310614374040237418582769788173403180577199750873758912081283412292055244469687038817481372223408922187440369342785600602956007308340662885241328399448055955"), e_float("3.089541177730275509003255590396076103915222352861193174072524119782994397732087304015199891950584793793855447604579498241978996807875453668485753385041334559927693241686069370680253248648815935373504717489736596623414097332983826160545583754760424157798547821235874541537595103443420319683453356521645803878669371110386667064900310211862051859008883949820544718321224746296542830021715402063487134670")),
+           ef::complex<e_float>(e_float("8.052485162017059861608458690689778110748324674922480108917522487639829037371069151358933738220291053630507605031233702377026145813091234360964156073738331410328086168156456765021476906541005435933879458820440410363809957947982818550740885678608205218212807230914388261534399978457211589348700734747894892537260062500892021110688966308362073075330306702568068505750780016280649666499059108832142898628"), e_float("-1.570849378442992084781793469223937324102741579118706029283227126790254313237206942931103772284882981679507425446219627160042724043469002356897843082011659957426608681453794984555034156005635219139440445483177903906808939951443575659077123267676355883429362832973818346243949491698837753839053549955058802058996161266450181545557510526832675787172384440727725620551109290705290377137387142063068905262")),
+           ef::complex<e_float>(e_float("1.436812808843983190697449368526364034536451579742742144567120679435742177028715617847206920543921958212300406429265815802216501340129773035637911831624434708772807744400939153845204133676468346246856586989617877738400766593468786070954710551231513104950842340400982608875352420611680462827154840627534572918753898297948451420407816352675590542908048570692135569163853849392554910258343671922521953032"), e_float("0.6467644097882481752804733875589020761734953091094584148959374755991603029181153471030633499391375337854775584870410755200550708852693521267269955109017481130825578360441912571173141635823610110227958040540168333086834025342589762586635084067189283068241644822057496549564829830943629776061394407292106548025782472078642850674343557089898251642558934371300067389070362466677291845531700829982865924214")),
+           ef::complex<e_float>(e_float("-1.699704922925673266842037951951459647245075935947852047999915951726714099508859861527928639580138111940628738065497740079938248003289640973112891634904323317076929530841451366353148981312699555708991913768076024635744199954944630977864503703093560062782500996298398518268794059482678929247100444009257663081787781767182830383897984218062939078697426629750002710898340757248100690021963863886980976863e7"), e_float("-1.222110298565702343509850169860873313505714675675816150234307000759694362848016937958053668081833223034158562014732830767502033559283760969783696874574701236512410464047857075038594038237548173406688413020270536917702817262382777870261982493885755733536807339210046213592854975388468641037627354024818613497601855939153994729269047192025269619722954308520578046234180129584186729149273237038397512915e6")),
+           ef::complex<e_float>(e_float("-1.0513062839418927964889905754086565177945804815720024915325137935198389086315771091529189220695625401068885705456482695054303826940182819519592511151108479789145084794915021861605021169704941240318765716484286374059901147937304358425404229685927692498826053542984691968317757995309874398343299771898426066967295316405006915487792209214700166226743585528221626207516259030438572557946953748808551894242e+6"), e_float("-314150.89401616797257783270825366722945585070355424049965439388456985944315558385878203902057601059531028699818667868734021691462734391023250340963173006629306472000277571449215605120159712648780717743080620175028397135717044526948027307860395759145970841292788663737984999398822334826327760755180040258492257465438821111493136706632948770629370619170886568197645692842007883983123348509932939075161783")),
+           ef::complex<e_float>(e_float("-78.840141663144589241743945968269112946748749137565164025529571992943411060138086399192532034027028193154398979632807888244062824170728790387562214910752538974468039493290455049660721643709570211610289583333745687795092294354671056717873131782767961822395427676225221509228319640703037309110745626974534575384746041287335782073948122711637507231137356355990473357902876386792026500863257645798853843985"), e_float("99.168494329552893422179690636033806677683158219072883151079730882449788803975468419919756983266335464414296077108899675708103970504803500956325590953791500975009109641123675978714391866526446141599393914195716114224153365597473525984192990822923326386689918609282540552754528589654267386927802433531337228614820334685338652936819368912687311132604222082108205882034735271968588500537599754415304370557")),
+           ef::complex<e_float>(e_float("28.705441732794264965399462101052858192581921549192650350663973616074306534509625389932915650647624161822075922054230179711700057378721394740293279719017730726919758264703104470458759233739724282900594752991142463403929857385483859204642232552993470655827440347289709246156389152999955969397389179594235000503424908970732893732358816100472389875664672729793055302488259742693292377040190370433313958571"), e_float("-38.69936423439460790343562233357380193134633016918531139041425963046999606409568658679130751128773196243877055611509239043340697955877653364229058768503146606396561195242377717227311417900633323840917089076098864495695094168781372961016497309532575001150566536586006795935012342754751299831055245430225413343898935155712350836411537381445853961771946041140857827139715291914109808126582450889401391447"))
+        }};
+        static const std::vector<ef::complex<e_float>> v(a.cbegin(), a.cend());
+        return v;
+      }
+    };
+
+    bool test_case_02203_z_lgamma_polygamma(const bool b_write_output)
+    {
+      return TestCase_case_02203_z_lgamma_polygamma().execute(b_write_output);
+    }
+  }
+}
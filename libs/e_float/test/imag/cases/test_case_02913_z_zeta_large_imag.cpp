@@ -0,0 +1,71 @@
+
+//          Copyright Christopher Kormanyos 1999 - 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+// This work is based on an earlier work:
+// "Algorithm 910: A Portable C++ Multiple-Precision System for Special-Function Calculations",
+// in ACM TOMS, {VOL 37, ISSUE 4, (February 2011)} (C) ACM, 2011. http://doi.acm.org/10.1145/1916461.1916469
+
+// Automatically generated file
+#include <array>
+
+#include <e_float/e_float_complex.h>
+#include <e_float/e_float_functions.h>
+#include <e_float/e_float_functions_complex.h>
+
+#include <../test/imag/test_case_imag.h>
+namespace test
+{
+  namespace imag
+  {
+    class TestCase_case_02913_z_zeta_large_imag : public TestCaseImag
+    {
+    public:
+      TestCase_case_02913_z_zeta_large_imag() { }
+      virtual ~TestCase_case_02913_z_zeta_large_imag() { }
+    private:
+      virtual const std::string& name() const
+      {
+        static const std::string str("TestCase_case_02913_z_zeta_large_imag");
+        return str;
+      }
+      virtual void e_float_test(std::vector<ef::complex<e_float>>& data) const
+      {
+        // N[Zeta[{1/2 + (500025/100) I, 3/10 + (1234567/10) I, 1/2 + (123456725/100) I,
+        //         4/5 + (27182818/10) I, 5/2 + (31415926/10) I, 1/2 - (100000001/10) I}], 400]
+
+        // These arguments use the Riemann-Siegel formula.
+        static const std::array<std::string, 6U> str_x = {{ "0.5",     "0.3",      "0.5",        "0.8",       "2.5",       "0.5" }};
+        static const std::array<std::string, 6U> str_y = {{ "5000.25", "123456.7", "1234567.25", "2718281.8", "3141592.6", "-10000000.1" }};
+
+        data.resize(str_x.size());
+
+        for(std::size_t k = static_cast<std::size_t>(0U); k < data.size(); k++)
+        {
+          data[k] = ef::riemann_zeta(ef::complex<e_float>(e_float(str_x[k]), e_float(str_y[k])));
+        }
+      }
+      virtual const std::vector<ef::complex<e_float>>& control_data() const
+      {
+        static const std::array<ef::complex<e_float>, 6U> a =
+        {{
+           ef::complex<e_float>(e_float("0.01562244393617380416408135756523749031942060316274266603188147531719794478476521460120018327920713963813845177236853057901675577498515482751439336708410042232753450396557741776250205847253590152565191901245781439478921382720350011446590058957801370113360257584571438166910944515171883866254692517529392678379830546876788328888362855255829045576462013191975906849963650395248849444156088009661339633900"), e_float("0.04970317818442986513350893958575553610056086487018698232712789972120608556055887390593835729829949289203420813363109101196356282138832068881258852687835460888827573881471546561044668306946247413440283479850366416584285867041841369347655120614250255906498739581699383936160526431309018817302415683225681922469475129720977620751733760668633817589889824719010540805644344503891639724819375408184435779028")),
+           ef::complex<e_float>(e_float("2.194656924884704132397104315567338103464835824241460926027672088880373915716477046159517196469557871556395230943548062434792720955800832605896986733424063680532968757944368940008273850427429336900597059666708323863427388973185908944520184081831701583174483468324317184276291304324526814797766340603487110176909516752346420909324065775698155342407616855851731687616398057202948704697393020728176073386"), e_float("-0.1749390599317928558681349906717667628952424960404129634808617469941201642305828846843113146639004626405333003294419522382100906053675522663306205508667833979740436990617241531526832741959438149062000558892080000207217328159528439620349555226699610435368618843143581047806575295242919938418598403164838920178716355372651181797647189409648327768832267400636395342586237767411659318010218542466086169918")),
+           ef::complex<e_float>(e_float("-0.03101923354098634126032720379032121857747041802173521142784475862017189438016034640999548304234633533457663078380100731130498943938011810467958649026422507442829141248814396745831915035390268959851440868339298331838558617937066875386732545481495719581417393944890469587187394119059933683013619724279652964460717694444936666457035214616286119869062194286667703451185707184606634655314891347007725173569"), e_float("0.06676790743230948293523702147165279667803174620306522397894859462512031046172282330736269629372810098466590455127796340852730904199301016393410562550140433495747240710965134372386993652150626835528146961747421634588316092338842970548411428594669746152859768360192698097611967025788784813665289664872579525681111978390160691642025338053451151386403979950222654983587527969420795452293318948192861207512")),
+           ef::complex<e_float>(e_float("0.7991306816937677078664094440689837671867868669545611591648444612072704456461207509001081579707324592847374837373427088795722521042779305197849817054623809917585104766826908713778420942965716101086873022171500343864149260929548232871720704630833908576006651362704796683867119847199720161681361265728096433364974217280238257267873586820035935761006155556737565973258062717720134768210072408487603867700"), e_float("0.4243832616143492094246373195308968648857381448588735543736963649493300126107514313077764338583783657954090098477083446049666527980793757313611502843739458308206804127390519549476142329785585477134904535311990569489476527681413971174394958148851095547184459389894249743466277091915070095792160349602391242096058645587898063495722391439469201869839520552441173428913791705422120358279203725298446847867")),
+           ef::complex<e_float>(e_float("0.9207750566500337743148752119525413501918638799243647037138145513109746263324864357698709666950649055526260998384540488988508996774977136146282179123087517374594354233583103135165129500792382343925651893890038895319228248588176644466322965712813064819254736971820829634284561517973586246515712776515359376719609891424861257210487147476030188270841481587740210255899810081281930316571170210438376247142"), e_float("0.03189916700227684512450646521401293144649834504280970138949828903203984650327434011580814965284671303786683147719895887128971652459298689732511101339920079415279886249644724213078484319933988091922289144750716269235781132574642529229180202711535199520890152638233513730990159128194730963690829283299343369266601341521623101352947433709664045867118212612631538117151692848422809477383641768655454317495")),
+           ef::complex<e_float>(e_float("1.769749753256180472640995428339094547620721434706396605098160257069039240477523610961820123934565046817032451253826880115441383627805672852555823733605970543414086214281471584373932378957803076959694007595384401747373526429289491268066710917023555737113541369801378051233560635870773432963370456726149087139571359234952737843137172441576896059601589072114283452035088080055387999391355320769805563792"), e_float("8.282714265217160593707502567777265746569293534900046549873158441507516197942237194805872359146497468232006533756399877564411141861661210187796859956503912226722764711285373641207823992035653694140987694571918234228978153600238601140087620005497358768609523878851784999703185640326888367492857417367681003076570320320955707086768625922394893681359545664406819565365274752475398054089414264993760231480"))
+        }};
+        static const std::vector<ef::complex<e_float>> v(a.cbegin(), a.cend());
+        return v;
+      }
+    };
+
+    bool test_case_02913_z_zeta_large_imag(const bool b_write_output)
+    {
+      return TestCase_case_02913_z_zeta_large_imag().execute(b_write_output);
+    }
+  }
+}
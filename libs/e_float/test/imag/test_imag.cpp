@@ -36,10 +36,13 @@ namespace test
     bool test_case_02126_z_atanh                  (const bool b_write_output);
     bool test_case_02201_z_gamma                  (const bool b_write_output);
     bool test_case_02202_z_gamma_medium_x         (const bool b_write_output);
+    bool test_case_02203_z_lgamma_polygamma       (const bool b_write_output);
     bool test_case_02901_z_zeta_small_x           (const bool b_write_output);
     bool test_case_02902_z_zeta_all_x             (const bool b_write_output);
     bool test_case_02903_z_zeta_neg_x             (const bool b_write_output);
     bool test_case_02911_z_zeta_crit_strip        (const bool b_write_output);
+    bool test_case_02912_z_zeta_table             (const bool b_write_output);
+    bool test_case_02913_z_zeta_large_imag        (const bool b_write_output);
   }
 }
 
@@ -67,10 +70,13 @@ bool test::imag::test_imag(const bool b_write_output)
   test_ok &= test::imag::test_case_02126_z_atanh                  (b_write_output);
   test_ok &= test::imag::test_case_02201_z_gamma                  (b_write_output);
   test_ok &= test::imag::test_case_02202_z_gamma_medium_x         (b_write_output);
+  test_ok &= test::imag::test_case_02203_z_lgamma_polygamma       (b_write_output);
   test_ok &= test::imag::test_case_02901_z_zeta_small_x           (b_write_output);
   test_ok &= test::imag::test_case_02902_z_zeta_all_x             (b_write_output);
   test_ok &= test::imag::test_case_02903_z_zeta_neg_x             (b_write_output);
   test_ok &= test::imag::test_case_02911_z_zeta_crit_strip        (b_write_output);
+  test_ok &= test::imag::test_case_02912_z_zeta_table             (b_write_output);
+  test_ok &= test::imag::test_case_02913_z_zeta_large_imag        (b_write_output);
 
   return test_ok;
 }
@@ -0,0 +1,135 @@
+//          Copyright Christopher Kormanyos 1999 - 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+// This work is based on an earlier work:
+// "Algorithm 910: A Portable C++ Multiple-Precision System for Special-Function Calculations",
+// in ACM TOMS, {VOL 37, ISSUE 4, (February 2011)} (C) ACM, 2011. http://doi.acm.org/10.1145/1916461.1916469
+
+#include <sstream>
+#include <string>
+
+#include <e_float/e_float_functions.h>
+#include <e_float/e_float_serialize.h>
+
+#include <../test/real/test_case_real.h>
+
+namespace test
+{
+  namespace real
+  {
+    class TestCase_case_00005_binary_serialize : public TestCaseReal
+    {
+    public:
+      TestCase_case_00005_binary_serialize() : my_test_result(false) { }
+      virtual ~TestCase_case_00005_binary_serialize() { }
+    private:
+      mutable bool my_test_result;
+
+      virtual const std::string& name() const
+      {
+        static const std::string str("TestCase_case_00005_binary_serialize");
+        return str;
+      }
+      virtual const std::vector<e_float>& control_data() const
+      {
+        static const std::vector<e_float> dummy(1U, ef::one());
+        return dummy;
+      }
+      virtual void e_float_test(std::vector<e_float>& data) const
+      {
+        data.clear();
+
+        data.push_back(ef::pi());
+        data.push_back(-ef::euler_gamma());
+        data.push_back(ef::zero());
+        data.push_back(ef::googol() * ef::googol());
+        data.push_back(ef::one() / ef::googol());
+        data.push_back(e_float("1e1234"));
+        data.push_back(e_float(123456789U));
+
+        my_test_result = true;
+
+        // Round-trip the whole array.
+        std::stringstream ss(std::ios::in | std::ios::out | std::ios::binary);
+
+        my_test_result &= ef::write_binary(ss, data);
+
+        std::vector<e_float> data_read;
+
+        my_test_result &= ef::read_binary(ss, data_read);
+        my_test_result &= (data_read.size() == data.size());
+
+        for(std::size_t i = 0U; my_test_result && (i < data.size()); ++i)
+        {
+          my_test_result &= (data_read[i] == data[i]);
+        }
+
+        // Round-trip single values, including non-finite ones.
+        const e_float values[3U] = { ef::sqrt(ef::two()),
+                                     std::numeric_limits<e_float>::infinity(),
+                                     std::numeric_limits<e_float>::quiet_NaN() };
+
+        for(std::size_t i = 0U; i < 3U; ++i)
+        {
+          std::stringstream ss_single(std::ios::in | std::ios::out | std::ios::binary);
+
+          e_float x;
+
+          my_test_result &= ef::write_binary(ss_single, values[i]);
+          my_test_result &= ef::read_binary (ss_single, x);
+
+          my_test_result &= (ef::isnan(x) == ef::isnan(values[i]));
+          my_test_result &= (ef::isinf(x) == ef::isinf(values[i]));
+          my_test_result &= (ef::isnan(x) || (x == values[i]));
+        }
+
+        // A corrupted byte must be detected by the checksum.
+        std::string str_corrupt = ss.str();
+
+        str_corrupt[str_corrupt.length() / 2U] = static_cast<char>(str_corrupt[str_corrupt.length() / 2U] ^ 0x10);
+
+        std::stringstream ss_corrupt(str_corrupt, std::ios::in | std::ios::binary);
+
+        my_test_result &= (!ef::read_binary(ss_corrupt, data_read));
+      }
+    public:
+      virtual bool execute(const bool b_write_output) const
+      {
+        std::cout << name() << " : ";
+
+        std::vector<e_float> e_float_data;
+
+        // Calculate the e_float test data.
+        e_float_test(e_float_data);
+
+        // Optionally write the e_float test data to an output file.
+        if(b_write_output)
+        {
+          if(!write_output_file(e_float_data))
+          {
+            std::cout << "Can not write output: FAIL" << std::endl;
+            return false;
+          }
+        }
+
+        if(my_test_result)
+        {
+          std::cout << "Numerical compare OK: PASS"  << std::endl;
+          return true;
+        }
+        else
+        {
+          std::cout << "Numerical compare not OK: FAIL"  << std::endl;
+          return false;
+        }
+      }
+    };
+
+    bool test_case_00005_binary_serialize(const bool b_write_output)
+    {
+      return TestCase_case_00005_binary_serialize().execute(b_write_output);
+    }
+  }
+}
@@ -0,0 +1,64 @@
+//          Copyright Christopher Kormanyos 1999 - 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+// This work is based on an earlier work:
+// "Algorithm 910: A Portable C++ Multiple-Precision System for Special-Function Calculations",
+// in ACM TOMS, {VOL 37, ISSUE 4, (February 2011)} (C) ACM, 2011. http://doi.acm.org/10.1145/1916461.1916469
+
+#include <array>
+
+#include <e_float/e_float_functions.h>
+#include <functions/constants/constants_util.h>
+
+#include <../test/real/test_case_real.h>
+
+namespace test
+{
+  namespace real
+  {
+    class TestCase_case_00031_glaisher_large_m : public TestCaseReal
+    {
+    public:
+      TestCase_case_00031_glaisher_large_m() { }
+      virtual ~TestCase_case_00031_glaisher_large_m() { }
+    private:
+      virtual const std::string& name() const
+      {
+        static const std::string str("TestCase_case_00031_glaisher_large_m");
+        return str;
+      }
+      virtual void e_float_test(std::vector<e_float>& data) const
+      {
+        // The Euler-Maclaurin summation for Glaisher's constant around M.
+        // Its hyperfactorial exceeds the range of the exponent for M above
+        // 16384, which is the M of precisions above about 16.4k digits.
+        data.clear();
+        data.push_back(ConstantsUtil::CalculateGlaisher());
+        data.push_back(ConstantsUtil::CalculateLogGlaisher(static_cast<std::uint32_t>(1000U)));
+        data.push_back(ConstantsUtil::CalculateLogGlaisher(static_cast<std::uint32_t>(32768U)));
+        data.push_back(ConstantsUtil::CalculateLogGlaisher(static_cast<std::uint32_t>(131072U)));
+        data.push_back(ef::exp(ConstantsUtil::CalculateLogGlaisher(static_cast<std::uint32_t>(131072U))));
+      }
+      virtual const std::vector<e_float>& control_data() const
+      {
+        static const std::array<e_float, 5U> a =
+        {{
+           e_float("1.2824271291006226368753425688697917277676889273250011920637400217404063088588264611297364919582023744"),
+           e_float("0.24875447703378426254725299357611397609736971366853511699985563969069303299991050609285843366584208887"),
+           e_float("0.24875447703378426254725299357611397609736971366853511699985563969069303299991050609285843366584208887"),
+           e_float("0.24875447703378426254725299357611397609736971366853511699985563969069303299991050609285843366584208887"),
+           e_float("1.2824271291006226368753425688697917277676889273250011920637400217404063088588264611297364919582023744"),
+        }};
+        static const std::vector<e_float> v(a.cbegin(), a.cend());
+        return v;
+      }
+    };
+
+    bool test_case_00031_glaisher_large_m(const bool b_write_output)
+    {
+      return TestCase_case_00031_glaisher_large_m().execute(b_write_output);
+    }
+  }
+}
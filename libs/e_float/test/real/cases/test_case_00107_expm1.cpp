@@ -0,0 +1,109 @@
+
+//          Copyright Christopher Kormanyos 1999 - 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+// This work is based on an earlier work:
+// "Algorithm 910: A Portable C++ Multiple-Precision System for Special-Function Calculations",
+// in ACM TOMS, {VOL 37, ISSUE 4, (February 2011)} (C) ACM, 2011. http://doi.acm.org/10.1145/1916461.1916469
+
+// Automatically generated file
+#include <array>
+
+#include <e_float/e_float_functions.h>
+
+#include <../test/real/test_case_real.h>
+
+namespace test
+{
+  namespace real
+  {
+    class TestCase_case_00107_expm1 : public TestCaseReal
+    {
+    public:
+      TestCase_case_00107_expm1() { }
+      virtual ~TestCase_case_00107_expm1() { }
+    private:
+      virtual const std::string& name() const
+      {
+        static const std::string str("TestCase_case_00107_expm1");
+        return str;
+      }
+      virtual void e_float_test(std::vector<e_float>& data) const
+      {
+        data.resize(51U);
+        for(std::int32_t k = static_cast<std::int32_t>(0); k < static_cast<std::int32_t>(data.size()); k++)
+        {
+          const e_float x = ((ef::one() + k) / static_cast<std::int32_t>(7)) * ef::pow(ef::ten(), static_cast<std::int64_t>(-(k / 2)));
+
+          data[static_cast<std::size_t>(k)] = ef::expm1(((k % 2) == 0) ? x : -x);
+        }
+      }
+      virtual const std::vector<e_float>& control_data() const
+      {
+        static const std::array<e_float, 51U> a =
+        {{
+           e_float("0.1535649948951077534613396244718624419956877327396609515388010824768403702721068430359913621823586086741271265908218014302214338249120254650483070652782415994617573108768974738182046287050629739033419486869001424832016363694863014629718800163163760337294646420435540169505935186924494963365781455963144866780933997164375395141511248724768654288172693678813319022751951435311022677247703158688002670657"),
+           e_float("-0.2485227069247140522009420824811987995671582274883146049326491166347977250193237230367048335122692638543880542867265668833367901249973587466203551137456297296942600963763337482648782716981772863783095889623568107607992780348315489732343604871317419652587365975455590527336036781733520246839969360266531371604274645484267363025661890511964830224564632003086360272612563992642634629443059327179992148500"),
+           e_float("4.3788771517554185307386328653523581429629848985835711084725827571155120277725575320785016591989848074762936782080642114036234439811319450022814564285544887037550560092343124357650084391357685905528096281478175290519581802442296747068650727993081783474903500329054108617824193883723970905632849364862074931080438688340159116956555970615310324968099518427384670446280893382726513622432831611448649333942e-2"),
+           e_float("-5.5540863005130130593963883562120010537163573364828254191293713247312051368730213988529131012482549601278606449321975853169287513027632652770528269081955515059564850608879720802798581658386541390496107427871859682709512781986789514941042363569688730680674816773056784972692816844467768601238805919689867437149389214235129212040245842245043881157442467885993779513724258742984436018500842302635462913922e-2"),
+           e_float("7.1684281941368043095956387945777776107870833820927121477983348140739939751208847786481557864747230509975182783300596864375085750728754718654974639008747846051702798972576567851226861345983672655804796984729305746947153323476979066872919858957549831789417360953253568955782905257076183348685172668133547152523029905215536907249021345220949771706786199693510170477267123999618031323991068112961519004775e-3"),
+           e_float("-8.5347986092979564574454954582628807051138319681443169531169856612720880351021118251870433612263628974971748867202242592969960675885873679116334945178544901752551953732987175578428558539353728837672723916175265684833564771167904381188888301795043013013269951680066675563262041928006905329180436816569141567000183543087565144815038547955272857383902383318004221495503918960033905409883490944049491185598e-3"),
+           e_float("1.0005001667083416680557539930583115630762005807014602285146744603597482514482984127182260041532609430682188720950993420636786961196238409723309055317683119235561984980236529093776777302838684862874098703172243368272906685243422270076506460803353776835394018643729355574114241076044969921559104238683620132925246925925297594332415740568434283435494855101046726180595909185975881728201221689344436681637e-3"),
+           e_float("-1.1422043303468161885719715342888911249610578355058438825617474513769778219428659147647067324489581706183946810640174254675625082868962199365049570392914367226787444252901516518002001850247199872410634542506849456402288056609751088121050956505466051793521608201686185263135648143828038918590665236125430072222021180950936977589747710198963264224874612497520062269272560573203783630862181710398568805077e-3"),
+           e_float("1.2857969423178981182964570991727414813149827562433232426988483789789836930853518930012836513391716412573341050052268592328968671674715549640618535041097651990808510420393786554130477275990738763711823699204115030582196998067376799992572110049443131784699758065845900952806024263115456276370132817236487840865934122066596853668776325264487859322496278597564073625994793753855502585408194117105052293004e-4"),
+           e_float("-1.4284693926140149987107365530339067479918828844386859008700561920867829838785411817276915112214568713729739379520851907176616592488757805389714264740058661191830483356846293352721437089358543081699565189125150261019958417108869262599623077376211792004592028449385221848424254900795089418761311813622749063106820145344565061619560558458204137971933331682331058190984038133351879665586348883867470066639e-4"),
+           e_float("1.5714409184320216340595240644860335227166843222926178044878503023650650553816644215662496718376923189592770885611356516740140949461222842984918288565581366629609055606150773396675150981640706986390461676174217966036244193228859318079443750902275480106103666921164048992146541987233180029037130933968018857207976324896934971284306203028100043459634212426350183407170659687257553016428711633918304740529e-5"),
+           e_float("-1.7142710204921279200345532183467859109609087837400682750115108297125686936092177215187826428696699055400773618024649632996883642592688981982577106594667983832034136107104244669648440780621070988217223188915142423385462577918589074428996395882881821512782419710465923828374740375852559564172328442477920198452258020506867788998468871798056639512002021846461919643818913556921729075143372792297913018106e-5"),
+           e_float("1.8571445816337206030223693358387948097292296751456292496451455408402966376259808805310679309615027834164723646446536694819765697021413470741702844810880891599960623035397304039791924206828210490033940244983029591553150638574526714176894195137095146760488501041555762585837901177180494253028688225080463380571096657326715780229481279059246693697361339469339388189915374328764270002223968599646703121386e-6"),
+           e_float("-1.9999980000013333326666669333332444444698412634920649029979541446721179969002204379980278393227387905059866416853246745740652980852244853795187548319114419889797549514653321454830693233729024740165902998461299979708542313094505444212181609399604616970066821113966110646536043857709913298458648215288527645365935633269162656991637211452667286381484610807841536553271892224218690335739609712451777255614e-6"),
+           e_float("2.1428573724489959912545228550980432273814748093307459973684623941039283211395506385039682311409956869582141026239217176540271425067487987312782168725623270359101436983697859379107522503841359773597873017709937943062656630174316787295633362770574303362475287154946055903693727310144406742874598099981092918624282115685094015002037754773185012460859477098477519060638437927569186923432889814523190220321e-7"),
+           e_float("-2.2857140244898158211844798001352896590733151327521608027405691213692394250581404631546120714099873941657977648717633008392325593581225892947294737791048033732068955061838729479091844176788923013962300163568091092589532138136057440053957077893792154970123223156299525703785895854970739944990288360321509013846012517764069909963155609441154861121085204756780637169031490634433849334838353759249625655896e-7"),
+           e_float("2.4285714580612247285228391559246217838648863917824816740504248857696351427571526310068844115702085504570134907182313023893171758177525966055655216352241583568399418824418349209903109155788699980873868134013464336748422009204154847467307641673186188518924160990759861083149104462560858803967946513846885588898662950863895262647324084698906725732967392424707808360773541050159199179506042703184285902433e-8"),
+           e_float("-2.5714285383673472221574325805914296105193862768065801934181712213248907960747246741992305071029669893462262065207193868578099429178087139064266024728557617945119069357513675299477759495746461334745969829330856269556055421064465843221328069321781764672595775153718081420611246085465622956999952469910582028814454998247208981997983121338604378982323654685138321618757827840019521162955752059787661713376e-8"),
+           e_float("2.7142857179693877584348882432722650296880759014696951787171336441678265100029504098323887833676791394343405359697105504666984038709614215714808665819879269132645242055405625510537533005810675699151303537007118218291356076578918241604005226885717996670415484404746027366213963337718017357402086163509960830248789986073566004614828859034825213419353909624762048626043815261044804248508083816686109034372e-9"),
+           e_float("-2.8571428530612244936831875579619602959084508431388659867973856434802580211938768989921866918442275706495501382643181202629505892622054492887641372603454226815803841969331280387153622229958536132360659993769973480722155144404165508705961182004957651003236475355347616619718309907230986003327941803566431449952037862796934171325507029088069223125162378628056630340401053095599748325028439422533615653732e-9"),
+           e_float("3.0000000004500000000450000000033750000002025000000101250000004339285714448437500005424107143019866071433009334415695363230522040849775279639445377149803321698895761047351797608253895793184064937228400798077838707936458861223799932295250335324662927271111768957878792109240871226426262437108750343822587507251227936148368257489602356748696983787267298552440567867003486473205773711397173425854435127153e-10"),
+           e_float("-3.1428571423632653061741885325518142440652284579837632161127125189861251406999923349807282104545411720221984744250281113506630625860429279518664245833754759950740102707129108029515762589983662947964905032187475895999236652300194998872645436810473416088968648439741594705780602334828038545363722490740788214331426391460382079570713862595906896694062347010500313668763024499897490731731266249407251660454e-10"),
+           e_float("3.2857142857682653061230401846452915424302374329958896096628718204630049062325284236236511785871789125753272683039158303678161447397809183056257802124883055220350704211428106418923817750156644511067226757287714637886738585346371161999973425323696481526043259719464571167608875126563499037495091277972889605142089739865040883887124592315614192896276962250672930934417003462172736974929014367223465385959e-11"),
+           e_float("-3.4285714285126530612251615160349796651395252373149283034573852731440981395888553134054162922291268074341186894878208872782470849770601434531906421424108387328192470885156522945423989691942116823839774535324609604962338239854698730277009334943355568337497772200252142765915137616130968193674253329829065343793137321779264695641889740917190266870143016353754217055012821756668092821827092922909421665824e-11"),
+           e_float("3.5714285714349489795918443270165209008507739830674548427242645985165029513940424408315618988990161045043280698236551924776877272744072558040230015520618014914078807941359702716628915531575472488185843540307032926228125696662307123349721979521866789451658945123425755607021684707344684891200132845078032293613005842522964294403507240423291747816951842278794937005496315974661292167654011149354642832262e-12"),
+           e_float("-3.7142857142788163265306207852283770571814521727117081057495848182614764653512011410079393280385350948520592481434923423417194860828325591274424746094649862652785377363935277069732490021391186350433154989094633127688898716799464102387534616255939286496659758802427970643028460680303808758418263071238723655753783445868546858091953423462800636184336796865819845840235020459131489225917209713708622578425e-12"),
+           e_float("3.8571428571436010204081633609475218658984353915035409030417385613594747097297919786421660523408301657868269406753197407810341518637014543320640552569592915346381742199082658056352258143302488139980209259400861150886698064149367736422011475092834862179653649389044523116179607877880888014324651048256300732351913331579136369022353130131824694205191352254882378795439932715651079697178708908031584334359e-13"),
+           e_float("-3.9999999999992000000000001066666666666560000000000008533333333332764444444444476952380952379326984126984199223985890649667724867724972801026134355965154187376517369050702380956562543864213276513805612281944980357727070845029138384678392286396347274468503014991245735143842025210123516733271557290246339975867809082007869779468402985749243678492231550640039135875187582423951109341213830088738260817853e-13"),
+           e_float("4.1428571428572286734693877562871234207969024587151187006431405019733848080393101986081011961666153131858412516896802366383581102051448551670026005163865564038459206591606178975178841850556209003338693803875009546469179084642982168647650279825151817442948585134387452782414297534367175345291158339166123074477299836454555157515623752817125240307766178822860244266113843134280566808227968639679768199973e-14"),
+           e_float("-4.2857142857141938775510204094752186588921142232403165348976616885821375341056872561655424012034413394801981394130498447671073646430409402499061015864913914373261376694565816902492351636632446382220749468193574769142548144535186797850315336602173823803330100833225138829805127209802517974033014362683245117702663131441036956291677237199689580182160271802503894233975851981635189043303397565667715714064e-14"),
+           e_float("4.4285714285714383775510204081777410106899902978536894349576707270537077804987659110409400533399481205470577268546306476344254116621233013051700298612674400090551550260477384143991991625749213509575654153464760077181253785753205036622427765890681326771558325901543226264470200991878774954499474685066383570095470161901742539564558715827076338735720756461886868279796959850051921597801194427425618245134e-15"),
+           e_float("-4.5714285714285609795918367347097998056365403122210190198528557319529561095448497245573225902333205642696417365644706253365340172716783905223491735015910205114592391233950757308040978950491356420943744470192617167618319593241186542776032060176254426741875434424584421749260706868378026942850548656836807105747059269279277203031494024865281810909755947170918526767262660781931323244143171629565026788432e-15"),
+           e_float("4.7142857142857153969387755102042562536443148688252450541441066241811642470399239937190721978087464237329115957347856615714403485983043868005073443516536563414377370905932470071364875021847533921573697983672264142806422682842930036635606578864193453404422543376861396445351868575017705486075787746524986946758669652566374585063463111640619123813778340204702354935311891457821945516408787103854681967686e-16"),
+           e_float("-4.8571428571428559632653061224491705733722060252440591420241566036688792368259255231894571517347868082307090912584096047125491299260745912389305403812670177753780003110810796291223822638983955746581351484664704306755551786605057054191627846953003655138964829597418309983767959141755342181778997273088525681804710836054612441473725733381944709479491439853941825997121839529571144980949814008261402139819e-16"),
+           e_float("5.0000000000000001250000000000000020833333333333333593750000000000002604166666666666688368055555555555710565476190476191445002480158730164112447641093474453719204695767195889520515171556838733191340070680350418458735516027189695036859130361137825390277130521912445584955156817970521271241923001486302230860323075435403971921951018397305600058841318327416010146429896212189992898508333200660244059779385e-17"),
+           e_float("-5.1428571428571427248979591836734716548104956268221282865472719700127946003450943059413821547144472116398881967998548430900424773428556220014533388020838561769379919624138887065120250234080754315352878149552188015629721390313014211227130481449567686015690583718510531266274185929067087367532976225264933006475561146921757268789950257498372012488729926041278029233687838681016995266864684039851779658080e-17"),
+           e_float("5.2857142857142857282551020408163265552249757045675413347591454949326669787112299438725927991753059359242794944824724346271642678084077720227435740014171207208724813648928158217650042341812166425605255091162998284002562242721492470075681784811571594955723577118288122840205331369620585393558733022859941987456606087172757375737847482361086138119792498242838990978506231731916640877111219537684078462418e-18"),
+           e_float("-5.4285714285714285566938775510204081899280855199222545799469665417187283469363796830685626665035592690498384830089207165269981475029943381379623610780500684539184266402072409989059264071843770065600521213672923260583011741666340867683593980897738372665208793568308513305816625027680447978708105388698122892434232678236358488598616438907908733155195163907605023135477712652966314205745118476455587921639e-18"),
+           e_float("5.5714285714285714301234693877551020411045626822157434402733833298625572678095547588802284762305576030491121896489038561123597327991049949221996166600424530078334645856883632423231920932737067600283341922839090607137349959919170968477637917155518672594687530957455318000634036182380105684573851544095261579040015679942286075261110089666106339077034738071112724022406047516222485079464333176376353800851e-19"),
+           e_float("-5.7142857142857142840816326530612244901068999028182701651645147855060391503590964082425973304768969089787796279139566714156019146772485432480807863236503933723061288700381694935536359002101310380810211220047199711068129502388550487915174273567648819976974190573236546355850033526820063406151000576913234155066619245532163609784684687680743552715764436677847898790701168575200064127845187225470883982901e-19"),
+           e_float("5.8571428571428571430286734693877551020441652575315840621963561321845064556434824569931229051387318831983558449757801218971330093231607936975876625868496729287306252977382430357598131757867390316321140201768248445514215175770287514500694306579946515690801969996890929601288571051309716475659914287712715048377252396435111871720051075636814175414789321318288195965699235115086080541362268180832042113410e-20"),
+           e_float("-5.9999999999999999998200000000000000000035999999999999999999460000000000000000006479999999999999999935200000000000000000555428571428571428567262857142857142857170628571428571428571261942857142857142858051740259740259740255195844155844155844176818381618381618381528492079349222206365423066076780362494646860590837733694876556778267111040220283901900049530301631142017369662623974875191000895504318768361e-20"),
+           e_float("6.1428571428571428571617244897959183673469774086491739552964043353255761488268776899243412680232442831360695487217745629419337458045942924906591649450397965216496769559395413168451484393440961897898853408451914652688155986246768829861796154037064960588263874267004527833145983974010231258372001206374140898134614153273935690659240428940977002824799300430325755365362799715758468906456946262019692799985e-21"),
+           e_float("-6.2857142857142857142659591836734693877551434324586977648202137347616270998195196446743005017750540449415061336657722925349510280093241881010097119641199486705391939588650523656083380281847165523662571280579988696905573017486986848183263384720922785039048421073529079575111190529738207253787774507538703822945981700460790030250993465887452481625353060339352646123770297033070922382504108225200990801059e-21"),
+           e_float("6.4285714285714285714306377551020408163265310550291545189504373178554183152852977925864314734002201463675849358288644877984513255532183999675899480311636154837226881330893171463173562159669186626684215559024364689464223788322475583309080136010881889014796258460841811473237950991890944372560923752065022041424689031157744182707162802169390262863592745463118415497765513381463528442627061342837041833612e-22"),
+           e_float("-6.5714285714285714285692693877551020408163270035762876579203109814577700957934194085797686461482318875071894635886907363806274974241752803053334653991814490986603303034486001605994885228833746661822104164932426596071328381958690692666691196606723203452600060862681593593667930578231746656622836837331430758369065569579096934022556275904308861320282732660709210426730120272519797831753406745261531708120e-22"),
+           e_float("6.7142857142857142857145111224489795918367346989224003887269193391643218048209079550187421918910027914956069891513583947156950382540910298422903834993610360531102297506972136361798945197847320426716130284112547515371091489357833689420608066230844816935495384134836586367015834880838203928106122215183407283759218131057328645864164510310976442926552455351479439778080518931929474773218353298852825522139e-23"),
+           e_float("-6.8571428571428571428569077551020408163265306176186588921282798833818320766347355268638067484520535491164395787469362366605751005108415712555164866228686818504217250675545311228312254806055330968838264481005275913337751483594838532868235488078393392297779918358073132425073133831442153158373701074036051595525444048111642444389250270860907128125564538834519551652747714744125765027039859008082606773110e-23"),
+           e_float("7.0000000000000000000000245000000000000000000000571666666666666666666667667083333333333333333334733916666666666666666668300680555555555555555557189569444444444444444445874206597222222222222223334259452160493827160494605586554783950617283951112645989407968574635241590869157869201271979049912422021148540245762468062487450184043065987510468260256592740678388826552858288957454448629217154275973715499375e-24"),
+           e_float("-7.1428571428571428571428316326530612244897959184280855199222546161321670441135637928640844092740685924515578826282699666944210698301255807056963220147967331781655988162043078708621456757949241850937064612965588393467613494982693059465678460135620988968676348502239323769856015806861330554688869710888374103973566757774963291525239823198751587911618412184781038679749219112482568905860065916503188297292e-24"),
+           e_float("7.2857142857142857142857169397959183673469387755108486443148688046647230321873733340274885464389837738752330874040578330457568223519632551062907462029038649762997022794021858019924308380637758106728864243371056362778000418721032967413939532735334071265375814984335943539349336422681981958332397546519874210270134023103897902153717321950846136797102373301162580665715940963428832781280733711103864972608e-25"),
+        }};
+        static const std::vector<e_float> v(a.cbegin(), a.cend());
+        return v;
+      }
+    };
+
+    bool test_case_00107_expm1(const bool b_write_output)
+    {
+      return TestCase_case_00107_expm1().execute(b_write_output);
+    }
+  }
+}
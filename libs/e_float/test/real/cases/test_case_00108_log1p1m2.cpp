@@ -0,0 +1,91 @@
+
+//          Copyright Christopher Kormanyos 1999 - 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+// This work is based on an earlier work:
+// "Algorithm 910: A Portable C++ Multiple-Precision System for Special-Function Calculations",
+// in ACM TOMS, {VOL 37, ISSUE 4, (February 2011)} (C) ACM, 2011. http://doi.acm.org/10.1145/1916461.1916469
+
+// Automatically generated file
+#include <array>
+
+#include <e_float/e_float_functions.h>
+
+#include <../test/real/test_case_real.h>
+
+namespace test
+{
+  namespace real
+  {
+    class TestCase_case_00108_log1p1m2 : public TestCaseReal
+    {
+    public:
+      TestCase_case_00108_log1p1m2() { }
+      virtual ~TestCase_case_00108_log1p1m2() { }
+    private:
+      virtual const std::string& name() const
+      {
+        static const std::string str("TestCase_case_00108_log1p1m2");
+        return str;
+      }
+      virtual void e_float_test(std::vector<e_float>& data) const
+      {
+        data.resize(31U);
+        for(std::int32_t k = static_cast<std::int32_t>(0); k < static_cast<std::int32_t>(data.size()); k++)
+        {
+          // Arguments above about 10^-3 need more terms than are summed
+          // directly and use the bit-burst algorithm, apart from |x| > 1/2.
+          const e_float x = ((ef::one() + k) / static_cast<std::int32_t>(7)) * ef::pow(ef::ten(), static_cast<std::int64_t>(-(k / 4)));
+
+          data[static_cast<std::size_t>(k)] = ef::log1p1m2(((k % 2) == 0) ? x : -x);
+        }
+      }
+      virtual const std::vector<e_float>& control_data() const
+      {
+        static const std::array<e_float, 31U> a =
+        {{
+           e_float("0.1438410362258904637196095029969137157517548554488805282533328426746464753603902321690554495895526431480164664875917528625015181227928706465062698162514372566291461862366807516006201892017111935192520649569665421946663245162973459014045950721369440284242978239795583149813133819012828050887967933570911414943173061167745757624441346977880563567234226306521725180689974240117591734549042689666560078210"),
+           e_float("-0.2938933324510595040948655703094318848846898806884905907783703879004047993647800845585488157671422833879868775551000842925060016112681817212359935620354245468270729504347897443526272707431901973751074927199954716324507290736539009906718628011646754582289096065362185308288226853629992479072415932841162421180299924424732520215543081081366469045967611255211008557404144589469627664469017223599447560058"),
+           e_float("0.4581453659370775325917636058840055357250506099541312338959839409903926828689815245121352755483804616289824110005724385830192424967832728213004729329143148828107260333344059052315929087892249257930734025391181909110753026065104295689170447878485376942113191711841754821981005148155915006518872480673121204715865982402335589608353895655471926396332140487139615547184099184153299903657463997912010543951"),
+           e_float("-0.6496414920651304263333491705213017975871081480573338617419366877465396653473138731007194765944513513133728484110900663899437824663326337871512502600169153272242395687486468647050434845467886433826560467444456877371257871214411156765530984181460515327049308887924982897402348368193477478401307689270991749435687396112205383392898364330176485279537549304019553214165317738425777008524431326564365251004"),
+           e_float("0.07155042182033666497125856429169736968391198366553002861414835722410430680092827605208748473321110540933906999745535350527992748163430450343057518562934269318582266310150128436415032693365624530913656538523464361857285448627182908064564265534472429128566252229035048570898500588116371359006239366831720487388047693606962729740950495416772330679195503462885748381227741793799781063410349062402312209999"),
+           e_float("-0.08592512846332961117004947302757363246768936192905390102762009921785910709270921314535253791503257281451735456923369670713993642382439919156697516099842629184689416523419648612641692311270028814011424508056340851392914525057959217712775690141321004194129651803591185277765319458758701004627131407049926824877299432807156121904169524868391933802849882240155541772247084172963755313540009741227409889507"),
+           e_float("0.1003353477310755806357265520600389452633628691459591358745895209277925187380093896639115991875853069193878338781111335187597803533673738766248493246332766219226581841569561811153566351246081634307847615860477319765529911625657800030256283347582614216033457623190495093951815760665263137711126102404498860523852437838244724302153264179657367128926306040278562084209830475971294718257096282334539822262"),
+           e_float("-0.1147872208222500907597841769727435495014097860511822981985108859129887719727339570296627934590674734921256421348403712795148077517821969175506028192891523535832968595148635996775398590545020380217800503370700987859895317789845992939809487952829319389033370448882340579752698578708576668364593582353612917556380371685023938374442328477529853562144216512640245465177560773252664434259072790740205092224"),
+           e_float("0.01285785138222880127871949348813396381974749727702365795831507551090317513092283443219820302415115260977348749119937203716935674631462547359994961228286614633809850536434639459601503826272399988598254171989350422148141226786717605273244092661131132762247470899886612227878674124927441721715358092989998489144172118264112551160619674010107064819845315627183989212462810278442582830118936680873502160772"),
+           e_float("-0.01428668622202801956372823189015613683485282702369045719404804545343198381041155044711323865295411519938955385421655487361541256771501221851967678190759824882336257671338575990243117453609716419397401655930118137720450794485954962083084641160335830060230071772766733263275670464475428548227314282703162265403721348463937524313150638519689743336753138629912119019939794581815702743211683514441416114045"),
+           e_float("0.01571557939479115338273971736604297815163832119834190470719240207666267314687508697946863373756653280143543152694839971350732965843249524795444395220695984637611129425669127326828126851279365251097239468100222078313765271508276285220820636970138123324007650420687637600494628867867973022052382626108147234333189342939136589278078776887644378943088147862598270071073384224074373838345786366654246826933"),
+           e_float("-0.01714453673931605271387045293291280788501203394557434739716615143585054846838754615180411343452988428889050241905723493082793986335970402448685115462219838619759189233530454176134331402460635124991365533876385715203530536428972050217960422072741690270883029942441097777751523698682392484154525300936500090655247951244219731873358795930799545225931411260001676538935062156360780287171112549693307985549"),
+           e_float("1.857144992229879937899334020236813701677379168009113708750944330801755772440524622822396332643542485744083769009350691781041876527035199141758014593061653165881674103597794364275038922886545230859220709917973282263403530304371219760873972535125719043134845427119895500197859452801560687165294715589426231641211847210347701089782465125649676527262534202484358376431336396768300033193973737745833052050e-3"),
+           e_float("-2.000002666673066684952437841456023718179118717977655508774218943249821906651620596548187113774179764929633335219382404814002728988457544747991058154338123816586027230621129324755727646849485358772986649961475520402021003664306758194447995229238576052511206243611114697085679733027663285660376571653820595188556034530455209033732188565707725018998682870161315246893564802712705243838747950992295271326e-3"),
+           e_float("2.142860422749561224378774777194585031223040029096933405093053457337083589967469281440235323980230920252166486374373833102437953876512081092913598029746255375337939816546251087041505943055961567501680325185984083617485873347890747867753932898127723749384361357040603771094539276739813302153617627639360174197472335493665748518891916158467613188327973707524444799276569274118714033527358241603413755500e-3"),
+           e_float("-2.285718266290417642407757028098805462940303913730659542409334643436029906614641040209259401527254364174140180677540573401807844007927195394494454112742854526066589165197940806593802588755458268510784387067505006962080665882784849458903249235518807187142734353721513586032698481806710855847554425093038170869663573566923302333825039070477009217217645421251596908725861749251521751213205109251809933409e-3"),
+           e_float("2.428571476316814128863441601081891662875241318413082163626316576276702764286284024134140882691409900635162827958005260331075964902389891855018160401425021098972886329009378256968516868235858732432102510612490290694241436245206043838717993134079251484917521826476708105901869515673102432802496797442680484149527769845416143517574964509540635317709804301453915723359880919510229102694594814581577557839e-4"),
+           e_float("-2.571428628104958516770499488198028969837656368630158323105265292076748297455484257080503191913313239469784342202454687475667221585063774669455595470164886778810268525840409515138266038633551202336799492110294298975191187591687961516947812525942598080620807122514424766543312745411576134359552081431505023477762469037990573226275403748476068930641665389365062814030857196240245897343534125950965512840e-4"),
+           e_float("2.714285780942665725906820930180166428279056658374036467575453378337527293880579213109447739817418055067902876078555727219046344288997656076642232910736228071076917273263164310079818410501549159039663203310742869540567611070643439222352358019333615963798322728185018527684678204410412503049261273381442562314687559686240143168813750405549203728044326625264703538498550345788341827900713922120231356920e-4"),
+           e_float("-2.857142934888244818627381355704721899917195694673937298039565083496995021275582184729912656193623795832342177267350669107582987863469096406143590939839934808880232338522978413213353229364618766252856759945137020279492878509134702379185576585151585428648920890318730179953768300005511392219179291027248526538945630725224327622576480539886302537473309624330662992711512235789809805065094242847156521840e-4"),
+           e_float("3.000000000900000000486000000312428571647271428732471298823938932163591448008032733893809606492715051150128811870704779629482199266660724042870292300342358045561085371703933642368135419449730569328424170503652758337131553431200400143977843088223159651817086467503073418466161451759690569966510566561947337693109292655900208006211753374359505200854808886670294377626132504900346491661749415522139986464e-5"),
+           e_float("-3.142857143891933917036984431522907941358189758949806624878197791900938610286821983872644133404107794383790912455744300104238171084499092710685994541433462287664980043287418012828589521679557645194229516102624353710310681643258868424216759383890748937515105045403799343027668573018178116376388841157113185018069129345116153917180504689389017487627115936461157668591906686454640908928904210054969740215e-5"),
+           e_float("3.285714286896695821951529284024113254997985038460946417304461150640009332544619060814825005523409276716325477728324430370053887869797643501661545578030844673355419886837963847963186531636127741783564357391930047469862095792680189224562072589632447791569653626150880469617083780109044988621346459400748536737318241417032858999394288706269638604878194610779914246263275594691487591514449628588794989910e-5"),
+           e_float("-3.428571429914868805612259654511312953941228033018995331094849140123778316079572468057300444067802059458677807946870495056809382627725873268526042785703411230182875428841428729528614423329242783302586706476330035425743484719791639077809450200439166818871120886491855168444349891655631859225384149539305120420180518092756911644102697738935966746744421309015818677520340656996822218998202437150282791341e-5"),
+           e_float("3.571428571443756073858230883461257281361309504679187292324767763786685062944122067473739815539931756449532202341463508498785136640557074162680145985603531615423677510095031266534050388772324233526938526511327704247010219479102100595420821435241231425499071772492638984088491258730069172807500019687287437720843212807247475989184090046889614575666274092309406351456096935212376915566358078712558985117e-6"),
+           e_float("-3.714285714302794946550189976906449103529652238273145030786593626150824606186096221753794828765758541454305447902098332321339702215461969007866622736703897759404566958534223803446159860230112890596850292870215636451408652074996184811913210466097654481186263108129509722150251309488371266151317338878007588571885134869890745340474527201684323877573632523694110391659119787287276010246266667183232896402e-6"),
+           e_float("3.857142857161985422740695530517048283254392150057084350683041938921725489231025361549184145368700937847555365406990593534293078329194865300838504964308303640411243767816627886940212113019225468521763354462501838120333718575183380441070269270365814785485383896635209615960383517070527549561777356085508590945692783098087100754621899819224923113819876828269462006835235522322488816034076005539808949415e-6"),
+           e_float("-4.000000000021333333333538133333335673904761933889015873397173379514541729687273269989954878934408603629729775832648985315699388110831868362663610268122205709340824665112809020147652586980147221634956840141829871875552934306048849316052653545680918263387194061859165691021658931863645564872068358982338899698501216149890200320066751614921972841021029813392609877257490481094143346317676027861940562763e-6"),
+           e_float("4.142857142857379873663751239179487515125659418768430856396994473575041283586694803326173817656723773199700245138045008497990440188769927567831131262478252631141000042096678465058873318942284793290468409799543652285483392347972882749022918482476643029135498803520826920995416969192838626600275033468954938268767376340646565578708999870265714196003475873527650411998367873188898541747787322067205078148e-7"),
+           e_float("-4.285714285714548104956268250490866900699932226628465253923893346220242127819515513094841636937756122310516655593003932492224040752627955099168543496418435856556869477508877530968292069632378513422844545452936557847836223003146345003357337881054930417755513136134837012462532825571586212988970086379525982667142396906243556462460192515216778206042189863467193383748978241059148234948310693435944862959e-7"),
+           e_float("4.428571428571718085519922288684259733052510563234418244463036219764901005732008345013193294657755104578954309295184143434440824470919525234289825618948451561162143639489834986026093719415241655177452144497513775985365987738922033578285080181275677676096362019426936666742307637120749777304387474509608021309632508256467317408572463296952478422312227889187741504407863597756623683899959710067848660017e-7")
+        }};
+        static const std::vector<e_float> v(a.cbegin(), a.cend());
+        return v;
+      }
+    };
+
+    bool test_case_00108_log1p1m2(const bool b_write_output)
+    {
+      return TestCase_case_00108_log1p1m2().execute(b_write_output);
+    }
+  }
+}
@@ -0,0 +1,139 @@
+
+//          Copyright Christopher Kormanyos 1999 - 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+// This work is based on an earlier work:
+// "Algorithm 910: A Portable C++ Multiple-Precision System for Special-Function Calculations",
+// in ACM TOMS, {VOL 37, ISSUE 4, (February 2011)} (C) ACM, 2011. http://doi.acm.org/10.1145/1916461.1916469
+
+// Automatically generated file
+#include <array>
+
+#include <e_float/e_float_functions.h>
+
+#include <../test/real/test_case_real.h>
+
+namespace test
+{
+  namespace real
+  {
+    class TestCase_case_00116_sin_large_x : public TestCaseReal
+    {
+    public:
+      TestCase_case_00116_sin_large_x() { }
+      virtual ~TestCase_case_00116_sin_large_x() { }
+    private:
+      virtual const std::string& name() const
+      {
+        static const std::string str("TestCase_case_00116_sin_large_x");
+        return str;
+      }
+      virtual void e_float_test(std::vector<e_float>& data) const
+      {
+        // Arguments at and beyond 10^digits10 and the numerator of a convergent
+        // of pi/2, which are reduced with the integer multiple of 2/pi.
+        static const std::array<e_float, 7U> x_large =
+        {{
+           e_float("1e78"),
+           e_float("1e100"),
+           e_float("1.2345e120"),
+           e_float("1e180"),
+           e_float("7e500"),
+           e_float("1e2000"),
+           e_float("2831832610402713719364888643361826298598072189419950658256248459843344781118618673511177480915007234"),
+        }};
+
+        data.resize(51U + (2U * x_large.size()));
+        for(std::int32_t k = static_cast<std::int32_t>(0); k < static_cast<std::int32_t>(51); k++)
+        {
+          data[static_cast<std::size_t>(k)] = ef::sin((ef::euler_gamma() + k) * ef::pow(ef::ten(), static_cast<std::int64_t>(k / 2)));
+        }
+        for(std::size_t i = 0U; i < x_large.size(); i++)
+        {
+          data[51U + (2U * i)]      = ef::sin(x_large[i]);
+          data[51U + (2U * i) + 1U] = ef::cos(x_large[i]);
+        }
+      }
+      virtual const std::vector<e_float>& control_data() const
+      {
+        static const std::array<e_float, 65U> a =
+        {{
+           e_float("0.5456928232039927881573565001614307435037881092052207111519141526897830537902831910575596154792374612106083918004437804248087674551007998810466659808600097487260580745625595832441329041313319211026304992624682919398244845234700634430104043187945943482135017848773853016147000614367823183207629236104615220495319356961680972558654117878248421613873697342886796586015066390704835246174135860844081128902"),
+           e_float("0.9999793961198900452627554170996459516849319591578882857935384055315250696726628852054045259150335243649190831044717691111186915533288951405023826165374908945084471592192882208093692361443499262688280800669621107619176855852565595467653008463774789520281983702932064040622026246243769657509872500112438827988751722902755699165341777939347298723685463905958922651486793672517982215242526767578647848427"),
+           e_float("0.5967264504483423216943179561815359835065247235868517474454544218302480549853558152231210875493221148627705146780778399587578860623828071563138899151222486787955943898472754727076597147252675410555932459830067171442133005225360394325069470055703038936405666220926823445146697044186339889870471531425378031999306830087389385641867551246099481291298478386307012449370776692463786352862165914708043445571"),
+           e_float("-0.9372430481957621849801288622273333912375328825133816542286965135773942144917171057366829653551305273767214510644779377924085099989736518431208742993425826865882648104699939994750872775297020052373695766137612903249769621587211579877416134601465193889591644859375532439465637905114427466679431888843271268215872974331952027986821972031102725331193543752168950545463033165198331419587935170124172294974"),
+           e_float("-0.8139740881844563477521706062805939953507839728984255496382077236940126829907262492774823742268038214824664558529669031185141250967859598824731542122344718177437445815394603201298487912615926469036127612878580757382154937072977481782457237741116276871843030977254773054875193614223167934703953139086934302772896957765091705624757075465072285058939710796184610973476517854428739409349408207047979352366"),
+           e_float("-0.9960536174640475404679597271501278083790560401785798410865581141026395303346230387957490807838044354206840010780917005830468221218300977136109416780974033436099798459170956288252837881774072588626470655466512951023255710631766750040555533063524996671314419159993093115913611401649224125351986646822056858468412406561414363503440385790107173473169878272000227089381154646742730232312006523754051084968"),
+           e_float("-0.9578297859602602009782176526622944304034343800419433738716700488499665025931638327404237837225530358497105178651884887284419108546488682046637346105978755757412016514636030559657519670024387991157094887028014917081382586360588351589497612301834614439920862952299182510968340745280110981388820487797143258951800868913873246569610460034407311442851419025603567960450075601610000115681945777827982438762"),
+           e_float("-0.3010709918608261322842557371034184979257963755032170330413509913370298890854052404105412730977913945573863177923012727422495608047114086205732854563988159570269124998302265674159649104921160842138543037225828871507462549918058901019806153458611048210321948097394510181874141422176491207189842298991458329844417855778215358245433175393437764456299475237369650938180587567396823968333589562371508061390"),
+           e_float("0.3839041201692823544198232289409357984897598557227176657924116573501677916409913079038909309363837533349857347758209138407363659785988632604153618966980333508943426162277595842249298158306457101909461930185186999077540624198297753225412738330198141337034933877198715110154852875927714091407521718139974198761923108593853005764694615052200069813198710872145135732133026921380450864461204114965250964122"),
+           e_float("-0.6477324323414141014366084571848387287588156737144965185825157021039103805633666388438169174619393301495437452764916084322900330373459225297107005900205790288609752978217304657272524373324859574402106637228992208324043528833539567814242916873659507453700124667558819622277917524647149507781630989839511056727176525353802162191814782710242969215589478609823597358583514550606489723997280090851858656947"),
+           e_float("-0.6647070092005996384743528620997136164427218680834630249906064019449798839850113658483690561827748169624332959010392636013375162455418107817036668171254856886887202539256017112039313959069841503870691790723053176852786036041281718322687251355674883488571184819686336790424601520384584527338525507364733913247386037645980385524818434120627924636528884046854667040930759503349693508169341224385821701316"),
+           e_float("0.6375740585573797400637592300711614838615761895321149344252991872099571844016431463497178279903945199231858579179737322483688448194515367841569286795550547798984841129986803735522093807940496682293218028354475393492531468484987119184587560487621396717655176085363016317779535199885728854021593975723205577337901950816094683535222448669297873018175692174552372292626435014007722960432090987198662953389"),
+           e_float("0.2693347305402863303297021634975488503383098127738046026332904518332172378916920058625330745540173607044598680868765268502686628083363647315965838202721462292279859510735627226044415057586954773369750676612091025296250960526004125440320904663583389099755943223414140555101254738456247478167494858856173448556791740741722659569745817526693452422433324209672494070877497484647701889762918303984212309183"),
+           e_float("-8.476017936768964390606851766269714864466058650187152291445335488419634808540939390069834499519755904944343418748020254060364949094299208541876790107918702456044731742921257298800927501622291396388447879536722670429109513399041098782375351704107364072929265180289377319160176306203911176149313303468725005114263069146850205385392425547807737631952205117495873383158642777087094564637014158093070972987e-2"),
+           e_float("0.9587776925128404155866090717855249012776723970859918978736530791874013409454493277694940304950266999510319924788457180254511272586366978058913929117440538864702960522645886768066260422160081530547997452132381622251395508521112047134959627166917102081382265484587756972912521879077761490382307541818078501523126410144310320925308469758321303346825174677706914668485725103813034939544745813239768077321"),
+           e_float("-0.9893723070282998892363208558178447382836082527506796648576148682705306614655861255525113494024034197366063064405010721461218133202137373530312151659348411929780611927629191113748342243151394471985185779746040701157384074783601623921501187789246997031258357484131949550580903549296516124564725639792396867516534266091505154067703497196534190820719450294177433295959030314605599511586950870173917178449"),
+           e_float("-0.4648614709501898874013386146765520780402431447376951837354728825351870325298645025884826741429451324541789780089379370654011709776383363802494280270559884185867857671827549283244376470975965759706104400624979130546139027618869235913528249153566630716893883858630467124572437683375295105453991930806963746118978887439606175711264284440399156456073575120989882244859788411298652147127403973299110170701"),
+           e_float("-0.6559340274004995383964549995762551432299512693198196200115355201757645791035088530232452398487445026130146880807468837734650988758322453490720888411622117538610578887625351194169824130895416321255549512496532829566199901278546404291688468836165983973360804807833747244740782921362721631011008355851356125846058261817062076915684385717634655056209778272205232503678624710931189812361760536804278820515"),
+           e_float("-0.2894125192443359650085567820842632722496671278974002322732820905115829105266749978874075629924344502123156650863172373277436661532506411804223314087857122786333124515024343143941755678911780818079421218367318222421208268671763989896631719109648123071069996815353437840842529448183870052549422692487091593715465916416134170457764477113512296224027628365303417849742931161532844786562286840971219987545"),
+           e_float("0.2799887486812454542059723794495404777198947658603483121458452944670744187027281834608284209811716071788216030699529505895434174643429096997578309035597730644836250996736329330869545699818049715040748121287647229080499884074632591458950739979214913688549803602249524294411647709489043072371917260039945208518688416215321525799576406887606031546712990015733995896111865870090353929646990786234346814127"),
+           e_float("0.7263522936681604883503051870213776583252808162274516888083790482031560378987644056343903917561356621484708868758549363166910126718428489241405280420371488776228410411053457288842544477033158293839707227462859844868049887549987629589481636580523149201866339969520460304881472270964691689844447937928373894757769716113464332445939594080117774819334981946862712511686109736925839095035384877892910327979"),
+           e_float("0.9692663453601130683312483398374024406855454941358153057742435153101868678195238841076941781896931834572447830150949543317809647769581244907977184245234289596132983909784768470919254097183928187928200872882083931491527081680026635197502769266483169123723182532143320324125331036022087338426519548079329286592339987553052249822229110752276729052723003755531224360442461916033790460743034341252187876695"),
+           e_float("0.5097860940074373738217933138468998540376479295343872786594698220476957793935986212585442858124494539558674428021567916951922380438327100137292368781141130126120556598413123025414469203719026121481499543001564323818908488342561264463892227735817717867997452124210392648914043360035973874127915802337279213513692897444907571467321457820882465186475111920390529617248203073237815510595017148853900676741"),
+           e_float("0.9880093091636540883995449079776459769690819586798541325863419886957090856493587601967778641860275048615083333203830069389409084863914099019438769264642675139250474660915335075990406172843743600905828100303389749893559318932518855209129562422291230539941412612554929814523977249293274617528792842741164492272648243300502032596091441741852976259390389798371293726568930233525647574643295512947957826624"),
+           e_float("-0.7786548568637582386300908857599906309195000208145725625021021240379714027894429227849969801047535113570784533296957739998858170424591231389994321942634530531570630144989615131299375535694072882158479725924501504517831647002584577942143941868905369140548408119800225154689715286644199283696906064896216544320867922335473388344163025157770225676717992640814345668933318918374285417322807883888900873390"),
+           e_float("-0.2327402675840650651754617547413728078388948485149366739486353692059031609701096528415164310579225765251068202035036440258144514718793501661883775737973721558594854265059206437748725468264247315208585272258284245815909538920409298115869924203405740333175806475992014533327152775882268988046734591763953647791503322013039179416493152380241429772405496750601636512414233031410998840734148464537192956014"),
+           e_float("0.8846352284608185007552929730444250056889092051345166838952464693658940231884686221215937932040707358078553144372989656218993723984458326333508192438807504670723446592302200879561751398056190473819035165107404417122121524520221466017684674874052840045940554137267045450248941710417900519354985061032604100602798299424986883948484088447652743996547909762897475629582487699800027472656163298378328565001"),
+           e_float("0.9816201818993509553435153420368678231090915539846664436983740848301866459539130777258454804537636282735741198565851643731632791294660056276349370813781363913663985885433882783896377018251411238702660951248106281352620868550900017841099757614318769955332539759193642706238012808575024351776266579027033708028834770509394976827540554542542073564772893717631755932069059515065736655513821189487478136530"),
+           e_float("0.8470412039932045567656624083341842958660965821454121832578594185518973613507561588179378751920239908682700053814541075685411340799575592773922378676974165140741251982590998699699835535900597174705718944578345672198779477443076988358026573070087431278818345414824744375499360610373405244033863469597158620587655030437346548670635511964352737679566162397130014826103060657618955975918822647263112445514"),
+           e_float("-0.7169546322231987071581217041891613865585650569273901091250565882062152397823081169851009790361629282797297283321422132452097138713594502383327856543600752395208545375954876862436405324868607435877632423591672700191928839484426402178487232989806772048720287463599095346105316076075506812541342402963677931761749946946424935941514966699352035190166277720141683123490087233772930772217003411288240043454"),
+           e_float("0.3881689796484036620245698176133265272228806538091467807799958608363060669381985474118701918758797339655726182678031436165128885957818432274705245715930615280608646001175101637437557996572318845768463721531534768163196938240213932080905974065417950665155613110533547486636401811148617207937845354595684528014704586890987693050815170705391439261354628606819867951350746156596051348279853601242281399607"),
+           e_float("0.5917682043089857197723364887752270140914587750088268995941267943011696486147143269979335549774747828535153997546029870766429059312282280434784751207789959704822104765675414142746137999642258341348882446583201456215708143633852751147081679317121077036473481549819412277453663208234434464775331084738843307280623511272020138479629534168113563390875815169175741499752462239023932830168697480038595269249"),
+           e_float("0.8096103439017801217460926418817488139833166387635897114734111028663924800823387434575988367482890482340589708523743859232028185778718692725186072107865821389297574429426799949483337443304899342201041088920377220298090874517737406638343048246586273681421902942812580503384210823404339217047707364532378606875324690586794754003823815289970031056301222790021750911496182104386368653784828982256916612152"),
+           e_float("-0.9646039329636867352273386852384530346049318092682559348781570682963728063656008457938442930727368112047240394059872042940651298978099087551997978708602933727060136838588134971340900335238306753657331523221637192706878086783519823432207650007800279617400820224677717684088292535945043767695157884648807268971813057261481555388049632973063031839051969216426985021428950280006180692324651771894786981223"),
+           e_float("-0.8169521591417666706267411793294747439522220569356056569361899620494676711423833299902050576689400020787849499839506924050563092498616687580947014863934693739603838775532336659257498504565449539194773243838125444640277178862004507978395912477449940685870255802433596834395972514523950948037182408562254735669511637438820691756407535523459718000794304669893869943689301602518292957466207533689746689115"),
+           e_float("0.9913550119722278904369367928513279894860876634386280876630745994080875721893337084629241955259596934459262394833925553079885232067486013081720636339431439113643616381374346086322157418885816567950311326333402735450516015725311064025937128673077469547923321549713531892749247724433957544621696990201613390544085943356351335275817358843955197697961183478862472746369826503881871121063084240078024446108"),
+           e_float("0.3649544185909221726682917876784842899229969646811600713790523909810385182942884852215099820005067124330993282838625605729578480785389305148204270336236760285616735956804921141925666880565288937178819452405698215534514085529009834599674642068581783568759711452121081250015206853178754518745884624789739592618970256496361446287966056492297729379394562597033578425304775866821738579489913942215071250329"),
+           e_float("-0.8812792658469816928025822089589635998578375860070560153949543453170506663603239494749847767940994450934102826480863613885340367044808822080459692809216904619838996699822470531869644400382127840556445285587682553748417930495735305714889529646428280696587908855149719310556830072165985711666353389387569722709866725940719736596685890360387270162138026344164746400415630257939355101693692053928261285557"),
+           e_float("-0.1734613047859547901798211806322943068801299036803594098990672333488579268863342132461475582767492200780469417530767474499864551419795610889587243689592554370835971342993416557618846430417271951343688658048858147028962289229152617690051394043226824295432147756320106625567450014870678220633464809919172792005326890753907313557151010341892775585331311915905272631373154477007112429035746343641103479688"),
+           e_float("-0.8479779840369833873597021625580081173495072788121335260850772097750207148708804374553729222405085154826122661285033165491721344948526143411047618286071200018040761058658739729671821481104493054849690018662797966969019172991820407105373866883559080097913901938531046521002146924789726738540712536052248927776930413292324449920568101721835914892666655493251754609537347075752351491768305954414026383087"),
+           e_float("4.543372973137664763031431430434811598334498769928782155376173478717347583115533404828850497124493079125927703042359676122907772959625850451761859604390758337498883973014161993630665184254920992145929892204343123378561969305983082851236883361545480427824746848465330895847364258339294427574803713734777751000363861189171198246004264558117282273911675661904220198921934193167158279936986051486140389617e-3"),
+           e_float("0.6487156280039387994667437948925193917734961673026883220285729213459084003955685308607474987817133930787872367556685820819832755445281032461793087247783560640987603232140017733915684368509943629414380462372078053712912166170022900960630752318238442403798964623034059903349152497601161497133429319715780038334798616837716108008465019195591534739467407935588762962369999886680794301500235434956117014180"),
+           e_float("-0.9979083379489096066035087637290376099519632166680448107312651509747845718174292321314276455439507075539736739177724580280915957716446888624445910547344179630945292372520755910003833128593449100760252421300965441158712133729983850429782320859885307208217825068397612959658911553594941712755300132653296547994241443385384331604238240447549023398195995604173840219625779838652048448232171024488102166562"),
+           e_float("-0.7865177727734612247634043322429366523886467656317247906692984521133925601894249694239225925842043371785239281835631218331017754833646005961856010666308483747574643152342056776569106083727604731354477437470541830848051011175626985243371895076400664879753578534190371312938742877352600616554542700624979694740591794798644920355224976160568348508610289757329346802982437215789370293533395237699533748272"),
+           e_float("0.9843163332725578743706073057947558133588474000289602404659443359726765026165609823035500108745977251026604203360482108998183672431974994696620962882578154230307652743075727263127771216168858780336807427360825775354077096087481718624199635365403203909700713489668646784434757023822645951835095224475108396265530492097258412216001361320892941059492438283954744313595144572869785026541151272904938974811"),
+           e_float("0.6653477074188757930589867747995240924911507005858062109127099191720271825500960854352111362873736181506926175861755395140844683513214313962740718250185285951642196535789939725792068055749393529835365736384440679335984491687120240424614505939349194738971631010758585872191127016409711920755791529526107365459838734984420283990135157666277642132503523024634999704886997535137105347568060200135131781310"),
+           e_float("-0.2176572877638577603300331452308066765095396203885158699725387855454746338511737053319702642773939076502082209203174352626904777760287723302087069419470996411618010790394084075116012266733176363046672760581369797374615615383711762094156932338364688681099813420862309792259528634595401467102348796602106027365074064250904969409379341784676785514597067324158713663225990288957232731342862211264338219594"),
+           e_float("-0.5291363212162760625390220655504432387282957804574919827132461241055718488983305017054439122807572223294866894817462040715051779803971600174672507555132234821494611416457514523917646859645605461204865161019853428630407260526084369677746121923972155071250085692092776088865875933247127826289951714973369283899858150438768795884172247095008082097900410225497359732557174662836783061006538172567811387347"),
+           e_float("-0.7028619957055897856527487615891977070996193645564714043637964535589867901621833082565671351607999972544853619625225326001627621624786464445680684606164072506950173273214149761154287777956078387144503301525570896659114516399706812927389553667924076006077715383178331909033275833440187146190780360213714860316410013294365333151128440404452938750712811463336680337609522535295042002363339517375432909160"),
+           e_float("-0.7678032397519087708526288279263563336864790520179137470406128544950200194343395573741649612212326291610080566951752945753025616588354025254453123377514329300462536149321514943250124325117142295872604879140644919444666774358348833025438832201182085389106828549035215253512948679008580972009090357615657211607692377054288499193536116338512292908153014896935389499008978288583798114842438898717658299436"),
+           e_float("0.1686845753257062379750541675173771041091572804100580318327353006726074736177220680413515663082704728504791545513341128660934636341696094164136314386734679028300705571388946266904985668774094454056119119242678848980473594821801989663443922976912229672429693575157563766044199891367424528108187712172441311828414400072545279970922577318129824207893794547912847807229434905083703835022099740425628287950"),
+           e_float("-0.2186957721510256306005946487556097002890430847528664550470760109030410661423311227694762594277734616389297098509250314043781491281650738748213827058669400047672716372109650362673852906329508629823443405147533534662664044172021610443042891062477375482667102912225083794229371465391338130085428992954057324715781681934580017487940426196540008848731552971082731560722110282993036534189687704803374481188"),
+           e_float("-0.9757930924346957490227155266364189617729860640585616673074528827709022280512296104483517213652612628566840087070232863314015894255244752499978641132197169354947470955670957850272303198266247368758759778054787433678876025074589657456902261566225692665270518698549574434078511121480486845791248820104182106207580414167045031340009365988257736249879963100842774536416088104014338508190174482932847298909"),
+           e_float("-0.3723761236612766882620866955531642957196678835674347023644153882967192240437564411887366004162030232186755854849979665802386125281373057985216256608861726865204885174435867245498079937810055460542410914466956946812206642493256309581177337472890310698971922651911127850629424713961117480578822993195912716909856255185831916278349158308318035156666572577006417125791093559517254014983400379897861507771"),
+           e_float("-0.9280819050746553434561946437769559281831820764390503933251142095425212220307967012613811770051118718369188719485302472861560569590742551367517358507185832149357144883209562092610835604493498717298427338287088534239119923027528706770455405405306741779655792398653068910543450419827119480989002402637621652860317570378087549451116652764703814287274049248627078413703989943437490955329158988784761372772"),
+           e_float("-0.2747628596656773884203608867809131968602619787969826113458574692361604313857820905501798162070321990429476183017830283608186300258194217859532344191449672578807558535192421816474986617752432661218539008548151434459815934730925289806687833862320414402449343825665593235946683374340480459300347107673624008210622461996257127855893776889679075211088747832209059978808264145825012026573241374712050978486"),
+           e_float("-0.9615120232988973257173042656261687070113703104899197846340017400998738238159059486330821476102950884623230099744099747514092170949236275196042904706441455370727568743052486500306462245482094795644055111992973797634532519630631447573321626044958641967249992919637320962252018080305578751386365821135563036579144723780346197300885495745131262238904549477152607913164690217363112432590437580888744547162"),
+           e_float("-0.9997437536294093842937103826087928789525738013495297320763568839633311623197125225002651150330441152144126711901957814501317827193809276723418912206779781544317480847837179188854984146860419482530779867817873769902109345922963901144848943908033366259938141567200631514398734707291583560362863111864098972497822915456053420412234415476471739728890716722696740325042530569972056104360714528787559105036"),
+           e_float("-2.263685223211899109332994994325991289232210682817065432924746243995916149039140215148678688000391661471870494457053505532445712252588372698951315042314023880690968722359747191030011107183092914014239393775571880751685167770268224203305119480887671188148732413881269304129911464333000518665838613633177833052792568313295978943137422591501672762208301999814933246199057004049592058055910768467087557786e-2"),
+           e_float("0.8002302678393641779737070053765850873582194385310979934653222424130282826773967192068290748541260852326038447109910162589595431136724725857322120659962104415372163090999442662659115971546806685000691402727783120127778135464880543223930975369090225699345254403217153747963342336880372777922496465845319674271283817430818972358363896428481685656995961134663745037907134029256913770697016359545144146749"),
+           e_float("0.5996928534122609250315999302413417403896905438845597437039380390839697556787696621225613560033695634558493545009584644730772786366732109178399987579880866441001943074641669418788241245161394661199405097987286394706694958157951871870463834053900919210824078109539100397056697467669330323708504671826629355107361112244030310493964307783695224181003450300701497055912783603150457820508504289345526779636"),
+           e_float("0.2678367442140108651893147708823844705032091286296278441582331582761178807376387489600401366439559783451426338954850465262293642580174552652894414178034951605025896815882741717207796261472858653416526188640421620219381165820692551901216387052241970558966257819310403411559045696033241332299288324140007957208713713030937853248837281313491183474240424305709177620119687262024366243290209410713756569705"),
+           e_float("-0.9634643109367562439603128969737342731853333030345547578988542841402372688204229321288137664638464687087223022467796462487333454978519017453536793683334146602743027335842494147686922671209455853144043082399835303341599258318097228250871901404522599715517361765712410717205489030403099875994170254703579804950937466771785462857535057427038646465874056503367109424631449917096123406790566629897659286089"),
+           e_float("0.9999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999260176215394937548914279333268297123303856527973872212081081066770672974068568181879233422355067889962668086906440583410865503085538138588166421542439047554470875549393158511633079948221973145010804304"),
+           e_float("3.846618734954277870056742551256189081932730721285912995976397447430253877068983911151911228621224848814867458742208285061267880302259100201667966252943310505679472640927930905119109966790689376348851783509652025749909166881932986129736462411632212319144219307002390819979221226202691455781205245873673614699494085549602280732302569721875958279404581349538117481361928905532097419518664418640833129947e-100"),
+        }};
+        static const std::vector<e_float> v(a.cbegin(), a.cend());
+        return v;
+      }
+    };
+
+    bool test_case_00116_sin_large_x(const bool b_write_output)
+    {
+      return TestCase_case_00116_sin_large_x().execute(b_write_output);
+    }
+  }
+}
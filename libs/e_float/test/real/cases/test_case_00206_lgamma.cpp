@@ -0,0 +1,110 @@
+
+//          Copyright Christopher Kormanyos 1999 - 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+// This work is based on an earlier work:
+// "Algorithm 910: A Portable C++ Multiple-Precision System for Special-Function Calculations",
+// in ACM TOMS, {VOL 37, ISSUE 4, (February 2011)} (C) ACM, 2011. http://doi.acm.org/10.1145/1916461.1916469
+
+// Automatically generated file
+#include <array>
+
+#include <e_float/e_float_complex.h>
+#include <e_float/e_float_functions.h>
+#include <e_float/e_float_functions_complex.h>
+
+#include <../test/real/test_case_real.h>
+
+namespace test
+{
+  namespace real
+  {
+    class TestCase_case_00206_lgamma : public TestCaseReal
+    {
+    public:
+      TestCase_case_00206_lgamma() { }
+      virtual ~TestCase_case_00206_lgamma() { }
+    private:
+      virtual const std::string& name() const
+      {
+        static const std::string str("TestCase_case_00206_lgamma");
+        return str;
+      }
+      virtual void e_float_test(std::vector<e_float>& data) const
+      {
+        data.clear();
+
+        // Lines from the negative axis to beyond the zeros at x = 1 and x = 2.
+        for(std::int32_t k = static_cast<std::int32_t>(0); k < static_cast<std::int32_t>(41); k++)
+        {
+          data.push_back(ef::lgamma(((static_cast<std::int32_t>(k - 20) * ef::pi()) / 7) + (ef::catalan() / 10)));
+        }
+
+        data.push_back(ef::lgamma(ef::one() + ef::pow(ef::tenth(), static_cast<std::int64_t>(30))));
+        data.push_back(ef::lgamma(ef::two() - ef::pow(ef::tenth(), static_cast<std::int64_t>(25))));
+        data.push_back(ef::lgamma(ef::pi() * ef::pow(e_float(10), static_cast<std::int64_t>(40))));
+        data.push_back(ef::lgamma(-1000 * ef::pi()));
+      }
+      virtual const std::vector<e_float>& control_data() const
+      {
+        static const std::array<e_float, 45U> a =
+        {{
+           e_float("-10.36263756650296495188693424205005912581932012975062223020546856802894490208667806964652438980780273130193664863571189821574729475729341780958501745272088323947599381124505200269684828737558497211463087836140490706804604106416717324198444498001639301446823140376665914196710204072766491845799976087374611681765152129877901407756790444071490186897300341964490440778184601259155924634366081851944257270"),
+           e_float("-10.38264559169332904574141614102188133922394721984916516957302264976035043931431529450967134820650130448085205525989086277041854770976711961977209436891344137972157828639975503234920331031058129064857624357184755366789645936860142066608155616121386758478374819910016632312121975330314764624667529370149064344449662400546249254144783040947406897573533108889434169180480679993237784225162746013057702861"),
+           e_float("-6.249667662550000578235122189229932078773292353243123442239145970454878681460539718725607049473054916346255995006886188671787114733554993429699086801251522815901908262490346392679991315756047036414669275355832487226300399934473085059660528966014744180790709547114004403890893424019216992594322022079924279873153987307640716611214183161121470792502643542902336865506838359408460992310014472874000832568"),
+           e_float("-8.476503371490351174408160959400193935912661536250896404362864452202663173723065575133459759584700787505418126200530140501894940650230796170124109578639486677983107780656863902861448796280544637819694623188056814612681973255948288029755649089140508871980428996164890026892797449233720259771426934946226528196546035596547309489307422008335932804729291849996855459865962915487906798589406589927843860683"),
+           e_float("-6.275314522873590061335272288766585722708503388099226942017490979003785445561100256460867230661693205881372263226804464037710492424946700311798648394037495869823009592768592629251562472101138523674776230076267687325021439548670080978261438189347136945102009895982042159231893568323460338101876246250418247091587737410762949135908434103783584978929995461076923981749494076058039215355737031667527838813"),
+           e_float("-6.563745764542673127596346616166086681766623123283078538845382501056573953974715650624404195048554576930737115284280806101784715843618739549797924845489712197818724324901565454245532225754816443156966238470509263209100601356582693549052438599846171349387814423496399124151410277513090208499715915655912937021732505386026549638208946733608811377793051520859980454555224729648574740955008688492519103432"),
+           e_float("-5.227316593488791185217513335268484915881655310882139465283358198963597197683003467219534566036480468193053329931660020951297760460135193677980323660666014888920810765796445737418124562190028867700109185943553634061079642710329225980813413768695466466213523455597678327121718560396907600704321499087182614157432176327380466625549772127445656428386872339604489671215516882718082803675815562757909073409"),
+           e_float("-4.633541631475886911728910147407363358194331579176690821569031095099244447646095558049250753035962254545469478528772643096510018507019975777374173946477804862265877929659301824236332204853159390267244851992109579793624652981018968516373894681450130264494604340761213525345230065930134486931975456067360202264931806369367981505422710053013776237283401524236671972822253546321436469345638232396434299246"),
+           e_float("-3.926119425642656432968618355585231680084026091757122585168601796370842544312948824871380113335260343236124673886398846954116930383996126750637846317084112822103913287054733784165170659640092694957226107503949968113234596274937345635442686168325170161126274739608838714423078742446837585814444342289860768256794313515437561628187436614421646924518817937513964472132967478559400693046098601398704171408"),
+           e_float("-2.620257932781978984697408717218066562797442399778223582414681937617546391139431698977679829336178912416257713306571508453218613890973774515599432650822091386564193603170450276449473804090752615576067865979744664242357241204728583692082343362844270439268724035965141533585185832890763546385870974936681396544825535232091462439118928437928431205451465810125189430481770504044704501968570855892347953181"),
+           e_float("-2.593305890815240263813487289609430538612912847510680106352464585255064133703455635972743901016422338186398318001318508487027941870434586022603393066310467124287339399650630771569601164878456511073430819271205809784269880827631367487990993112039523718259330355337485510966768420998081418507294518733298783690766039156060678564721315951275525489114773453345532386273649040491081679059556331441264231950"),
+           e_float("-0.1461735002530112895056436622450088318359858861518077630239718281025377616190592824870882319886604060023314752260274394356703017706465488781566117566807993012622553996619408225673002277987083226173157175186380634108202327669618291384456708785327786035352704811031488759330515173440439034901529246946250994053224277957029988354430597694997690954547066717156894815265369591160404798975758932192173544388"),
+           e_float("-1.307326173228573431066511807363573562601650893422023908572661479796098645048866502633351738106718113274254370665950049941767615652533023143357753663817421733339325067296194238269850418281937942749555350088140984394967407975216678513096194980799160912289273558495889506166641223325475356921415394206980278352800675169025415110031937289121159460742463558632472231723957498150642208836253400119054340971"),
+           e_float("1.145011958164024170335552264921574589505406912042447391568478171364265943169204958546551865037982534146953096032359387676640911635077718304779660278635748811645619770653726171618499363788362807928289551808686904669923947483850610184738801117184409319840109788969604990889792415215884954054970112641319816530749983008320934999851362828702035313796193107549757469776262884955322743523931925280962489179"),
+           e_float("-0.1181415854491393080033129286097085986981497076867043047672476763019387282499082917101427692470654342053768877113561120906102566630739043744084616247081847072370488743136953281979851606146501462024319928951824470508559721160180193963514230057947836704605512412294512812359374327885945237148411453627345040838265881597064653835287896860918945088281300021592148728234536499915916980469658950273150195281"),
+           e_float("1.081482932133831143967841357710903583544562410281049212914611877427012465988706962890152008117204217124899845987144881081301132876361113059381601027852278932977724358175626469211059394732971835501381663586382430884556690995041031757522222659649262222409170476343233143680400182868683499067414725574583807248354261519533594723249779925332917175826169305097644222511200089853481751112710462036843796630"),
+           e_float("0.9272874641357971776984312201680634246408260475836364575915056532748117570495959405559971079329867286858871676742274304533347875881349663567012411573652675792375340357466482241976438277335261123890295144070732466707659709035555198555467509921773325088520030759948053923639860697621839200846727494087837441173606811921241033758498273388415918302044906324853747021860241509847814120081783183909223589160"),
+           e_float("1.348821563746990174773090638270788692175372526065511389443318334873700832812835221536085482962902391772649120779430012882387036277162027564046179283000434055123190479019931760990711003294099812920122459354230721366241576185102795352225277731357086891531153740957164290240174476826337005026113445957819895625169916820430234821901751522502564823583540193215171821253424059979534495606421638841006283093"),
+           e_float("1.771957320966740744402427782817747257083146252596498316073008291110929576836409549089626298957364821081230633287538870213674357912716689981222777809512611495773846352858521813007062028208673572504788465127869022925853704794752659376764491772087390223812779612968994069365436271408000717007336584522184478646386181434612029774466009668587747452157275457236828150368143240589745384223942370259697491946"),
+           e_float("1.364957992079002903017562582791515024609004335809177170920456598823290319846719416768194207509405471102133368123680305288653178120542233927393805377937613211367263219260822114325421927805366384327226434205065008276410969758460655290322477039569881579646675532979102152340671871820862832603274562169512375926134740695011740206541508404812712024152196869744484961075886942152196802284966354620229558182"),
+           e_float("2.344100920430328831486924952035713630350829504131427831994412529845683987255886201664138677642587600834734637386648076367078976656577715150502002179355136096517982950285205005181853170473501577782140977581870967223158022612982402567644289695530770900813060108440921191590210561057246233951036016204171760391099722976310134375599012040850554808141258990414107669875097225893576110973709518828214252826"),
+           e_float("0.4968995269585513870140925655538886203504306061763705472882179376302005786389961529238645589730143929237105439225755118085177786232019913115252422482223328613736005701384289982663769527156373591132908370819664623376014938547244284514784172169637873061354157577872167684716513638985469322240508964909503063955125922611868774209608686065872489161482933618711709834504038280296366299760961546409752242759"),
+           e_float("6.333666936824570522128078756346085876220104934267697039921686305389429725325395127313592121104053396830924929367024920606827397530330795725780893662425994271199963589717225809011474654563390998255492561902358567067298506833261092060698156185714307521223871637554299377430894438331688615282047641804597172325193779574794162503401914196055547586896105980891424849231354754006750713259719961326941305986e-3"),
+           e_float("-0.1212139579494416277344159011788639948348497173527192032590359093086003208974178553470003000994950693365637273821948726254316824401089613372015184653008346823087772797239420475328021693489254610525234537791908917329434104031525662783490452134192346860689379300969684448121044856935330538644521185353739156488150891740315595587929617085963496689612252789679880445513684887138178884161901409221034956473"),
+           e_float("-0.04362844531481397407004228000216512255056016209134761077366112619669906210600235036102061910380853261280810677312168306265127742505237651752550576877963784579116329710037675308049771936455273918281072432278037019557749822415280053354590598521867913912484765453347697093080798775503742556538187257010025018862656300263272953529737887977451241885465481040168509169202290628249989325137900781330300850447"),
+           e_float("0.1758871436970610837047733287688634551124338147144308316939265332150117799931751293933306912233544490886786328236419958997605531617368241161624706152631280561545347891426856775266386720663665396472577994873054931188262855569340615157904355021419562552249761869360359150060812128090397031727956872204878990415818193058671212578023341985292438018900965833802954325605270319576259468992600405197415006782"),
+           e_float("0.5036343737448486357132418470812715372582047845782150826453596753596696061187308078114045698927306404004394053925873285888473878103260978501887039524645449044089058258707249134317862512860563712938167898281798522637449070853948410614888298970747864900458117891229850255622530329510121800494842633874897028294736245362699885194793563830612220605541037354060066230721665748904450038051440598697661021492"),
+           e_float("0.9187564552643618058363651503139646064768872762349066611095548173248520792378190873324033207288348477440912566081603506141455772138998612738496459486220154937789997560082912843112424876197014125397988371952786070460559440601269054978174367303608027105116804138041569943201744821017978125556944072069876717045354076456884241965276553806827076745849298144887318656901372994249089377859371065200662442174"),
+           e_float("1.407100133341745788353452463144270974597298311966628425061766319728579167396574395035737556364934666733123867131801860934951626179154369969681653668364687579635183475388175350100139730769477316641706545240815882035960728345766795461428398707636700005985001745958923891129489442799096163492137933722462750581301044780193848447133221248238473548404448131614021381663534048797530695436637237663508010874"),
+           e_float("1.958441599822202823193531322629096951454815306581686402118100156590242015862840270688426486147712977020082460900361692423433650949564478463244007560544730204178224144150736515009277364429180401460416678938699624686297414504724922796690061169433768979213302855692290034382765218451743229641342598601698324668437043768957340312120898264706015947872659629811890324117933014761075403496776283911883861186"),
+           e_float("2.565053925550687814013154328239156530640041743281594532654829429871795633978060740011310932562987041412019560211972584663750143959014699968856256682128799850335653080084852227741067852062769793038273741621057998135138527534229221130004184412942495562383026835325756798736891354892967272076915102779029111072263425444892702711998195051535951171559846275513673132156074549464910183922153725548556462181"),
+           e_float("3.220893978610981555336023045334769528896410128206263701922151184335267562264331469138993270926594802376138126170341348471257856789105320306450478936177936125811657452668035415523890832279564860289181643687041946835962884849395865663280763044618147175313880470450272586579614154449217999066257995874512341760452892399224129557252222868396905072590440622650879223580866250127289297851575489747559500019"),
+           e_float("3.921107175434874202063702978984022719717693763530431983300013262220412250972362971274629225480456316114953910090395325904201577117043249769784767230792854099289702199342510732922993055032052474825223706416723334606072266476562577725423559779076280830903907269544645533408777181507014290029731653573887950182278499705258860075021311857675324264253560998937524109151281793460753174018104685249792412308"),
+           e_float("4.661708810633741781280622905959977300584814636995919207242266579702837418606626859285426535318456121272975110595863163640684632241570752085041751300673995693285873004482394072035688856667089965576403423677204329261940193852016899905410478443664650196193595039570512047911806193834399327444616454722613345594743989121692420056237906188821410988503675146174727312953064737266889612925784458895446109437"),
+           e_float("5.439369807902177845509713281660131044209371567836138708741850811889479833236411518043230642250105823586875454843745241066468996458233432700015548359762582708128098381096121145834379545342304940637075807229414855582722331155749858772217737099681786571314321812176116401602251402030806469571013049514577884640776201508664381159268409315123056995773370484610535074487873390429949840203388903576755303649"),
+           e_float("6.251267407990523266366372177296977931365397967749780641843211278386874634662438880749006005156901757730626720159750668939771102323061827259729143251051952687909377756536760318391290644106284754349658167878920618906066565362950205954551153944448084406494050987486365964349351657013109426658411111056660397433332472124246271375857120183594669644698566198151060029497390302893703035933308622457133240321"),
+           e_float("7.094977948964307031541154502848049558025429628808465835332819763325135268241696128946538628164885126116214329130862257169443221178837189598733914438908706947502087259523144864374501770659194704905086288355497920724375757545150387667750527079570809098315278129389968959758611681151651019541106876520499215424731222509635689566599876969741988668682799896488699623747856565289861706742930069465905240519"),
+           e_float("7.968397895898535026751784929151398864917331829401010893291267108085620644534760092542033232054946917233433211294860010026529777035501969213385649091793547503418709609998617077091755484020738478664504891100148430026918730827152982540811526986354374809487428774426381251144630480458903757981672277446574406640968449816482187236716484294012953204174444865196167167196121200413410206990116302536954854632"),
+           e_float("8.869684398769210647784415950505579526053517557138990130782056848880090346494256232540589818882105750426607689872364860792936485697417487152885377220694804350570825772348390376741062125757403964752065554153076799027884331911393713725032403753660526693857064901788783542547485893052034810548500009693936803766295430259980733362256336420385811567501401664529196041365621974973113862129368969874591283639"),
+           e_float("9.797209698078696156271677539109092208525797549143346058605829212828642148739826239115725433012442694299088317523351781612063982731993321185201719748584894247110197333663249117199175872639608255581525344006575624780698610843213882002894782123583279096937483062867872188173534875722356833184428204695760081380693020259487180868385022413806163465056123032274151254069811745770957807295102330102432991716"),
+           e_float("10.74952557030806491490408504865582616396162578967334598586276419110404827746532325369632796407181427860001897727751967034431588721328284790361291497539082802771721908697190554269301829474052716358501323103979775206831283263773811420444052793521794470698090982732483658298598873692746712377826269321382912934882274155988496788986049558548829450224936946363749433251072691656211362632980730204045524269"),
+           e_float("-5.772156649015328606065120900815799640087352227216873912224446229758926383584897382974664543898111923470760791001832746527511484652440721200242803974768290344003112918697867100167792144372068249941477577838944804783141246746475530521648992457589101482210290062554146782673071286151668982630173757436136618265554657044066814049534116253446755415156477982882808759684895179696740994868753326923903210098e-31"),
+           e_float("-4.227843350984671393934878776708942265465188404393173953699627721866858804218544899767444670390262610708450397516689941391446182566970234715863795017768054875589202270855630953401257109233919576101950974182668596892609082540584965906792515681736967833336602834134385711968889802556112749937655825987957226428768942921941391514112436535747943922988983616474657775129560091653223555245562854432320513155e-26"),
+           e_float("2.898060588427579574592252203788385026012588197024569724636248203971731077328060698997197154629941769983089239956412658903014878103937999525644867916872260720251008883741709221878754798449150987506840864819402181951119793443939871348833591912532120462829541846183430150710370946406445822116611601477621329027691151481913072877593788137981463484155246781257498697879531894017489842819376543076594554344e42"),
+           e_float("-22159.79308530303309658784712253421180564082397474381671370192740687295868173236902382607299061667455233305111332791458364258727424992764741212971573337771100487945307294365349125072771193331095407213389373415120309917152278799157839328086666596898504404082151640715124504484558100468905761510617471840937511982513267298302549836427928334137544202742209967091508687928637470045164956226130016697916166")
+        }};
+        static const std::vector<e_float> v(a.cbegin(), a.cend());
+        return v;
+      }
+    };
+
+    bool test_case_00206_lgamma(const bool b_write_output)
+    {
+      return TestCase_case_00206_lgamma().execute(b_write_output);
+    }
+  }
+}
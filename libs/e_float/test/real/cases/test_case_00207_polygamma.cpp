@@ -0,0 +1,101 @@
+
+//          Copyright Christopher Kormanyos 1999 - 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+// This work is based on an earlier work:
+// "Algorithm 910: A Portable C++ Multiple-Precision System for Special-Function Calculations",
+// in ACM TOMS, {VOL 37, ISSUE 4, (February 2011)} (C) ACM, 2011. http://doi.acm.org/10.1145/1916461.1916469
+
+// Automatically generated file
+#include <array>
+
+#include <e_float/e_float_complex.h>
+#include <e_float/e_float_functions.h>
+#include <e_float/e_float_functions_complex.h>
+
+#include <../test/real/test_case_real.h>
+
+namespace test
+{
+  namespace real
+  {
+    class TestCase_case_00207_polygamma : public TestCaseReal
+    {
+    public:
+      TestCase_case_00207_polygamma() { }
+      virtual ~TestCase_case_00207_polygamma() { }
+    private:
+      virtual const std::string& name() const
+      {
+        static const std::string str("TestCase_case_00207_polygamma");
+        return str;
+      }
+      virtual void e_float_test(std::vector<e_float>& data) const
+      {
+        data.clear();
+
+        for(std::int32_t k = static_cast<std::int32_t>(0); k < static_cast<std::int32_t>(21); k++)
+        {
+          data.push_back(ef::digamma(((static_cast<std::int32_t>(k - 10) * ef::pi()) / 3) + ef::third()));
+        }
+
+        data.push_back(ef::polygamma( 1U, ef::euler_gamma()));
+        data.push_back(ef::polygamma( 2U, ef::catalan() * 10));
+        data.push_back(ef::polygamma( 3U, -ef::pi()));
+        data.push_back(ef::polygamma( 5U, ef::third()));
+        data.push_back(ef::polygamma(10U, -ef::pi() / 7));
+        data.push_back(ef::polygamma(25U, ef::euler_gamma() * 100));
+        data.push_back(ef::polygamma(60U, ef::half()));
+        data.push_back(ef::polygamma( 1U, -100000 - ef::half()));
+        data.push_back(ef::polygamma( 4U, -1234 - ef::eighth()));
+        data.push_back(ef::polygamma(12U, -100000 - ef::half()));
+      }
+      virtual const std::vector<e_float>& control_data() const
+      {
+        static const std::array<e_float, 31U> a =
+        {{
+           e_float("9.115683292963828044073403613554579897127281735952695622553446348668252239146714129146864784643488464311430118134906991210140218423375556362371305469295862651217122424307582628789022815733920697542190351861051998148969400208902497341333215445147530119809522057113031113259148833788493751075057482572361316401211088836081148313989021245110553236644716313085874980560950950506614547081561884531639640524"),
+           e_float("12.89439402696308133529674784881526774071994476848888553912722503051562095576599597674749152357767677932480111489682006026182848054690042304136838574366853081230525673728961434061484080919673823260890363311658913669387688324293950925290346925386435246953354605065811291160653325235259610661141660278079029623677105407988363121434200981593133349171092074945606379913504668391315950527420171502637460938"),
+           e_float("24.60043602211378214447678885855231356383204622318952006092168690216525942079194563686565575043099368177159261857630252001002633875816176349468086947317385074318868380928772521518125748082370684569309346516742063574974846241358532320033386790080932080286288299921073827572411530262776419499619013911054747458513959405170546065182836407741511473354050787697468807396038882476317397853618746218081133858"),
+           e_float("-336.9035272277926952549943043965115525202783052141511421146004339688665754026765277301181522056569118052756441029328593880447428789811990706863781496153381310211911216728689706064926877898266608797656420072440962430433342130887690216596101934327177304503289693711992952397297737945427078522139511069684804395988649203977988472847756791126876485562038337281391441949644554492794673923834579396498827652"),
+           e_float("-17.91065567595185956812048051592665468305798705801099624722639649089349691318182597872852095674366092412376415314760794873701029566755502738836415309860339467987950491774151499097053201366707590450728639812850355852928724686909368894385548051266099787936315359366999562728816967398346757232815672499479516823866192475244638553740364542085450659481832851990436135491129386267080257326202413926232916828"),
+           e_float("-8.262102004689001374995464240667176500989319074339540183500242450174460109693203296822488732401551025149758637511204644152776366606543316534729336560847430781463101466128105161438295456962342498094214591714722274188994910901011183562746819054914903355069097119572951026235781023647898302239375520728351537123171949536491100957819508105808586958149459478900752808386904579556868405494339191736667758759"),
+           e_float("-4.962548163946652683596672036033947535192792366776664032282925055967234825021864445748923282884361272053812294991130744321469111227002298530614345548226030551951065863656771492275779751775262909646836189538536267308324659625093339119612446700889252454162756859793594485829039331979747500305511853135151817166427438675300507620054637530378865028146051278483628101310089099041286247692429186959492276981"),
+           e_float("-3.368598467366693243736745367524969725518538859047971898849741804318423198076390602828960661602297506387672217138748036836686665840809813479183102671686552367249466849616407663812238733454514601569527034112550626348960931017256517386647726841189994359611712482711108453132991163239088217776644336057123585739653169689822766514748955348695719234865423151401757101803108109852218968566421999983074725068"),
+           e_float("-2.544168999211308296228519243496011345582591778811384722173750431085000704603239080691007341396370488806597075262789414869719544813677872093128343534293016042655722727594075067059282806020200343860936990280126147418609410132955744296336739622921167927769678886253617438020581273062029715968389293232675965915397453337954560960303561976471784775249543820790090317203899396765975748148499223880163185284"),
+           e_float("-2.279050338930367324700022680452494164519036483562976433614858109476192105604470364179811815703620078080821491591002162570503422428709932510534211774712883526307783976430005785025206249808940503592903010629139373193214029931372601815602922949708237658964657128894022648630119819779104976836842702826141167817132547065354543807449468933909715755019794965229905105675822387668202281263771207621277367894"),
+           e_float("-3.132033780020806322996419074287268854155428296720418064192751203035170757168755063089433189618374967124697698089277143879910536600399526642702502819527370587967316191020396257504281401746843866444715419366942795850283877833346977600436480585542891585882595286755945172349464595574900606041971899175378592334200224992124676832520702030981145686453689171276980255469585866818429007860248070606507544002"),
+           e_float("-0.08153706149796169198318138168289555339315273178267802498218176495116932355308220063697893716369734782912551752603309879727222115230330800934677871494496964032935464510511385331945831177798144343144061796111544354198641845375231536546702510695499738772854031827098076858661717169292836103370003255930088406390312167571041048160514888966351768423553017341732278207487937512449872502630913969659254196380"),
+           e_float("0.6670863971689402409560992452150086314185956598531190328085406679032932381921911590539232662826574806774182146139447135862776157034353150598473932358008620618018414810589595222243957442943728516081385204080017844780794337062690922975923240166202780952258570579158076883403758329647812548796817762458791336149835035537870428135816161881820374602688808138238661996463893199964262157425733671344262074534"),
+           e_float("1.094839045827179777877359211110274387849899029979676470835315812639085458545392594934472723799353432478388501992779602894642433017740441703106820690296200687094181656024687337030726910319181316080848335968905477943173359810201987327245830961118075275707018259650955025714170115030944874490622592924626796363715695592972474841768803404345963515183005515908523293143833325571140401621554701248077264221"),
+           e_float("1.394358595638278284816697409603736475474115797575376898556234158560621352362782640342816195441583413090383728323336254081461659815480807090618746721088190728354103230389912483040312351049097879568076660399458674154111674152066654507419475312687820913821083640573769506340157840031127772509000507000895776219181036241592934425927828374761003196768714480531188419777778416814132840097453398974861978227"),
+           e_float("1.624817473596837055972161492614090308699274552806626898824137696015123998594181555250980828898290122407414305027567917039459735402695342561066715917659947234995061485186586593997798061847597134727858058924036959061153831316856741997742326070208416256669284521972535048198709892522484380539041024605113652908158138768321906291363390074163627941532752959904275119038095188730880189112573701110054464352"),
+           e_float("1.812101677414121897495991584633451604560878502008198050279691726229966627334520570091205073988611004191368359601304034673501735604037413184915424660746132151218374812875392847903148469974339462692117458456841223879135508721896338901406536364970562785091934634816792003053362990965889576833343598024911677905918331515326727866346339132407986016492490290651264525319647201052722491341886213021510069502"),
+           e_float("1.969838044410008245660546647686817299834839147001904237776678301647151453835156246758679200121750778176522476586338212776873119335581962008422935597570099192065987985326193582630285426789762702594694231062361630379078273483618019007358513163834313861630315565737780816828597760404568716962914543114181063070943968877560045029155609423072593364581391455331291587976081349979275473824741055106446300345"),
+           e_float("2.106080646370518439750527086708366662231274056963513551725954706230849629006087264196750869142320736701190527715455714246012099162743733911191635463559864804564735344052578292148277651086494452100399513598751049652741281690573860332211005411310583524348373608304877258906457481962164323294432121641356874469670109645942823113059579274547459307984329400056225058610971988745539723079534865428939070859"),
+           e_float("2.225985197980576156828754573190893673266996681532879356726295278329094947198844588647810067612631872262521285163239866105351231941052119074729765979198465288305500224269470873325095391276660557880816235540285213997518206557770528694753089962428506521595894553025075842432884810199937883176147036108269833856884045016591561958836506511317644893106702494044966468177525731042013314103413354990539998548"),
+           e_float("2.333050884727643383479021824481885028097142826772457504630354805036826716950681327810851039214115854441971015863991442608890753553022932880560276163195219060242469607775036533094557501661321347808151514326912029004785636043643685976121858143835969268350200373286961375035786074957775210970246070976998064205174421794605814483434214659210540016118224770228914533865715435838392621811579068818948690281"),
+           e_float("3.876155081335994522283107648233329876446097232585954841564855496822696482090952942025386971181403603801163605298764208666855180694583155556015607714565187511921918465396313649253187879722410664967285880687401753158658136725296773258955504909013199751234958519026015118205283573280384341667117373529842999241808828377459714044757584780695419030070673345064009328034423083579775614513288068659243421519"),
+           e_float("-0.01329105929579064348750783599844295330073782503738931707198719269547595978515724748019515531297914101414674392979991870746744013068880324589007601084509550981600768889185494559018718441087960950953543264360980122063911761710612159598856745079130991003757624919062323635935533887927736149693149553115796198624375800986861103879737792072495887504704754650657579522019622689062267985131012517197728232789"),
+           e_float("14943.11766731338601634408179185795912768111515860539958829829342619023904742745944489416885747445023450884802031013938954533453655160113344441871320059253855867870284924730394829790011802516111596889763882327796163172995586194827148853595971057874549281697286567026205616405298086625397259055049594496263779675793127650337818745492122937078695817937416098071212726490536097363135991955815975189433680"),
+           e_float("87502.21523619660237952856384716927388504174570513330414876393798036400391886253484078678275398567867257508374804443921845466900651169244226024604624301313842123944312603232303300325895529406525299191268146875767210724217496800131662305168951138296112786599667551326688941168488273537388776369553292356749171508516821495505028997245172760692053269450769628409577402722284858915391951477798888194776271"),
+           e_float("2.184587119395851750662891362270814500967278136905740646010333087381415383434907430088438560612255998332744950343536230738348769801209922238521188881936095376122874549651340336145156379900933762623004766086408088047461299193566981341438882967030541124999241457656506627444137419647574959151943143553228985403222883146113261640229137008086900831190219665542673251469293629366397189933336702642293887962e10"),
+           e_float("7.081563113026853500331824676484787003883225410108197371707017011159266845838145311552081471669475290324367591930101177932868824013826263492432362464991933732882404287780209219558003617014546347574237733627429438648853455881082408897791160940420365436317294461103106163455981791567058806030222455200134428929995906146340543266837226199683177178209631994614011459679455556286312273768308637111778287729e-21"),
+           e_float("-1.918688996367197390978387989548951616175054391897516240039858232319625001355013858219579927245775444996117625321375854558968201589363826066459374206412418817769779348343930714843749935256293641578504447427928011881907802431850779271927522191392108150608321053067950166159657234066881555231581324689821808840517934347919642043365782245404455681609273653040460995685123341549007040955587045781941935585e100"),
+           e_float("9.8695944011893577021753242802931303003360317732166466327433619850386481583669674062416819821548048098015464669642145665769543053158545514690405738102044535825101487236496570816569112916532891032040101138391501304911895454848108508285783434367469703784963357523795322237536304849642662964667384236729048701984334908484962401118800372498495309884509105210298178759420235802198239642426053610080543528153"),
+           e_float("786397.99250691413839346245542482115773856141345259888906692179775578239876131732894367095182195024823794094199889083171443717830122497162275415132521342725269735114584533426736366930456304706688521472824233241236268422457004580719514179066708692458371301982043760991651449359962917576214342294325589946671166291014124007296340470826767032143142774962081435296552188324453329389224449416198824099284714"),
+           e_float("-3.9912010269394223001918587438030961824818032752637532329236992889537950057145224803349274404619133417816812307909521956703854212136755403079530459856340597633500913803478988501392053619689352664664740779143715339644961661059126529877538987367079418905999331950359747246065677240964728395691554466528237627379689761528420713253104979547359080983799946020026583366300565813488443758717188574321044890493e-53")
+        }};
+        static const std::vector<e_float> v(a.cbegin(), a.cend());
+        return v;
+      }
+    };
+
+    bool test_case_00207_polygamma(const bool b_write_output)
+    {
+      return TestCase_case_00207_polygamma().execute(b_write_output);
+    }
+  }
+}
@@ -19,6 +19,7 @@ namespace test
     bool test_case_00002_underflow_mul_x               (const bool b_write_output);
     bool test_case_00003_overflow_x_mul_by_n           (const bool b_write_output);
     bool test_case_00004_underflow_x_div_by_n          (const bool b_write_output);
+    bool test_case_00005_binary_serialize              (const bool b_write_output);
     bool test_case_00006_write_os_floatfield_fixed     (const bool b_write_output);
     bool test_case_00007_write_os_floatfield_scientific(const bool b_write_output);
     bool test_case_00008_write_os_floatfield_not_set   (const bool b_write_output);
@@ -28,6 +29,7 @@ namespace test
     bool test_case_00010_global_ops_pod_operations     (const bool b_write_output);
     bool test_case_00011_various_elem_math             (const bool b_write_output);
     bool test_case_00021_bernoulli                     (const bool b_write_output);
+    bool test_case_00031_glaisher_large_m              (const bool b_write_output);
     bool test_case_00051_factorial                     (const bool b_write_output);
     bool test_case_00052_factorial2                    (const bool b_write_output);
     bool test_case_00071_various_int_func              (const bool b_write_output);
@@ -37,11 +39,14 @@ namespace test
     bool test_case_00104_log                           (const bool b_write_output);
     bool test_case_00105_sqrt                          (const bool b_write_output);
     bool test_case_00106_rootn                         (const bool b_write_output);
+    bool test_case_00107_expm1                         (const bool b_write_output);
+    bool test_case_00108_log1p1m2                      (const bool b_write_output);
     bool test_case_00111_sin_small_x                   (const bool b_write_output);
     bool test_case_00112_cos_x_near_pi_half            (const bool b_write_output);
     bool test_case_00113_atan_x_small_to_large         (const bool b_write_output);
     bool test_case_00114_various_trig                  (const bool b_write_output);
     bool test_case_00115_various_elem_trans            (const bool b_write_output);
+    bool test_case_00116_sin_large_x                   (const bool b_write_output);
     bool test_case_00121_sinh                          (const bool b_write_output);
     bool test_case_00122_cosh                          (const bool b_write_output);
     bool test_case_00123_tanh                          (const bool b_write_output);
@@ -54,6 +59,8 @@ namespace test
     bool test_case_00203_gamma_small_x                 (const bool b_write_output);
     bool test_case_00204_gamma_tiny_x                  (const bool b_write_output);
     bool test_case_00205_gamma_near_neg_n              (const bool b_write_output);
+    bool test_case_00206_lgamma                        (const bool b_write_output);
+    bool test_case_00207_polygamma                     (const bool b_write_output);
     bool test_case_00221_various_gamma_func            (const bool b_write_output);
     bool test_case_00901_zeta_small_x                  (const bool b_write_output);
     bool test_case_00902_zeta_all_x                    (const bool b_write_output);
@@ -69,6 +76,7 @@ bool test::real::test_real(const bool b_write_output)
   test_ok &= test::real::test_case_00002_underflow_mul_x               (b_write_output);
   test_ok &= test::real::test_case_00003_overflow_x_mul_by_n           (b_write_output);
   test_ok &= test::real::test_case_00004_underflow_x_div_by_n          (b_write_output);
+  test_ok &= test::real::test_case_00005_binary_serialize              (b_write_output);
   test_ok &= test::real::test_case_00006_write_os_floatfield_fixed     (b_write_output);
   test_ok &= test::real::test_case_00007_write_os_floatfield_scientific(b_write_output);
   test_ok &= test::real::test_case_00008_write_os_floatfield_not_set   (b_write_output);
@@ -78,6 +86,7 @@ bool test::real::test_real(const bool b_write_output)
   test_ok &= test::real::test_case_00010_global_ops_pod_operations     (b_write_output);
   test_ok &= test::real::test_case_00011_various_elem_math             (b_write_output);
   test_ok &= test::real::test_case_00021_bernoulli                     (b_write_output);
+  test_ok &= test::real::test_case_00031_glaisher_large_m              (b_write_output);
   test_ok &= test::real::test_case_00051_factorial                     (b_write_output);
   test_ok &= test::real::test_case_00052_factorial2                    (b_write_output);
   test_ok &= test::real::test_case_00071_various_int_func              (b_write_output);
@@ -87,11 +96,14 @@ bool test::real::test_real(const bool b_write_output)
   test_ok &= test::real::test_case_00104_log                           (b_write_output);
   test_ok &= test::real::test_case_00105_sqrt                          (b_write_output);
   test_ok &= test::real::test_case_00106_rootn                         (b_write_output);
+  test_ok &= test::real::test_case_00107_expm1                         (b_write_output);
+  test_ok &= test::real::test_case_00108_log1p1m2                      (b_write_output);
   test_ok &= test::real::test_case_00111_sin_small_x                   (b_write_output);
   test_ok &= test::real::test_case_00112_cos_x_near_pi_half            (b_write_output);
   test_ok &= test::real::test_case_00113_atan_x_small_to_large         (b_write_output);
   test_ok &= test::real::test_case_00114_various_trig                  (b_write_output);
   test_ok &= test::real::test_case_00115_various_elem_trans            (b_write_output);
+  test_ok &= test::real::test_case_00116_sin_large_x                   (b_write_output);
   test_ok &= test::real::test_case_00121_sinh                          (b_write_output);
   test_ok &= test::real::test_case_00122_cosh                          (b_write_output);
   test_ok &= test::real::test_case_00123_tanh                          (b_write_output);
@@ -104,6 +116,8 @@ bool test::real::test_real(const bool b_write_output)
   test_ok &= test::real::test_case_00203_gamma_small_x                 (b_write_output);
   test_ok &= test::real::test_case_00204_gamma_tiny_x                  (b_write_output);
   test_ok &= test::real::test_case_00205_gamma_near_neg_n              (b_write_output);
+  test_ok &= test::real::test_case_00206_lgamma                        (b_write_output);
+  test_ok &= test::real::test_case_00207_polygamma                     (b_write_output);
   test_ok &= test::real::test_case_00221_various_gamma_func            (b_write_output);
   test_ok &= test::real::test_case_00901_zeta_small_x                  (b_write_output);
   test_ok &= test::real::test_case_00902_zeta_all_x                    (b_write_output);